@@ -183,6 +183,53 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
         dnnl_primitive_t *primitive, const_dnnl_primitive_desc_t primitive_desc,
         size_t size, const uint8_t *cache_blob);
 
+/// Submits creation of a primitive to a background thread and returns
+/// immediately. The primitive is created as by #dnnl_primitive_create(), so
+/// it is added to the primitive cache and a later creation of a primitive
+/// with the same primitive descriptor results in a cache hit.
+///
+/// @note
+///     The primitive descriptor and its engine must not be destroyed until
+///     the future is destroyed.
+///
+/// @param future Output primitive future.
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        dnnl_primitive_future_t *future,
+        const_dnnl_primitive_desc_t primitive_desc);
+
+/// Checks whether the background creation of a primitive has completed.
+///
+/// @param future Primitive future.
+/// @param is_ready Output value: 1 if the primitive has been created or the
+///     creation has failed, and 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_is_ready(
+        const_dnnl_primitive_future_t future, int *is_ready);
+
+/// Waits for the background creation of a primitive to complete and returns
+/// the primitive. The function can be called multiple times, every returned
+/// primitive must be destroyed with #dnnl_primitive_destroy().
+///
+/// @param future Primitive future.
+/// @param primitive Output primitive.
+/// @returns #dnnl_success on success and the status of the primitive
+///     creation otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_get(
+        const_dnnl_primitive_future_t future, dnnl_primitive_t *primitive);
+
+/// Destroys a primitive future. Waits for the background creation to
+/// complete if it's still in progress.
+///
+/// @param future Primitive future to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_destroy(
+        dnnl_primitive_future_t future);
+
 /// Executes a primitive.
 ///
 /// @param primitive Primitive to execute.
@@ -234,6 +281,21 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
 dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
         const_dnnl_primitive_t primitive, size_t *size, uint8_t *cache_blob);
 
+/// Returns the amount of memory of the given kind the primitive holds in
+/// addition to its inputs and outputs.
+///
+/// @param primitive Primitive to query.
+/// @param kind Kind of the memory.
+/// @param size Output size of the memory in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+///
+/// @note The code of kernels shared between primitives, for example through
+///     the kernel cache, is reported by every primitive that uses it.
+dnnl_status_t DNNL_API dnnl_primitive_get_memory_consumption(
+        const_dnnl_primitive_t primitive, dnnl_memory_consumption_kind_t kind,
+        size_t *size);
+
 /// Destroys a primitive.
 ///
 /// @param primitive The primitive to destroy.
@@ -339,6 +401,73 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
         dnnl_primitive_attr_t attr, int value);
 
+/// Returns the maximum number of threads primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param max_threads Output maximum number of threads. 0 means that the
+///     number of threads is not limited by the attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_max_threads(
+        const_dnnl_primitive_attr_t attr, int *max_threads);
+
+/// Sets the maximum number of threads primitive attribute value. A primitive
+/// created with this attribute uses at most @p max_threads threads of the
+/// threading runtime for its creation and execution.
+///
+/// @param attr Primitive attributes.
+/// @param max_threads Maximum number of threads. 0 (default) means that the
+///     number of threads is not limited by the attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_max_threads(
+        dnnl_primitive_attr_t attr, int max_threads);
+
+/// Returns the CPU ISA hints primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param isa_hints Output CPU ISA hints. #dnnl_cpu_isa_no_hints means that
+///     the hints set with dnnl_set_cpu_isa_hints() are used.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_cpu_isa_hints(
+        const_dnnl_primitive_attr_t attr, dnnl_cpu_isa_hints_t *isa_hints);
+
+/// Sets the CPU ISA hints primitive attribute value. The hints apply to the
+/// primitive created with this attribute only and take precedence over the
+/// hints set with dnnl_set_cpu_isa_hints().
+///
+/// @param attr Primitive attributes.
+/// @param isa_hints CPU ISA hints. #dnnl_cpu_isa_no_hints (default) means
+///     that the hints set with dnnl_set_cpu_isa_hints() are used.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_cpu_isa_hints(
+        dnnl_primitive_attr_t attr, dnnl_cpu_isa_hints_t isa_hints);
+
+/// Returns the scratchpad size limit primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param limit Output scratchpad size limit in bytes. 0 means that the
+///     scratchpad size is not limited by the attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_limit(
+        const_dnnl_primitive_attr_t attr, size_t *limit);
+
+/// Sets the scratchpad size limit primitive attribute value. Implementations
+/// that support the limit trade parallelism for memory to keep their
+/// scratchpad within @p limit bytes, and are skipped if they cannot.
+/// Implementations that do not support the limit ignore it.
+///
+/// @param attr Primitive attributes.
+/// @param limit Scratchpad size limit in bytes. 0 (default) means that the
+///     scratchpad size is not limited by the attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_limit(
+        dnnl_primitive_attr_t attr, size_t limit);
+
 /// Returns the accumulation mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -789,6 +918,31 @@ dnnl_status_t DNNL_API dnnl_post_ops_append_quantization(
 dnnl_status_t DNNL_API dnnl_post_ops_append_binarization(
         dnnl_post_ops_t post_ops, dnnl_alg_kind_t alg, const float* weights_data, const float* output_mask);
 
+/// Appends a pooling post-op.
+///
+/// The kind of this post-op is #dnnl_pooling.
+///
+/// The post-op pools non-overlapping @p kernel_h x @p kernel_w windows of the
+/// primitive output: the stride equals the kernel and there is no padding.
+/// The destination of the primitive has the pooled spatial dimensions
+/// `in_h / kernel_h` and `in_w / kernel_w`, so the pre-pooling output of
+/// @p in_h x @p in_w is never written to memory.
+///
+/// The pooling post-op must be the last one in the chain.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind Pooling algorithm kind: #dnnl_pooling_max,
+///     #dnnl_pooling_avg_include_padding or #dnnl_pooling_avg_exclude_padding.
+/// @param in_h Height of the output before pooling.
+/// @param in_w Width of the output before pooling.
+/// @param kernel_h Height of the pooling window.
+/// @param kernel_w Width of the pooling window.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_pooling(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg_kind, dnnl_dim_t in_h, dnnl_dim_t in_w,
+        dnnl_dim_t kernel_h, dnnl_dim_t kernel_w);
+
 /// @} dnnl_api_attributes
 
 /// @} dnnl_api_primitives
@@ -1425,6 +1579,31 @@ dnnl_status_t DNNL_API dnnl_reorder_primitive_desc_create(
         const_dnnl_memory_desc_t dst_desc, dnnl_engine_t dst_engine,
         const_dnnl_primitive_attr_t attr);
 
+/// Reorders a batch of memory objects in a single call.
+///
+/// For each index @p i, data of @p src[i] is copied into @p dst[i] as if by a
+/// reorder primitive created for their memory descriptors. Reorders of small
+/// tensors are distributed over the threads so that each thread processes
+/// about the same amount of data, while tensors that can occupy all threads
+/// on their own are processed one by one by all threads. The call returns
+/// after all reorders are complete.
+///
+/// @note
+///     Only CPU engines are supported. All memory objects must be located on
+///     the engine of the stream.
+///
+/// @param stream Stream to execute the reorders in.
+/// @param n Number of source and destination memory objects.
+/// @param src Array of @p n source memory objects.
+/// @param dst Array of @p n destination memory objects.
+/// @param attr Primitive attributes shared by all reorders (can be NULL).
+///     Scales and zero points are not supported.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_reorder_batch_execute(dnnl_stream_t stream,
+        dnnl_dim_t n, const const_dnnl_memory_t *src,
+        const dnnl_memory_t *dst, const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_reorder
 
 /// @addtogroup dnnl_api_concat
@@ -2642,6 +2821,32 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_rnn_weights_projection_qparams(
         const_dnnl_primitive_attr_t attr, dnnl_dim_t *count, int *mask,
         const float **scales);
 
+/// Sets softmax parameters primitive attribute. The softmax source is
+/// multiplied by @p scale and the @p mask is applied before the softmax is
+/// computed, i.e. `dst = softmax(scale * src + mask)`.
+///
+/// @note
+///     The attribute is supported by the forward softmax primitive only.
+///
+/// @param attr Primitive attributes.
+/// @param scale Scaling factor applied to the source. 1.f by default.
+/// @param mask Mask kind. #dnnl_softmax_mask_none by default.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_softmax_params(
+        dnnl_primitive_attr_t attr, float scale, dnnl_softmax_mask_t mask);
+
+/// Returns softmax parameters primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param scale Output scaling factor applied to the source.
+/// @param mask Output mask kind.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_softmax_params(
+        const_dnnl_primitive_attr_t attr, float *scale,
+        dnnl_softmax_mask_t *mask);
+
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dyn_quant_params(
         dnnl_primitive_attr_t attr, uint64_t group_size);
 dnnl_status_t DNNL_API  dnnl_primitive_attr_get_src_dyn_quant_params(
@@ -3561,6 +3766,38 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns statistics of the primitive cache and of the kernel cache that
+/// shares its capacity.
+///
+/// @param primitive_stats Primitive cache statistics. Can be NULL.
+/// @param kernel_stats Kernel cache statistics. Can be NULL.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_cache_stats_t *primitive_stats, dnnl_cache_stats_t *kernel_stats);
+
+/// Sets a store of cache blobs that primitive creation consults when a
+/// primitive is not found in the primitive cache. Primitives whose cache blob
+/// ID matches an entry of the store are created from the corresponding cache
+/// blob as by #dnnl_primitive_create_from_cache_blob(). The store is copied
+/// and replaces the previously set one.
+///
+/// The store is a sequence of records, each record is a 64-bit cache blob ID
+/// size, the cache blob ID, a 64-bit cache blob size, and the cache blob. Such
+/// a store can be produced ahead of time with benchdnn from a verbose log, see
+/// the `--cache-blob-store` option.
+///
+/// @note
+///     The store is only used for engines that support cache blobs.
+///
+/// @param size Size of the store in bytes. Setting the @p size to 0 clears
+///     the store.
+/// @param store Store of cache blobs of size @p size.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p store is malformed, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_blob_store(
+        size_t size, const uint8_t *store);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -3628,6 +3865,25 @@ dnnl_status_t DNNL_API dnnl_set_jit_profiling_flags(unsigned flags);
 /// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on Windows.
 dnnl_status_t DNNL_API dnnl_set_jit_profiling_jitdumpdir(const char *dir);
 
+/// Sets the size threshold starting from which the library requests
+/// transparent huge pages for the memory it allocates on the CPU, such as the
+/// memory of memory objects, scratchpads and prepacked weights. Such
+/// allocations are aligned to a 2MB boundary and are advised with
+/// `MADV_HUGEPAGE`, which lowers the number of TLB misses when the buffers
+/// are large. Only applicable to Linux.
+///
+/// @note
+///     This setting overrides the ONEDNN_HUGE_PAGE_THRESHOLD environment
+///     variable. The huge pages are used only if transparent huge pages are
+///     enabled in the `madvise` or `always` mode in the system.
+///
+/// @param threshold Allocation size in bytes. Passing 0 disables huge pages
+///     (default).
+/// @returns #dnnl_success/#dnnl::status::success on success.
+/// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on systems other
+///     than Linux.
+dnnl_status_t DNNL_API dnnl_set_huge_page_threshold(size_t threshold);
+
 /// Sets the maximal ISA the library can dispatch to on the CPU. See
 /// #dnnl_cpu_isa_t and #dnnl::cpu_isa for the list of the values accepted by
 /// the C and C++ API functions respectively.
@@ -3795,6 +4051,82 @@ dnnl_status_t DNNL_API dnnl_sgemm(char transa, char transb, dnnl_dim_t M,
         dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A, dnnl_dim_t lda,
         const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc);
 
+/// Returns the size of the buffer required to pack one of the matrices of a
+/// single-precision matrix-matrix multiply with dnnl_sgemm_pack().
+///
+/// The parameters have the same meaning as for dnnl_sgemm(). The packed
+/// layout depends on all of them, as well as on the maximum number of
+/// threads at the time of the call.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for A, 'B' or 'b' for B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success,
+///     #dnnl_unimplemented/#dnnl::status::unimplemented if packing is not
+///     supported on the current platform, and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs one of the matrices of a single-precision matrix-matrix multiply
+/// into an internal layout, so that it can be reused by any number of
+/// dnnl_sgemm_compute() calls without being repacked.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for A, 'B' or 'b' for B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to pack.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_sgemm_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst);
+
+/// Performs single-precision matrix-matrix multiply with one or both of the
+/// matrices packed by dnnl_sgemm_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// The parameters have the same meaning as for dnnl_sgemm(), except that
+/// the transposition flag of a packed matrix must be 'P' or 'p'. The
+/// dimensions, the leading dimension and the original transposition flags
+/// must be the same as the ones used to pack the matrix.
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T' or 'P'.
+/// @param transb Transposition flag for matrix B: 'N', 'T' or 'P'.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data, packed or not.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data, packed or not.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const float *A,
+        dnnl_dim_t lda, const float *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
 /// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
 /// signed matrix B, and 32-bit signed resulting matrix C.
 ///
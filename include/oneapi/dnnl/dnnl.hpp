@@ -86,6 +86,13 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_primitive_future_t> {
+    static dnnl_status_t destructor(dnnl_primitive_future_t p) {
+        return dnnl_primitive_future_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -155,6 +162,18 @@ struct primitive : public handle<dnnl_primitive_t> {
         binarization = dnnl_binarization,
     };
 
+    /// Kinds of memory a primitive holds in addition to its inputs and
+    /// outputs.
+    enum class memory_consumption_kind {
+        /// Scratchpad memory the primitive requires for execution.
+        scratchpad = dnnl_memory_consumption_scratchpad,
+        /// Memory occupied by the code generated for the primitive and its
+        /// nested primitives.
+        code = dnnl_memory_consumption_code,
+        /// Memory held by the resources of the primitive.
+        resources = dnnl_memory_consumption_resources,
+    };
+
     using handle::handle;
 
     /// Default constructor. Constructs an empty object.
@@ -203,6 +222,13 @@ struct primitive : public handle<dnnl_primitive_t> {
     ///     constructor.
     inline std::vector<uint8_t> get_cache_blob() const;
 
+    /// Returns the amount of memory of the given kind the primitive holds in
+    /// addition to its inputs and outputs.
+    ///
+    /// @param kind Kind of the memory.
+    /// @returns Size of the memory in bytes.
+    inline size_t get_memory_consumption(memory_consumption_kind kind) const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -257,6 +283,15 @@ std::vector<uint8_t> primitive::get_cache_blob() const {
     return cache_blob;
 }
 
+size_t primitive::get_memory_consumption(memory_consumption_kind kind) const {
+    size_t size;
+    error::wrap_c_api(dnnl_primitive_get_memory_consumption(get(),
+                              static_cast<dnnl_memory_consumption_kind_t>(kind),
+                              &size),
+            "could not get memory consumption of a primitive");
+    return size;
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -295,6 +330,15 @@ enum class scratchpad_mode {
     /// as the scratchpad buffers are not used concurrently by two primitive
     /// executions.
     user = dnnl_scratchpad_mode_user,
+    /// The library provides the scratchpad from an arena which is shared by all
+    /// primitives created with this mode in the same thread. The arena grows
+    /// to the largest scratchpad of these primitives at their creation and is
+    /// freed when all of them are destroyed, so that a model with many
+    /// primitives holds a single scratchpad regardless of the
+    /// `DNNL_ENABLE_CONCURRENT_EXEC` build option. The primitives must be
+    /// executed sequentially in the thread they were created in. Applies to
+    /// CPU engines only, other engines behave as with the library mode.
+    shared = dnnl_scratchpad_mode_shared,
 };
 
 /// Converts a scratchpad mode enum value from C++ API to C API type.
@@ -550,6 +594,13 @@ enum class normalization_flags : unsigned {
     /// On training, normalization will require the workspace to implement
     /// backward propagation. On inference, the workspace is not required.
     fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Use Root Mean Square (RMS) Normalization. If specified, the mean is
+    /// considered zero on forward and backward propagation, and the variance
+    /// holds the mean of squares of the input. The mean is neither computed
+    /// nor used, so the user does not need to pass it. Supported by layer
+    /// normalization only.
+    rms_norm = dnnl_rms_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -559,6 +610,23 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags flags) {
     return static_cast<dnnl_normalization_flags_t>(flags);
 }
 
+/// Kinds of masks applied to the softmax source.
+enum class softmax_mask {
+    /// No mask is applied.
+    none = dnnl_softmax_mask_none,
+    /// Causal (upper-triangular) mask over the last two dimensions of the
+    /// source. For a source of shape `[..., M, N]` an element with query
+    /// index `m` and key index `n` is masked when `n > m + N - M`.
+    causal = dnnl_softmax_mask_causal,
+};
+
+/// Converts softmax mask enum value from C++ API to C API type.
+/// @param mask C++ API softmax mask enum value.
+/// @returns Corresponding C API softmax mask enum value.
+inline dnnl_softmax_mask_t convert_to_c(softmax_mask mask) {
+    return static_cast<dnnl_softmax_mask_t>(mask);
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_rnn
@@ -697,6 +765,12 @@ enum class query {
     kernel = dnnl_query_kernel,
     /// Shuffle parameter group size
     group_size_s64 = dnnl_query_group_size_s64,
+    /// theoretical number of floating-point operations
+    flops_f64 = dnnl_query_flops_f64,
+    /// size of all inputs of the problem (bytes)
+    bytes_read_s64 = dnnl_query_bytes_read_s64,
+    /// size of all outputs of the problem (bytes)
+    bytes_written_s64 = dnnl_query_bytes_written_s64,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -4011,6 +4085,23 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         error::wrap_c_api(dnnl_post_ops_append_binarization(get(), convert_to_c(alg), weights_data, output_mask),
                           "could not append binarization");
     }
+
+    /// Appends a pooling post-op over non-overlapping windows.
+    ///
+    /// @sa dnnl_post_ops_append_pooling
+    ///
+    /// @param aalgorithm Pooling algorithm.
+    /// @param in_h Height of the output before pooling.
+    /// @param in_w Width of the output before pooling.
+    /// @param kernel_h Height of the pooling window.
+    /// @param kernel_w Width of the pooling window.
+    void append_pooling(algorithm aalgorithm, memory::dim in_h,
+            memory::dim in_w, memory::dim kernel_h, memory::dim kernel_w) {
+        error::wrap_c_api(dnnl_post_ops_append_pooling(get(),
+                                  convert_to_c(aalgorithm), in_h, in_w,
+                                  kernel_h, kernel_w),
+                "could not append a pooling post-op");
+    }
 };
 
 /// @cond DO_NOT_DOCUMENT_THIS
@@ -4020,6 +4111,9 @@ struct handle_traits<dnnl_primitive_attr_t> {
         return dnnl_primitive_attr_destroy(p);
     }
 };
+
+// Defined in the service API section.
+enum class cpu_isa_hints;
 /// @endcond
 
 /// Primitive attributes.
@@ -4111,6 +4205,62 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the maximum number of threads attribute value
+    int get_max_threads() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_max_threads(get(), &result),
+                "could not get max threads primitive attribute");
+        return result;
+    }
+
+    /// Sets the maximum number of threads attribute value
+    ///
+    /// @param value Maximum number of threads the primitive uses. 0 means
+    ///     that the number of threads is not limited by the attribute.
+    void set_max_threads(int value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_max_threads(get(), value),
+                "could not set max threads primitive attribute");
+    }
+
+    /// Returns the CPU ISA hints attribute value
+    cpu_isa_hints get_cpu_isa_hints() const {
+        dnnl_cpu_isa_hints_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_cpu_isa_hints(get(), &result),
+                "could not get CPU ISA hints primitive attribute");
+        return static_cast<cpu_isa_hints>(result);
+    }
+
+    /// Sets the CPU ISA hints attribute value
+    ///
+    /// @param isa_hints CPU ISA hints for the primitive.
+    ///     #dnnl::cpu_isa_hints::no_hints means that the hints set with
+    ///     #dnnl::set_cpu_isa_hints() are used.
+    void set_cpu_isa_hints(cpu_isa_hints isa_hints) {
+        error::wrap_c_api(dnnl_primitive_attr_set_cpu_isa_hints(get(),
+                                  static_cast<dnnl_cpu_isa_hints_t>(isa_hints)),
+                "could not set CPU ISA hints primitive attribute");
+    }
+
+    /// Returns the scratchpad size limit attribute value
+    size_t get_scratchpad_limit() const {
+        size_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_scratchpad_limit(get(), &result),
+                "could not get scratchpad limit primitive attribute");
+        return result;
+    }
+
+    /// Sets the scratchpad size limit attribute value
+    ///
+    /// @param limit Scratchpad size limit in bytes. 0 means that the
+    ///     scratchpad size is not limited by the attribute.
+    void set_scratchpad_limit(size_t limit) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_scratchpad_limit(get(), limit),
+                "could not set scratchpad limit primitive attribute");
+    }
+
     /// Returns the scratchpad mode.
     scratchpad_mode get_scratchpad_mode() const {
         dnnl_scratchpad_mode_t result;
@@ -4469,6 +4619,32 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
             scales[c] = c_scales[c];
     }
 
+    /// Sets softmax parameters. The softmax source is multiplied by @p scale
+    /// and the @p mask is applied before the softmax is computed.
+    ///
+    /// @note
+    ///     The attribute is supported by the forward softmax primitive only.
+    ///
+    /// @param scale Scaling factor applied to the source.
+    /// @param mask Mask kind.
+    void set_softmax_params(float scale, softmax_mask mask) {
+        error::wrap_c_api(dnnl_primitive_attr_set_softmax_params(
+                                  get(), scale, convert_to_c(mask)),
+                "could not set softmax parameters primitive attribute");
+    }
+
+    /// Returns softmax parameters.
+    ///
+    /// @param scale Output scaling factor applied to the source.
+    /// @param mask Output mask kind.
+    void get_softmax_params(float &scale, softmax_mask &mask) const {
+        dnnl_softmax_mask_t c_mask;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_softmax_params(get(), &scale, &c_mask),
+                "could not get softmax parameters primitive attribute");
+        mask = static_cast<softmax_mask>(c_mask);
+    }
+
     void set_src_dyn_quant_params(uint64_t group_size) {
         error::wrap_c_api(dnnl_primitive_attr_set_src_dyn_quant_params(get(), group_size),
                 "could not set src dynamic quantization parameters primitive attribute");
@@ -4670,6 +4846,34 @@ struct primitive_desc_base : public handle<dnnl_primitive_desc_t> {
         return query_s64(query::group_size_s64);
     }
 
+    /// Returns the theoretical number of floating-point operations of the
+    /// problem, the same as benchdnn reports.
+    /// @returns The number of operations.
+    /// @returns Zero if the number is not known for the primitive or the
+    ///     primitive has runtime dimensions.
+    double get_flops() const {
+        double res;
+        dnnl_status_t status = dnnl_primitive_desc_query(
+                get(), dnnl_query_flops_f64, 0, &res);
+        return status == dnnl_success ? res : 0;
+    }
+
+    /// Returns the minimal amount of memory read by the primitive: the size
+    /// of all input memory objects including post-op arguments.
+    /// @returns The number of bytes.
+    /// @returns Zero if the primitive has runtime dimensions.
+    memory::dim get_bytes_read() const {
+        return query_s64(query::bytes_read_s64);
+    }
+
+    /// Returns the minimal amount of memory written by the primitive: the
+    /// size of all output memory objects excluding the scratchpad.
+    /// @returns The number of bytes.
+    /// @returns Zero if the primitive has runtime dimensions.
+    memory::dim get_bytes_written() const {
+        return query_s64(query::bytes_written_s64);
+    }
+
     /// Returns a propagation kind.
     /// @returns A propagation kind.
     /// @returns #dnnl::prop_kind::undef if the primitive does not have
@@ -5070,6 +5274,47 @@ protected:
     using base = primitive_desc_base;
 };
 
+/// A primitive that is being created in the background.
+///
+/// The primitive is created as by a regular primitive constructor, so it is
+/// added to the primitive cache and a later construction of a primitive with
+/// the same primitive descriptor results in a cache hit. It can be used to
+/// prepare primitives ahead of time without blocking the calling thread.
+struct primitive_future : public handle<dnnl_primitive_future_t> {
+    /// Default constructor. Produces an empty object.
+    primitive_future() = default;
+
+    /// Submits creation of a primitive to a background thread.
+    ///
+    /// @param pd Primitive descriptor. The object keeps a reference to it
+    ///     until the future is destroyed.
+    primitive_future(const primitive_desc_base &pd) : pd_(pd) {
+        dnnl_primitive_future_t result;
+        error::wrap_c_api(dnnl_primitive_create_async(&result, pd_.get()),
+                "could not submit a primitive creation");
+        reset(result);
+    }
+
+    /// Returns whether the creation has completed.
+    bool is_ready() const {
+        int result = 0;
+        error::wrap_c_api(dnnl_primitive_future_is_ready(get(), &result),
+                "could not query a primitive future state");
+        return result != 0;
+    }
+
+    /// Waits for the creation to complete and returns the primitive.
+    primitive get_primitive() const {
+        dnnl_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_future_get(get(), &result),
+                "could not create a primitive");
+        return primitive(result);
+    }
+
+private:
+    primitive_desc_base pd_;
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_reorder Reorder
@@ -5212,6 +5457,38 @@ struct reorder : public primitive {
     void execute(const stream &astream, memory &src, memory &dst) const {
         primitive::execute(astream, {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst}});
     }
+
+    /// Reorders a batch of memory objects in a single call, balancing the
+    /// work of all reorders over the threads. Supported only on CPU engines.
+    ///
+    /// @param astream Stream object. All memory objects must belong to the
+    ///     engine of the stream.
+    /// @param src Source memory objects.
+    /// @param dst Destination memory objects, one for each source.
+    /// @param attr Primitive attributes shared by all reorders (optional).
+    ///     Scales and zero points are not supported.
+    static void execute_batch(const stream &astream,
+            const std::vector<memory> &src, const std::vector<memory> &dst,
+            const primitive_attr &attr = primitive_attr()) {
+        if (src.size() != dst.size())
+            DNNL_THROW_ERROR(dnnl_invalid_arguments,
+                    "numbers of source and destination memory objects differ");
+
+        std::vector<const_dnnl_memory_t> c_src;
+        std::vector<dnnl_memory_t> c_dst;
+        c_src.reserve(src.size());
+        c_dst.reserve(dst.size());
+        for (size_t i = 0; i < src.size(); ++i) {
+            c_src.push_back(src[i].get());
+            c_dst.push_back(dst[i].get());
+        }
+
+        error::wrap_c_api(
+                dnnl_reorder_batch_execute(astream.get(),
+                        static_cast<dnnl_dim_t>(src.size()), c_src.data(),
+                        c_dst.data(), attr.get()),
+                "could not execute a batch of reorders");
+    }
 };
 
 /// @} dnnl_api_reorder
@@ -13703,6 +13980,13 @@ inline status set_verbose(int level) {
     return static_cast<status>(dnnl_set_verbose(level));
 }
 
+/// @copydoc dnnl_set_exec_anomaly_callback()
+inline status set_exec_anomaly_callback(dnnl_exec_anomaly_callback_t callback,
+        float factor, void *user_data = nullptr) {
+    return static_cast<status>(
+            dnnl_set_exec_anomaly_callback(callback, factor, user_data));
+}
+
 /// @copydoc dnnl_version()
 inline const version_t *version() {
     return dnnl_version();
@@ -13740,6 +14024,11 @@ inline status set_jit_profiling_jitdumpdir(const std::string &dir) {
     return static_cast<status>(dnnl_set_jit_profiling_jitdumpdir(dir.c_str()));
 }
 
+/// @copydoc dnnl_set_huge_page_threshold()
+inline status set_huge_page_threshold(size_t threshold) {
+    return static_cast<status>(dnnl_set_huge_page_threshold(threshold));
+}
+
 /// @copydoc dnnl_cpu_isa_t
 enum class cpu_isa {
     /// @copydoc dnnl_cpu_isa_default
@@ -13791,6 +14080,8 @@ enum class cpu_isa_hints {
     no_hints = dnnl_cpu_isa_no_hints,
     /// @copydoc dnnl_cpu_isa_prefer_ymm
     prefer_ymm = dnnl_cpu_isa_prefer_ymm,
+    /// @copydoc dnnl_cpu_isa_prefer_ymm_auto
+    prefer_ymm_auto = dnnl_cpu_isa_prefer_ymm_auto,
 };
 
 /// @copydoc dnnl_set_cpu_isa_hints()
@@ -13885,6 +14176,33 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// @copydoc dnnl_cache_stats_t
+using cache_stats = dnnl_cache_stats_t;
+
+/// Returns statistics of the primitive cache.
+inline cache_stats get_primitive_cache_stats() {
+    cache_stats result {};
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(&result, nullptr),
+            "could not get primitive cache statistics");
+    return result;
+}
+
+/// Returns statistics of the kernel cache that shares its capacity with the
+/// primitive cache.
+inline cache_stats get_kernel_cache_stats() {
+    cache_stats result {};
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(nullptr, &result),
+            "could not get kernel cache statistics");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_blob_store(size_t, const uint8_t *)
+inline void set_primitive_cache_blob_store(const std::vector<uint8_t> &store) {
+    error::wrap_c_api(
+            dnnl_set_primitive_cache_blob_store(store.size(), store.data()),
+            "could not set primitive cache blob store");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -13902,6 +14220,30 @@ inline status sgemm(char transa, char transb, dnnl_dim_t M, dnnl_dim_t N,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
 }
 
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const float *A, dnnl_dim_t lda,
+        const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
 /// @copydoc dnnl_gemm_u8s8s32()
 inline status gemm_u8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
         dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint8_t *A,
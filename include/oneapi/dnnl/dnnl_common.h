@@ -54,6 +54,25 @@ size_t DNNL_API dnnl_engine_get_count(dnnl_engine_kind_t kind);
 dnnl_status_t DNNL_API dnnl_engine_create(
         dnnl_engine_t *engine, dnnl_engine_kind_t kind, size_t index);
 
+/// Creates a CPU engine that allocates memory through user-provided
+/// call-back functions. The functions serve the memory objects created with
+/// #DNNL_MEMORY_ALLOCATE and the scratchpads the library allocates for
+/// primitives created on the engine. Primitives created on such an engine
+/// never use a scratchpad shared with primitives of other engines.
+///
+/// @note
+///     The call-back functions must be thread-safe and must be valid until
+///     all the objects created on the engine are destroyed.
+///
+/// @param engine Output engine.
+/// @param cpu_malloc Allocation call-back function.
+/// @param cpu_free Deallocation call-back function.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_cpu_engine_create_with_allocator(
+        dnnl_engine_t *engine, dnnl_cpu_allocate_f cpu_malloc,
+        dnnl_cpu_deallocate_f cpu_free);
+
 /// Returns the kind of an engine.
 ///
 /// @param engine Engine to query.
@@ -101,6 +120,34 @@ dnnl_status_t DNNL_API dnnl_stream_get_engine(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_stream_wait(dnnl_stream_t stream);
 
+/// Binds the threads executing primitives in a CPU execution stream to the
+/// given logical CPUs. The thread with index `i` in a parallel region is bound
+/// to `cpus[i % ncpus]`, including the thread submitting the primitives.
+///
+/// @note
+///     The binding is applied on the first execution of a primitive in the
+///     stream and is kept afterwards. Supported only for the OpenMP and
+///     sequential threading runtimes on Linux.
+///
+/// @param stream Execution stream.
+/// @param ncpus Number of logical CPUs.
+/// @param cpus Logical CPU indices.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_cpu_affinity(
+        dnnl_stream_t stream, int ncpus, const int *cpus);
+
+/// Binds the threads executing primitives in a CPU execution stream to the
+/// logical CPUs of a NUMA node. The same as #dnnl_stream_set_cpu_affinity()
+/// called with the CPUs of the node.
+///
+/// @param stream Execution stream.
+/// @param node NUMA node index.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_numa_node_affinity(
+        dnnl_stream_t stream, int node);
+
 /// Destroys an execution stream.
 ///
 /// @param stream Execution stream to destroy.
@@ -154,6 +201,26 @@ dnnl_status_t DNNL_API dnnl_set_default_fpmath_mode(dnnl_fpmath_mode_t mode);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_verbose(int level);
 
+/// Sets a call-back function that is called when a primitive execution takes
+/// longer than @p factor times the moving average of the previous executions
+/// of the same primitive object.
+///
+/// @note
+///     While the call-back is set, every primitive execution waits for the
+///     stream to complete before and after the execution, the same way as
+///     the verbose profiling does. The first executions of a primitive only
+///     warm up the moving average and are never reported.
+///
+/// @param callback Call-back function. NULL disables the detection.
+/// @param factor Ratio between the execution time and the moving average
+///     above which the call-back is called. Must be greater than 1.
+/// @param user_data User data passed to the call-back function as is.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p factor value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_set_exec_anomaly_callback(
+        dnnl_exec_anomaly_callback_t callback, float factor, void *user_data);
+
 /// Returns library version information.
 /// @returns Pointer to a constant structure containing
 ///  - major: major version number,
@@ -298,6 +298,23 @@ inline dnnl_engine_kind_t convert_to_c(engine::kind akind) {
     return static_cast<dnnl_engine_kind_t>(akind);
 }
 
+/// Constructs a CPU engine that allocates memory through user-provided
+/// call-back functions.
+///
+/// @sa dnnl_cpu_engine_create_with_allocator()
+///
+/// @param cpu_malloc Allocation call-back function.
+/// @param cpu_free Deallocation call-back function.
+/// @returns Created engine.
+inline engine make_cpu_engine_with_allocator(
+        dnnl_cpu_allocate_f cpu_malloc, dnnl_cpu_deallocate_f cpu_free) {
+    dnnl_engine_t c_engine;
+    error::wrap_c_api(dnnl_cpu_engine_create_with_allocator(
+                              &c_engine, cpu_malloc, cpu_free),
+            "could not create a CPU engine with an allocator");
+    return engine(c_engine);
+}
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream Stream
@@ -368,6 +385,29 @@ struct stream : public handle<dnnl_stream_t> {
                 dnnl_stream_wait(get()), "could not wait on a stream");
         return *this;
     }
+
+    /// Binds the threads executing primitives in the stream to the given
+    /// logical CPUs. Supported only for CPU streams.
+    ///
+    /// @param cpus Logical CPU indices.
+    /// @returns The stream itself.
+    stream &set_cpu_affinity(const std::vector<int> &cpus) {
+        error::wrap_c_api(dnnl_stream_set_cpu_affinity(
+                                  get(), (int)cpus.size(), cpus.data()),
+                "could not set a stream CPU affinity");
+        return *this;
+    }
+
+    /// Binds the threads executing primitives in the stream to the logical
+    /// CPUs of a NUMA node. Supported only for CPU streams.
+    ///
+    /// @param node NUMA node index.
+    /// @returns The stream itself.
+    stream &set_numa_node_affinity(int node) {
+        error::wrap_c_api(dnnl_stream_set_numa_node_affinity(get(), node),
+                "could not set a stream NUMA node affinity");
+        return *this;
+    }
 };
 
 #define DNNL_DEFINE_BITMASK_OPS(enum_name) \
@@ -190,6 +190,16 @@ typedef enum {
 struct dnnl_engine;
 /// @brief An engine handle.
 typedef struct dnnl_engine *dnnl_engine_t;
+
+/// Allocation call-back function interface for CPU engines created with
+/// #dnnl_cpu_engine_create_with_allocator(). The function must return a
+/// buffer of at least @p size bytes aligned to @p alignment bytes or NULL in
+/// case of a failure.
+typedef void *(*dnnl_cpu_allocate_f)(size_t size, size_t alignment);
+
+/// Deallocation call-back function interface for CPU engines created with
+/// #dnnl_cpu_engine_create_with_allocator().
+typedef void (*dnnl_cpu_deallocate_f)(void *);
 #if 0
 // FIXME: looks like this never happens
 /// @brief A constant engine handle.
@@ -239,6 +249,17 @@ typedef struct {
     unsigned gpu_runtime; ///< GPU runtime
 } dnnl_version_t;
 
+/// Call-back function interface for #dnnl_set_exec_anomaly_callback(). The
+/// function is called from the thread that executes the primitive.
+///
+/// @param info Primitive information string in the verbose format.
+/// @param time_ms Execution time of the primitive in milliseconds.
+/// @param avg_ms Moving average of the previous execution times of the
+///     primitive in milliseconds.
+/// @param user_data User data passed to #dnnl_set_exec_anomaly_callback().
+typedef void (*dnnl_exec_anomaly_callback_t)(
+        const char *info, double time_ms, double avg_ms, void *user_data);
+
 /// @} dnnl_api_service
 
 /// @addtogroup dnnl_api_memory
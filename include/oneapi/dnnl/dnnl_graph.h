@@ -500,6 +500,31 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_execute(
         const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
         const_dnnl_graph_tensor_t *outputs);
 
+/// Materializes the constant parts of a compiled partition ahead of its first
+/// execution.
+///
+/// Constant inputs are the inputs whose logical tensors have
+/// #dnnl_graph_tensor_property_constant. When the constant tensor cache is
+/// enabled, the results of the operations computed only from such inputs
+/// (for example, weights reorders) are stored in the cache on the first
+/// execution. This function computes and caches them right away, so that the
+/// first call to #dnnl_graph_compiled_partition_execute() does not pay for
+/// it. The function is a no-op if the constant tensor cache is disabled, if
+/// the results are already cached or if the partition has no constant parts.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param stream The stream used for execution.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors, in the same order as for
+///     #dnnl_graph_compiled_partition_execute(). Only the buffers of the
+///     constant inputs are accessed.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs);
+
 /// Destroys a compiled partition.
 ///
 /// @param compiled_partition The compiled partition to be destroyed.
@@ -672,6 +697,39 @@ dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_set_compiled_partition_cache_capacity(
         int capacity);
 
+/// Retrieves a cache blob with the compiled partitions held in the compiled
+/// partition cache. The blob can be stored, e.g. in a file, and passed to
+/// #dnnl_graph_set_compiled_partition_cache_blob() in another process to warm
+/// up its compiled partition cache.
+///
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size. If the @p cache_blob is
+///     nullptr then the size of the cache blob is returned in @p size.
+/// @returns #dnnl_invalid_arguments if @p size is nullptr or is less than the
+///     size of the cache blob, and #dnnl_success on success.
+///
+/// @note Compiled partitions with opaque input or output logical tensors are
+///     not stored in the cache blob since opaque layout IDs are only valid
+///     within the process that generated them.
+dnnl_status_t DNNL_API dnnl_graph_get_compiled_partition_cache_blob(
+        size_t *size, uint8_t *cache_blob);
+
+/// Populates the compiled partition cache from a cache blob retrieved with
+/// #dnnl_graph_get_compiled_partition_cache_blob(). Each stored partition is
+/// re-created from its operations and compiled for @p engine with the stored
+/// input and output logical tensors, so that later compilations of the same
+/// partitions are served from the cache.
+///
+/// @param engine Engine to compile the partitions for. Partitions stored for
+///     other engine kinds are skipped.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size.
+/// @returns #dnnl_invalid_arguments if the cache blob is malformed or was
+///     generated by a different version of the library, and #dnnl_success
+///     otherwise. Partitions that cannot be compiled are skipped.
+dnnl_status_t DNNL_API dnnl_graph_set_compiled_partition_cache_blob(
+        dnnl_engine_t engine, size_t size, const uint8_t *cache_blob);
+
 /// @} dnnl_graph_api_compiled_partition_cache
 
 /// @addtogroup dnnl_graph_api_constant_tensor_cache
@@ -725,6 +783,47 @@ dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
         dnnl_engine_kind_t eng_kind, size_t *size);
 
+/// Control the capacity of the NUMA replicas of the CPU constant tensor
+/// cache. When the capacity is not zero, a thread that uses a constant tensor
+/// cached by a thread of another NUMA node creates a replica of the tensor in
+/// the memory of its own node, as long as the replicas of the node fit in the
+/// capacity. Otherwise, the remote copy is used. The replicas are not
+/// accounted by the capacity set with
+/// #dnnl_graph_set_constant_tensor_cache_capacity(). The capacity is set to
+/// zero by default which means replication is disabled. When calling this API,
+/// existing replicas are flushed. This API is thread safe and can be called
+/// multiple times at runtime. The default value can also be set with the
+/// ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_NUMA_REPLICA_CAPACITY environment
+/// variable.
+///
+/// @param size The capacity of the replicas on each NUMA node in MBytes.
+/// @returns #dnnl_success on success.
+dnnl_status_t DNNL_API
+dnnl_graph_set_constant_tensor_cache_numa_replica_capacity(size_t size);
+
+/// Return the current capacity of the NUMA replicas of the CPU constant
+/// tensor cache.
+///
+/// @param size The capacity of the replicas on each NUMA node in MBytes to
+///     query.
+/// @returns #dnnl_invalid_arguments if the @p size is nullptr, and
+/// #dnnl_success on success.
+dnnl_status_t DNNL_API
+dnnl_graph_get_constant_tensor_cache_numa_replica_capacity(size_t *size);
+
+/// Sets the callback that decides whether the constant tensors of a partition
+/// can be evicted from the constant tensor cache. The constant tensors of the
+/// partitions for which the callback returns a non-zero value are never
+/// evicted. The callback is only used when the cache evicts tensors to make
+/// room for new ones, which is enabled by setting the
+/// ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_EVICTION_POLICY environment variable to
+/// `cost`. The callback may be called concurrently from multiple threads.
+///
+/// @param callback The pin callback. Passing nullptr unpins all partitions.
+/// @returns #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_pin_callback(
+        dnnl_graph_constant_tensor_cache_pin_f callback);
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 /// @} dnnl_graph_api
@@ -713,6 +713,27 @@ public:
                         c_outputs.data()),
                 "could not execute the compiled_partition");
     }
+
+    /// Computes and caches the constant parts of a compiled partition ahead
+    /// of its first execution. See
+    /// #dnnl_graph_compiled_partition_prepare_constants() for details.
+    ///
+    /// @param astream Stream object to run over.
+    /// @param inputs A list of input tensors, same as for execute(). Only
+    ///     the buffers of the constant inputs are accessed.
+    void prepare_constants(
+            stream &astream, const std::vector<tensor> &inputs) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_prepare_constants(get(),
+                        astream.get(), c_inputs.size(), c_inputs.data()),
+                "could not prepare constants of the compiled_partition");
+    }
 };
 
 /// @} dnnl_graph_api_compiled_partition
@@ -1482,6 +1503,40 @@ inline void set_compiled_partition_cache_capacity(int capacity) {
             "could not set compiled partition cache capacity");
 }
 
+/// Returns a cache blob with the compiled partitions held in the compiled
+/// partition cache.
+///
+/// @sa dnnl_graph_get_compiled_partition_cache_blob
+inline std::vector<uint8_t> get_compiled_partition_cache_blob() {
+    size_t size = 0;
+    error::wrap_c_api(
+            dnnl_graph_get_compiled_partition_cache_blob(&size, nullptr),
+            "could not get compiled partition cache blob size");
+
+    std::vector<uint8_t> cache_blob(size);
+    if (size == 0) return cache_blob;
+    error::wrap_c_api(dnnl_graph_get_compiled_partition_cache_blob(
+                              &size, cache_blob.data()),
+            "could not get compiled partition cache blob");
+    return cache_blob;
+}
+
+/// Populates the compiled partition cache from a cache blob by compiling the
+/// stored partitions for the given engine.
+///
+/// @sa dnnl_graph_set_compiled_partition_cache_blob
+///
+/// @param aengine Engine to compile the partitions for.
+/// @param cache_blob Cache blob returned by
+///     #get_compiled_partition_cache_blob().
+inline void set_compiled_partition_cache_blob(
+        const engine &aengine, const std::vector<uint8_t> &cache_blob) {
+    error::wrap_c_api(dnnl_graph_set_compiled_partition_cache_blob(
+                              aengine.get(), cache_blob.size(),
+                              cache_blob.data()),
+            "could not set compiled partition cache blob");
+}
+
 /// @} dnnl_graph_api_compiled_partition_cache
 
 /// @addtogroup dnnl_graph_api_constant_tensor_cache Constant Tensor Cache
@@ -1543,6 +1598,31 @@ inline size_t get_constant_tensor_cache_capacity(engine::kind kind) {
     return size;
 }
 
+/// @copydoc dnnl_graph_set_constant_tensor_cache_numa_replica_capacity()
+inline void set_constant_tensor_cache_numa_replica_capacity(size_t size) {
+    error::wrap_c_api(
+            dnnl_graph_set_constant_tensor_cache_numa_replica_capacity(size),
+            "fail to set constant tensor cache numa replica capacity");
+}
+
+/// Return the current capacity of the NUMA replicas of the CPU constant
+/// tensor cache in MBytes.
+inline size_t get_constant_tensor_cache_numa_replica_capacity() {
+    size_t size = 0;
+    error::wrap_c_api(
+            dnnl_graph_get_constant_tensor_cache_numa_replica_capacity(&size),
+            "fail to get constant tensor cache numa replica capacity");
+    return size;
+}
+
+/// @copydoc dnnl_graph_set_constant_tensor_cache_pin_callback()
+inline void set_constant_tensor_cache_pin_callback(
+        dnnl_graph_constant_tensor_cache_pin_f callback) {
+    error::wrap_c_api(
+            dnnl_graph_set_constant_tensor_cache_pin_callback(callback),
+            "fail to set constant tensor cache pin callback");
+}
+
 /// @} dnnl_graph_constant_tensor_cache
 
 } // namespace graph
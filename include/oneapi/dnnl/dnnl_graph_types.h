@@ -457,6 +457,19 @@ typedef const struct dnnl_graph_tensor *const_dnnl_graph_tensor_t;
 
 /// @} dnnl_graph_api_tensor
 
+/// @addtogroup dnnl_graph_api_constant_tensor_cache
+/// @{
+
+/// Constant tensor cache pin callback function prototype.
+///
+/// @param partition_id The ID of the partition that owns the cached constant
+///     tensor.
+/// @returns A non-zero value if the constant tensors of the partition must not
+///     be evicted from the cache, and 0 otherwise.
+typedef int (*dnnl_graph_constant_tensor_cache_pin_f)(size_t partition_id);
+
+/// @} dnnl_graph_api_constant_tensor_cache
+
 /// @} dnnl_graph_api
 
 #ifdef __cplusplus
@@ -56,6 +56,13 @@ struct threadpool_iface {
     /// waiting for the submitted closures to finish execution on its own.
     static constexpr uint64_t ASYNCHRONOUS = 1;
 
+    /// If set, parallel_for() may be called from the worker threads of this
+    /// threadpool, e.g. because the calling thread takes part in executing
+    /// the closures or idle workers steal them. oneDNN then parallelizes
+    /// primitives executed from within the threadpool tasks instead of
+    /// executing them sequentially.
+    static constexpr uint64_t NESTED_PARALLELISM = 2;
+
     virtual ~threadpool_iface() {}
 };
 
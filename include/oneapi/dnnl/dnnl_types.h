@@ -2274,8 +2274,34 @@ typedef enum {
     ///    tensor and then perform backward normalization.
     dnnl_fuse_norm_add_relu = 0x10U,
 
+    /// Use Root Mean Square (RMS) Normalization
+    ///
+    /// If specified:
+    ///  - on forward propagation the mean is considered zero and is neither
+    ///    computed nor output; the variance holds the mean of squares of the
+    ///    input.
+    ///  - on backward propagation the derivative is computed wrt the RMS
+    ///    statistic only, assuming the mean is zero.
+    ///  - with #dnnl_use_global_stats only the variance is required as an
+    ///    input.
+    ///
+    /// The flag is supported by the layer normalization primitive only.
+    dnnl_rms_norm = 0x20U,
+
 } dnnl_normalization_flags_t;
 
+/// Kinds of masks applied to the softmax source before the normalization.
+typedef enum {
+    /// No mask is applied.
+    dnnl_softmax_mask_none = 0,
+    /// Causal (upper-triangular) mask. The softmax axis must be the last one
+    /// and the second to last dimension holds queries. For a source of shape
+    /// `[..., M, N]` an element with query index `m` and key index `n` is
+    /// masked when `n > m + N - M`. Masked elements don't contribute to the
+    /// normalization and their destination values are zero before post-ops.
+    dnnl_softmax_mask_causal = 1,
+} dnnl_softmax_mask_t;
+
 /// @} dnnl_api_primitives_common
 /// @} dnnl_api_primitives
 
@@ -2461,8 +2487,31 @@ typedef enum {
     /// as the scratchpad buffers are not used concurrently by two primitive
     /// executions.
     dnnl_scratchpad_mode_user,
+    /// The library provides the scratchpad from an arena which is shared by all
+    /// primitives created with this mode in the same thread. The arena grows
+    /// to the largest scratchpad of these primitives at their creation and is
+    /// freed when all of them are destroyed, so that a model with many
+    /// primitives holds a single scratchpad regardless of the
+    /// `DNNL_ENABLE_CONCURRENT_EXEC` build option. The primitives must be
+    /// executed sequentially in the thread they were created in. Applies to
+    /// CPU engines only, other engines behave as with the library mode.
+    dnnl_scratchpad_mode_shared,
 } dnnl_scratchpad_mode_t;
 
+/// Kinds of memory a primitive holds in addition to its inputs and outputs.
+typedef enum {
+    /// Scratchpad memory the primitive requires for execution. Reported
+    /// regardless of whether the scratchpad is provided by the library or by
+    /// the user.
+    dnnl_memory_consumption_scratchpad,
+    /// Memory occupied by the code generated for the primitive and its nested
+    /// primitives.
+    dnnl_memory_consumption_code,
+    /// Memory held by the resources of the primitive, such as constant
+    /// buffers created at primitive creation.
+    dnnl_memory_consumption_resources,
+} dnnl_memory_consumption_kind_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -2516,6 +2565,15 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_primitive_future
+/// An opaque structure to describe a primitive that is being created in the
+/// background.
+struct dnnl_primitive_future;
+/// A primitive future handle.
+typedef struct dnnl_primitive_future *dnnl_primitive_future_t;
+/// A constant primitive future handle.
+typedef const struct dnnl_primitive_future *const_dnnl_primitive_future_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -2834,6 +2892,10 @@ typedef enum {
     dnnl_query_activation_kind, ///< RNN parameter activation kind
     dnnl_query_kernel, ///< Pooling parameter kernel
     dnnl_query_group_size_s64, ///< Shuffle parameter group size
+    dnnl_query_flops_f64, ///< theoretical number of floating-point operations
+    dnnl_query_bytes_read_s64, ///< size of all inputs of the problem (bytes)
+    dnnl_query_bytes_written_s64, ///< size of all outputs of the problem
+    ///  (bytes)
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -2873,6 +2935,24 @@ typedef enum {
 
 /// @} dnnl_api_primitives
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Cache statistics. The counters are accumulated from the library load.
+typedef struct {
+    /// Number of lookups that found the requested object in the cache.
+    int64_t hits;
+    /// Number of lookups that had to create the requested object.
+    int64_t misses;
+    /// Number of objects evicted from the cache because of its capacity.
+    int64_t evictions;
+    /// Cumulative creation time in milliseconds of the objects returned on
+    /// cache hits, that is, the creation time saved by the cache.
+    double creation_time_saved_ms;
+} dnnl_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -2962,6 +3042,11 @@ typedef enum {
 
     /// Prefer to exclusively use Ymm registers for computations
     dnnl_cpu_isa_prefer_ymm = 0x1,
+
+    /// Prefer to use Ymm registers for memory-bound primitives (e.g. eltwise,
+    /// binary) only, and keep the widest vector registers and AMX for
+    /// compute-bound ones
+    dnnl_cpu_isa_prefer_ymm_auto = 0x2,
 } dnnl_cpu_isa_hints_t;
 
 /// @} dnnl_api_service
@@ -91,6 +91,21 @@ dnnl_status_t DNNL_API dnnl_brgemm_get_scratchpad_size(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_brgemm_set_hw_context(const_dnnl_brgemm_t brgemm);
 
+/// Checks whether two BRGeMM ukernel objects require the same hardware-specific
+/// context. If they do, the context set for one of them is valid for the other
+/// one, and the objects can be executed one after another without calling
+/// #dnnl_brgemm_set_hw_context in between.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param other_brgemm Another BRGeMM ukernel object.
+/// @param is_same Output flag. Possible values are 0 (the contexts differ) and
+///     1 (the contexts are the same).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_is_same_hw_context(
+        const_dnnl_brgemm_t brgemm, const_dnnl_brgemm_t other_brgemm,
+        int *is_same);
+
 /// Releases the hardware-specific context. Must be used after all the execution
 /// calls to BRGeMM ukernel objects.
 /// @returns #dnnl_success on success and a status describing the error
@@ -166,6 +181,28 @@ dnnl_status_t DNNL_API dnnl_brgemm_pack_B_create(
         dnnl_dim_t in_ld, dnnl_dim_t out_ld, dnnl_data_type_t in_dt,
         dnnl_data_type_t out_dt);
 
+/// Creates a BRGeMM ukernel packing tensor B object with an input tensor of a
+/// given layout. A transposed input is transposed during packing, which makes
+/// the packing routine usable as a standalone transform ukernel.
+///
+/// @param brgemm_pack_B Output BRGeMM ukernel packing B object.
+/// @param K Dimension K.
+/// @param N Dimension N.
+/// @param in_pack_type Layout of the input tensor.
+/// @param in_ld Input leading dimension. The distance between rows of K for
+///     #dnnl_pack_type_no_trans and between rows of N for
+///     #dnnl_pack_type_trans.
+/// @param out_ld Output leading dimension. Specifies a block by N dimension
+///     during data packing.
+/// @param in_dt Input data type.
+/// @param out_dt Output data type.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_pack_B_create_v2(
+        dnnl_brgemm_pack_B_t *brgemm_pack_B, dnnl_dim_t K, dnnl_dim_t N,
+        dnnl_pack_type_t in_pack_type, dnnl_dim_t in_ld, dnnl_dim_t out_ld,
+        dnnl_data_type_t in_dt, dnnl_data_type_t out_dt);
+
 /// Returns the flag if packing is expected by BRGeMM ukernel kernel.
 ///
 /// @param brgemm_pack_B BRGeMM ukernel packing B object.
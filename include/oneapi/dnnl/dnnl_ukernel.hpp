@@ -167,6 +167,23 @@ struct brgemm : public handle<dnnl_brgemm_t> {
             error::wrap_c_api(status, "could not set hardware context");
     }
 
+    /// Returns whether the object requires the same hardware-specific context
+    /// as @p other. If so, both objects can be executed after a single call
+    /// to #set_hw_context(), e.g. inside an inner loop switching between
+    /// them.
+    ///
+    /// @param other Another BRGeMM ukernel object.
+    bool is_same_hw_context(const brgemm &other) const {
+        int flag;
+        dnnl_status_t status
+                = dnnl_brgemm_is_same_hw_context(get(), other.get(), &flag);
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not compare hardware contexts of BRGeMM ukernel "
+                    "objects");
+        return bool(flag);
+    }
+
     /// Releases the hardware-specific context. Affects the global state for
     /// all BRGeMM ukernel objects. Must be used after all the execution calls
     /// to BRGeMM ukernel objects.
@@ -231,6 +248,16 @@ struct brgemm : public handle<dnnl_brgemm_t> {
     }
 };
 
+/// Layout of an input tensor of a BRGeMM ukernel packing B routine.
+enum class pack_type {
+    /// Undefined pack type. A guard value.
+    undef = dnnl_pack_type_undef,
+    /// Plain, not transposed layout. Similar to format_tag::ab.
+    no_trans = dnnl_pack_type_no_trans,
+    /// Plain, transposed layout. Similar to format_tag::ba.
+    trans = dnnl_pack_type_trans,
+};
+
 struct brgemm_pack_B : public handle<dnnl_brgemm_pack_B_t> {
     /// Default constructor. Produces an empty object.
     brgemm_pack_B() = default;
@@ -263,6 +290,36 @@ struct brgemm_pack_B : public handle<dnnl_brgemm_pack_B_t> {
         reset(brgemm_pack_B);
     }
 
+    /// Constructs a BRGeMM ukernel packing tensor B object with an input
+    /// tensor of a given layout.
+    ///
+    /// @param K Dimension K.
+    /// @param N Dimension N.
+    /// @param in_pack_type Layout of the input tensor.
+    /// @param in_ld Input leading dimension.
+    /// @param out_ld Output leading dimension. Specifies a block by N dimension
+    ///     during data packing.
+    /// @param in_dt Input data type.
+    /// @param out_dt Output data type.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    brgemm_pack_B(memory::dim K, memory::dim N, pack_type in_pack_type,
+            memory::dim in_ld, memory::dim out_ld, memory::data_type in_dt,
+            memory::data_type out_dt, bool allow_empty = false) {
+
+        dnnl_brgemm_pack_B_t brgemm_pack_B = nullptr;
+        dnnl_status_t status = dnnl_brgemm_pack_B_create_v2(&brgemm_pack_B, K,
+                N, static_cast<dnnl_pack_type_t>(in_pack_type), in_ld, out_ld,
+                memory::convert_to_c(in_dt), memory::convert_to_c(out_dt));
+
+        if (!allow_empty)
+            error::wrap_c_api(status,
+                    "could not create a BRGeMM ukernel packing B object");
+        reset(brgemm_pack_B);
+    }
+
     /// Returns the flag if packing is expected by BRGeMM ukernel kernel.
     bool need_pack() const {
         int flag;
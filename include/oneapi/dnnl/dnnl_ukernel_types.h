@@ -56,6 +56,16 @@ typedef struct dnnl_brgemm_pack_B *dnnl_brgemm_pack_B_t;
 /// A constant brgemm ukernel packing B routine handle.
 typedef const struct dnnl_brgemm_pack_B *const_dnnl_brgemm_pack_B_t;
 
+/// Layout of an input tensor of a brgemm ukernel packing B routine.
+typedef enum {
+    /// Undefined pack type. A guard value.
+    dnnl_pack_type_undef = 0,
+    /// Plain, not transposed layout. Similar to format_tag::ab.
+    dnnl_pack_type_no_trans,
+    /// Plain, transposed layout. Similar to format_tag::ba.
+    dnnl_pack_type_trans,
+} dnnl_pack_type_t;
+
 /// @} dnnl_api_ukernel_brgemm
 #endif
 
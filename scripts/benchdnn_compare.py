@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+################################################################################
+# Copyright 2024 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import math
+import sys
+
+
+def parse_line(line):
+    """Returns (problem, mean, stddev, samples) for a performance line printed
+    with the `%prb%,%0time%[,%stddev%,%samples%]` template or None for other
+    lines. Numeric fields are taken from the right side since a problem
+    descriptor may contain commas."""
+    fields = line.strip().split(",")
+    for n_numbers in (3, 1):
+        if len(fields) <= n_numbers:
+            continue
+        try:
+            numbers = [float(f) for f in fields[-n_numbers:]]
+        except ValueError:
+            continue
+        problem = ",".join(fields[:-n_numbers])
+        if n_numbers == 3:
+            return problem, numbers[0], numbers[1], int(numbers[2])
+        return problem, numbers[0], None, None
+    return None
+
+
+def read_results(path):
+    results = {}
+    with open(path) as f:
+        for line in f:
+            parsed = parse_line(line)
+            if parsed is None:
+                continue
+            # The last measurement of a problem wins.
+            results[parsed[0]] = parsed[1:]
+    return results
+
+
+def betacf(a, b, x):
+    """Continued fraction for the incomplete beta function."""
+    max_iter, eps, tiny = 200, 3e-16, 1e-300
+    qab, qap, qam = a + b, a + 1.0, a - 1.0
+    c, d = 1.0, 1.0 - qab * x / qap
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, max_iter + 1):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < eps:
+            break
+    return h
+
+
+def betainc(a, b, x):
+    """Regularized incomplete beta function I_x(a, b)."""
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    ln_front = (
+        math.lgamma(a + b)
+        - math.lgamma(a)
+        - math.lgamma(b)
+        + a * math.log(x)
+        + b * math.log(1.0 - x)
+    )
+    front = math.exp(ln_front)
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * betacf(a, b, x) / a
+    return 1.0 - front * betacf(b, a, 1.0 - x) / b
+
+
+def welch_p_value(mean_a, std_a, n_a, mean_b, std_b, n_b):
+    """Two-sided p-value of Welch's t-test for means of two samples."""
+    if n_a < 2 or n_b < 2:
+        return None
+    var_a, var_b = std_a * std_a / n_a, std_b * std_b / n_b
+    var = var_a + var_b
+    if var == 0.0:
+        return 0.0 if mean_a != mean_b else 1.0
+    t = (mean_a - mean_b) / math.sqrt(var)
+    df = var * var / (var_a * var_a / (n_a - 1) + var_b * var_b / (n_b - 1))
+    return betainc(df / 2.0, 0.5, df / (df + t * t))
+
+
+def compare(results_a, results_b, alpha, threshold):
+    rows = []
+    for problem, (mean_a, std_a, n_a) in results_a.items():
+        if problem not in results_b:
+            continue
+        mean_b, std_b, n_b = results_b[problem]
+        if mean_a <= 0 or mean_b <= 0:
+            continue
+        speedup = mean_a / mean_b
+        p_value = None
+        if None not in (std_a, n_a, std_b, n_b):
+            p_value = welch_p_value(mean_a, std_a, n_a, mean_b, std_b, n_b)
+        significant = (
+            p_value is not None
+            and p_value < alpha
+            and abs(speedup - 1.0) * 100 > threshold
+        )
+        rows.append((problem, mean_a, mean_b, speedup, p_value, significant))
+    return rows
+
+
+def main():
+    args_parser = argparse.ArgumentParser(
+        description="Compares two benchdnn performance results. Results are "
+        "expected in the `--perf-template=%%prb%%,%%0time%%,%%stddev%%,"
+        "%%samples%%` format; the `--perf-template=%%prb%%,%%0time%%` format "
+        "gives speedups without significance."
+    )
+    args_parser.add_argument("a", help="baseline benchdnn output")
+    args_parser.add_argument("b", help="new benchdnn output")
+    args_parser.add_argument(
+        "--alpha",
+        type=float,
+        default=0.05,
+        help="significance level of Welch's t-test (default: 0.05)",
+    )
+    args_parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.0,
+        help="minimal speedup or slowdown in percents to be reported as "
+        "significant (default: 0)",
+    )
+    args = args_parser.parse_args()
+
+    results_a = read_results(args.a)
+    results_b = read_results(args.b)
+    rows = compare(results_a, results_b, args.alpha, args.threshold)
+    if not rows:
+        print("Error: no common problems found", file=sys.stderr)
+        return 1
+
+    # The problem goes last since it may contain commas.
+    print("speedup,p_value,significant,time_a,time_b,problem")
+    log_sum = 0.0
+    n_faster, n_slower = 0, 0
+    for problem, mean_a, mean_b, speedup, p_value, significant in rows:
+        p_str = "n/a" if p_value is None else "%.3g" % p_value
+        print(
+            "%.3f,%s,%s,%g,%g,%s"
+            % (speedup, p_str, significant, mean_a, mean_b, problem)
+        )
+        log_sum += math.log(speedup)
+        if significant:
+            if speedup > 1.0:
+                n_faster += 1
+            else:
+                n_slower += 1
+
+    print(
+        "problems: %d; geomean speedup: %.3f; significantly faster: %d; "
+        "significantly slower: %d"
+        % (len(rows), math.exp(log_sum / len(rows)), n_faster, n_slower)
+    )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
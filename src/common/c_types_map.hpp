@@ -23,6 +23,7 @@
 // to give names that better reflects the meaning of the entities
 using primitive_iface_t = dnnl_primitive;
 using primitive_desc_iface_t = dnnl_primitive_desc;
+using primitive_future_iface_t = dnnl_primitive_future;
 
 namespace dnnl {
 namespace impl {
@@ -201,8 +202,17 @@ using scratchpad_mode_t = dnnl_scratchpad_mode_t;
 namespace scratchpad_mode {
 const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
+const scratchpad_mode_t shared = dnnl_scratchpad_mode_shared;
 } // namespace scratchpad_mode
 
+using memory_consumption_kind_t = dnnl_memory_consumption_kind_t;
+namespace memory_consumption_kind {
+const memory_consumption_kind_t scratchpad
+        = dnnl_memory_consumption_scratchpad;
+const memory_consumption_kind_t code = dnnl_memory_consumption_code;
+const memory_consumption_kind_t resources = dnnl_memory_consumption_resources;
+} // namespace memory_consumption_kind
+
 #ifdef DNNL_EXPERIMENTAL_SPARSE
 using sparse_encoding_t = dnnl_sparse_encoding_t;
 namespace sparse_encoding {
@@ -1899,8 +1909,15 @@ const normalization_flags_t use_scale = dnnl_use_scale;
 const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
+const normalization_flags_t rms_norm = dnnl_rms_norm;
 } // namespace normalization_flags
 
+using softmax_mask_t = dnnl_softmax_mask_t;
+namespace softmax_mask {
+const softmax_mask_t none = dnnl_softmax_mask_none;
+const softmax_mask_t causal = dnnl_softmax_mask_causal;
+} // namespace softmax_mask
+
 using rnn_flags_t = dnnl_rnn_flags_t;
 namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
@@ -2022,6 +2039,9 @@ const query_t direction = dnnl_query_direction;
 const query_t activation_kind = dnnl_query_activation_kind;
 const query_t kernel = dnnl_query_kernel;
 const query_t group_size_s64 = dnnl_query_group_size_s64;
+const query_t flops_f64 = dnnl_query_flops_f64;
+const query_t bytes_read_s64 = dnnl_query_bytes_read_s64;
+const query_t bytes_written_s64 = dnnl_query_bytes_written_s64;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "cache_blob_store.hpp"
+
+namespace dnnl {
+namespace impl {
+
+status_t cache_blob_store_t::set(const uint8_t *data, size_t size) {
+    if (size > 0 && !data) return status::invalid_arguments;
+
+    std::unordered_map<std::string, std::vector<uint8_t>> blobs;
+    size_t pos = 0;
+    const auto read_record = [&](const uint8_t *&ptr, size_t &n) {
+        uint64_t n64 = 0;
+        if (size - pos < sizeof(n64)) return false;
+        std::memcpy(&n64, data + pos, sizeof(n64));
+        pos += sizeof(n64);
+        if (n64 == 0 || size - pos < n64) return false;
+        ptr = data + pos;
+        n = static_cast<size_t>(n64);
+        pos += n;
+        return true;
+    };
+
+    while (pos < size) {
+        const uint8_t *id = nullptr, *blob = nullptr;
+        size_t id_size = 0, blob_size = 0;
+        if (!read_record(id, id_size) || !read_record(blob, blob_size))
+            return status::invalid_arguments;
+        blobs[std::string(reinterpret_cast<const char *>(id), id_size)]
+                .assign(blob, blob + blob_size);
+    }
+
+    utils::lock_write_t lock_w(rw_mutex_);
+    blobs_ = std::move(blobs);
+    return status::success;
+}
+
+bool cache_blob_store_t::get(
+        const std::vector<uint8_t> &id, std::vector<uint8_t> &blob) const {
+    if (id.empty()) return false;
+    const std::string key(reinterpret_cast<const char *>(id.data()), id.size());
+
+    utils::lock_read_t lock_r(rw_mutex_);
+    const auto it = blobs_.find(key);
+    if (it == blobs_.end()) return false;
+    blob = it->second;
+    return true;
+}
+
+bool cache_blob_store_t::empty() const {
+    utils::lock_read_t lock_r(rw_mutex_);
+    return blobs_.empty();
+}
+
+cache_blob_store_t &global_cache_blob_store() {
+    static cache_blob_store_t store;
+    return store;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl::impl::status_t dnnl_set_primitive_cache_blob_store(
+        size_t size, const uint8_t *store) {
+    return dnnl::impl::global_cache_blob_store().set(store, size);
+}
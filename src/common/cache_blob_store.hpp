@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_CACHE_BLOB_STORE_HPP
+#define COMMON_CACHE_BLOB_STORE_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "rw_mutex.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A process-wide collection of cache blobs indexed by cache blob ID. The store
+// is populated ahead of time (e.g. by benchdnn replaying a verbose log) and
+// consulted by primitive creation so that kernels are loaded from the blobs
+// instead of being generated.
+//
+// The serialized form is a sequence of records:
+//     [uint64 id_size][id][uint64 blob_size][blob]
+struct cache_blob_store_t {
+    cache_blob_store_t() = default;
+
+    // Replaces the content of the store. An empty input clears the store.
+    status_t set(const uint8_t *data, size_t size);
+
+    // Copies the blob for the given ID to `blob`. Returns false if the store
+    // has no blob for the ID.
+    bool get(const std::vector<uint8_t> &id, std::vector<uint8_t> &blob) const;
+
+    bool empty() const;
+
+private:
+    mutable utils::rw_mutex_t rw_mutex_;
+    std::unordered_map<std::string, std::vector<uint8_t>> blobs_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cache_blob_store_t);
+};
+
+cache_blob_store_t &global_cache_blob_store();
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -18,23 +18,25 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <future>
 #include <memory>
 #include <thread>
 #include <unordered_map>
 
 #include "oneapi/dnnl/dnnl_config.h"
+#include "oneapi/dnnl/dnnl_types.h"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/platform.hpp"
-#else
-#include <chrono>
 #endif
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
 
+#include "profiler.hpp"
 #include "rw_mutex.hpp"
 
 namespace dnnl {
@@ -63,6 +65,8 @@ struct cache_t {
 
     virtual int get_size() const = 0;
 
+    virtual dnnl_cache_stats_t get_stats() const = 0;
+
     // Returns the cached value or cache_object_t() on a miss
     virtual cache_object_t get(const key_t &key) = 0;
 
@@ -87,7 +91,9 @@ struct cache_t {
             // The requested object is NOT present in the cache therefore we
             // have to create it and notify the waiting threads once the
             // creation is done.
+            const double start_ms = get_msec();
             cache_object_t cv = create(create_context);
+            const double creation_time_ms = get_msec() - start_ms;
             if (cv.status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, cv.status});
@@ -104,7 +110,7 @@ struct cache_t {
                 // The key_t may contains pointers that should reside within the
                 // stored object. Therefore the pointers in the key may need
                 // updated.
-                update_entry(key, cv.get_value());
+                update_entry(key, cv.get_value(), creation_time_ms);
                 return cv;
             }
         }
@@ -113,14 +119,18 @@ struct cache_t {
 protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
-    virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
+    virtual void update_entry(const key_t &key, const object_t &p,
+            double creation_time_ms)
+            = 0;
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy.
+//
+// Entries are distributed across `n_shards` shards by the key hash. Each shard
+// has its own lock, so concurrent lookups of different keys don't contend on
+// a single mutex. The capacity is shared by all shards: the cache size is
+// tracked globally and the least recently used entry across all shards is
+// evicted when the capacity is exceeded.
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
@@ -129,23 +139,31 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    lru_cache_t(int capacity)
+        : capacity_(capacity)
+        , size_(0)
+        , hits_(0)
+        , misses_(0)
+        , evictions_(0)
+        , creation_time_saved_ns_(0) {}
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        if (size_ == 0) return;
 
         if (!is_destroying_cache_safe()) {
             // It is safe to remove those entries that are not affected by the
             // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &shard : shards_) {
+                for (auto it = shard.mapper_.begin();
+                        it != shard.mapper_.end();) {
+                    if (!it->first.has_runtime_dependencies()) {
+                        it = shard.mapper_.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
+                release_cache(shard);
             }
-            release_cache();
             return;
         }
     }
@@ -153,93 +171,140 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     cache_object_t get(const key_t &key) override {
         value_t e;
         {
-            utils::lock_read_t lock_r(this->rw_mutex());
+            auto &shard = get_shard(key);
+            utils::lock_read_t lock_r(shard.rw_mutex_);
             if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            e = get_future(shard, key);
         }
 
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    };
+    int get_capacity() const override { return capacity_; };
 
     status_t set_capacity(int capacity) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
         capacity_ = capacity;
         // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
-            // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
-            evict(n_excess_entries);
-        }
+        evict_excess();
         return status::success;
     }
-    void set_capacity_without_clearing(int capacity) {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+    void set_capacity_without_clearing(int capacity) { capacity_ = capacity; }
+
+    int get_size() const override { return size_; }
+
+    dnnl_cache_stats_t get_stats() const override {
+        dnnl_cache_stats_t stats;
+        stats.hits = hits_;
+        stats.misses = misses_;
+        stats.evictions = evictions_;
+        stats.creation_time_saved_ms = 1e-6 * creation_time_saved_ns_;
+        return stats;
     }
 
-    int get_size() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+    // Calls `f(key, object)` for every entry whose object has been created
+    // successfully. Entries that are still being created are skipped. A read
+    // lock of the visited shard is held while `f` runs, hence `f` must not
+    // access the cache.
+    template <typename F>
+    void for_each_ready(const F &f) {
+        for (auto &shard : shards_) {
+            utils::lock_read_t lock_r(shard.rw_mutex_);
+            for (const auto &kv : shard.mapper_) {
+                const auto &value = kv.second.value_;
+                if (value.wait_for(std::chrono::seconds(0))
+                        != std::future_status::ready)
+                    continue;
+                const auto &cv = value.get();
+                if (cv.is_empty()) continue;
+                f(kv.first, cv.get_value());
+            }
+        }
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
-
     value_t get_or_add(const key_t &key, const value_t &value) override {
+        auto &shard = get_shard(key);
         {
             // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
+            utils::lock_read_t lock_r(shard.rw_mutex_);
             // Check if the cache is enabled.
             if (capacity_ == 0) { return value_t(); }
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
-            auto e = get_future(key);
+            auto e = get_future(shard, key, true);
             if (e.valid()) { return e; }
         }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
-        // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
-
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
-        if (!e.valid()) {
+        value_t e;
+        {
+            utils::lock_write_t lock_w(shard.rw_mutex_);
+            // 2. Section with exclusive access (write lock).
+            // In a multithreaded scenario, in the context of one thread the
+            // shard may have changed by another thread between releasing the
+            // read lock and acquiring the write lock (a.k.a. ABA problem),
+            // therefore additional checks have to be performed for
+            // correctness. Double check the capacity due to possible race
+            // condition
+            if (capacity_ == 0) { return value_t(); }
+
+            // Double check if the requested entry is present in the cache
+            // (unlikely cache_hit).
+            e = get_future(shard, key, true);
+            if (e.valid()) return e;
+
             // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+            add(shard, key, value);
+            misses_++;
         }
+        // The eviction locks other shards, hence it's performed after the
+        // shard lock is released to avoid lock order inversion.
+        evict_excess();
         return e;
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &shard = get_shard(key);
+        utils::lock_write_t lock_w(shard.rw_mutex_);
 
         if (capacity_ == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto it = shard.mapper_.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == shard.mapper_.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        erase(shard, it);
     }
 
 private:
+    static constexpr int n_shards = 16;
+
+    struct timed_entry_t {
+        value_t value_;
+        std::atomic<size_t> timestamp_;
+        // Time it took to create the object, used to account the time saved
+        // on cache hits.
+        std::atomic<uint64_t> creation_time_ns_;
+        timed_entry_t(const value_t &value, size_t timestamp)
+            : value_(value), timestamp_(timestamp), creation_time_ns_(0) {}
+    };
+
+    // Each entry in the cache has a corresponding key and timestamp. NOTE:
+    // pairs that contain atomics cannot be stored in an unordered_map *as an
+    // element*, since it invokes the copy constructor of std::atomic, which is
+    // deleted.
+    using mapper_t = std::unordered_map<key_t, timed_entry_t>;
+
+    struct shard_t {
+        utils::rw_mutex_t rw_mutex_;
+        mapper_t mapper_;
+    };
+
     static size_t get_timestamp() {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
         return cpu::platform::get_timestamp();
@@ -248,13 +313,14 @@ private:
 #endif
     }
 
-    void update_entry(const key_t &key, const object_t &p) override {
-        // Cast to void as compilers may warn about comparing compile time
-        // constant function pointers with nullptr, as that is often not an
-        // intended behavior
-        if ((void *)key_merge == nullptr) return;
+    shard_t &get_shard(const key_t &key) {
+        return shards_[std::hash<key_t>()(key) % n_shards];
+    }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
+    void update_entry(const key_t &key, const object_t &p,
+            double creation_time_ms) override {
+        auto &shard = get_shard(key);
+        utils::lock_write_t lock_w(shard.rw_mutex_);
 
         if (capacity_ == 0) { return; }
 
@@ -263,104 +329,135 @@ private:
         //    by another thread
         // 2. After the requested entry had been evicted it was inserted again
         //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
+        auto it = shard.mapper_.find(key);
+        if (it == shard.mapper_.end()
                 || it->first.thread_id() != key.thread_id()) {
             return;
         }
 
+        it->second.creation_time_ns_.store(
+                static_cast<uint64_t>(1e6 * creation_time_ms),
+                std::memory_order_relaxed);
+
+        // Cast to void as compilers may warn about comparing compile time
+        // constant function pointers with nullptr, as that is often not an
+        // intended behavior
+        if ((void *)key_merge == nullptr) return;
         key_merge(it->first, p);
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    static typename mapper_t::iterator get_lru_entry(mapper_t &mapper) {
+        using v_t = typename mapper_t::value_type;
+        // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
+        // maybe evict multiple entries at once.
+        return std::min_element(mapper.begin(), mapper.end(),
+                [&](const v_t &left, const v_t &right) {
+                    // By default, load() and operator T use sequentially
+                    // consistent memory ordering, which enforces writing the
+                    // timestamps into registers in the same exact order they
+                    // are read from the CPU cache line. Since the order is not
+                    // important for the eviction, we can safely use the
+                    // weakest memory ordering (relaxed). This brings about a
+                    // few microseconds performance improvement for default
+                    // cache capacity.
+                    return left.second.timestamp_.load(
+                                   std::memory_order_relaxed)
+                            < right.second.timestamp_.load(
+                                    std::memory_order_relaxed);
+                });
+    }
 
-        if (n == capacity_) {
-            cache_mapper().clear();
+    // Evicts the least recently used entries until the cache size fits the
+    // capacity. Shards are locked one at a time, therefore concurrent
+    // insertions may exceed the capacity for a short period of time.
+    void evict_excess() {
+        if (size_ <= capacity_) return;
+
+        if (capacity_ == 0) {
+            for (auto &shard : shards_) {
+                utils::lock_write_t lock_w(shard.rw_mutex_);
+                size_ -= (int)shard.mapper_.size();
+                evictions_ += shard.mapper_.size();
+                shard.mapper_.clear();
+            }
             return;
         }
 
-        for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                        // By default, load() and operator T use sequentially
-                        // consistent memory ordering, which enforces writing
-                        // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
-                        // microseconds performance improvement for default
-                        // cache capacity.
-                        return left.second.timestamp_.load(
-                                       std::memory_order_relaxed)
-                                < right.second.timestamp_.load(
-                                        std::memory_order_relaxed);
-                    });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
+        while (size_ > capacity_) {
+            // Find the shard with the smallest timestamp.
+            shard_t *victim = nullptr;
+            size_t victim_timestamp = 0;
+            for (auto &shard : shards_) {
+                utils::lock_read_t lock_r(shard.rw_mutex_);
+                if (shard.mapper_.empty()) continue;
+                const size_t timestamp
+                        = get_lru_entry(shard.mapper_)
+                                  ->second.timestamp_.load(
+                                          std::memory_order_relaxed);
+                if (!victim || timestamp < victim_timestamp) {
+                    victim = &shard;
+                    victim_timestamp = timestamp;
+                }
+            }
+            if (!victim) return;
+
+            utils::lock_write_t lock_w(victim->rw_mutex_);
+            // The size might have been changed by another thread.
+            if (victim->mapper_.empty() || size_ <= capacity_) continue;
+            erase(*victim, get_lru_entry(victim->mapper_));
+            evictions_++;
         }
     }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
-            evict(1);
-        }
 
+    void add(shard_t &shard, const key_t &key, const value_t &value) {
         size_t timestamp = get_timestamp();
 
-        auto res = cache_mapper().emplace(std::piecewise_construct,
+        auto res = shard.mapper_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(key),
                 std::forward_as_tuple(value, timestamp));
         MAYBE_UNUSED(res);
         assert(res.second);
+        size_++;
+    }
+
+    void erase(shard_t &shard, typename mapper_t::iterator it) {
+        shard.mapper_.erase(it);
+        size_--;
     }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
+
+    value_t get_future(
+            shard_t &shard, const key_t &key, bool count_hit = false) {
+        auto it = shard.mapper_.find(key);
+        if (it == shard.mapper_.end()) return value_t();
 
         size_t timestamp = get_timestamp();
         it->second.timestamp_.store(timestamp);
+        if (count_hit) {
+            hits_++;
+            creation_time_saved_ns_.fetch_add(
+                    it->second.creation_time_ns_.load(
+                            std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+        }
         // Return the entry
         return it->second.value_;
     }
 
-    int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
-    };
-
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
-    }
-
     // Leaks cached resources. Used to avoid issues with calling destructors
     // allocated by an already unloaded dynamic library.
-    void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
+    static void release_cache(shard_t &shard) {
+        auto t = utils::make_unique<mapper_t>();
+        std::swap(*t, shard.mapper_);
         t.release();
     }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+
+    std::atomic<int> capacity_;
+    std::atomic<int> size_;
+    std::atomic<int64_t> hits_;
+    std::atomic<int64_t> misses_;
+    std::atomic<int64_t> evictions_;
+    std::atomic<uint64_t> creation_time_saved_ns_;
+    shard_t shards_[n_shards];
 };
 
 } // namespace utils
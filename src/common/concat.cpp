@@ -20,6 +20,7 @@
 
 #include "c_types_map.hpp"
 #include "concat_pd.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -51,14 +52,24 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
         attr = &default_attr();
     else {
         using smask_t = primitive_attr_t::skip_mask_t;
-        VCHECK_CONCAT_UNIMPL(attr->has_default_values(smask_t::scales_runtime),
+        VCHECK_CONCAT_UNIMPL(
+                attr->has_default_values(smask_t::scales_runtime
+                        | smask_t::zero_points_runtime),
                 VERBOSE_UNSUPPORTED_ATTR);
         const auto &scales = attr->scales_;
         if (!scales.has_default_values())
             for (const auto &s : scales.scales_)
                 VCHECK_CONCAT_UNIMPL(
                         s.second.mask_ == 0, VERBOSE_UNSUPPORTED_SCALES_CFG);
+        // Only a common destination zero point is supported, it is applied
+        // together with the scales while the inputs are copied.
+        const auto &zp = attr->zero_points_;
+        VCHECK_CONCAT_UNIMPL(zp.has_default_values(DNNL_ARG_SRC)
+                        && zp.has_default_values(DNNL_ARG_WEIGHTS)
+                        && zp.common(DNNL_ARG_DST),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
     }
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
 
     const int ndims = src_mds[0]->ndims;
     const dims_t &dims = src_mds[0]->dims;
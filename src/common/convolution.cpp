@@ -172,6 +172,17 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
                     |= smask_t::scales_runtime | smask_t::zero_points_runtime |
                         smask_t::input_zero_points | smask_t::output_compensations |
                         smask_t::weights_zero_points;
+        // Weights decompression: integer weights with a floating-point source
+        // take weights scales and zero points.
+        const data_type_t wei_dt = desc.weights_desc.data_type;
+        const bool is_wei_decomp = engine->kind() == engine_kind::cpu
+                && utils::one_of(src_dt, data_type::f32, data_type::bf16)
+                && utils::one_of(wei_dt, data_type::s8, data_type::u8,
+                        data_type::s4, data_type::u4);
+        if (is_wei_decomp)
+            fwd_attr_mask |= smask_t::scales_runtime
+                    | smask_t::zero_points_runtime
+                    | smask_t::zero_points_runtime_data_type;
 
         VCHECK_CONV_UNIMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
@@ -192,11 +203,15 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         // Check zero points
         if (!attr->zero_points_.has_default_values()) {
             const auto &zp = attr->zero_points_;
-            int mask_src = 0, mask_dst = 0;
+            int mask_src = 0, mask_wei = 0, mask_dst = 0;
             zp.get(DNNL_ARG_SRC, &mask_src);
+            zp.get(DNNL_ARG_WEIGHTS, &mask_wei);
             zp.get(DNNL_ARG_DST, &mask_dst);
 
-            VCHECK_CONV_UNIMPL(zp.has_default_values(DNNL_ARG_WEIGHTS)
+            VCHECK_CONV_UNIMPL((zp.has_default_values(DNNL_ARG_WEIGHTS)
+                                       || (is_wei_decomp
+                                               && utils::one_of(
+                                                       mask_wei, 0, 1)))
                             && (mask_src == 0 || mask_src == 1 << 1)
                             && (mask_dst == 0 || mask_dst == 1 << 1),
                     VERBOSE_UNSUPPORTED_ZP_CFG);
@@ -206,8 +221,9 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         if (!attr->post_ops_.has_default_values()) {
             const auto &po = attr->post_ops_;
             using namespace primitive_kind;
-            VCHECK_CONV_UNIMPL(po.has_default_values({binary, eltwise, prelu,
-                                       sum, convolution, depthwise, quantization}),
+            VCHECK_CONV_UNIMPL(
+                    po.has_default_values({binary, eltwise, prelu, sum,
+                            convolution, depthwise, quantization, pooling}),
                     VERBOSE_UNSUPPORTED_POSTOP);
 
             // Check sum
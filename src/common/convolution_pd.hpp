@@ -89,6 +89,11 @@ struct convolution_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    double flops() const override {
+        return 2.0 * MB() * OC() * (IC() / G()) * OD() * OH() * OW() * KD()
+                * KH() * KW();
+    }
+
     /* common conv aux functions */
 
     dim_t MB() const { return invariant_src_md()->dims[0]; }
@@ -1881,6 +1881,7 @@ const char *dnnl_rnn_direction2str(dnnl_rnn_direction_t v) {
 const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     if (v == dnnl_scratchpad_mode_library) return "library";
     if (v == dnnl_scratchpad_mode_user) return "user";
+    if (v == dnnl_scratchpad_mode_shared) return "shared";
     assert(!"unknown scratchpad_mode");
     return "unknown scratchpad_mode";
 }
@@ -1908,6 +1909,7 @@ const char *dnnl_cpu_isa2str(dnnl_cpu_isa_t v) {
 const char *dnnl_cpu_isa_hints2str(dnnl_cpu_isa_hints_t v) {
     if (v == dnnl_cpu_isa_no_hints) return "cpu_isa_no_hints";
     if (v == dnnl_cpu_isa_prefer_ymm) return "cpu_isa_prefer_ymm";
+    if (v == dnnl_cpu_isa_prefer_ymm_auto) return "cpu_isa_prefer_ymm_auto";
     assert(!"unknown cpu_isa_hints");
     return "unknown cpu_isa_hints";
 }
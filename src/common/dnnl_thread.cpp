@@ -1,6 +1,9 @@
+#include <atomic>
 #include <functional>
 
+#include "cpu/platform.hpp"
 #include "dnnl_thread.hpp"
+#include "thread_trace.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
 #include "common/ittnotify.hpp"
@@ -13,8 +16,8 @@
 namespace dnnl {
 namespace impl {
 
-void parallel(int nthr, const std::function<void(int, int)> &f) {
-    nthr = adjust_num_threads(nthr, INT64_MAX);
+namespace {
+void parallel_impl(int nthr, const std::function<void(int, int)> &f) {
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
         f(i, nthr);
@@ -83,7 +86,15 @@ void parallel(int nthr, const std::function<void(int, int)> &f) {
                 if (itt_enable) itt::primitive_task_start(task_primitive_kind);
 #endif
             }
+            // A closure may run on a thread which is already inside of another
+            // closure (of an outer region of the user) when the threadpool
+            // supports nested parallelism.
+            bool &in_parallel_region
+                    = threadpool_utils::get_threadlocal_in_parallel_region();
+            const bool was_in_parallel_region = in_parallel_region;
+            in_parallel_region = true;
             f(ithr, nthr);
+            in_parallel_region = was_in_parallel_region;
             if (!is_master) {
 #if defined(DNNL_ENABLE_ITT_TASKS)
                 if (itt_enable) itt::primitive_task_end();
@@ -97,6 +108,70 @@ void parallel(int nthr, const std::function<void(int, int)> &f) {
 #endif
 #endif
 }
+} // namespace
+
+void parallel(int nthr, const std::function<void(int, int)> &f) {
+    nthr = adjust_num_threads(nthr, INT64_MAX);
+    if (!thread_trace::is_enabled()) {
+        parallel_impl(nthr, f);
+        return;
+    }
+
+    // Chunks are attributed to the primitive of the calling thread.
+    const char *primitive = thread_trace::current_primitive();
+    parallel_impl(nthr, [&](int ithr, int nthr) {
+        thread_trace::event_scope_t scope("parallel",
+                primitive ? primitive : "parallel", primitive, ithr, nthr);
+        f(ithr, nthr);
+    });
+}
+
+namespace {
+void parallel_dynamic(dim_t work_amount, const std::function<void(dim_t)> &f) {
+    const int nthr = adjust_num_threads(
+            dnnl_get_current_num_threads(), work_amount);
+    if (nthr == 0) return;
+
+    // A few chunks per thread keep the counter contention low while still
+    // letting faster threads pick up the remaining work.
+    const dim_t chunks_per_thr = 8;
+    const dim_t chunk = nstl::max(
+            (dim_t)1, utils::div_up(work_amount, nthr * chunks_per_thr));
+    std::atomic<dim_t> next {0};
+    parallel(nthr, [&](int, int) {
+        for (;;) {
+            const dim_t start = next.fetch_add(chunk);
+            if (start >= work_amount) break;
+            const dim_t end = nstl::min(start + chunk, work_amount);
+            for (dim_t iwork = start; iwork < end; ++iwork)
+                f(iwork);
+        }
+    });
+}
+
+bool use_dynamic_schedule(dynamic_schedule_t schedule) {
+    return schedule == dynamic_schedule_t::always || cpu::platform::is_hybrid();
+}
+} // namespace
+
+void parallel_nd_dynamic(dim_t D0, const std::function<void(dim_t)> &f,
+        dynamic_schedule_t schedule) {
+    if (!use_dynamic_schedule(schedule)) {
+        parallel_nd(D0, f);
+        return;
+    }
+    parallel_dynamic(D0, f);
+}
+
+void parallel_nd_dynamic(dim_t D0, dim_t D1,
+        const std::function<void(dim_t, dim_t)> &f,
+        dynamic_schedule_t schedule) {
+    if (!use_dynamic_schedule(schedule)) {
+        parallel_nd(D0, D1, f);
+        return;
+    }
+    parallel_dynamic(D0 * D1, [&](dim_t iwork) { f(iwork / D1, iwork % D1); });
+}
 
 } // namespace impl
 } // namespace dnnl
@@ -52,6 +52,46 @@
 #include "common/ittnotify.hpp"
 #endif
 
+namespace dnnl {
+namespace impl {
+
+// Returns the limit on the number of threads for the work submitted by the
+// calling thread. The limit comes from the max_threads primitive attribute and
+// is set for the time of primitive creation and execution. 0 means no limit.
+inline int &get_threadlocal_max_threads_limit() {
+    static thread_local int max_threads_limit = 0;
+    return max_threads_limit;
+}
+
+inline int apply_max_threads_limit(int nthr) {
+    const int limit = get_threadlocal_max_threads_limit();
+    return limit > 0 ? std::min(nthr, limit) : nthr;
+}
+
+// Lowers the limit on the number of threads of the calling thread to
+// `max_threads` (if it is positive) for the lifetime of the object.
+struct max_threads_limit_guard_t {
+    max_threads_limit_guard_t(int max_threads)
+        : saved_limit_(get_threadlocal_max_threads_limit()) {
+        if (max_threads > 0)
+            get_threadlocal_max_threads_limit()
+                    = apply_max_threads_limit(max_threads);
+    }
+    ~max_threads_limit_guard_t() {
+        get_threadlocal_max_threads_limit() = saved_limit_;
+    }
+
+    max_threads_limit_guard_t(const max_threads_limit_guard_t &) = delete;
+    max_threads_limit_guard_t &operator=(const max_threads_limit_guard_t &)
+            = delete;
+
+private:
+    int saved_limit_;
+};
+
+} // namespace impl
+} // namespace dnnl
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -66,7 +106,7 @@ inline void dnnl_thr_barrier() {}
 #include "omp.h"
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
-    return omp_get_max_threads();
+    return dnnl::impl::apply_max_threads_limit(omp_get_max_threads());
 }
 inline int dnnl_in_parallel() {
     return omp_in_parallel();
@@ -80,7 +120,8 @@ inline void dnnl_thr_barrier() {
 #include "tbb/task_arena.h"
 #define DNNL_THR_SYNC 0
 inline int dnnl_get_max_threads() {
-    return tbb::this_task_arena::max_concurrency();
+    return dnnl::impl::apply_max_threads_limit(
+            tbb::this_task_arena::max_concurrency());
 }
 inline int dnnl_in_parallel() {
     return 0;
@@ -121,6 +162,13 @@ int get_max_concurrency();
 
 int &get_threadlocal_max_concurrency();
 
+// Returns true if the calling thread executes a closure of a parallel region
+// created by the library.
+inline bool &get_threadlocal_in_parallel_region() {
+    static thread_local bool in_parallel_region = false;
+    return in_parallel_region;
+}
+
 } // namespace threadpool_utils
 } // namespace impl
 } // namespace dnnl
@@ -134,12 +182,19 @@ inline int dnnl_get_max_threads() {
 
     // Use the default max_concurrency only when no tp is passed by
     // user (e.g. primitive creation).
-    return tp ? std::max(1, tp->get_num_threads()) : max_concurrency;
+    return dnnl::impl::apply_max_threads_limit(
+            tp ? std::max(1, tp->get_num_threads()) : max_concurrency);
 }
 inline int dnnl_in_parallel() {
     using namespace dnnl::impl::threadpool_utils;
-    dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
-    return tp ? tp->get_in_parallel() : 0;
+    using dnnl::threadpool_interop::threadpool_iface;
+    threadpool_iface *tp = get_active_threadpool();
+    if (!tp) return 0;
+    // With nested parallelism only the library parallel regions count, so
+    // that primitives executed from within the user tasks are parallelized.
+    if (tp->get_flags() & threadpool_iface::NESTED_PARALLELISM)
+        return get_threadlocal_in_parallel_region();
+    return tp->get_in_parallel();
 }
 inline void dnnl_thr_barrier() {
     assert(!"no barrier with THREADPOOL");
@@ -161,10 +216,9 @@ inline void dnnl_thr_barrier() {
  */
 inline int dnnl_get_current_num_threads() {
     if (dnnl_in_parallel()) return 1;
-#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    return omp_get_max_threads();
-#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
-    return tbb::this_task_arena::max_concurrency();
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    return dnnl_get_max_threads();
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
@@ -277,6 +331,9 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd, but with
+ *                                         dynamic scheduling on hybrid CPUs or
+ *                                         for irregular work items
  */
 
 /* general parallelization */
@@ -289,6 +346,32 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 #endif
 }
 
+// Estimated cost of a whole parallel job.
+struct parallel_cost_t {
+    // Bytes read and written.
+    size_t bytes = 0;
+    // Arithmetic operations.
+    size_t ops = 0;
+};
+
+// Cost-aware version of adjust_num_threads() for jobs which take only a few
+// microseconds, e.g. small eltwise or binary primitives. Such jobs are run
+// inline when the fork/join overhead outweighs the work, and otherwise use
+// only as many threads as can each get more work than the overhead.
+inline int adjust_num_threads(
+        int nthr, dim_t work_amount, const parallel_cost_t &cost) {
+    nthr = adjust_num_threads(nthr, work_amount);
+    if (nthr <= 1) return nthr;
+    // Rough single-thread throughput and fork/join overhead of a parallel
+    // region with a warm thread team.
+    constexpr size_t bytes_per_ns = 16;
+    constexpr size_t ops_per_ns = 16;
+    constexpr size_t fork_join_ns = 2000;
+    const size_t cost_ns = cost.bytes / bytes_per_ns + cost.ops / ops_per_ns;
+    const size_t max_nthr = cost_ns / fork_join_ns;
+    return (int)std::max<size_t>(1, std::min<size_t>(nthr, max_nthr));
+}
+
 void DNNL_API parallel(int nthr, const std::function<void(int, int)> &f);
 
 // XXX: IMPORTANT!!!
@@ -579,6 +662,27 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         });
 }
 
+/* parallel_nd_dynamic section */
+// Opt-in variants of parallel_nd(). With dynamic scheduling the iteration
+// space is handed out in chunks from a shared counter, so that threads which
+// finish early (e.g. running on faster cores or getting cheaper work items)
+// process a larger share of it instead of waiting for the slowest thread.
+enum class dynamic_schedule_t {
+    // Work items of similar cost: dynamic scheduling on hybrid CPUs only,
+    // the same static split as parallel_nd() elsewhere.
+    hybrid,
+    // Work items of irregular cost (e.g. rows of a sparse tensor): dynamic
+    // scheduling on all CPUs.
+    always,
+};
+
+void DNNL_API parallel_nd_dynamic(dim_t D0,
+        const std::function<void(dim_t)> &f,
+        dynamic_schedule_t schedule = dynamic_schedule_t::hybrid);
+void DNNL_API parallel_nd_dynamic(dim_t D0, dim_t D1,
+        const std::function<void(dim_t, dim_t)> &f,
+        dynamic_schedule_t schedule = dynamic_schedule_t::hybrid);
+
 template <typename F>
 void parallel_legacy(int nthr, F f) {
     nthr = adjust_num_threads(nthr, INT64_MAX);
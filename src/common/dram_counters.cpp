@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+#include "utils.hpp"
+
+#include "dram_counters.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace dram_counters {
+
+namespace {
+#ifdef __linux__
+// Every CAS command transfers one 64-byte cache line.
+constexpr uint64_t cas_bytes = 64;
+
+bool read_line(const std::string &path, std::string &line) {
+    std::ifstream ifs(path);
+    return ifs && std::getline(ifs, line);
+}
+
+// Parses `event=0x04,umask=0x03` with the layout of the IMC PMU format:
+// event in bits 0-7 and umask in bits 8-15 of the config.
+bool parse_event(const std::string &str, uint64_t &config) {
+    config = 0;
+    std::stringstream ss(str);
+    std::string term;
+    while (std::getline(ss, term, ',')) {
+        const auto pos = term.find('=');
+        if (pos == std::string::npos) return false;
+        const auto key = term.substr(0, pos);
+        const uint64_t val = std::stoull(term.substr(pos + 1), nullptr, 0);
+        if (key == "event")
+            config |= val & 0xff;
+        else if (key == "umask")
+            config |= (val & 0xff) << 8;
+        else
+            return false;
+    }
+    return true;
+}
+
+// Returns the first CPU of every range in `0,28-29`: one per socket.
+std::vector<int> parse_cpumask(const std::string &str) {
+    std::vector<int> cpus;
+    std::stringstream ss(str);
+    std::string range;
+    while (std::getline(ss, range, ','))
+        cpus.push_back(std::stoi(range));
+    return cpus;
+}
+
+struct counters_t {
+    counters_t() {
+        if (getenv_int_user("VERBOSE_DRAM_COUNTERS", 0) <= 0) return;
+
+        const std::string root = "/sys/bus/event_source/devices/";
+        DIR *dir = opendir(root.c_str());
+        if (!dir) return;
+        while (struct dirent *entry = readdir(dir)) {
+            const std::string name = entry->d_name;
+            // Skip the free running counters which have no CAS events.
+            if (name.compare(0, 11, "uncore_imc_") != 0
+                    || name.find("free_running") != std::string::npos)
+                continue;
+            try {
+                open_pmu(root + name + "/");
+            } catch (...) {}
+        }
+        closedir(dir);
+    }
+
+    ~counters_t() {
+        for (int fd : fds_)
+            close(fd);
+    }
+
+    void open_pmu(const std::string &path) {
+        std::string type, cpumask;
+        if (!read_line(path + "type", type)
+                || !read_line(path + "cpumask", cpumask))
+            return;
+
+        for (const char *event : {"cas_count_read", "cas_count_write"}) {
+            std::string str;
+            uint64_t config = 0;
+            if (!read_line(path + "events/" + event, str)
+                    || !parse_event(str, config))
+                continue;
+            for (int cpu : parse_cpumask(cpumask)) {
+                perf_event_attr attr = {};
+                attr.size = sizeof(attr);
+                attr.type = static_cast<uint32_t>(std::stoul(type));
+                attr.config = config;
+                const long fd = syscall(
+                        __NR_perf_event_open, &attr, -1, cpu, -1, 0);
+                if (fd >= 0) fds_.push_back(static_cast<int>(fd));
+            }
+        }
+    }
+
+    uint64_t get_bytes() const {
+        uint64_t cas = 0;
+        for (int fd : fds_) {
+            uint64_t count = 0;
+            if (read(fd, &count, sizeof(count)) == sizeof(count))
+                cas += count;
+        }
+        return cas * cas_bytes;
+    }
+
+    std::vector<int> fds_;
+};
+#else
+struct counters_t {
+    uint64_t get_bytes() const { return 0; }
+
+    std::vector<int> fds_;
+};
+#endif
+
+const counters_t &counters() {
+    static const counters_t instance;
+    return instance;
+}
+} // namespace
+
+bool is_enabled() {
+    return !counters().fds_.empty();
+}
+
+uint64_t get_bytes() {
+    return counters().get_bytes();
+}
+
+} // namespace dram_counters
+} // namespace impl
+} // namespace dnnl
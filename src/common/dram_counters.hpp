@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DRAM_COUNTERS_HPP
+#define COMMON_DRAM_COUNTERS_HPP
+
+#include <cstdint>
+
+namespace dnnl {
+namespace impl {
+namespace dram_counters {
+
+// DRAM traffic measured with the uncore memory controller (IMC) CAS counters
+// of the Linux perf_event interface. Enabled by ONEDNN_VERBOSE_DRAM_COUNTERS=1.
+// The counters are system-wide, so the traffic of other processes is counted
+// as well, and opening them requires perf_event_paranoid <= 0 or CAP_PERFMON.
+
+// Returns `true` if the counters were requested and could be opened.
+bool is_enabled();
+
+// Returns the number of bytes read from and written to DRAM by all memory
+// controllers since the counters were opened.
+uint64_t get_bytes();
+
+} // namespace dram_counters
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -108,6 +108,26 @@ status_t dnnl_engine_create(
     }
 }
 
+status_t dnnl_cpu_engine_create_with_allocator(engine_t **engine,
+        dnnl_cpu_allocate_f cpu_malloc, dnnl_cpu_deallocate_f cpu_free) {
+    using namespace dnnl::impl;
+    VERROR_ENGINE(!any_null(engine, cpu_malloc, cpu_free), invalid_arguments,
+            VERBOSE_NULL_ARG);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#if DNNL_USE_ACL
+    dnnl::impl::cpu::acl::acl_thread_utils::set_acl_threading();
+#endif
+    return safe_ptr_assign<engine_t>(
+            *engine, new cpu::cpu_engine_t(cpu_malloc, cpu_free));
+#else
+    UNUSED(cpu_malloc);
+    UNUSED(cpu_free);
+    VERROR(common, runtime, VERBOSE_INVALID_ENGINE_KIND,
+            dnnl_engine_kind2str(engine_kind::cpu));
+    return invalid_arguments;
+#endif
+}
+
 status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     using namespace dnnl::impl;
     if (engine == nullptr) return invalid_arguments;
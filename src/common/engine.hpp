@@ -65,6 +65,15 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     /** get index of the current engine */
     size_t index() const { return index_; }
 
+    /** return true if primitives created for the engine can be stored to
+     * and restored from a cache blob */
+    bool is_cache_blob_supported() const {
+        using namespace dnnl::impl;
+        if (kind_ == engine_kind::gpu)
+            return runtime_kind_ == runtime_kind::ocl;
+        return kind_ == engine_kind::cpu && runtime_kind_ != runtime_kind::sycl;
+    }
+
     virtual dnnl::impl::device_id_t device_id() const = 0;
 
     virtual dnnl::impl::engine_id_t engine_id() const = 0;
@@ -130,6 +139,11 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
 
     virtual bool mayiuse_f16_accumulator_with_f16() const { return false; }
 
+    // Returns true if the engine allocates memory through user-provided
+    // call-back functions. Memory of such engines is never shared with other
+    // engines, e.g. through a global scratchpad.
+    virtual bool has_user_allocator() const { return false; }
+
 #ifdef ONEDNN_BUILD_GRAPH
     /** only used in graph implementation **/
     void *get_allocator() const { return (void *)(&allocator_); };
@@ -25,6 +25,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -68,7 +69,8 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
 #endif
 
 #define MAYBE_VERBOSE(status, sdt_, wdt_, ddt_, ...) \
-    if (get_verbose(verbose_t::exec_profile, component_t::gemm_api)) { \
+    if (get_verbose(verbose_t::exec_profile, component_t::gemm_api) \
+            && get_verbose_exec_sampled()) { \
         double start_ms = get_msec(); \
         status = __VA_ARGS__; \
         double duration_ms = get_msec() - start_ms; \
@@ -89,7 +91,7 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
         if (beta != 0.f) ss << "attr-post-ops:sum:" << beta << " "; \
         ss << ",," << get_descriptor(M, N, K); \
         VPROF(start_ms, primitive, exec, VERBOSE_profile, ss.str().c_str(), \
-                duration_ms); \
+                duration_ms, 0, 2.0 * M * N * K); \
     } else { \
         status = __VA_ARGS__; \
     }
@@ -109,6 +111,56 @@ dnnl_status_t dnnl_sgemm(char transa, char transb, dim_t M, dim_t N, dim_t K,
 #endif
 }
 
+// The internal packing routines are column-major, so as in dnnl_sgemm() the
+// row-major problem is solved as C**T = op(B)**T * op(A)**T: A and B, M and
+// N, and the related parameters swap places.
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr
+            || !utils::one_of(identifier, 'A', 'a', 'B', 'b'))
+        return dnnl::impl::status::invalid_arguments;
+    const char *c_identifier
+            = utils::one_of(identifier, 'A', 'a') ? "B" : "A";
+    return cpu::sgemm_pack_get_size(c_identifier, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        float *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (!utils::one_of(identifier, 'A', 'a', 'B', 'b'))
+        return dnnl::impl::status::invalid_arguments;
+    const char *c_identifier
+            = utils::one_of(identifier, 'A', 'a') ? "B" : "A";
+    return cpu::sgemm_pack(c_identifier, &transb, &transa, &N, &M, &K, &ldb,
+            &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const float *A, dim_t lda, const float *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    const float alpha = 1.f;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_compute, cpu::sgemm_compute,
+                    &transb, &transa, &N, &M, &K, B, &ldb, A, &lda, &beta, C,
+                    &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 dnnl_status_t dnnl_gemm_u8s8s32(char transa, char transb, char offsetc, dim_t M,
         dim_t N, dim_t K, float alpha, const uint8_t *A, dim_t lda, uint8_t ao,
         const int8_t *B, dim_t ldb, int8_t bo, float beta, int32_t *C,
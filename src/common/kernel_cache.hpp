@@ -125,6 +125,7 @@ struct iface_t {
     status_t set_capacity(int capacity);
     int get_capacity() const;
     int get_size() const;
+    dnnl_cache_stats_t get_stats() const;
 
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context);
@@ -98,6 +98,8 @@ struct matmul_pd_t : public primitive_desc_t {
     }
     int n_outputs() const override { return 1; }
 
+    double flops() const override { return 2.0 * batch() * M() * N() * K(); }
+
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(src_md(0)).has_zero_dim()
                 || memory_desc_wrapper(weights_md(0)).has_zero_dim()
@@ -200,6 +200,7 @@ enum {
     key_conv_gemm_col,
     key_conv_gemm_imtr,
     key_conv_gemm_zp_src_comp,
+    key_conv_grouped_weights,
     key_conv_int_dat_in_acc_dt,
     key_conv_padded_bias,
     key_conv_rtus_space,
@@ -229,6 +230,7 @@ enum {
     key_gemm_blocked_b,
     key_gemm_accumulator,
     key_gnorm_cvt,
+    key_gnorm_pivot,
     key_gnorm_reduction,
     key_gnorm_tmp_mean,
     key_gnorm_tmp_var,
@@ -287,6 +289,7 @@ enum {
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_sum_srcs_ptrs,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -146,13 +146,31 @@ status_t pooling_attr_check(const pooling_desc_t &desc, const engine_t *engine,
     // Check attributes
     if (utils::one_of(desc.prop_kind, prop_kind::forward_inference,
                 prop_kind::forward_training)) {
+        const data_type_t src_dt = desc.src_desc.data_type;
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
         auto fwd_attr_mask = smask_t::post_ops;
 
+        const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
+                || utils::one_of(dst_dt, data_type::s8, data_type::u8);
+        if (is_int8) fwd_attr_mask |= smask_t::scales_runtime;
+
         VCHECK_POOLING_IMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
 
+        // Check scales
+        if (!attr->scales_.has_default_values()) {
+            const auto &sc = attr->scales_;
+            VCHECK_POOLING_IMPL(
+                    sc.has_default_values({DNNL_ARG_SRC, DNNL_ARG_DST}),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            const int mask_src = sc.get(DNNL_ARG_SRC).mask_;
+            const int mask_dst = sc.get(DNNL_ARG_DST).mask_;
+
+            VCHECK_POOLING_IMPL(utils::everyone_is(0, mask_src, mask_dst),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+        }
+
         // Check post-ops
         if (!attr->post_ops_.has_default_values()) {
             const auto &po = attr->post_ops_;
@@ -229,6 +229,22 @@ protected:
     memory_desc_t src_md_;
     memory_desc_t dst_md_;
 
+    bool attr_scales_ok() const {
+        using namespace data_type;
+        const auto &scales = attr()->scales_;
+        const std::vector<int> supported_args({DNNL_ARG_SRC, DNNL_ARG_DST});
+        bool ok = scales.has_default_values(supported_args);
+
+        for (const auto &arg : supported_args) {
+            const auto &sc = scales.get(arg);
+            if (!sc.has_default_values()) {
+                const data_type_t dt = arg_md(arg)->data_type;
+                ok = ok && utils::one_of(dt, s8, u8) && sc.mask_ == 0;
+            }
+        }
+        return ok;
+    }
+
     pooling_fwd_pd_t(const pooling_desc_t *adesc, const primitive_attr_t *attr,
             const pooling_fwd_pd_t *hint_fwd_pd)
         : pooling_pd_t(adesc, attr, hint_fwd_pd)
@@ -19,6 +19,7 @@
 #include <assert.h>
 
 #include "c_types_map.hpp"
+#include "cache_blob_store.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -41,6 +42,16 @@ using namespace dnnl::impl::primitive_kind;
 namespace dnnl {
 namespace impl {
 
+cache_blob_t primitive_t::get_stored_cache_blob(const primitive_desc_t *pd,
+        engine_t *engine, std::vector<uint8_t> &storage) {
+    const auto &store = global_cache_blob_store();
+    if (store.empty() || !engine->is_cache_blob_supported()) return {};
+
+    const auto &id = pd->get_cache_blob_id(engine);
+    if (!store.get(id, storage) || storage.empty()) return {};
+    return cache_blob_t(storage.data(), storage.size());
+}
+
 nested_scratchpad_t::nested_scratchpad_t(const exec_ctx_t &master_ctx, int key,
         const std::shared_ptr<primitive_t> &nested_p) {
     auto scratchpad = master_ctx.get_scratchpad_grantor();
@@ -33,6 +33,7 @@
 
 #include <future>
 #include <type_traits>
+#include <vector>
 
 namespace dnnl {
 namespace impl {
@@ -50,7 +51,9 @@ struct primitive_t : public c_compatible {
     status_t init(engine_t *engine, bool use_global_scratchpad,
             const cache_blob_t &cache_blob) {
         cache_blob_ = cache_blob;
+        jit_code_size_tracker_t code_size_tracker;
         CHECK(init(engine));
+        code_size_ = code_size_tracker.size();
         use_global_scratchpad_ = use_global_scratchpad;
         // The `cache_blob_` is no longer needed after primitive creation.
         cache_blob_ = cache_blob_t();
@@ -61,15 +64,15 @@ struct primitive_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // Not every CPU primitive supports cache blobs, hence the default
+    // implementation reports `unimplemented` rather than asserting.
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t get_cache_blob_size(engine_t *engine, size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t create_resource(
@@ -79,6 +82,9 @@ struct primitive_t : public c_compatible {
 
     bool use_global_scratchpad() const { return use_global_scratchpad_; }
     cache_blob_t cache_blob() const { return cache_blob_; }
+    // Returns the size of the JIT code generated by the primitive and its
+    // nested primitives.
+    size_t code_size() const { return code_size_; }
 
 protected:
     template <typename impl_type, typename pd_t>
@@ -102,21 +108,37 @@ protected:
 
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
+            // Only a primitive cache miss consults the ahead-of-time cache
+            // blob store, and only when the user didn't provide a blob.
+            std::vector<uint8_t> stored_blob;
+            const cache_blob_t cache_blob = c.cache_blob
+                    ? c.cache_blob
+                    : get_stored_cache_blob(c.pd, c.engine, stored_blob);
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
             status_t status
-                    = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
+                    = p->init(c.engine, c.use_global_scratchpad, cache_blob);
             c.is_create_called = true;
             return primitive_cache_iface_t::result_t {std::move(p), status};
         };
         auto result
                 = global_primitive_cache.get_or_create(key, *create, &context);
         primitive = {std::move(result.value), !context.is_create_called};
+        // A primitive taken from the cache doesn't generate code. Account its
+        // code to the primitive being created, if this one is nested.
+        if (primitive.second && primitive.first)
+            jit_code_size_tracker_t::add(primitive.first->code_size());
         return result.status;
     }
 
+    // Returns the blob of the ahead-of-time cache blob store for `pd`, or an
+    // empty blob. The blob data is kept in `storage`.
+    static cache_blob_t get_stored_cache_blob(const primitive_desc_t *pd,
+            engine_t *engine, std::vector<uint8_t> &storage);
+
     std::shared_ptr<primitive_desc_t> pd_;
     bool use_global_scratchpad_ = false;
     cache_blob_t cache_blob_;
+    size_t code_size_ = 0;
 
 private:
     primitive_t() = delete;
@@ -193,6 +193,7 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
     CHECK_MASK(smask_t::rnn_weights_projection_qparams,
             rnn_weights_projection_qparams_);
     CHECK_MASK(smask_t::src_dyn_quant_params, src_dyn_quant_params_);
+    CHECK_MASK(smask_t::softmax_params, softmax_params_);
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::sum_dt),
             post_ops_.sum_with_default_dt(dst_dt)));
     bool gpu_attr_ok = IMPLICATION((bool)(~mask & smask_t::gpu_attr),
@@ -227,6 +228,7 @@ bool primitive_attr_t::defined(dnnl_primitive_attr::skip_mask_t mask) const {
     CHECK_MASK(smask_t::rnn_weights_projection_qparams,
             rnn_weights_projection_qparams_);
     CHECK_MASK(smask_t::src_dyn_quant_params, src_dyn_quant_params_);
+    CHECK_MASK(smask_t::softmax_params, softmax_params_);
     return ok;
 #undef CHECK_MASK
 #undef CHECK_ARG
@@ -417,6 +419,28 @@ status_t post_ops_t::append_dw_conv(int in_h, int in_w, int ker_h, int ker_w, in
     return success;
 }
 
+status_t post_ops_t::append_pooling(alg_kind_t alg, dim_t in_h, dim_t in_w,
+        dim_t ker_h, dim_t ker_w) {
+    using namespace dnnl::impl::alg_kind;
+    if (len() == post_ops_limit) return out_of_memory;
+    const bool known_alg = one_of(alg, pooling_max, pooling_avg_include_padding,
+            pooling_avg_exclude_padding);
+    if (!known_alg) return invalid_arguments;
+    if (in_h < ker_h || in_w < ker_w || ker_h <= 0 || ker_w <= 0)
+        return invalid_arguments;
+
+    entry_.emplace_back();
+    auto &e = entry_.back();
+    e.kind = primitive_kind::pooling;
+    e.pooling.alg = alg;
+    e.pooling.in_h = in_h;
+    e.pooling.in_w = in_w;
+    e.pooling.ker_h = ker_h;
+    e.pooling.ker_w = ker_w;
+
+    return success;
+}
+
 bool post_ops_t::defined() const {
     for (int idx = 0; idx < len(); ++idx) {
         auto kind = entry_[idx].kind;
@@ -437,6 +461,8 @@ bool post_ops_t::defined() const {
             // quantization is always defined
         } else if (kind == primitive_kind::binarization) {
             // binarization is always defined
+        } else if (kind == primitive_kind::pooling) {
+            // pooling is always defined
         } else {
             assert(!"unreachable");
         }
@@ -535,7 +561,8 @@ status_t primitive_attr_t::set_scratchpad_mode(
     /* workaround for the name conflict with system struct 'user' in llvm-android toolchain */
     using namespace dnnl::impl::scratchpad_mode;
 
-    const bool ok = one_of(scratchpad_mode, scratchpad_mode::library, scratchpad_mode::user);
+    const bool ok = one_of(scratchpad_mode, scratchpad_mode::library,
+            scratchpad_mode::user, scratchpad_mode::shared);
     if (!ok) return invalid_arguments;
 
     scratchpad_mode_ = scratchpad_mode;
@@ -633,6 +660,54 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_max_threads(
+        const primitive_attr_t *attr, int *max_threads) {
+    if (any_null(attr, max_threads)) return invalid_arguments;
+    *max_threads = attr->max_threads_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_max_threads(
+        primitive_attr_t *attr, int max_threads) {
+    if (any_null(attr)) return invalid_arguments;
+    VCONDCHECK(primitive, create, check, attr, max_threads >= 0,
+            invalid_arguments, VERBOSE_BAD_PARAM, "max_threads");
+    attr->max_threads_ = max_threads;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_cpu_isa_hints(
+        const primitive_attr_t *attr, dnnl_cpu_isa_hints_t *isa_hints) {
+    if (any_null(attr, isa_hints)) return invalid_arguments;
+    *isa_hints = attr->cpu_isa_hints_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_cpu_isa_hints(
+        primitive_attr_t *attr, dnnl_cpu_isa_hints_t isa_hints) {
+    if (any_null(attr)) return invalid_arguments;
+    VCONDCHECK(primitive, create, check, attr,
+            one_of(isa_hints, dnnl_cpu_isa_no_hints, dnnl_cpu_isa_prefer_ymm,
+                    dnnl_cpu_isa_prefer_ymm_auto),
+            invalid_arguments, VERBOSE_BAD_PARAM, "isa_hints");
+    attr->cpu_isa_hints_ = isa_hints;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_scratchpad_limit(
+        const primitive_attr_t *attr, size_t *limit) {
+    if (any_null(attr, limit)) return invalid_arguments;
+    *limit = attr->scratchpad_limit_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_scratchpad_limit(
+        primitive_attr_t *attr, size_t limit) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->scratchpad_limit_ = limit;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -936,6 +1011,13 @@ status_t dnnl_post_ops_append_dw_conv(post_ops_t *post_ops,
     return post_ops->append_dw_conv(in_h, in_w, ker_h, ker_w, str_h, str_w, in_dt);
 }
 
+status_t dnnl_post_ops_append_pooling(post_ops_t *post_ops, alg_kind_t kind,
+        dim_t in_h, dim_t in_w, dim_t kernel_h, dim_t kernel_w) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_pooling(kind, in_h, in_w, kernel_h, kernel_w);
+}
+
 status_t dnnl_primitive_attr_set_rnn_data_qparams(
         primitive_attr_t *attr, const float scale, const float shift) {
     if (attr == nullptr) return invalid_arguments;
@@ -1019,6 +1101,22 @@ status_t dnnl_primitive_attr_get_src_dyn_quant_params(
     return success;
 }
 
+status_t dnnl_primitive_attr_set_softmax_params(
+        primitive_attr_t *attr, float scale, softmax_mask_t mask) {
+    if (attr == nullptr) return invalid_arguments;
+
+    return attr->softmax_params_.set(scale, mask);
+}
+
+status_t dnnl_primitive_attr_get_softmax_params(
+        const primitive_attr_t *attr, float *scale, softmax_mask_t *mask) {
+    if (attr == nullptr) return invalid_arguments;
+
+    if (scale) *scale = attr->softmax_params_.scale_;
+    if (mask) *mask = attr->softmax_params_.mask_;
+    return success;
+}
+
 template struct dnnl::impl::shifts_t<uint8_t>;
 template struct dnnl::impl::shifts_t<int32_t>;
 template struct dnnl::impl::shifts_t<float>;
@@ -618,6 +618,29 @@ struct src_dyn_quant_params_t : public c_compatible {
     uint64_t group_size_;
 };
 
+// Scale and mask applied to the softmax source before the normalization.
+struct softmax_params_t : public c_compatible {
+    bool has_default_values() const {
+        return scale_ == 1.f && mask_ == softmax_mask::none;
+    }
+    bool defined() const { return true; }
+
+    status_t set(float scale, softmax_mask_t mask) {
+        if (!utils::one_of(mask, softmax_mask::none, softmax_mask::causal))
+            return status::invalid_arguments;
+        scale_ = scale;
+        mask_ = mask;
+        return status::success;
+    }
+
+    bool operator==(const softmax_params_t &rhs) const {
+        return scale_ == rhs.scale_ && mask_ == rhs.mask_;
+    }
+
+    float scale_ = 1.f;
+    softmax_mask_t mask_ = softmax_mask::none;
+};
+
 } // namespace impl
 } // namespace dnnl
 
@@ -715,6 +738,16 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::data_type_t in_dt;
         };
 
+        // Pooling of non-overlapping ker_h x ker_w windows of an in_h x in_w
+        // output.
+        struct pooling_t {
+            dnnl::impl::alg_kind_t alg;
+            dnnl::impl::dim_t in_h;
+            dnnl::impl::dim_t in_w;
+            dnnl::impl::dim_t ker_h;
+            dnnl::impl::dim_t ker_w;
+        };
+
         dnnl::impl::primitive_kind_t kind
                 = dnnl::impl::primitive_kind::undefined;
         union {
@@ -727,6 +760,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             depthwise_t depthwise;
             quantization_t quantization;
             binarization_t binarization;
+            pooling_t pooling;
         };
 
         bool is_eltwise(bool require_scale_one = false) const {
@@ -780,6 +814,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             return kind == primitive_kind::binarization;
         }
 
+        bool is_pooling() const {
+            using namespace dnnl::impl;
+            return kind == primitive_kind::pooling;
+        }
+
         dnnl::impl::status_t set_depthwise_scales(const float *scales);
 
         bool operator==(const entry_t &rhs) const {
@@ -844,6 +883,13 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                           && binarization.weights_data == rhs.binarization.weights_data
                           && binarization.output_mask_data == rhs.binarization.output_mask_data;
                     break;
+                case primitive_kind::pooling:
+                    ret = pooling.alg == rhs.pooling.alg
+                            && pooling.in_h == rhs.pooling.in_h
+                            && pooling.in_w == rhs.pooling.in_w
+                            && pooling.ker_h == rhs.pooling.ker_h
+                            && pooling.ker_w == rhs.pooling.ker_w;
+                    break;
                 default: assert(!"unsupported post_op");
             }
             return ret;
@@ -877,6 +923,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             const float* output_mask_data);
     dnnl::impl::status_t append_dw_conv(int in_h, int in_w, int ker_h, int ker_w, int str_h, int str_w,
             dnnl::impl::data_type_t in_dt);
+    dnnl::impl::status_t append_pooling(dnnl::impl::alg_kind_t alg,
+            dnnl::impl::dim_t in_h, dnnl::impl::dim_t in_w,
+            dnnl::impl::dim_t ker_h, dnnl::impl::dim_t ker_w);
 
     dnnl::impl::status_t prepend_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc);
@@ -978,7 +1027,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
-        , deterministic_(false) {}
+        , deterministic_(false)
+        , max_threads_(0)
+        , cpu_isa_hints_(dnnl_cpu_isa_no_hints)
+        , scratchpad_limit_(0) {}
 
     ~dnnl_primitive_attr() = default;
 
@@ -1001,6 +1053,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        max_threads_ = other.max_threads_;
+        cpu_isa_hints_ = other.cpu_isa_hints_;
+        scratchpad_limit_ = other.scratchpad_limit_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -1012,6 +1067,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         weights_zero_points_ = (other.weights_zero_points_);
         output_compensations_ = (other.output_compensations_);
         src_dyn_quant_params_ = other.src_dyn_quant_params_;
+        softmax_params_ = other.softmax_params_;
 
         return status::success;
     }
@@ -1044,6 +1100,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         weights_zero_points = 1 << 20,
         output_compensations = 1 << 21,
         src_dyn_quant_params = 1u << 22,
+        softmax_params = 1u << 23,
     };
 
     /** Returns true if the attributes have default values.
@@ -1059,6 +1116,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && max_threads_ == rhs.max_threads_
+                && cpu_isa_hints_ == rhs.cpu_isa_hints_
+                && scratchpad_limit_ == rhs.scratchpad_limit_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && post_ops_ == rhs.post_ops_
@@ -1073,7 +1133,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                 && input_zero_points_ == rhs.input_zero_points_
                 && weights_zero_points_ == rhs.weights_zero_points_
                 && output_compensations_ == rhs.output_compensations_
-                && src_dyn_quant_params_ == rhs.src_dyn_quant_params_;
+                && src_dyn_quant_params_ == rhs.src_dyn_quant_params_
+                && softmax_params_ == rhs.softmax_params_;
         return ret;
     }
 
@@ -1141,6 +1202,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    // The maximum number of threads, 0 means no limit.
+    int max_threads_;
+    // CPU ISA hints of the primitive, no_hints means the global ones are used.
+    dnnl_cpu_isa_hints_t cpu_isa_hints_;
+    // The scratchpad size limit in bytes, 0 means no limit.
+    size_t scratchpad_limit_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
@@ -1153,6 +1220,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::legacy_zero_points_t output_compensations_;
 
     dnnl::impl::src_dyn_quant_params_t src_dyn_quant_params_;
+    dnnl::impl::softmax_params_t softmax_params_;
 
     dnnl_primitive_attr &operator=(const dnnl_primitive_attr &other) = delete;
 };
@@ -21,6 +21,7 @@
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_iface.hpp"
+#include "verbose.hpp"
 #include "z_magic.hpp"
 
 namespace dnnl {
@@ -41,6 +42,7 @@ struct primitive_cache_t {
     }
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
+    dnnl_cache_stats_t get_stats() const { return cache_.get_stats(); }
 
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
@@ -122,6 +124,33 @@ int primitive_cache_iface_t::get_size() const {
     return cache_.get_size();
 }
 
+dnnl_cache_stats_t primitive_cache_iface_t::get_stats() const {
+    return cache_.get_stats();
+}
+
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+namespace {
+template <typename cache_type>
+void print_cache_stats(const char *name, const cache_type &cache) {
+    const auto stats = cache.get_stats();
+    VFORMAT(get_msec(), primitive, create, ":cache_stats",
+            "%s,capacity:%d,size:%d,hits:%lld,misses:%lld,evictions:%lld,"
+            "saved_ms:%g",
+            name, cache.get_capacity(), cache.get_size(),
+            (long long)stats.hits, (long long)stats.misses,
+            (long long)stats.evictions, stats.creation_time_saved_ms);
+}
+} // namespace
+#endif
+
+void print_primitive_cache_stats() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    print_cache_stats("primitive_cache", global_primitive_cache());
+    print_cache_stats("kernel_cache", kernel_cache::get());
+    fflush(stdout);
+#endif
+}
+
 std::shared_ptr<primitive_desc_t> primitive_cache_iface_t::get_pd(
         const key_t &key) {
     return cache_.get_pd(key);
@@ -156,3 +185,20 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
 #endif
     return dnnl::impl::status::success;
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl_cache_stats_t *primitive_stats, dnnl_cache_stats_t *kernel_stats) {
+    if (primitive_stats) {
+        *primitive_stats = dnnl_cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+        *primitive_stats = dnnl::impl::global_primitive_cache().get_stats();
+#endif
+    }
+    if (kernel_stats) {
+        *kernel_stats = dnnl_cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+        *kernel_stats = dnnl::impl::kernel_cache::get().get_stats();
+#endif
+    }
+    return dnnl::impl::status::success;
+}
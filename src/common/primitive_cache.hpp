@@ -49,6 +49,7 @@ struct primitive_cache_iface_t {
     status_t set_capacity(int capacity);
     int get_capacity() const;
     int get_size() const;
+    dnnl_cache_stats_t get_stats() const;
 
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key);
     result_t get_or_create(
@@ -58,6 +59,10 @@ private:
     primitive_cache_t &cache_;
 };
 
+// Prints the cumulative statistics of the primitive and kernel caches with
+// the verbose infrastructure.
+void print_primitive_cache_stats();
+
 primitive_cache_iface_t primitive_cache();
 
 // Undocumented API for testing.
@@ -305,7 +305,12 @@ struct primitive_desc_t : public c_compatible {
 
     /** returns the scratchpad size for the given scratchpad mode. */
     dim_t scratchpad_size(scratchpad_mode_t mode) const {
-        if (mode != attr_.scratchpad_mode_) return 0;
+        // The shared scratchpad is managed by the library as well.
+        const scratchpad_mode_t attr_mode
+                = attr_.scratchpad_mode_ == scratchpad_mode::shared
+                ? scratchpad_mode::library
+                : attr_.scratchpad_mode_;
+        if (mode != attr_mode) return 0;
         return scratchpad_registry().size();
     }
 
@@ -345,6 +350,22 @@ struct primitive_desc_t : public c_compatible {
 
             case query::impl_info_str: *(const char **)result = name(); break;
 
+            case query::flops_f64:
+                if (has_runtime_dims_or_strides() || flops() < 0)
+                    return status::unimplemented;
+                *(double *)result = flops();
+                break;
+            case query::bytes_read_s64:
+                if (has_runtime_dims_or_strides())
+                    return status::unimplemented;
+                *(dim_t *)result = args_size(arg_usage_t::input);
+                break;
+            case query::bytes_written_s64:
+                if (has_runtime_dims_or_strides())
+                    return status::unimplemented;
+                *(dim_t *)result = args_size(arg_usage_t::output);
+                break;
+
             default: return status::unimplemented;
         }
         return status::success;
@@ -352,6 +373,32 @@ struct primitive_desc_t : public c_compatible {
 
     virtual int n_inputs() const { return 0; }
     virtual int n_outputs() const { return 0; }
+
+    // Returns the theoretical number of floating-point operations of the
+    // problem or a negative value if it is not defined for the primitive.
+    virtual double flops() const { return -1; }
+
+    // Returns the size of all memory arguments with the given usage. The
+    // scratchpad is skipped as its size depends on the implementation.
+    dim_t args_size(arg_usage_t usage) const {
+        auto arg_size = [&](int arg) -> dim_t {
+            if (arg == DNNL_ARG_SCRATCHPAD || arg_usage(arg) != usage)
+                return 0;
+            return (dim_t)memory_desc_wrapper(arg_md(arg)).size();
+        };
+
+        dim_t size = 0;
+        for (int arg = DNNL_ARG_SRC_0; arg <= DNNL_ARG_DIFF_SHIFT; arg++)
+            size += arg_size(arg);
+        for (int i = 0; i < n_inputs(); i++)
+            size += arg_size(DNNL_ARG_MULTIPLE_SRC + i);
+        for (int idx = 0; idx < attr()->post_ops_.len(); idx++) {
+            const int po_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx);
+            size += arg_size(po_arg | DNNL_ARG_SRC_1);
+            size += arg_size(po_arg | DNNL_ARG_WEIGHTS);
+        }
+        return size;
+    }
     int n_binary_po_inputs() const {
         return po_inputs(attr()->post_ops_, primitive_kind::binary);
     }
@@ -18,6 +18,7 @@
 
 #include "c_types_map.hpp"
 
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_desc_iterator.hpp"
@@ -44,6 +45,7 @@ status_t primitive_desc_create(primitive_desc_iface_t **primitive_desc_iface,
             softmax);
     if (!known_primitive_kind) return invalid_arguments;
 
+    max_threads_limit_guard_t max_threads_guard(attr ? attr->max_threads_ : 0);
     auto pd_iface = utils::make_unique<primitive_desc_iface_t>(engine, op_desc,
             attr, hint_fwd_pd ? hint_fwd_pd->impl().get() : nullptr);
     if (pd_iface == nullptr) return out_of_memory;
@@ -84,6 +86,7 @@ status_t dnnl_primitive_desc::init() {
 
 status_t dnnl_primitive_desc::next_impl() {
     if (!pd_iterator_) return status::last_impl_reached;
+    max_threads_limit_guard_t max_threads_guard(attr()->max_threads_);
     ++(*pd_iterator_);
     if (*pd_iterator_ == pd_iterator_->end()) return last_impl_reached;
     pd_ = *(*pd_iterator_);
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <system_error>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_future.hpp"
+#include "primitive_iface.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+
+dnnl_primitive_future::dnnl_primitive_future(
+        const primitive_desc_iface_t *pd_iface) {
+    // `std::launch::async` guarantees that the creation doesn't block the
+    // caller and that the destructor of the future waits for the task.
+    future_ = std::async(std::launch::async, [pd_iface]() {
+        primitive_iface_t *p_iface = nullptr;
+        status_t status = primitive_create(&p_iface, pd_iface);
+        return result_t(p_iface, status);
+    }).share();
+}
+
+dnnl_primitive_future::~dnnl_primitive_future() {
+    const auto &result = future_.get();
+    if (result.first) result.first->release();
+}
+
+bool dnnl_primitive_future::is_ready() const {
+    return future_.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
+status_t dnnl_primitive_future::get(primitive_iface_t **primitive_iface) const {
+    const auto &result = future_.get();
+    if (result.second != status::success) return result.second;
+    // The future keeps its own reference to the primitive.
+    result.first->retain();
+    *primitive_iface = result.first;
+    return status::success;
+}
+
+status_t dnnl_primitive_create_async(primitive_future_iface_t **future_iface,
+        const primitive_desc_iface_t *primitive_desc_iface) {
+    if (utils::any_null(future_iface, primitive_desc_iface))
+        return status::invalid_arguments;
+    try {
+        return safe_ptr_assign(*future_iface,
+                new primitive_future_iface_t(primitive_desc_iface));
+    } catch (const std::system_error &) {
+        // No thread could be started for the task.
+        return status::out_of_memory;
+    }
+}
+
+status_t dnnl_primitive_future_is_ready(
+        const primitive_future_iface_t *future_iface, int *is_ready) {
+    if (utils::any_null(future_iface, is_ready))
+        return status::invalid_arguments;
+    *is_ready = future_iface->is_ready();
+    return status::success;
+}
+
+status_t dnnl_primitive_future_get(
+        const primitive_future_iface_t *future_iface,
+        primitive_iface_t **primitive_iface) {
+    if (utils::any_null(future_iface, primitive_iface))
+        return status::invalid_arguments;
+    return future_iface->get(primitive_iface);
+}
+
+status_t dnnl_primitive_future_destroy(primitive_future_iface_t *future_iface) {
+    delete future_iface;
+    return status::success;
+}
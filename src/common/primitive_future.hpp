@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_FUTURE_HPP
+#define COMMON_PRIMITIVE_FUTURE_HPP
+
+#include <future>
+#include <utility>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+// dnnl_primitive_future is a user facing entity that has an alias
+// primitive_future_iface_t for internal use.
+// It owns a background task that creates a primitive for the given primitive
+// descriptor. The created primitive goes through the regular creation path,
+// hence it's added to the primitive cache and subsequent creation calls for
+// the same primitive descriptor result in a cache hit.
+struct dnnl_primitive_future : public dnnl::impl::c_compatible {
+    dnnl_primitive_future(const primitive_desc_iface_t *pd_iface);
+    ~dnnl_primitive_future();
+
+    bool is_ready() const;
+    // Waits for the creation to complete. The returned primitive is owned by
+    // the caller.
+    dnnl::impl::status_t get(primitive_iface_t **primitive_iface) const;
+
+private:
+    using result_t = std::pair<primitive_iface_t *, dnnl::impl::status_t>;
+    std::shared_future<result_t> future_;
+
+    dnnl_primitive_future() = delete;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_future);
+};
+
+#endif
@@ -132,6 +132,12 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
     // deterministic
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
+    // max_threads
+    seed = hash_combine(seed, attr.max_threads_);
+    // cpu_isa_hints
+    seed = hash_combine(seed, static_cast<size_t>(attr.cpu_isa_hints_));
+    // scratchpad_limit
+    seed = hash_combine(seed, attr.scratchpad_limit_);
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
 
@@ -191,6 +197,9 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = hash_combine(seed, attr.gpu_attr_->get_hash());
     }
     seed = hash_combine(seed, attr.src_dyn_quant_params_.group_size_);
+    // softmax_params
+    seed = hash_combine(seed, attr.softmax_params_.scale_);
+    seed = hash_combine(seed, static_cast<size_t>(attr.softmax_params_.mask_));
     // Combined hash for attributes
     return seed;
 }
@@ -240,6 +249,14 @@ size_t get_post_op_hash(size_t seed, const post_ops_t &post_ops) {
                 seed = get_array_hash(seed, entry.quantization.all_default, entry.quantization.fields_count);
                 seed = get_array_hash(seed, entry.quantization.offset, entry.quantization.fields_count);
                 break;
+            case primitive_kind::pooling:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.alg));
+                seed = hash_combine(seed, entry.pooling.in_h);
+                seed = hash_combine(seed, entry.pooling.in_w);
+                seed = hash_combine(seed, entry.pooling.ker_h);
+                seed = hash_combine(seed, entry.pooling.ker_w);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -17,6 +17,8 @@
 #include <string>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "dram_counters.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -32,6 +34,7 @@
 #include "scratchpad_debug.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
+#include "thread_trace.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -60,9 +63,15 @@ namespace impl {
 
 status_t primitive_create(primitive_iface_t **primitive_iface,
         const primitive_desc_iface_t *primitive_desc_iface,
-        const cache_blob_t &cache_blob = cache_blob_t()) {
+        const cache_blob_t &user_cache_blob) {
 
     std::pair<primitive_iface_t *, bool> p_iface;
+    max_threads_limit_guard_t max_threads_guard(
+            primitive_desc_iface->attr()->max_threads_);
+
+    // On a primitive cache miss, the ahead-of-time cache blob store is
+    // consulted when `cache_blob` is empty, see create_primitive_common().
+    const cache_blob_t &cache_blob = user_cache_blob;
 
     if (get_verbose(verbose_t::create_profile,
                 prim_kind2_comp_kind(primitive_desc_iface->impl()->kind()))) {
@@ -76,6 +85,10 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
 
         VPROF(start_ms, primitive, create, str, p_iface.first->pd()->info(),
                 duration_ms);
+        // Cache misses are rare in a warmed up application, so the last
+        // statistics line is close to the final one and helps to size the
+        // cache capacity.
+        if (!p_iface.second && !cache_blob) print_primitive_cache_stats();
     } else {
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
@@ -83,10 +96,59 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
 
+namespace {
+void print_exec_profile(const primitive_iface_t *primitive_iface,
+        const exec_ctx_t &ctx, double start_ms, double duration_ms,
+        uint64_t dram_bytes, long page_faults, bool is_first_exec) {
+    // The first execution pays for the page faults on the scratchpad, lazy
+    // initializations and cold instruction caches.
+    const char *subtype = is_first_exec ? ":first" : VERBOSE_profile;
+    // Counters are only reported in the JSON format.
+    size_t bytes = 0;
+    double flops = 0;
+    if (get_verbose_json()) {
+        for (const auto &arg : ctx.args())
+            if (arg.second.mem)
+                bytes += memory_desc_wrapper(arg.second.mem->md()).size();
+        flops = get_verbose_flops(primitive_iface->pd()->impl().get());
+    }
+    if (primitive_iface->pd()->impl()->has_runtime_dims_or_strides()) {
+        // Take out mds from `ctx` here to avoid primitive_desc dependency
+        // on `exec_ctx_t` type.
+        // TODO: invariant arg names for training?
+        const auto *pd = primitive_iface->pd()->impl().get();
+        const auto pd_src_md = pd->invariant_src_md();
+        const auto src_md = ctx.memory_mdw(DNNL_ARG_SRC, pd_src_md).md_;
+        const auto pd_wei_md = pd->invariant_wei_md();
+        const auto wei_md = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd_wei_md).md_;
+        const auto pd_bia_md = pd->invariant_bia_md();
+        const auto bia_md = ctx.memory_mdw(DNNL_ARG_BIAS, pd_bia_md).md_;
+        const auto pd_dst_md = pd->invariant_dst_md();
+        const auto dst_md = ctx.memory_mdw(DNNL_ARG_DST, pd_dst_md).md_;
+
+        std::string info = primitive_iface->pd()->info_with_runtime_dims(
+                src_md, wei_md, bia_md, dst_md);
+        VPROF(start_ms, primitive, exec, subtype, info.c_str(),
+                duration_ms, bytes, flops, dram_bytes, page_faults);
+    } else {
+        VPROF(start_ms, primitive, exec, subtype,
+                primitive_iface->pd()->info(), duration_ms, bytes, flops,
+                dram_bytes, page_faults);
+    }
+}
+} // namespace
+
 status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     auto stream = ctx.stream();
     status_t status = success;
+    max_threads_limit_guard_t max_threads_guard(
+            primitive_iface->pd()->attr()->max_threads_);
+    exec_allocation_checker_t allocation_checker;
+
+    thread_trace::primitive_scope_t trace_scope(
+            primitive_iface->pd()->impl()->kind(),
+            primitive_iface->pd()->impl()->name());
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
     const bool enable_itt = itt::get_itt(itt::__itt_task_level_low);
@@ -94,38 +156,35 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
-    if (get_verbose(verbose_t::exec_profile,
-                prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()))) {
+    const auto prim_kind = primitive_iface->pd()->impl()->kind();
+    const bool verbose_exec = get_verbose(verbose_t::exec_profile,
+                                      prim_kind2_comp_kind(prim_kind))
+            && get_verbose_exec_sampled();
+    const bool anomaly_check = get_exec_anomaly_check();
+    const bool is_first_exec = primitive_iface->mark_executed();
+
+    if (verbose_exec || anomaly_check) {
+        // DRAM traffic and page faults are only reported in the JSON format.
+        const bool with_counters = verbose_exec && get_verbose_json();
+        const bool with_dram = with_counters && dram_counters::is_enabled();
         stream->wait();
+        const uint64_t dram_start = with_dram ? dram_counters::get_bytes() : 0;
+        const long pf_start = with_counters ? get_page_faults() : -1;
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
         double duration_ms = get_msec() - start_ms;
-        if (primitive_iface->pd()->impl()->has_runtime_dims_or_strides()) {
-            // Take out mds from `ctx` here to avoid primitive_desc dependency
-            // on `exec_ctx_t` type.
-            // TODO: invariant arg names for training?
-            const auto pd_src_md
-                    = primitive_iface->pd()->impl()->invariant_src_md();
-            const auto src_md = ctx.memory_mdw(DNNL_ARG_SRC, pd_src_md).md_;
-            const auto pd_wei_md
-                    = primitive_iface->pd()->impl()->invariant_wei_md();
-            const auto wei_md = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd_wei_md).md_;
-            const auto pd_bia_md
-                    = primitive_iface->pd()->impl()->invariant_bia_md();
-            const auto bia_md = ctx.memory_mdw(DNNL_ARG_BIAS, pd_bia_md).md_;
-            const auto pd_dst_md
-                    = primitive_iface->pd()->impl()->invariant_dst_md();
-            const auto dst_md = ctx.memory_mdw(DNNL_ARG_DST, pd_dst_md).md_;
-
-            std::string info = primitive_iface->pd()->info_with_runtime_dims(
-                    src_md, wei_md, bia_md, dst_md);
-            VPROF(start_ms, primitive, exec, VERBOSE_profile, info.c_str(),
-                    duration_ms);
-        } else {
-            VPROF(start_ms, primitive, exec, VERBOSE_profile,
+        const uint64_t dram_bytes
+                = with_dram ? dram_counters::get_bytes() - dram_start : 0;
+        const long page_faults
+                = pf_start >= 0 ? get_page_faults() - pf_start : -1;
+
+        if (anomaly_check && status == success)
+            check_exec_anomaly(primitive_iface->exec_time_stats(),
                     primitive_iface->pd()->info(), duration_ms);
-        }
+        if (verbose_exec)
+            print_exec_profile(primitive_iface, ctx, start_ms, duration_ms,
+                    dram_bytes, page_faults, is_first_exec);
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
@@ -136,6 +195,9 @@ status_t primitive_execute(
 
     if (msan_enabled) unpoison_outputs(ctx.args());
 
+    if (status == success)
+        status = allocation_checker.check(primitive_iface->pd()->info());
+
     return status;
 }
 
@@ -170,13 +232,8 @@ status_t dnnl_primitive_create_from_cache_blob(
             || size == 0) {
         return invalid_arguments;
     }
-    const auto ekind = primitive_desc_iface->engine()->kind();
-    const auto runtime_kind = primitive_desc_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!primitive_desc_iface->engine()->is_cache_blob_supported())
         return status::unimplemented;
-    }
 
     cache_blob_t cb(const_cast<uint8_t *>(cache_blob), size);
     return dnnl::impl::primitive_create(
@@ -229,13 +286,8 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
         return status::invalid_arguments;
     }
 
-    const auto ekind = primitive_iface->engine()->kind();
-    const auto runtime_kind = primitive_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!primitive_iface->engine()->is_cache_blob_supported())
         return status::unimplemented;
-    }
 
     if (!cache_blob) {
         size_t sz = 0;
@@ -248,6 +300,14 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
     return primitive_iface->get_cache_blob(cb);
 }
 
+status_t dnnl_primitive_get_memory_consumption(
+        const primitive_iface_t *primitive_iface,
+        memory_consumption_kind_t kind, size_t *size) {
+    if (utils::any_null(primitive_iface, size))
+        return status::invalid_arguments;
+    return primitive_iface->get_memory_consumption(kind, size);
+}
+
 status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     if (primitive_iface != nullptr) primitive_iface->release();
     return success;
@@ -286,11 +346,16 @@ status_t dnnl_primitive::init() {
     if (scratchpad_size) {
         const memory_tracking::registry_t &registry
                 = primitive_->pd()->scratchpad_registry();
-        bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
-                ? false
-                : primitive_->use_global_scratchpad();
-        auto *scratchpad_ptr = create_scratchpad(
-                pd_->engine(), scratchpad_size, use_global_scratchpad);
+        const bool can_share_scratchpad
+                = !scratchpad_debug::is_protect_scratchpad()
+                && !pd_->engine()->has_user_allocator();
+        bool use_global_scratchpad
+                = can_share_scratchpad && primitive_->use_global_scratchpad();
+        bool use_shared_scratchpad = can_share_scratchpad
+                && primitive_->pd()->attr()->scratchpad_mode_
+                        == scratchpad_mode::shared;
+        auto *scratchpad_ptr = create_scratchpad(pd_->engine(), scratchpad_size,
+                use_global_scratchpad, use_shared_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
         if (scratchpad_ptr->get_memory_storage() == nullptr) {
             delete scratchpad_ptr;
@@ -307,6 +372,20 @@ status_t dnnl_primitive::init() {
     return primitive_->create_resource(pd()->engine(), resource_mapper_);
 }
 
+bool dnnl_primitive::uses_global_scratchpad() const {
+    if (scratchpad_ == nullptr || scratchpad_debug::is_protect_scratchpad()
+            || pd_->engine()->kind() != engine_kind::cpu
+            || pd_->engine()->has_user_allocator())
+        return false;
+    if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::shared)
+        return true;
+#ifndef DNNL_ENABLE_CONCURRENT_EXEC
+    return primitive_->use_global_scratchpad();
+#else
+    return false;
+#endif
+}
+
 engine_t *dnnl_primitive::engine() const {
     return pd_->engine();
 }
@@ -339,6 +418,23 @@ status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
     return primitive_->get_cache_blob_size(engine(), size);
 }
 
+status_t dnnl_primitive::get_memory_consumption(
+        memory_consumption_kind_t kind, size_t *size) const {
+    switch (kind) {
+        case memory_consumption_kind::scratchpad:
+            *size = primitive_->pd()->scratchpad_registry().size();
+            break;
+        case memory_consumption_kind::code:
+            *size = primitive_->code_size();
+            break;
+        case memory_consumption_kind::resources:
+            *size = resource_mapper_.size();
+            break;
+        default: return status::invalid_arguments;
+    }
+    return status::success;
+}
+
 status_t dnnl_primitive::get_cache_blob(cache_blob_t cache_blob) const {
     return primitive_->get_cache_blob(engine(), cache_blob);
 }
@@ -26,9 +26,13 @@
 #include "primitive_exec_types.hpp"
 #include "resource.hpp"
 #include "scratchpad.hpp"
+#include "verbose.hpp"
 
 namespace dnnl {
 namespace impl {
+status_t primitive_create(primitive_iface_t **primitive_iface,
+        const primitive_desc_iface_t *primitive_desc_iface,
+        const cache_blob_t &cache_blob = cache_blob_t());
 status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx);
 }
@@ -64,7 +68,20 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob_size(size_t *size) const;
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
+    dnnl::impl::status_t get_memory_consumption(
+            dnnl::impl::memory_consumption_kind_t kind, size_t *size) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Returns true if the scratchpad of the primitive is shared with the
+    // other primitives created by the same thread.
+    bool uses_global_scratchpad() const;
+    dnnl::impl::exec_time_stats_t &exec_time_stats() const {
+        return exec_time_stats_;
+    }
+    // Returns true for the first call only.
+    bool mark_executed() const {
+        return !executed_.load(std::memory_order_relaxed)
+                && !executed_.exchange(true);
+    }
 
     void retain() { counter_++; }
 
@@ -81,6 +98,8 @@ private:
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    mutable dnnl::impl::exec_time_stats_t exec_time_stats_;
+    mutable std::atomic<bool> executed_ {false};
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
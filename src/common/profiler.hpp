@@ -17,6 +17,7 @@
 #define COMMON_PROFILER_HPP
 
 #ifndef _WIN32
+#include <sys/resource.h>
 #include <sys/time.h>
 #else
 #include <windows.h>
@@ -53,6 +54,18 @@ static double get_msec() {
 #endif
 }
 
+// Returns the number of minor and major page faults of the process or -1 if
+// it is not available.
+inline long get_page_faults() {
+#ifdef _WIN32
+    return -1;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+    return usage.ru_minflt + usage.ru_majflt;
+#endif
+}
+
 // Record custom profiling information within a single thread.
 //
 // Basic Usage:
@@ -15,13 +15,23 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
+#include "memory.hpp"
 #include "primitive_cache.hpp"
+#include "primitive_exec_types.hpp"
 #include "primitive_hashing.hpp"
+#include "primitive_iface.hpp"
+#include "stream.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -87,6 +97,7 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
             "src", "dst");
 
     if (attr == nullptr) attr = &default_attr();
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
 
     // Zero points are only allowed for integral data types
     auto zero_points = attr->zero_points_;
@@ -148,4 +159,148 @@ status_t dnnl_reorder_primitive_desc_create(
             new reorder_primitive_desc_iface_t(pd, e, src_engine, dst_engine));
 }
 
+status_t dnnl_reorder_batch_execute(stream_t *stream, dim_t n,
+        const memory_t *const *src, memory_t *const *dst,
+        const primitive_attr_t *attr) {
+    if (any_null(stream) || n < 0) return invalid_arguments;
+    if (n == 0) return success;
+    if (any_null(src, dst)) return invalid_arguments;
+
+    engine_t *engine = stream->engine();
+    if (engine->kind() != engine_kind::cpu) return unimplemented;
+
+    // Runtime quantization parameters are passed per execution, so there is
+    // no way to supply them for every pair of the batch.
+    if (attr == nullptr) attr = &default_attr();
+    if (!attr->scales_.has_default_values()
+            || !attr->zero_points_.has_default_values())
+        return unimplemented;
+
+    // Reorders of the batch run concurrently, so each thread must own its
+    // scratchpad instead of sharing the library one of the creating thread.
+    primitive_attr_t batch_attr(*attr);
+    if (!batch_attr.is_initialized()) return out_of_memory;
+    batch_attr.scratchpad_mode_ = scratchpad_mode::user;
+
+    struct prim_deleter_t {
+        void operator()(primitive_iface_t *p) const { p->release(); }
+    };
+    using prim_ptr_t = std::unique_ptr<primitive_iface_t, prim_deleter_t>;
+
+    std::vector<prim_ptr_t> prims(n);
+    std::vector<size_t> sizes(n);
+    size_t total_size = 0;
+    for (dim_t i = 0; i < n; ++i) {
+        if (any_null(src[i], dst[i])) return invalid_arguments;
+        if (src[i]->engine() != engine || dst[i]->engine() != engine)
+            return invalid_arguments;
+
+        std::shared_ptr<primitive_desc_t> pd;
+        CHECK(reorder_primitive_desc_create(
+                pd, engine, src[i]->md(), dst[i]->md(), &batch_attr));
+        std::unique_ptr<primitive_desc_iface_t> pd_iface(
+                new reorder_primitive_desc_iface_t(pd, engine, engine, engine));
+
+        primitive_iface_t *p = nullptr;
+        CHECK(primitive_create(&p, pd_iface.get()));
+        prims[i].reset(p);
+
+        sizes[i] = memory_desc_wrapper(dst[i]->md()).size();
+        total_size += sizes[i];
+    }
+
+    // Tensors that would keep all threads busy on their own are executed one
+    // by one with the whole team. The rest are spread over the threads,
+    // largest first, each to the least loaded thread, and every thread runs
+    // its reorders sequentially.
+    const int nthr = dnnl_get_max_threads();
+    std::vector<dim_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+            [&](dim_t a, dim_t b) { return sizes[a] > sizes[b]; });
+
+    std::vector<dim_t> large;
+    std::vector<std::vector<dim_t>> buckets(nthr);
+    std::vector<size_t> loads(nthr, 0);
+    std::vector<const memory_desc_t *> sp_mds(nthr, &glob_zero_md);
+    const memory_desc_t *large_sp_md = &glob_zero_md;
+    const auto sp_size = [](const memory_desc_t *md) {
+        return memory_desc_wrapper(md).size();
+    };
+    for (dim_t i : order) {
+        const auto *sp_md = prims[i]->pd()->impl()->scratchpad_md();
+        if (nthr == 1 || sizes[i] * nthr >= total_size) {
+            large.push_back(i);
+            if (sp_size(sp_md) > sp_size(large_sp_md)) large_sp_md = sp_md;
+            continue;
+        }
+        const int ithr = static_cast<int>(
+                std::min_element(loads.begin(), loads.end()) - loads.begin());
+        buckets[ithr].push_back(i);
+        loads[ithr] += sizes[i];
+        if (sp_size(sp_md) > sp_size(sp_mds[ithr])) sp_mds[ithr] = sp_md;
+    }
+
+    std::unique_ptr<memory_t> large_sp;
+    std::vector<std::unique_ptr<memory_t>> sps(nthr);
+    const auto create_sp = [&](std::unique_ptr<memory_t> &sp,
+                                   const memory_desc_t *md) {
+        if (sp_size(md) == 0) return success;
+        memory_t *m = nullptr;
+        CHECK(dnnl_memory_create(&m, md, engine, DNNL_MEMORY_ALLOCATE));
+        sp.reset(m);
+        return success;
+    };
+    CHECK(create_sp(large_sp, large_sp_md));
+    for (int ithr = 0; ithr < nthr; ++ithr)
+        CHECK(create_sp(sps[ithr], sp_mds[ithr]));
+
+    const auto make_ctx = [&](dim_t i, memory_t *sp) {
+        exec_args_t args;
+        args[DNNL_ARG_FROM] = {const_cast<memory_t *>(src[i]), true};
+        args[DNNL_ARG_TO] = {dst[i], false};
+        if (sp) args[DNNL_ARG_SCRATCHPAD] = {sp, false};
+        return exec_ctx_t(stream, std::move(args));
+    };
+
+    stream->before_exec_hook();
+    status_t status = success;
+    for (dim_t i : large) {
+        exec_ctx_t ctx = make_ctx(i, large_sp.get());
+        status = primitive_execute(prims[i].get(), ctx);
+        if (status != success) break;
+    }
+
+    // Small reorders are executed directly by the threads of the parallel
+    // region rather than enqueued to the stream, so the work submitted
+    // before them has to complete first.
+    if (status == success && large.size() < static_cast<size_t>(n))
+        status = stream->wait();
+
+    if (status == success && large.size() < static_cast<size_t>(n)) {
+        std::vector<status_t> statuses(nthr, success);
+        parallel(nthr, [&](int ithr, int team_size) {
+            // A smaller team than requested picks up the remaining buckets.
+            for (int b = ithr; b < nthr; b += team_size) {
+                for (dim_t i : buckets[b]) {
+                    exec_ctx_t ctx = make_ctx(i, sps[b].get());
+                    statuses[b] = prims[i]->execute(ctx);
+                    if (statuses[b] != success) break;
+                }
+            }
+        });
+        for (auto s : statuses)
+            if (s != success) {
+                status = s;
+                break;
+            }
+    }
+    stream->after_exec_hook();
+
+    // Scratchpads are released on return, while an out-of-order stream may
+    // still run the reorders that use them.
+    const status_t wait_status = stream->wait();
+    return status != success ? status : wait_status;
+}
+
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
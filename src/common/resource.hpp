@@ -44,6 +44,9 @@ namespace impl {
 // responsible for destroying it as well.
 struct resource_t : public c_compatible {
     virtual ~resource_t() = default;
+
+    // Returns the size of the memory held by the resource in bytes.
+    virtual size_t size() const { return 0; }
 };
 
 // The resource_mapper_t is an abstraction for holding resources for
@@ -82,6 +85,14 @@ struct resource_mapper_t {
         return utils::downcast<T *>(primitive_to_resource_.at(p).get());
     }
 
+    // Returns the size of the memory held by all resources in bytes.
+    size_t size() const {
+        size_t total = 0;
+        for (const auto &r : primitive_to_resource_)
+            total += r.second->size();
+        return total;
+    }
+
     DNNL_DISALLOW_COPY_AND_ASSIGN(resource_mapper_t);
 
 private:
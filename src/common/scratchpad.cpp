@@ -18,6 +18,7 @@
 
 #include "engine.hpp"
 #include "utils.hpp"
+#include "verbose.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/cpu_engine.hpp"
@@ -101,8 +102,12 @@ struct global_scratchpad_t : public scratchpad_t {
                 // Recreate scratchpad with original capacity
                 mem_storage_ = create_scratchpad_memory_storage(engine, size_);
                 if (mem_storage_ == nullptr) size_ = 0;
-            } else
+            } else {
+                VINFO(primitive, create, check, primitive,
+                        "global scratchpad grown from %zu to %zu bytes", size_,
+                        size);
                 size_ = size;
+            }
         }
         reference_count_++;
     }
@@ -141,8 +146,10 @@ thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 /*
    Scratchpad creation routine
 */
-scratchpad_t *create_scratchpad(
-        engine_t *engine, size_t size, bool use_global_scratchpad) {
+scratchpad_t *create_scratchpad(engine_t *engine, size_t size,
+        bool use_global_scratchpad, bool use_shared_scratchpad) {
+    if (use_shared_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu)
+        return new global_scratchpad_t(engine, size);
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
@@ -30,8 +30,12 @@ struct scratchpad_t {
     virtual size_t size() const = 0;
 };
 
-scratchpad_t *create_scratchpad(
-        engine_t *engine, size_t size, bool use_global_scratchpad);
+// Creates a scratchpad of a primitive. A global scratchpad is shared by the
+// primitives created in the same thread. `use_shared_scratchpad` requests the
+// global scratchpad for the shared scratchpad mode, which also applies when
+// the library is built for concurrent execution.
+scratchpad_t *create_scratchpad(engine_t *engine, size_t size,
+        bool use_global_scratchpad, bool use_shared_scratchpad = false);
 
 } // namespace impl
 } // namespace dnnl
@@ -160,6 +160,13 @@ void serialize_post_ops(
                 serialize_md(sstream, entry.binary.user_src1_desc);
                 break;
             case primitive_kind::prelu: sstream.write(&entry.prelu.mask); break;
+            case primitive_kind::pooling:
+                sstream.write(&entry.pooling.alg);
+                sstream.write(&entry.pooling.in_h);
+                sstream.write(&entry.pooling.in_w);
+                sstream.write(&entry.pooling.ker_h);
+                sstream.write(&entry.pooling.ker_w);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -174,6 +181,12 @@ void serialize_attr(
     sstream.write(&attr.fpmath_.apply_to_int_);
     // deterministic
     sstream.write(&attr.deterministic_);
+    // max_threads
+    sstream.write(&attr.max_threads_);
+    // cpu_isa_hints
+    sstream.write(&attr.cpu_isa_hints_);
+    // scratchpad_limit
+    sstream.write(&attr.scratchpad_limit_);
     // acc_mode
     sstream.write(&attr.acc_mode_);
 
@@ -237,6 +250,9 @@ void serialize_attr(
         sstream.write(&zero);
     }
     sstream.write(&attr.src_dyn_quant_params_.group_size_);
+    // softmax_params
+    sstream.write(&attr.softmax_params_.scale_);
+    sstream.write(&attr.softmax_params_.mask_);
 }
 
 void serialize_desc(
@@ -103,7 +103,7 @@ status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
         const data_type_t src_dt = desc.src_desc.data_type;
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
-        auto fwd_attr_mask = smask_t::post_ops;
+        auto fwd_attr_mask = smask_t::post_ops | smask_t::softmax_params;
 
         const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
                 || utils::one_of(dst_dt, data_type::s8, data_type::u8);
@@ -128,6 +128,16 @@ status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
             VCHECK_SOFTMAX_UNIMPL(po.has_default_values({binary, eltwise}),
                     VERBOSE_UNSUPPORTED_POSTOP);
         }
+
+        // Check softmax parameters
+        if (attr->softmax_params_.mask_ == softmax_mask::causal) {
+            const int ndims = desc.dst_desc.ndims;
+            VCHECK_SOFTMAX_UNIMPL(desc.alg_kind == alg_kind::softmax_accurate,
+                    VERBOSE_BAD_ALGORITHM);
+            VCHECK_SOFTMAX_UNIMPL(
+                    ndims >= 2 && desc.softmax_axis == ndims - 1,
+                    VERBOSE_BAD_AXIS);
+        }
     } else {
         VCHECK_SOFTMAX_UNIMPL(false, VERBOSE_UNSUPPORTED_ATTR);
     }
@@ -18,6 +18,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "cpu/platform.hpp"
 #include "engine.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
@@ -28,6 +29,11 @@ using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::utils;
 
+int &dnnl::impl::sync_exec_scope_t::depth() {
+    static thread_local int depth = 0;
+    return depth;
+}
+
 status_t stream_t::enqueue_primitive(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     return primitive_iface->execute(ctx);
@@ -40,10 +46,12 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
     if (engine->kind() != engine_kind::gpu
             && (flags & stream_flags::profiling)) {
         return status::unimplemented;
     }
+#endif
 
     return engine->create_stream(stream, flags);
 }
@@ -61,6 +69,31 @@ status_t dnnl_stream_wait(stream_t *stream) {
     return stream->wait();
 }
 
+status_t dnnl_stream_set_cpu_affinity(
+        stream_t *stream, int ncpus, const int *cpus) {
+    bool args_ok = !any_null(stream, cpus) && ncpus > 0
+            && stream->engine()->kind() == engine_kind::cpu;
+    if (!args_ok) return invalid_arguments;
+
+    std::vector<int> cpu_list(cpus, cpus + ncpus);
+    for (int cpu : cpu_list)
+        if (cpu < 0) return invalid_arguments;
+
+    return stream->set_cpu_affinity(cpu_list);
+}
+
+status_t dnnl_stream_set_numa_node_affinity(stream_t *stream, int node) {
+    bool args_ok = !any_null(stream) && node >= 0
+            && stream->engine()->kind() == engine_kind::cpu;
+    if (!args_ok) return invalid_arguments;
+
+    std::vector<int> cpu_list;
+    if (!cpu::platform::get_numa_node_cpus(node, cpu_list))
+        return invalid_arguments;
+
+    return stream->set_cpu_affinity(cpu_list);
+}
+
 status_t dnnl_stream_destroy(stream_t *stream) {
     delete stream;
     return success;
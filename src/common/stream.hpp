@@ -18,6 +18,8 @@
 #define COMMON_STREAM_HPP
 
 #include <assert.h>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
@@ -50,6 +52,13 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
+    /** binds the threads executing the stream's primitives to the given
+     * logical CPUs */
+    virtual dnnl::impl::status_t set_cpu_affinity(
+            const std::vector<int> &cpus) {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t reset_profiling() {
         return dnnl::impl::status::unimplemented;
     }
@@ -97,6 +106,28 @@ protected:
 #endif
 };
 
+namespace dnnl {
+namespace impl {
+
+// While an object is alive, primitives enqueued by the calling thread are
+// executed synchronously even on out-of-order streams. Used by callers that
+// change the data handles of memory objects, or release them, right after
+// an execution is enqueued, e.g. the graph kernels with their temporaries.
+struct sync_exec_scope_t {
+    sync_exec_scope_t() { depth()++; }
+    ~sync_exec_scope_t() { depth()--; }
+
+    static bool is_active() { return depth() > 0; }
+
+private:
+    static int &depth();
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(sync_exec_scope_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -19,6 +19,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -54,6 +55,7 @@ status_t sum_primitive_desc_create(primitive_desc_iface_t **sum_pd_iface,
 
     if (attr == nullptr) attr = &default_attr();
     VCHECK_SUM_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    max_threads_limit_guard_t max_threads_guard(attr->max_threads_);
 
     const int ndims = src_mds[0]->ndims;
     const dims_t &dims = src_mds[0]->dims;
@@ -0,0 +1,222 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "dnnl_debug.h"
+
+#include "thread_trace.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace thread_trace {
+
+namespace {
+
+struct event_t {
+    const char *category;
+    const char *name;
+    const char *primitive;
+    int ithr, nthr;
+    double ts_us, dur_us;
+};
+
+// Events are appended by the owning thread only. The lock is uncontended
+// except for the final dump.
+struct thread_buffer_t {
+    explicit thread_buffer_t(int tid) : tid(tid) {}
+
+    int tid;
+    std::mutex mutex;
+    std::vector<event_t> events;
+};
+
+// Set once the tracer is destroyed at exit, so that late events from the
+// threads still alive are dropped.
+std::atomic<bool> finalized {false};
+
+struct tracer_t {
+    tracer_t() : start_(std::chrono::steady_clock::now()) {
+        const int len = 1024;
+        char value[len];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "THREAD_TRACE";
+            if (getenv(name.c_str(), value, len) > 0) {
+                path_ = value;
+                break;
+            }
+        }
+    }
+
+    ~tracer_t() {
+        if (!path_.empty()) dump();
+        finalized = true;
+    }
+
+    bool enabled() const { return !path_.empty(); }
+
+    double now_us() const {
+        return std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start_)
+                .count();
+    }
+
+    thread_buffer_t *register_thread() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        const int tid = (int)buffers_.size();
+        buffers_.emplace_back(new thread_buffer_t(tid));
+        return buffers_.back().get();
+    }
+
+    // Primitive names are kept for the lifetime of the process as the
+    // primitives may be destroyed before the dump.
+    const char *intern(const std::string &name) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return names_.insert(name).first->c_str();
+    }
+
+private:
+    void dump();
+
+    std::string path_;
+    std::chrono::steady_clock::time_point start_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<thread_buffer_t>> buffers_;
+    std::set<std::string> names_;
+};
+
+tracer_t &tracer() {
+    static tracer_t t;
+    return t;
+}
+
+thread_local const char *thread_primitive = nullptr;
+
+void record(const event_t &e) {
+    static thread_local thread_buffer_t *buffer = nullptr;
+    if (finalized) return;
+    if (!buffer) buffer = tracer().register_thread();
+    std::lock_guard<std::mutex> guard(buffer->mutex);
+    buffer->events.push_back(e);
+}
+
+void print_string(FILE *f, const char *s) {
+    fputc('"', f);
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+void tracer_t::dump() {
+    FILE *f = fopen(path_.c_str(), "w");
+    if (!f) return;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    const char *delim = "";
+    fprintf(f, "{\"traceEvents\":[");
+    for (const auto &b : buffers_) {
+        std::lock_guard<std::mutex> buffer_guard(b->mutex);
+        fprintf(f,
+                "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                delim, b->tid, b->tid);
+        delim = ",";
+        for (const auto &e : b->events) {
+            fprintf(f, ",\n{\"name\":");
+            print_string(f, e.name);
+            fprintf(f, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                       "\"dur\":%.3f,\"pid\":0,\"tid\":%d,\"args\":{",
+                    e.category, e.ts_us, e.dur_us, b->tid);
+            if (e.primitive) {
+                fprintf(f, "\"primitive\":");
+                print_string(f, e.primitive);
+                if (e.ithr >= 0) fputc(',', f);
+            }
+            if (e.ithr >= 0)
+                fprintf(f, "\"ithr\":%d,\"nthr\":%d", e.ithr, e.nthr);
+            fprintf(f, "}}");
+        }
+    }
+    fprintf(f, "\n]}\n");
+    fclose(f);
+}
+
+} // namespace
+
+bool is_enabled() {
+    static const bool enabled = tracer().enabled();
+    return enabled;
+}
+
+const char *current_primitive() {
+    return thread_primitive;
+}
+
+primitive_scope_t::primitive_scope_t(
+        primitive_kind_t kind, const char *impl_name) {
+    if (!is_enabled()) return;
+
+    enabled_ = true;
+    prev_name_ = thread_primitive;
+    thread_primitive = tracer().intern(
+            std::string(dnnl_prim_kind2str(kind)) + "," + impl_name);
+    start_us_ = tracer().now_us();
+}
+
+primitive_scope_t::~primitive_scope_t() {
+    if (!enabled_) return;
+
+    const double end_us = tracer().now_us();
+    record({"primitive", thread_primitive, nullptr, -1, -1, start_us_,
+            end_us - start_us_});
+    thread_primitive = prev_name_;
+}
+
+event_scope_t::event_scope_t(const char *category, const char *name,
+        const char *primitive, int ithr, int nthr)
+    : category_(category)
+    , name_(name)
+    , primitive_(primitive)
+    , ithr_(ithr)
+    , nthr_(nthr) {
+    if (!is_enabled()) return;
+
+    enabled_ = true;
+    prev_name_ = thread_primitive;
+    thread_primitive = primitive;
+    start_us_ = tracer().now_us();
+}
+
+event_scope_t::~event_scope_t() {
+    if (!enabled_) return;
+
+    const double end_us = tracer().now_us();
+    record({category_, name_, primitive_, ithr_, nthr_, start_us_,
+            end_us - start_us_});
+    thread_primitive = prev_name_;
+}
+
+} // namespace thread_trace
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_THREAD_TRACE_HPP
+#define COMMON_THREAD_TRACE_HPP
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace thread_trace {
+
+// Per-thread execution timeline in the Chrome trace event format (readable by
+// chrome://tracing and Perfetto). Enabled by setting ONEDNN_THREAD_TRACE to
+// the output file name; the file is written at process exit.
+
+// Returns `true` if tracing was requested by the environment.
+bool is_enabled();
+
+// Name of the primitive executed by the calling thread or `nullptr`.
+const char *current_primitive();
+
+// Records primitive execution on the calling thread. The name is propagated
+// to the `parallel()` chunks and barriers executed inside of the scope.
+struct primitive_scope_t {
+    primitive_scope_t(primitive_kind_t kind, const char *impl_name);
+    ~primitive_scope_t();
+
+private:
+    const char *prev_name_ = nullptr;
+    double start_us_ = 0;
+    bool enabled_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_scope_t);
+};
+
+// Records a chunk of a `parallel()` region or a barrier wait on the calling
+// thread. @p primitive becomes the current one for the scope, so that nested
+// events are attributed to it even on worker threads.
+struct event_scope_t {
+    event_scope_t(const char *category, const char *name,
+            const char *primitive, int ithr = -1, int nthr = -1);
+    ~event_scope_t();
+
+private:
+    const char *category_;
+    const char *name_;
+    const char *primitive_;
+    const char *prev_name_ = nullptr;
+    int ithr_, nthr_;
+    double start_us_ = 0;
+    bool enabled_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(event_scope_t);
+};
+
+} // namespace thread_trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
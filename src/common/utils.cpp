@@ -29,6 +29,10 @@
 #include <sys/types.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include <algorithm>
 #include <climits>
 #include <cstdio>
@@ -41,6 +45,7 @@
 
 #include "memory_debug.hpp"
 #include "utils.hpp"
+#include "verbose.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/platform.hpp"
@@ -143,7 +148,94 @@ int getpagesize() {
 #endif
 }
 
+static thread_local jit_code_size_tracker_t *active_code_size_tracker
+        = nullptr;
+
+jit_code_size_tracker_t::jit_code_size_tracker_t()
+    : parent_(active_code_size_tracker) {
+    active_code_size_tracker = this;
+}
+
+jit_code_size_tracker_t::~jit_code_size_tracker_t() {
+    active_code_size_tracker = parent_;
+    add(size_);
+}
+
+void jit_code_size_tracker_t::add(size_t size) {
+    if (active_code_size_tracker) active_code_size_tracker->size_ += size;
+}
+
+static setting_t<int> exec_allocation_check {0};
+int get_exec_allocation_check() {
+    if (!exec_allocation_check.initialized()) {
+        static int val = getenv_int_user(
+                "EXEC_ALLOCATION_CHECK", exec_allocation_check.get());
+        exec_allocation_check.set(val);
+    }
+    return exec_allocation_check.get();
+}
+
+static std::atomic<int> n_active_allocation_checkers {0};
+static std::atomic<size_t> exec_allocation_count {0};
+static std::atomic<size_t> exec_allocation_size {0};
+
+exec_allocation_checker_t::exec_allocation_checker_t(int mode)
+    : mode_(mode)
+    , count_start_(exec_allocation_count.load())
+    , size_start_(exec_allocation_size.load()) {
+    if (mode_ > 0) n_active_allocation_checkers++;
+}
+
+exec_allocation_checker_t::~exec_allocation_checker_t() {
+    if (mode_ > 0) n_active_allocation_checkers--;
+}
+
+size_t exec_allocation_checker_t::count() const {
+    return mode_ > 0 ? exec_allocation_count.load() - count_start_ : 0;
+}
+
+size_t exec_allocation_checker_t::size() const {
+    return mode_ > 0 ? exec_allocation_size.load() - size_start_ : 0;
+}
+
+status_t exec_allocation_checker_t::check(const char *what) const {
+    const size_t n = count();
+    if (n == 0) return status::success;
+    if (mode_ == 1) {
+        VFORMAT(get_msec(), common, exec, VERBOSE_check,
+                "%s,%zu heap allocation(s) of %zu bytes during execution",
+                what, n, size());
+        return status::success;
+    }
+    VERROR(common, common,
+            "%s,%zu heap allocation(s) of %zu bytes during execution", what, n,
+            size());
+    return status::runtime_error;
+}
+
+void exec_allocation_checker_t::on_allocation(size_t size) {
+    if (n_active_allocation_checkers.load(std::memory_order_relaxed) == 0)
+        return;
+    exec_allocation_count++;
+    exec_allocation_size += size;
+}
+
+static setting_t<size_t> huge_page_threshold {0};
+size_t get_huge_page_threshold() {
+    if (!huge_page_threshold.initialized()) {
+        // The value is read as int, hence thresholds set through the
+        // environment are limited to 2GB
+        static size_t val = (size_t)std::max(0,
+                getenv_int_user("HUGE_PAGE_THRESHOLD",
+                        (int)huge_page_threshold.get()));
+        huge_page_threshold.set(val);
+    }
+    return huge_page_threshold.get();
+}
+
 void *malloc(size_t size, int alignment) {
+    exec_allocation_checker_t::on_allocation(size);
+
     void *ptr;
     if (memory_debug::is_mem_debug())
         return memory_debug::malloc(size, alignment);
@@ -152,7 +244,27 @@ void *malloc(size_t size, int alignment) {
     ptr = _aligned_malloc(size, alignment);
     int rc = ptr ? 0 : -1;
 #else
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Large buffers are aligned to a huge page boundary so that the kernel
+    // can back them with huge pages starting from the first byte.
+    const size_t hp_threshold = get_huge_page_threshold();
+    const bool use_huge_pages = hp_threshold > 0 && size >= hp_threshold;
+    const size_t hp_size = 2 * 1024 * 1024;
+    if (use_huge_pages) alignment = std::max(alignment, (int)hp_size);
+#endif
     int rc = ::posix_memalign(&ptr, alignment, size);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // The advice is a hint: a failure (e.g. transparent huge pages are
+    // disabled in the system) leaves the buffer backed with regular pages.
+    // Only the huge pages that lie entirely inside the buffer are advised,
+    // the memory past its end may belong to other allocations.
+    if (rc == 0 && use_huge_pages) {
+        const uintptr_t beg = utils::rnd_up((uintptr_t)ptr, hp_size);
+        const uintptr_t end = utils::rnd_dn((uintptr_t)ptr + size, hp_size);
+        if (end > beg)
+            ::madvise((void *)beg, end - beg, MADV_HUGEPAGE);
+    }
+#endif
 #endif
 
     return (rc == 0) ? ptr : nullptr;
@@ -326,6 +438,17 @@ dnnl_status_t dnnl_set_jit_profiling_flags(unsigned flags) {
 #endif
 }
 
+dnnl_status_t dnnl_set_huge_page_threshold(size_t threshold) {
+    using namespace dnnl::impl;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    huge_page_threshold.set(threshold);
+    return status::success;
+#else
+    UNUSED(threshold);
+    return status::unimplemented;
+#endif
+}
+
 dnnl_status_t dnnl_set_jit_profiling_jitdumpdir(const char *dir) {
     auto status = dnnl::impl::status::unimplemented;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -644,6 +644,12 @@ std::string getenv_string_user(const char *name);
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+// Returns the allocation size starting from which impl::malloc() requests
+// transparent huge pages, 0 if huge pages are disabled
+size_t get_huge_page_threshold();
+// Returns the mode of the execution allocation check, see
+// exec_allocation_checker_t
+int get_exec_allocation_check();
 FILE *fopen(const char *filename, const char *mode);
 int getpagesize();
 
@@ -690,6 +696,57 @@ public:
     DNNL_DISALLOW_COPY_AND_ASSIGN(setting_t);
 };
 
+// Accumulates the size of the JIT code generated by the calling thread while
+// the tracker is alive. Trackers nest: a destroyed tracker adds its size to
+// the enclosing one, so that the code of nested primitives is accounted for
+// by their parent.
+struct jit_code_size_tracker_t {
+    jit_code_size_tracker_t();
+    ~jit_code_size_tracker_t();
+
+    size_t size() const { return size_; }
+
+    // Adds `size` bytes to the innermost tracker of the calling thread.
+    static void add(size_t size);
+
+private:
+    size_t size_ = 0;
+    jit_code_size_tracker_t *parent_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_code_size_tracker_t);
+};
+
+// Counts the heap allocations made by the library while a primitive or a
+// compiled partition is executed. The mode is set with
+// ONEDNN_EXEC_ALLOCATION_CHECK:
+// - 0 (default): the allocations are not counted;
+// - 1: the allocations are reported with verbose;
+// - 2: the allocations are reported and the execution fails.
+// The allocations of all threads are counted, so the executions that are
+// checked should not run concurrently.
+struct exec_allocation_checker_t {
+    exec_allocation_checker_t(int mode = get_exec_allocation_check());
+    ~exec_allocation_checker_t();
+
+    // Number and size of the allocations made since the checker creation.
+    size_t count() const;
+    size_t size() const;
+
+    // Reports the allocations made on behalf of `what` and returns
+    // status::runtime_error if the allocations are not allowed.
+    status_t check(const char *what) const;
+
+    // Called by the library allocation functions.
+    static void on_allocation(size_t size);
+
+private:
+    int mode_;
+    size_t count_start_;
+    size_t size_start_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(exec_allocation_checker_t);
+};
+
 // The following code is derived from Boost C++ library
 // Copyright 2005-2014 Daniel James.
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
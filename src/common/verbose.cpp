@@ -173,10 +173,13 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
             if (s == "check")
                 k |= verbose_t::create_check | verbose_t::exec_check;
             if (s == "dispatch") k |= verbose_t::create_dispatch;
+            if (s == "dispatch_explain")
+                k |= verbose_t::create_dispatch | verbose_t::create_explain;
             if (s == "profile")
                 k |= verbose_t::create_profile | verbose_t::exec_profile;
             if (s == "profile_create") k |= verbose_t::create_profile;
             if (s == "profile_exec") k |= verbose_t::exec_profile;
+            if (s == "profile_exec_ops") k |= verbose_t::exec_profile_ops;
             // Enable profiling to external libraries
             if (s == "profile_externals") k |= verbose_t::profile_externals;
             // we extract debug info debuginfo=XX. ignore if debuginfo is invalid.
@@ -288,6 +291,176 @@ bool get_verbose_timestamp() {
 #endif
 }
 
+#if !defined(DISABLE_VERBOSE)
+static setting_t<bool> verbose_json {false};
+static setting_t<int> verbose_sampling {1};
+#endif
+bool get_verbose_json() {
+#if defined(DISABLE_VERBOSE)
+    return false;
+#else
+    if (verbose.get() == 0) return false;
+
+    if (!verbose_json.initialized()) {
+        // Assumes that all threads see the same environment
+        static bool val = getenv_string_user("VERBOSE_FORMAT") == "json";
+        verbose_json.set(val);
+    }
+    return verbose_json.get();
+#endif
+}
+
+bool get_verbose_exec_sampled() {
+#if defined(DISABLE_VERBOSE)
+    return false;
+#else
+    if (!verbose_sampling.initialized()) {
+        // Assumes that all threads see the same environment
+        static int val
+                = getenv_int_user("VERBOSE_SAMPLING", verbose_sampling.get());
+        verbose_sampling.set(nstl::max(1, val));
+    }
+    const int n = verbose_sampling.get();
+    if (n == 1) return true;
+
+    static std::atomic<size_t> counter {0};
+    return counter.fetch_add(1, std::memory_order_relaxed) % n == 0;
+#endif
+}
+
+namespace {
+struct exec_anomaly_t {
+    std::mutex mutex;
+    std::atomic<bool> enabled {false};
+    dnnl_exec_anomaly_callback_t callback = nullptr;
+    float factor = 0;
+    void *user_data = nullptr;
+};
+
+exec_anomaly_t &exec_anomaly() {
+    static exec_anomaly_t instance;
+    return instance;
+}
+} // namespace
+
+bool get_exec_anomaly_check() {
+    return exec_anomaly().enabled.load(std::memory_order_relaxed);
+}
+
+void check_exec_anomaly(
+        exec_time_stats_t &stats, const char *info, double duration_ms) {
+    // The first executions include one-time costs like page faults and cold
+    // caches, so they only warm up the average.
+    constexpr int warmup_samples = 10;
+    constexpr double alpha = 0.1;
+
+    auto &ea = exec_anomaly();
+    dnnl_exec_anomaly_callback_t callback;
+    float factor;
+    void *user_data;
+    {
+        std::lock_guard<std::mutex> guard(ea.mutex);
+        callback = ea.callback;
+        factor = ea.factor;
+        user_data = ea.user_data;
+    }
+    if (!callback) return;
+
+    double avg_ms = 0;
+    bool is_anomaly = false;
+    {
+        std::lock_guard<std::mutex> guard(stats.mutex);
+        avg_ms = stats.avg_ms;
+        if (stats.nsamples < warmup_samples) {
+            stats.nsamples++;
+            stats.avg_ms += (duration_ms - stats.avg_ms) / stats.nsamples;
+        } else {
+            is_anomaly = duration_ms > factor * avg_ms;
+            stats.avg_ms += alpha * (duration_ms - stats.avg_ms);
+        }
+    }
+
+    // The call-back is called outside of the lock as it may take a while.
+    if (is_anomaly) callback(info, duration_ms, avg_ms, user_data);
+}
+
+namespace {
+void print_json_string(std::stringstream &ss, const std::string &s) {
+    ss << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') ss << '\\';
+        ss << c;
+    }
+    ss << '"';
+}
+} // namespace
+
+void print_verbose_json(double stamp, const char *apitype, const char *logtype,
+        const char *logsubtype, const char *info, double duration,
+        size_t bytes, double flops, uint64_t dram_bytes, long page_faults) {
+    std::stringstream ss;
+    ss.precision(15);
+    ss << "{\"stamp\":" << stamp << ",\"api\":\"" << apitype
+       << "\",\"type\":\"" << logtype << "\"";
+    // Sub-types, e.g. `:cache_hit`, come with a leading colon.
+    if (logsubtype[0] == ':')
+        ss << ",\"subtype\":\"" << logsubtype + 1 << "\"";
+
+    // Primitive lines have the layout of `pd_info_t`, other lines are
+    // reported as is.
+    static const char *fields[] = {"engine", "kind", "impl", "prop_kind",
+            "mds", "attrs", "aux", "problem"};
+    const int nfields = sizeof(fields) / sizeof(fields[0]);
+    std::vector<std::string> values;
+    const std::string info_str(info);
+    for (size_t pos_st = 0;;) {
+        const size_t pos_en = info_str.find(',', pos_st);
+        values.push_back(info_str.substr(pos_st, pos_en - pos_st));
+        if (pos_en == std::string::npos) break;
+        pos_st = pos_en + 1;
+    }
+
+    if (std::string(apitype) == VERBOSE_primitive
+            && (int)values.size() == nfields) {
+        for (int i = 0; i < nfields; i++) {
+            ss << ",\"" << fields[i] << "\":";
+            print_json_string(ss, values[i]);
+        }
+        // Implementation names carry the ISA after a colon, e.g.
+        // `brg_conv_fwd:avx512_core`.
+        const auto isa_pos = values[2].rfind(':');
+        if (isa_pos != std::string::npos) {
+            ss << ",\"isa\":";
+            print_json_string(ss, values[2].substr(isa_pos + 1));
+        }
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        if (std::string(logtype) == VERBOSE_exec
+                && values[0].compare(0, 3, "cpu") == 0)
+            ss << ",\"nthr\":" << dnnl_get_current_num_threads();
+#endif
+    } else {
+        ss << ",\"info\":";
+        print_json_string(ss, info_str);
+    }
+
+    ss << ",\"time\":" << duration;
+    if (bytes > 0) ss << ",\"bytes\":" << bytes;
+    if (flops > 0) ss << ",\"flops\":" << flops;
+    if (dram_bytes > 0) {
+        ss << ",\"dram_bytes\":" << dram_bytes;
+        if (duration > 0)
+            ss << ",\"dram_gbs\":" << dram_bytes / duration / 1e6;
+    }
+    if (page_faults >= 0) ss << ",\"page_faults\":" << page_faults;
+    ss << "}";
+    printf("%s\n", ss.str().c_str());
+}
+
+double get_verbose_flops(const primitive_desc_t *pd) {
+    if (pd->has_runtime_dims_or_strides()) return 0;
+    return nstl::max(0.0, pd->flops());
+}
+
 #if defined(DISABLE_VERBOSE)
 void pd_info_t::init(
         dnnl::impl::engine_t *, const dnnl::impl::primitive_desc_t *) {}
@@ -364,6 +537,7 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::use_shift) s += "H";
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
+    if (flags & normalization_flags::rms_norm) s += "M";
     return s;
 }
 
@@ -665,6 +839,22 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
     if (deterministic) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
+
+    const int max_threads = attr->max_threads_;
+    if (max_threads > 0) {
+        ss << field_delim() << "attr-max-threads:" << max_threads;
+    }
+
+    const dnnl_cpu_isa_hints_t cpu_isa_hints = attr->cpu_isa_hints_;
+    if (cpu_isa_hints != dnnl_cpu_isa_no_hints) {
+        ss << field_delim()
+           << "attr-cpu-isa-hints:" << dnnl_cpu_isa_hints2str(cpu_isa_hints);
+    }
+
+    const size_t scratchpad_limit = attr->scratchpad_limit_;
+    if (scratchpad_limit > 0) {
+        ss << field_delim() << "attr-scratchpad-limit:" << scratchpad_limit;
+    }
     if (attr->has_default_values()) return ss;
 
     const runtime_scales_t &os = attr->output_scales_;
@@ -784,6 +974,10 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                     const post_ops_t::entry_t::quantization_t &qt = e.quantization;
                     ss << delim << qt.alg;
                 } break;
+                case primitive_kind::pooling: {
+                    const post_ops_t::entry_t::pooling_t &p = e.pooling;
+                    ss << delim << p.alg << ":" << p.ker_h << "x" << p.ker_w;
+                } break;
                 default: assert(!"unsupported post op primitive kind!"); break;
             }
             delim = attr_delim;
@@ -803,6 +997,12 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << "src_dyn_quant_group_size:" << dyn_qp.group_size_ << ";";
     }
 
+    const softmax_params_t &sm = attr->softmax_params_;
+    if (!sm.has_default_values()) {
+        ss << field_delim() << "attr-softmax-params:" << sm.scale_ << ":"
+           << (sm.mask_ == softmax_mask::causal ? "causal" : "none");
+    }
+
     return ss;
 }
 
@@ -1604,6 +1804,21 @@ dnnl_status_t dnnl_set_verbose(int level) {
     return success;
 }
 
+dnnl_status_t dnnl_set_exec_anomaly_callback(
+        dnnl_exec_anomaly_callback_t callback, float factor, void *user_data) {
+    using namespace dnnl::impl::status;
+    using namespace dnnl::impl;
+    if (callback && !(factor > 1.f)) return invalid_arguments;
+
+    auto &ea = exec_anomaly();
+    std::lock_guard<std::mutex> guard(ea.mutex);
+    ea.callback = callback;
+    ea.factor = factor;
+    ea.user_data = user_data;
+    ea.enabled.store(callback != nullptr);
+    return success;
+}
+
 const dnnl_version_t *dnnl_version(void) {
     static const dnnl_version_t ver
             = {DNNL_VERSION_MAJOR, DNNL_VERSION_MINOR, DNNL_VERSION_PATCH,
@@ -132,9 +132,17 @@ struct const_expr_value {
 // NOTE: the VPROF macro does not check for verbose flags, it is the
 // responsibility of the caller do check those (it should happen
 // anyway to condition collecting stamp/duration)
-#define VPROF(stamp, apitype, logtype, logsubtype, info, duration) \
+// Optional arguments are the bytes accessed, the FLOPs, the DRAM traffic and
+// the page faults, which are reported in the JSON format only.
+#define VPROF(stamp, apitype, logtype, logsubtype, info, duration, ...) \
     { \
-        VFORMAT(stamp, apitype, logtype, logsubtype, "%s,%g", info, duration); \
+        if (dnnl::impl::get_verbose_json()) \
+            dnnl::impl::print_verbose_json(stamp, CONCAT2(VERBOSE_, apitype), \
+                    CONCAT2(VERBOSE_, logtype), logsubtype, info, duration, \
+                    ##__VA_ARGS__); \
+        else \
+            VFORMAT(stamp, apitype, logtype, logsubtype, "%s,%g", info, \
+                    duration); \
         fflush(stdout); \
     }
 
@@ -151,6 +159,10 @@ struct verbose_t {
         exec_check = 1 << 6,
         exec_profile = 1 << 7,
         profile_externals = 1 << 8,
+        // per-op execution timings inside graph compiled partitions
+        exec_profile_ops = 1 << 9,
+        // parameters chosen by the implementation heuristics at creation
+        create_explain = 1 << 10,
         // the upper 8 bits are reserved for devinfo levels
         debuginfo = 1 << 24,
         //
@@ -222,8 +234,41 @@ static inline uint32_t get_verbose_dev_mode(
 
 bool get_verbose_timestamp();
 
+// Returns `true` if profiling lines are printed as JSON objects, one per line,
+// instead of comma-separated values.
+bool get_verbose_json();
+
+// Returns `true` for one of every ONEDNN_VERBOSE_SAMPLING primitive
+// executions, so that the profiling is only paid for the sampled ones.
+bool get_verbose_exec_sampled();
+
+void print_verbose_json(double stamp, const char *apitype, const char *logtype,
+        const char *logsubtype, const char *info, double duration,
+        size_t bytes = 0, double flops = 0, uint64_t dram_bytes = 0,
+        long page_faults = -1);
+
 /// A container for primitive desc verbose string.
 struct primitive_desc_t;
+
+// Moving average of the execution time of a primitive object used to detect
+// the executions that are much slower than usual.
+struct exec_time_stats_t {
+    std::mutex mutex;
+    double avg_ms = 0;
+    int nsamples = 0;
+};
+
+// Returns `true` if a call-back was set with dnnl_set_exec_anomaly_callback().
+bool get_exec_anomaly_check();
+
+// Updates `stats` with `duration_ms` and calls the anomaly call-back if the
+// duration exceeds the moving average by the requested factor.
+void check_exec_anomaly(
+        exec_time_stats_t &stats, const char *info, double duration_ms);
+
+// Returns the number of floating point operations of the primitive or 0 if it
+// is unknown for the primitive kind or the shapes are not defined.
+double get_verbose_flops(const primitive_desc_t *pd);
 struct pd_info_t {
     pd_info_t() = default;
     pd_info_t(const pd_info_t &rhs)
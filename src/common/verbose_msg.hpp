@@ -34,8 +34,10 @@
 // log subtypes strings
 #define VERBOSE_check ":check"
 #define VERBOSE_dispatch ":dispatch"
+#define VERBOSE_explain ":explain"
 #define VERBOSE_debug ":debug"
 #define VERBOSE_profile ""
+#define VERBOSE_profile_op ":op"
 #define VERBOSE_external ":external"
 
 // verbose messages
@@ -97,6 +99,7 @@
     "sparse encoding is not supported on this isa"
 #define VERBOSE_ISA_DT_MISMATCH \
     "datatype configuration not supported on this isa"
+#define VERBOSE_ISA_NOT_PREFERRED "isa is not preferred by cpu isa hints"
 #define VERBOSE_OFFSET_DT_MISMATCH "%s offsets do not fit into %s datatype"
 #define VERBOSE_PROPKIND_DT_MISMATCH "datatype and propagation kind mismatch"
 #define VERBOSE_WS_MISMATCH \
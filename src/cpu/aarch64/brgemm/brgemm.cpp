@@ -182,6 +182,10 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
                 false, brg->is_int8, brg->is_bf16, brg->is_f32, brg->is_f16))
         return status::unimplemented;
 
+    // Only `sdot` and `udot` are used for int8, mixed signedness requires
+    // `usdot` from FEAT_I8MM which is not detected yet.
+    if (brg->is_int8 && brg->dt_a != brg->dt_b) return status::unimplemented;
+
     CHECK(brgemm_blocking(brg));
 
     return status::success;
@@ -228,7 +232,7 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
     brg->LDD = LDD;
     const auto dt_d = dst_md->data_type;
 
-    if ((brg->dt_a == data_type::u8 && brg->dt_b == data_type::s8)
+    if (brg->is_int8
             && (!one_of(dt_d, data_type::u8, data_type::s8, data_type::s32,
                     data_type::f32))
             && (!one_of(dt_bias, data_type::undef, data_type::u8, data_type::s8,
@@ -247,7 +251,7 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
     brg->dt_d = dt_d;
     brg->typesize_D = types::data_type_size(brg->dt_d);
 
-    if (brg->is_int8 || (brg->dt_d == bf16)) return status::unimplemented;
+    if (brg->dt_d == bf16 && !mayiuse_bf16()) return status::unimplemented;
 
     if (!brg->attr) return status::success;
 
@@ -332,6 +336,12 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
     init_zp_type(brg->zp_type_b, DNNL_ARG_WEIGHTS);
     init_zp_type(brg->zp_type_c, DNNL_ARG_DST);
 
+    // TODO: zero points are not implemented for int8 in the kernel yet.
+    if (brg->is_int8
+            && !everyone_is(brgemm_broadcast_t::none, brg->zp_type_a,
+                    brg->zp_type_b, brg->zp_type_c))
+        return status::unimplemented;
+
     // src zero points require additional register in brgemm kernel
     if (brg->zp_type_a != brgemm_broadcast_t::none
             || (brg->is_bf16_emu && !brg->is_dgmm))
@@ -102,7 +102,10 @@ void set_isa_impl(brgemm_t *brg) {
         brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512), sve_512,
                 is_isa_ok(sve_256), sve_256);
     } else if (brg->is_bf16) {
-        assert(!"unsupported case");
+        // bf16 dot products (`bfdot`) come with FEAT_BF16 extension.
+        if (mayiuse_bf16())
+            brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512),
+                    sve_512, is_isa_ok(sve_256), sve_256);
     } else if (brg->is_f16) {
         assert(!"unsupported case");
     } else if (brg->is_int8) {
@@ -323,7 +326,9 @@ void init_brgemm_conf(brgemm_t *brg, cpu_isa_t isa, brgemm_batch_kind_t type,
     brg->has_int8_vnni = true;
 
     set_brg_vmm(brg); // TODO: Investigate if it is really needed here.
-    brg->req_s8s8_compensation = brg->is_int8 && brg->dt_a == data_type::s8;
+    // `sdot` multiplies signed values natively, so no shift of the source and
+    // no compensation is needed for s8s8 unlike on x64.
+    brg->req_s8s8_compensation = false;
 
     brg->LDA = (brg->is_row_major()) ? static_cast<int>(LDA)
                                      : static_cast<int>(LDB);
@@ -342,7 +347,7 @@ void init_brgemm_conf(brgemm_t *brg, cpu_isa_t isa, brgemm_batch_kind_t type,
     brg->bdb2 = 0;
     brg->bdb2_tail = 0;
 
-    const bool is_b_in_vnni_format = false;
+    const bool is_b_in_vnni_format = brg->is_bf16 || brg->is_int8;
     brg->ld_step
             = is_b_in_vnni_format ? data_type_vnni_granularity(brg->dt_b) : 1;
 
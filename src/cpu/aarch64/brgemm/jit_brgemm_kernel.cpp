@@ -312,6 +312,7 @@ private:
             int bd_block, int ld_block2, bool is_ld_tail, int vpad);
 
     void dot_product(ZReg z1, ZReg z2, ZReg z3);
+    void saturate_cvt_f32(const ZReg &zmm, data_type_t dt_out);
     void gemm_microkernel_sve512(int bd_block2, bool is_bdb_tail, int ld_block,
             bool is_rd_tail, bool is_ld_tail, int vpad, int rows_for_rd_tail);
 
@@ -500,20 +501,32 @@ void jit_brgemm_kernel_t::cvt2ps(data_type_t type_in, const ZReg zmm_in,
         const XReg &addr, bool mask_flag, bool store, PReg ktail_mask,
         const int offset, const int base_offset) {
     const auto mask = mask_flag ? ktail_mask : P_ALL_ONE;
+    const auto vmm = z_tmp_1();
+    // Lower precision values are loaded into 32-bit lanes directly.
     switch (type_in) {
         case data_type::f32:
         case data_type::s32:
-            LD_MUL_VL(ld1w, z_tmp_1().s, mask, addr, offset - base_offset, 4);
-            if (store) //Merging
-                mov(zmm_in.s, ktail_mask / T_m, z_tmp_1().s);
+            LD_MUL_VL(ld1w, vmm.s, mask, addr, offset - base_offset, 4);
+            break;
+        case data_type::bf16:
+            add_imm(X_DEFAULT_ADDR, addr, offset - base_offset, X_TMP_0);
+            ld1h(vmm.s, mask / T_z, ptr(X_DEFAULT_ADDR));
+            lsl(vmm.s, vmm.s, 16);
+            break;
+        case data_type::s8:
+            add_imm(X_DEFAULT_ADDR, addr, offset - base_offset, X_TMP_0);
+            ld1sb(vmm.s, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::u8:
+            add_imm(X_DEFAULT_ADDR, addr, offset - base_offset, X_TMP_0);
+            ld1b(vmm.s, mask / T_z, ptr(X_DEFAULT_ADDR));
             break;
-        case data_type::bf16: assert(!"unsupported data type\n"); break;
-        case data_type::s8: assert(!"unsupported data type\n"); break;
-        case data_type::u8: assert(!"unsupported data type\n"); break;
         default: assert(!"unsupported data type");
     }
-    if (!one_of(type_in, data_type::f32, data_type::bf16))
-        assert(!"unsupported data type\n");
+    if (one_of(type_in, data_type::s32, data_type::s8, data_type::u8))
+        scvtf(vmm.s, mask / T_m, vmm.s);
+    if (store) //Merging
+        mov(zmm_in.s, ktail_mask / T_m, vmm.s);
 }
 
 void jit_brgemm_kernel_t::advance_ldb_post_op_regs() {
@@ -811,7 +824,9 @@ void jit_brgemm_kernel_t::apply_alpha_beta(
         auto vmm = accm(ld_block2, bd, ld);
         if (use_vadd_for_beta) {
             if (brg.is_int8) {
-                assert(!"unsupported\n");
+                add_imm(X_DEFAULT_ADDR, reg_aux_C, C_offset(bd, ld), X_TMP_0);
+                ld1w(vmm_prev_dst.s, k_mask / T_z, ptr(X_DEFAULT_ADDR));
+                add(vmm.s, vmm.s, vmm_prev_dst.s);
             } else {
                 ZRegS z_masked = vmm.s;
                 ZRegS z(vmm.getIdx());
@@ -835,6 +850,8 @@ void jit_brgemm_kernel_t::apply_alpha_beta(
         } else {
             add_imm(X_DEFAULT_ADDR, reg_aux_C, C_offset(bd, ld), X_TMP_0);
             ld1w(vmm_prev_dst.s, k_mask / T_z, ptr(X_DEFAULT_ADDR));
+            if (brg.is_int8)
+                scvtf(vmm_prev_dst.s, P_ALL_ONE / T_m, vmm_prev_dst.s);
             if (brg.beta == 1.f) {
                 fadd(vmm.s, vmm.s, vmm_prev_dst.s);
             } else {
@@ -1033,7 +1050,13 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
 
     const bool dt_requires_saturation
             = one_of(brg.dt_d, data_type::u8, data_type::s8, data_type::s32);
-    if (dt_requires_saturation) { assert(!"unsupported\n"); }
+    if (dt_requires_saturation) {
+        for_(int bd = 0; bd < bd_block; bd++)
+        for (int ld = 0; ld < ld_block2; ld++) {
+            auto zmm = accm(ld_block2, bd, ld);
+            saturate_cvt_f32(zmm, brg.dt_d);
+        }
+    }
 
     x_addr = reg_aux_D;
     base_offset = 0;
@@ -1053,9 +1076,20 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
                     ST_MUL_VL(st1w, zmm.s, k_mask, x_addr, offset - base_offset,
                             4);
                     break;
-                case data_type::bf16: assert(!"unsupported\n"); break;
-                case data_type::s8: assert(!"unsupported\n"); break;
-                case data_type::u8: assert(!"unsupported\n"); break;
+                case data_type::bf16:
+                    // Converted values land in the lower halves of 32-bit
+                    // lanes which is exactly what `st1h` stores.
+                    bfcvt(zmm.h, P_ALL_ONE / T_m, zmm.s);
+                    add_imm(X_DEFAULT_ADDR, x_addr, offset - base_offset,
+                            X_TMP_0);
+                    st1h(zmm.s, k_mask, ptr(X_DEFAULT_ADDR));
+                    break;
+                case data_type::s8:
+                case data_type::u8:
+                    add_imm(X_DEFAULT_ADDR, x_addr, offset - base_offset,
+                            X_TMP_0);
+                    st1b(zmm.s, k_mask, ptr(X_DEFAULT_ADDR));
+                    break;
                 default: assert(!"unknown dst_dt");
             }
         }
@@ -1146,7 +1180,13 @@ void jit_brgemm_kernel_t::store_accumulators_without_post_ops(
             = brg.beta == 1.f && IMPLICATION(brg.is_int8, brg.alpha == 1.0f);
     const bool dt_requires_saturation = brg.is_int8
             && !IMPLICATION(alpha_or_beta_applicable, beta_uses_vadd);
-    if (dt_requires_saturation) { assert(!"unsupported\n"); }
+    if (dt_requires_saturation) {
+        for_(int bd = 0; bd < bd_block; bd++)
+        for (int ld = 0; ld < ld_block2; ld++) {
+            auto zmm = accm(ld_block2, bd, ld);
+            saturate_cvt_f32(zmm, data_type::s32);
+        }
+    }
     auto x_addr = reg_aux_C;
     int base_offset = 0;
 
@@ -1278,16 +1318,34 @@ void jit_brgemm_kernel_t::set_A_B_matrices() {
 }
 
 void jit_brgemm_kernel_t::dot_product(ZReg v1, ZReg v2, ZReg v3) {
+    // Lower precision data is in vnni format: every 32-bit lane keeps
+    // `rd_step` consecutive values along the reduce dimension.
     if (brg.is_f32) {
         fmla(v1.s, P_ALL_ONE / T_m, v2.s, v3.s);
     } else if (brg.is_bf16)
-        assert(!"unsupported\n");
-    else if (brg.is_int8)
-        assert(!"unsupported\n");
+        bfdot(v1.s, v2.h, v3.h);
+    else if (brg.is_int8 && brg.dt_a == data_type::s8)
+        sdot(v1.s, v2.b, v3.b);
+    else if (brg.is_int8 && brg.dt_a == data_type::u8)
+        udot(v1.s, v2.b, v3.b);
     else
         assert(!"unsupported\n");
 }
 
+void jit_brgemm_kernel_t::saturate_cvt_f32(
+        const ZReg &zmm, data_type_t dt_out) {
+    // `fcvtzs` saturates to the s32 range, narrower types are clamped after.
+    frintn(zmm.s, P_ALL_ONE / T_m, zmm.s);
+    fcvtzs(zmm.s, P_ALL_ONE / T_m, zmm.s);
+    if (dt_out == data_type::s8) {
+        smax(zmm.s, -128);
+        smin(zmm.s, 127);
+    } else if (dt_out == data_type::u8) {
+        smax(zmm.s, 0);
+        umin(zmm.s, 255);
+    }
+}
+
 void jit_brgemm_kernel_t::compute_int8_compensation(int rd_loop, int bd_b,
         int bd_e, int bd_block, int ld_block2, bool is_ld_tail, int vpad) {
     assert(brg.is_int8);
@@ -1372,7 +1430,10 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
     int rd_loop = 0, rd_tail_size = 0;
     if (is_rd_tail) {
         if (brg.is_bf16 || brg.is_int8) {
-            assert(!"unsupported\n");
+            rd_tail_size = brg.rdb_tail % brg.rd_step;
+            rd_loop = (rd_tail_size != 0)
+                    ? ((brg.rdb_tail / brg.rd_step) + 1) * brg.rd_step
+                    : brg.rdb_tail;
         } else
             rd_loop = brg.rdb_tail;
     } else
@@ -1383,13 +1444,15 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
         if (is_tail) {
             eor(z1.d, z1.d, z1.d);
             auto xmm_tmp = z_tmp_1();
-            add_imm(X_DEFAULT_ADDR, reg_aux_A, rd_tail_size * brg.typesize_A,
-                    X_TMP_0);
-            set_preg(P_TMP.b, offset);
+            add_imm(X_DEFAULT_ADDR, reg_aux_A, offset, X_TMP_0);
+            set_preg(P_TMP.b, rd_tail_size * brg.typesize_A, X_TMP_0, X_TMP_1);
             ld1b(xmm_tmp.b, P_TMP / T_z, ptr(X_DEFAULT_ADDR));
             dup(z1.s, xmm_tmp.s[0]);
         } else {
-            if (dt == data_type::f32) {
+            // Either a single f32 value or a vnni group of lower precision
+            // values fits into 32 bits.
+            if (one_of(dt, data_type::f32, data_type::bf16, data_type::s8,
+                        data_type::u8)) {
                 if (offset < (1 << 6)) {
                     ld1rw(z1.s, P_ALL_ONE / T_z,
                             ptr(reg_aux_A, (int32_t)offset));
@@ -1397,10 +1460,6 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
                     add_imm(X_DEFAULT_ADDR, reg_aux_A, offset, X_TMP_0);
                     ld1rw(z1.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
                 }
-            } else if (dt == data_type::bf16) {
-                assert(!"unsupported\n");
-            } else if (one_of(dt, data_type::s8, data_type::u8)) {
-                assert(!"unsupported\n");
             } else if (dt == data_type::f16) {
                 assert(!"unsupported\n");
             }
@@ -1433,9 +1492,6 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
                 const auto mask = is_ld_tail ? ld_tail_mask : P_ALL_ONE;
                 if (brg.dt_b == data_type::f16) {
                     assert(!"unsupported\n");
-                } else if (brg.dt_b == data_type::bf16
-                        && brg.isa_impl == sve_256) {
-                    assert(!"unsupported\n");
                 } else if (is_ld_tail) {
                     ld1w(load().s, ld_tail_mask / T_z, addr);
                 } else {
@@ -1469,9 +1525,6 @@ void jit_brgemm_kernel_t::gemm_microkernel_sve512(int bd_block2,
                 const auto mask = is_ld_tail ? ld_tail_mask : P_ALL_ONE;
                 if (brg.dt_b == data_type::f16) {
                     assert(!"unsupported\n");
-                } else if (brg.dt_b == data_type::bf16
-                        && brg.isa_impl == sve_256) {
-                    assert(!"unsupported\n");
                 } else {
                     const int offset = B_offset(ld, rd);
                     if ((unsigned)(offset - base_offset) > cpu_sveLen * 7) {
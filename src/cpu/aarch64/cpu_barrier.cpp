@@ -17,6 +17,8 @@
 
 #include <assert.h>
 
+#include "common/thread_trace.hpp"
+
 #include "cpu/aarch64/cpu_barrier.hpp"
 
 namespace dnnl {
@@ -109,6 +111,8 @@ struct jit_t : public jit_generator {
 };
 
 void barrier(ctx_t *ctx, int nthr) {
+    thread_trace::event_scope_t trace_scope("barrier", "barrier",
+            thread_trace::current_primitive());
     static jit_t j;
     j(ctx, nthr);
 }
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_depthwise_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+template <cpu_isa_t isa>
+void jit_uni_depthwise_injector_f32<isa>::load_vector(const TReg &vmm,
+        const XReg &reg_base, int64_t offset, bool is_broadcast) {
+    h->add_imm(h->X_DEFAULT_ADDR, reg_base, offset, h->X_TMP_0);
+    if (is_broadcast)
+        h->ld1rw(vmm.s, h->P_ALL_ONE / T_z, ptr(h->X_DEFAULT_ADDR));
+    else
+        h->ld1w(vmm.s, h->P_ALL_ONE / T_z, ptr(h->X_DEFAULT_ADDR));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_depthwise_injector_f32<isa>::scale_shift_compute_vector(
+        const TReg &vmm_src, const XReg &p_weights, const XReg &p_bias,
+        bool is_broadcast, int offset) {
+    const auto &dw = post_op_.depthwise;
+    const size_t weights_off = dw.offset[dw.scales] * sizeof(float);
+    const size_t bias_off = dw.offset[dw.shifts] * sizeof(float);
+
+    if (is_broadcast) {
+        load_vector(vmm_mask, p_weights, weights_off, true);
+        load_vector(vmm_aux0, p_bias, bias_off, true);
+    } else {
+        load_vector(vmm_mask, p_weights, offset + weights_off, false);
+        load_vector(vmm_aux0, p_bias, offset + bias_off, false);
+    }
+    h->fmad(vmm_src.s, h->P_ALL_ONE / T_m, vmm_mask.s, vmm_aux0.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_depthwise_injector_f32<isa>::prelu_compute_vector(
+        const TReg &vmm_src, const XReg &p_weights, bool is_broadcast,
+        int offset) {
+    const auto &dw = post_op_.depthwise;
+    const size_t weights_off = dw.offset[dw.scales] * sizeof(float);
+
+    if (is_broadcast)
+        load_vector(vmm_mask, p_weights, weights_off, true);
+    else
+        load_vector(vmm_mask, p_weights, offset + weights_off, false);
+    // Only negative lanes are multiplied by the weights.
+    h->fcmlt(p_mask_.s, h->P_ALL_ONE / T_z, vmm_src.s, 0.0);
+    h->fmul(vmm_src.s, p_mask_ / T_m, vmm_mask.s);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_depthwise_injector_f32<isa>::init_ptrs(const XReg &reg_table,
+        size_t table_off, const XReg &reg_d_weights, const XReg &reg_d_bias,
+        const XReg &ch_off, bool is_broadcast) {
+    const bool with_bias = depthwise_alg == alg_kind::depthwise_scale_shift;
+
+    h->add_imm(h->X_DEFAULT_ADDR, reg_table, table_off, h->X_TMP_0);
+    h->ldr(reg_d_weights, ptr(h->X_DEFAULT_ADDR));
+    if (!is_broadcast) h->add(reg_d_weights, reg_d_weights, ch_off);
+    if (with_bias) h->mov(reg_d_bias, reg_d_weights);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_depthwise_injector_f32<isa>::compute(int start_idx, int end_idx,
+        int vmm_d_weights_idx, int vmm_d_bias_idx, const XReg &reg_d_weights,
+        const XReg &reg_d_bias, bool is_broadcast, int offset) {
+    vmm_mask = TReg(vmm_d_weights_idx);
+    vmm_aux0 = TReg(vmm_d_bias_idx);
+
+    for (int idx = start_idx; idx < end_idx; idx++) {
+        switch (depthwise_alg) {
+            case alg_kind::depthwise_scale_shift:
+                scale_shift_compute_vector(TReg(idx), reg_d_weights,
+                        reg_d_bias, is_broadcast, offset);
+                break;
+            case alg_kind::depthwise_prelu:
+                prelu_compute_vector(
+                        TReg(idx), reg_d_weights, is_broadcast, offset);
+                break;
+            default: assert(!"unsupported depthwise algorithm");
+        }
+    }
+}
+
+template struct jit_uni_depthwise_injector_f32<sve_512>;
+template struct jit_uni_depthwise_injector_f32<sve_256>;
+template struct jit_uni_depthwise_injector_f32<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
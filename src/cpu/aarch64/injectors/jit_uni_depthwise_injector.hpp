@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_DEPTHWISE_INJECTOR_HPP
+#define CPU_AARCH64_JIT_UNI_DEPTHWISE_INJECTOR_HPP
+
+#include <assert.h>
+#include <map>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace depthwise_injector {
+
+/*
+ * Registers used by the depthwise injector inside compute_vector_range().
+ *
+ * @param vmm_d_weights_idx, vmm_d_bias_idx - vector registers for the scales
+ * and the shifts (prelu weights), clobbered.
+ * @param reg_d_weights, reg_d_bias - gprs for the scales and the shifts
+ * pointers, clobbered.
+ * @param reg_init_off - gpr with the channel offset in bytes of the vector
+ * registers block.
+ * @param vmm_idx_off - offset in bytes of the channels of a vector register
+ * relative to reg_init_off.
+ */
+struct dynamic_params_t {
+    dynamic_params_t(int vmm_d_weights_idx = 0, int vmm_d_bias_idx = 0,
+            Xbyak_aarch64::XReg reg_d_weights = Xbyak_aarch64::XReg(0),
+            Xbyak_aarch64::XReg reg_d_bias = Xbyak_aarch64::XReg(0),
+            Xbyak_aarch64::XReg reg_init_off = Xbyak_aarch64::XReg(0),
+            const std::map<size_t, int> &vmm_idx_off = {})
+        : vmm_d_weights_idx(vmm_d_weights_idx)
+        , vmm_d_bias_idx(vmm_d_bias_idx)
+        , reg_d_weights(reg_d_weights)
+        , reg_d_bias(reg_d_bias)
+        , reg_init_off(reg_init_off)
+        , vmm_idx_off(vmm_idx_off) {}
+
+    int vmm_d_weights_idx;
+    int vmm_d_bias_idx;
+    Xbyak_aarch64::XReg reg_d_weights;
+    Xbyak_aarch64::XReg reg_d_bias;
+    Xbyak_aarch64::XReg reg_init_off;
+    std::map<size_t, int> vmm_idx_off;
+};
+
+} // namespace depthwise_injector
+
+/*
+ * Applies depthwise_scale_shift or depthwise_prelu post-op to f32 vector
+ * registers. Scales and shifts are read by full vectors, so the buffers are
+ * expected to be padded up to the vector length as on x64.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_depthwise_injector_f32 {
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+
+    // Prelu uses the host's P_TMP_0 predicate as a scratch register.
+    jit_uni_depthwise_injector_f32(
+            jit_generator *host, const post_ops_t::entry_t &post_op)
+        : h(host), post_op_(post_op), p_mask_(host->P_TMP_0) {
+        depthwise_alg = post_op.depthwise.alg;
+        assert(utils::one_of(depthwise_alg, alg_kind::depthwise_scale_shift,
+                alg_kind::depthwise_prelu));
+    }
+
+    /*
+     * Loads the post-op data pointer from `reg_table + table_off` to the
+     * scales and shifts registers and moves them to the channel offset.
+     * `reg_table` may be the same register as `reg_d_weights`.
+     */
+    void init_ptrs(const Xbyak_aarch64::XReg &reg_table, size_t table_off,
+            const Xbyak_aarch64::XReg &reg_d_weights,
+            const Xbyak_aarch64::XReg &reg_d_bias,
+            const Xbyak_aarch64::XReg &ch_off, bool is_broadcast);
+
+    void compute(int start_idx, int end_idx, int vmm_d_weights_idx,
+            int vmm_d_bias_idx, const Xbyak_aarch64::XReg &reg_d_weights,
+            const Xbyak_aarch64::XReg &reg_d_bias, bool is_broadcast = false,
+            int offset = 0);
+
+    static constexpr size_t memoryStep() { return sizeof(float *); }
+
+private:
+    void load_vector(const TReg &vmm, const Xbyak_aarch64::XReg &reg_base,
+            int64_t offset, bool is_broadcast);
+    void scale_shift_compute_vector(const TReg &vmm_src,
+            const Xbyak_aarch64::XReg &p_weights,
+            const Xbyak_aarch64::XReg &p_bias, bool is_broadcast, int offset);
+    void prelu_compute_vector(const TReg &vmm_src,
+            const Xbyak_aarch64::XReg &p_weights, bool is_broadcast,
+            int offset);
+
+    jit_generator *h;
+
+    alg_kind_t depthwise_alg;
+
+    TReg vmm_mask = TReg(0);
+    TReg vmm_aux0 = TReg(0);
+
+    post_ops_t::entry_t post_op_;
+
+    Xbyak_aarch64::PReg p_mask_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -40,6 +40,16 @@ bool is_supported(const post_ops_ok_args_t &post_ops_ok_args) {
             const auto res = binary_injector::is_supported(
                     isa, src1_desc, *dst_d, enabled_bcast_strategy);
             if (!res) return false;
+        } else if (post_op.is_depthwise()) {
+            if (!utils::one_of(post_op.depthwise.alg,
+                        alg_kind::depthwise_scale_shift,
+                        alg_kind::depthwise_prelu))
+                return false;
+        } else if (post_op.is_quantization()) {
+            if (!utils::one_of(post_op.quantization.alg,
+                        alg_kind::quantization_quantize,
+                        alg_kind::quantization_quantize_dequantize))
+                return false;
         }
     }
     return true;
@@ -50,13 +60,20 @@ jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
         const post_ops_t &post_ops,
         const binary_injector::static_params_t &binary_static_params,
         const eltwise_injector::static_params_t &eltwise_static_params,
+        const quantization_injector::static_params_t
+                &quantization_static_params,
         const lambda_jit_injectors_t &lambda_jit_injectors)
     : post_ops_(post_ops)
     , host_(host)
+    , param1_(binary_static_params.param1)
+    , rhs_arg_table_offset_(
+              binary_static_params.rhs_arg_static_params.abi_param_offset)
+    , reg_quantization_table_(quantization_static_params.reg_d_weights)
     , binary_injector_(nullptr)
     , lambda_jit_injectors_(lambda_jit_injectors) {
 
     const auto &esp = eltwise_static_params;
+    const auto &qsp = quantization_static_params;
     bool is_binary = false;
     bool is_eltwise = false;
 
@@ -70,6 +87,16 @@ jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
                             esp.is_fwd, esp.use_dst));
         } else if (post_op.is_binary()) {
             is_binary = true;
+        } else if (post_op.is_depthwise()) {
+            depthwise_injectors_.emplace_back(
+                    new jit_uni_depthwise_injector_f32<isa>(host, post_op));
+        } else if (post_op.is_quantization()) {
+            using TReg = typename cpu_isa_traits<isa>::TReg;
+            quantization_injectors_.emplace_back(
+                    new jit_uni_quantization_injector_f32<isa>(host, post_op,
+                            TReg(qsp.vmm_d_weights_idx),
+                            TReg(qsp.vmm_d_bias_idx), qsp.reg_d_weights,
+                            qsp.reg_d_bias));
         }
     }
 
@@ -87,6 +114,27 @@ jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
                 host, binary_static_params);
 }
 
+template <cpu_isa_t isa>
+jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
+        const post_ops_t &post_ops,
+        const binary_injector::static_params_t &binary_static_params,
+        const eltwise_injector::static_params_t &eltwise_static_params,
+        const lambda_jit_injectors_t &lambda_jit_injectors)
+    : jit_uni_postops_injector_t(host, post_ops, binary_static_params,
+            eltwise_static_params, quantization_injector::static_params_t(),
+            lambda_jit_injectors) {}
+
+template <cpu_isa_t isa>
+jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
+        const post_ops_t &post_ops,
+        const binary_injector::static_params_t &binary_static_params,
+        const eltwise_injector::static_params_t &eltwise_static_params,
+        const quantization_injector::static_params_t
+                &quantization_static_params)
+    : jit_uni_postops_injector_t(host, post_ops, binary_static_params,
+            eltwise_static_params, quantization_static_params,
+            lambda_jit_injectors_t()) {}
+
 template <cpu_isa_t isa>
 jit_uni_postops_injector_t<isa>::jit_uni_postops_injector_t(jit_generator *host,
         const post_ops_t &post_ops,
@@ -128,12 +176,50 @@ void jit_uni_postops_injector_t<isa>::compute_vector_range(
             start_idx, end_idx, binary_injector::rhs_arg_dynamic_params_t());
 }
 
+template <cpu_isa_t isa>
+void jit_uni_postops_injector_t<isa>::compute_vector_range(size_t start_idx,
+        size_t end_idx,
+        const binary_injector::rhs_arg_dynamic_params_t &rhs_arg_params,
+        const depthwise_injector::dynamic_params_t &ddp,
+        const quantization_injector::dynamic_params_t &qdp,
+        bool is_broadcast) {
+
+    injector_utils::vmm_index_set_t vmm_idxs;
+    for (size_t i = start_idx; i < end_idx; i++)
+        vmm_idxs.emplace(i);
+    compute_vector_range(vmm_idxs, rhs_arg_params, ddp, qdp, is_broadcast);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_postops_injector_t<isa>::load_rhs_arg_table(
+        const Xbyak_aarch64::XReg &reg) const {
+    host_->add_imm(host_->X_DEFAULT_ADDR, param1_, rhs_arg_table_offset_,
+            host_->X_TMP_0);
+    host_->ldr(reg, Xbyak_aarch64::ptr(host_->X_DEFAULT_ADDR));
+}
+
 template <cpu_isa_t isa>
 void jit_uni_postops_injector_t<isa>::compute_vector_range(
         const injector_utils::vmm_index_set_t &vmm_idxs,
         const binary_injector::rhs_arg_dynamic_params_t &rhs_arg_params) {
+    compute_vector_range(vmm_idxs, rhs_arg_params,
+            depthwise_injector::dynamic_params_t(),
+            quantization_injector::dynamic_params_t());
+}
 
+template <cpu_isa_t isa>
+void jit_uni_postops_injector_t<isa>::compute_vector_range(
+        const injector_utils::vmm_index_set_t &vmm_idxs,
+        const binary_injector::rhs_arg_dynamic_params_t &rhs_arg_params,
+        const depthwise_injector::dynamic_params_t &ddp,
+        const quantization_injector::dynamic_params_t &qdp,
+        bool is_broadcast) {
+
+    // Binary, depthwise and quantization post-ops share the rhs arguments
+    // table, in the order of the post-ops.
     std::size_t rhs_arg_idx = 0;
+    std::size_t depthwise_inj_idx = 0;
+    std::size_t quantization_inj_idx = 0;
     for (int i = 0; i < post_ops_.len(); i++) {
         const auto &post_op = post_ops_.entry_[i];
         if (post_op.is_eltwise()) {
@@ -142,6 +228,62 @@ void jit_uni_postops_injector_t<isa>::compute_vector_range(
             binary_injector_->compute_vector_range(
                     vmm_idxs, rhs_arg_idx, post_op, rhs_arg_params);
             ++rhs_arg_idx;
+        } else if (post_op.is_depthwise()) {
+            auto &injector = depthwise_injectors_[depthwise_inj_idx];
+            const size_t table_off = rhs_arg_idx * injector->memoryStep();
+
+            load_rhs_arg_table(ddp.reg_d_weights);
+            injector->init_ptrs(ddp.reg_d_weights, table_off,
+                    ddp.reg_d_weights, ddp.reg_d_bias, ddp.reg_init_off,
+                    is_broadcast);
+            for (auto vmm_idx : vmm_idxs)
+                injector->compute(vmm_idx, vmm_idx + 1, ddp.vmm_d_weights_idx,
+                        ddp.vmm_d_bias_idx, ddp.reg_d_weights, ddp.reg_d_bias,
+                        is_broadcast, ddp.vmm_idx_off.at(vmm_idx));
+
+            ++rhs_arg_idx;
+            ++depthwise_inj_idx;
+        } else if (post_op.is_quantization()) {
+            auto &injector = quantization_injectors_[quantization_inj_idx];
+            const size_t table_off = rhs_arg_idx * injector->memoryStep();
+
+            // Registers with the same channel offset share parameter loads.
+            std::map<int, std::set<size_t>> off_to_vmm_idxs;
+            for (auto vmm_idx : vmm_idxs)
+                off_to_vmm_idxs[qdp.vmm_idx_off.at(vmm_idx)].insert(vmm_idx);
+
+            const bool do_dequantization = post_op.quantization.alg
+                    == alg_kind::quantization_quantize_dequantize;
+            const bool do_rounding = do_dequantization
+                    || qdp.dst_dt == data_type::f32
+                    || i != post_ops_.len() - 1;
+
+            // The table address is reloaded since the injector clobbers it.
+            const auto &reg_table = reg_quantization_table_;
+            load_rhs_arg_table(reg_table);
+            injector->init_crop_ptrs(reg_table, table_off, qdp.reg_oc_off);
+            for (const auto &off_idxs : off_to_vmm_idxs)
+                injector->compute_crop(
+                        off_idxs.second, off_idxs.first, is_broadcast);
+
+            load_rhs_arg_table(reg_table);
+            injector->init_input_scale_shift_ptrs(
+                    reg_table, table_off, qdp.reg_oc_off);
+            for (const auto &off_idxs : off_to_vmm_idxs)
+                injector->compute_input_scale_shift(off_idxs.second,
+                        off_idxs.first, do_rounding, is_broadcast);
+
+            if (do_dequantization) {
+                load_rhs_arg_table(reg_table);
+                injector->init_output_scale_shift_ptrs(
+                        reg_table, table_off, qdp.reg_oc_off);
+                for (const auto &off_idxs : off_to_vmm_idxs)
+                    injector->compute_output_scale_shift(
+                            off_idxs.second, off_idxs.first, is_broadcast);
+            }
+
+            ++rhs_arg_idx;
+            ++quantization_inj_idx;
         } else {
             const auto lam = lambda_jit_injectors_.find(post_op.kind);
             if (lam != lambda_jit_injectors_.end()) lam->second();
@@ -250,6 +392,18 @@ bool post_ops_ok(const post_ops_ok_args_t &post_ops_ok_args) {
                                 enabled_bcast_strategy);
                     }
                     break;
+                case depthwise:
+                    if (entry.is_depthwise())
+                        return utils::one_of(entry.depthwise.alg,
+                                alg_kind::depthwise_scale_shift,
+                                alg_kind::depthwise_prelu);
+                    break;
+                case quantization:
+                    if (entry.is_quantization())
+                        return utils::one_of(entry.quantization.alg,
+                                alg_kind::quantization_quantize,
+                                alg_kind::quantization_quantize_dequantize);
+                    break;
                 default: assert(false && "Unhandled post_op type");
             }
         }
@@ -27,7 +27,9 @@
 #include "common/utils.hpp"
 #include "cpu/aarch64/injectors/injector_utils.hpp"
 #include "cpu/aarch64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/aarch64/injectors/jit_uni_depthwise_injector.hpp"
 #include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/injectors/jit_uni_quantization_injector.hpp"
 #include "cpu/aarch64/jit_generator.hpp"
 #include <initializer_list>
 
@@ -71,6 +73,8 @@ public:
      * params for eltwise_injector
      * @param lambda_jit_injectors <optional> - allows user specify custom injector
      * function for given post-op type
+     * @param quantization_static_params <optional> - registers used by
+     * quantization injectors
      */
     jit_uni_postops_injector_t(jit_generator *host, const post_ops_t &post_ops,
             const binary_injector::static_params_t &binary_static_params);
@@ -84,6 +88,17 @@ public:
             const binary_injector::static_params_t &binary_static_params,
             const eltwise_injector::static_params_t &eltwise_static_params,
             const lambda_jit_injectors_t &lambda_jit_injectors);
+    jit_uni_postops_injector_t(jit_generator *host, const post_ops_t &post_ops,
+            const binary_injector::static_params_t &binary_static_params,
+            const eltwise_injector::static_params_t &eltwise_static_params,
+            const quantization_injector::static_params_t
+                    &quantization_static_params);
+    jit_uni_postops_injector_t(jit_generator *host, const post_ops_t &post_ops,
+            const binary_injector::static_params_t &binary_static_params,
+            const eltwise_injector::static_params_t &eltwise_static_params,
+            const quantization_injector::static_params_t
+                    &quantization_static_params,
+            const lambda_jit_injectors_t &lambda_jit_injectors);
 
     /*
      * Generates code of post_ops chain injected to host primitive. Applied to
@@ -96,6 +111,26 @@ public:
 
     void compute_vector_range(const injector_utils::vmm_index_set_t &vmm_idxs);
 
+    /*
+     * Same as above for post-ops chains with depthwise or quantization
+     * post-ops. Their data pointers are read from the rhs arguments table
+     * (see binary_injector::prepare_binary_args).
+     *
+     * @ddp: registers and channel offsets for depthwise injectors
+     * @qdp: channel offsets for quantization injectors
+     * @is_broadcast: the same channel for all lanes of a vector register
+     */
+    void compute_vector_range(const injector_utils::vmm_index_set_t &vmm_idxs,
+            const binary_injector::rhs_arg_dynamic_params_t &rhs_arg_params,
+            const depthwise_injector::dynamic_params_t &ddp,
+            const quantization_injector::dynamic_params_t &qdp,
+            bool is_broadcast = false);
+    void compute_vector_range(size_t start_idx, size_t end_idx,
+            const binary_injector::rhs_arg_dynamic_params_t &rhs_arg_params,
+            const depthwise_injector::dynamic_params_t &ddp,
+            const quantization_injector::dynamic_params_t &qdp,
+            bool is_broadcast = false);
+
     /*
      * Generates code of post_ops chain injected to host primitive. Applied to
      * range <start_idx, end_idx) of vector registers' indexes.
@@ -125,16 +160,26 @@ public:
             const lambda_jit_injectors_t::mapped_type &jit_injector);
 
 private:
+    // Loads the address of the rhs arguments table to `reg`.
+    void load_rhs_arg_table(const Xbyak_aarch64::XReg &reg) const;
+
     post_ops_t post_ops_;
     jit_generator *host_;
+    Xbyak_aarch64::XReg param1_;
+    std::size_t rhs_arg_table_offset_;
+    Xbyak_aarch64::XReg reg_quantization_table_;
     // Key is a numerical order of a post-op in attributes.
     std::map<int, jit_uni_eltwise_injector_f32<isa>> alg_to_eltwise_injector_;
     std::unique_ptr<binary_injector::jit_uni_binary_injector_t<isa>>
             binary_injector_;
+    std::vector<std::unique_ptr<jit_uni_depthwise_injector_f32<isa>>>
+            depthwise_injectors_;
+    std::vector<std::unique_ptr<jit_uni_quantization_injector_f32<isa>>>
+            quantization_injectors_;
     lambda_jit_injectors_t lambda_jit_injectors_;
 };
 
-enum post_op_type { sum = 0, eltwise, binary };
+enum post_op_type { sum = 0, eltwise, binary, depthwise, quantization };
 
 struct post_ops_ok_args_t {
     post_ops_ok_args_t(const cpu_isa_t isa,
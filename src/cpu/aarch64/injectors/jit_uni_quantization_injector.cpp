@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_quantization_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::init_ptrs(const XReg &reg_table,
+        size_t table_off, const XReg &ch_off, quantization_fields weights,
+        quantization_fields bias) {
+    const auto &q = post_op_.quantization;
+
+    h->add_imm(h->X_DEFAULT_ADDR, reg_table, table_off, h->X_TMP_0);
+    h->ldr(reg_d_weights_, ptr(h->X_DEFAULT_ADDR));
+    h->mov(reg_d_bias_, reg_d_weights_);
+
+    // Parameters known to be all zeros are not loaded, see load_param().
+    auto is_loaded_per_channel = [&](quantization_fields field) {
+        const bool is_scale
+                = utils::one_of(field, q.inp_scale, q.output_scale);
+        return q.per_channel[field] && (is_scale || !q.all_default[field]);
+    };
+    if (is_loaded_per_channel(weights))
+        h->add(reg_d_weights_, reg_d_weights_, ch_off);
+    if (is_loaded_per_channel(bias)) h->add(reg_d_bias_, reg_d_bias_, ch_off);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::load_param(const TReg &vmm,
+        const XReg &reg_base, quantization_fields field, int offset,
+        bool is_broadcast) {
+    const auto &q = post_op_.quantization;
+    // Default scales are ones and are loaded as is.
+    const bool is_scale = utils::one_of(field, q.inp_scale, q.output_scale);
+
+    if (q.per_channel[field] && q.all_default[field] && !is_scale) {
+        h->dup(vmm.s, 0);
+        return;
+    }
+
+    const int64_t off = q.offset[field] * sizeof(float)
+            + (q.per_channel[field] ? offset : 0);
+    h->add_imm(h->X_DEFAULT_ADDR, reg_base, off, h->X_TMP_0);
+    if (!q.per_channel[field] || is_broadcast)
+        h->ld1rw(vmm.s, h->P_ALL_ONE / T_z, ptr(h->X_DEFAULT_ADDR));
+    else
+        h->ld1w(vmm.s, h->P_ALL_ONE / T_z, ptr(h->X_DEFAULT_ADDR));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::init_crop_ptrs(
+        const XReg &reg_table, size_t table_off, const XReg &ch_off) {
+    const auto &q = post_op_.quantization;
+    init_ptrs(reg_table, table_off, ch_off, q.crop_low, q.crop_high);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::compute_crop(
+        const std::set<size_t> &vmm_idxs, int offset, bool is_broadcast) {
+    const auto &q = post_op_.quantization;
+    const bool is_shared_vmm = vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx();
+
+    load_param(vmm_d_weights_, reg_d_weights_, q.crop_low, offset,
+            is_broadcast);
+    if (is_shared_vmm) {
+        for (auto idx : vmm_idxs)
+            h->fmax(TReg(idx).s, h->P_ALL_ONE / T_m, vmm_d_weights_.s);
+    }
+
+    load_param(vmm_d_bias_, reg_d_bias_, q.crop_high, offset, is_broadcast);
+    for (auto idx : vmm_idxs) {
+        const TReg vmm_dst(idx);
+        if (!is_shared_vmm)
+            h->fmax(vmm_dst.s, h->P_ALL_ONE / T_m, vmm_d_weights_.s);
+        h->fmin(vmm_dst.s, h->P_ALL_ONE / T_m, vmm_d_bias_.s);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::init_input_scale_shift_ptrs(
+        const XReg &reg_table, size_t table_off, const XReg &ch_off) {
+    const auto &q = post_op_.quantization;
+    init_ptrs(reg_table, table_off, ch_off, q.inp_scale, q.inp_shift);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::compute_input_scale_shift(
+        const std::set<size_t> &vmm_idxs, int offset, bool do_rounding,
+        bool is_broadcast) {
+    const auto &q = post_op_.quantization;
+    const bool is_shared_vmm = vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx();
+    // A shift that is known to be all zeros is skipped together with its load.
+    const bool with_shift
+            = !(q.per_channel[q.inp_shift] && q.all_default[q.inp_shift]);
+
+    load_param(vmm_d_weights_, reg_d_weights_, q.inp_scale, offset,
+            is_broadcast);
+    if (is_shared_vmm || !with_shift) {
+        for (auto idx : vmm_idxs)
+            h->fmul(TReg(idx).s, TReg(idx).s, vmm_d_weights_.s);
+    }
+
+    if (with_shift) {
+        load_param(vmm_d_bias_, reg_d_bias_, q.inp_shift, offset,
+                is_broadcast);
+        for (auto idx : vmm_idxs) {
+            const TReg vmm_dst(idx);
+            if (is_shared_vmm)
+                h->fadd(vmm_dst.s, vmm_dst.s, vmm_d_bias_.s);
+            else
+                h->fmad(vmm_dst.s, h->P_ALL_ONE / T_m, vmm_d_weights_.s,
+                        vmm_d_bias_.s);
+        }
+    }
+
+    if (do_rounding) {
+        for (auto idx : vmm_idxs)
+            h->frintn(TReg(idx).s, h->P_ALL_ONE / T_m, TReg(idx).s);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::init_output_scale_shift_ptrs(
+        const XReg &reg_table, size_t table_off, const XReg &ch_off) {
+    if (!do_dequantization) return;
+
+    const auto &q = post_op_.quantization;
+    init_ptrs(reg_table, table_off, ch_off, q.output_scale, q.output_shift);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_quantization_injector_f32<isa>::compute_output_scale_shift(
+        const std::set<size_t> &vmm_idxs, int offset, bool is_broadcast) {
+    if (!do_dequantization) return;
+
+    const auto &q = post_op_.quantization;
+    const bool is_shared_vmm = vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx();
+    const bool with_shift = !(
+            q.per_channel[q.output_shift] && q.all_default[q.output_shift]);
+
+    load_param(vmm_d_weights_, reg_d_weights_, q.output_scale, offset,
+            is_broadcast);
+    if (is_shared_vmm || !with_shift) {
+        for (auto idx : vmm_idxs)
+            h->fmul(TReg(idx).s, TReg(idx).s, vmm_d_weights_.s);
+    }
+
+    if (!with_shift) return;
+
+    load_param(vmm_d_bias_, reg_d_bias_, q.output_shift, offset, is_broadcast);
+    for (auto idx : vmm_idxs) {
+        const TReg vmm_dst(idx);
+        if (is_shared_vmm)
+            h->fadd(vmm_dst.s, vmm_dst.s, vmm_d_bias_.s);
+        else
+            h->fmad(vmm_dst.s, h->P_ALL_ONE / T_m, vmm_d_weights_.s,
+                    vmm_d_bias_.s);
+    }
+}
+
+template struct jit_uni_quantization_injector_f32<sve_512>;
+template struct jit_uni_quantization_injector_f32<sve_256>;
+template struct jit_uni_quantization_injector_f32<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_QUANTIZATION_INJECTOR_HPP
+#define CPU_AARCH64_JIT_UNI_QUANTIZATION_INJECTOR_HPP
+
+#include <assert.h>
+#include <map>
+#include <set>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace quantization_injector {
+
+/*
+ * Registers owned by the quantization injectors for the whole kernel.
+ *
+ * @param vmm_d_weights_idx, vmm_d_bias_idx - vector registers for the scales
+ * and the shifts (lower and upper bounds for the crop), clobbered.
+ * @param reg_d_weights, reg_d_bias - gprs for the scales and the shifts
+ * pointers, clobbered.
+ */
+struct static_params_t {
+    static_params_t(int vmm_d_weights_idx = 0, int vmm_d_bias_idx = 0,
+            Xbyak_aarch64::XReg reg_d_weights = Xbyak_aarch64::XReg(0),
+            Xbyak_aarch64::XReg reg_d_bias = Xbyak_aarch64::XReg(0))
+        : vmm_d_weights_idx(vmm_d_weights_idx)
+        , vmm_d_bias_idx(vmm_d_bias_idx)
+        , reg_d_weights(reg_d_weights)
+        , reg_d_bias(reg_d_bias) {}
+
+    int vmm_d_weights_idx;
+    int vmm_d_bias_idx;
+    Xbyak_aarch64::XReg reg_d_weights;
+    Xbyak_aarch64::XReg reg_d_bias;
+};
+
+/*
+ * @param reg_oc_off - gpr with the channel offset in bytes of the vector
+ * registers block.
+ * @param vmm_idx_off - offset in bytes of the channels of a vector register
+ * relative to reg_oc_off.
+ * @param dst_dt - destination data type, results are rounded unless the
+ * quantization is the last post-op with an integer destination.
+ */
+struct dynamic_params_t {
+    dynamic_params_t()
+        : reg_oc_off(Xbyak_aarch64::XReg(0)), vmm_idx_off(), dst_dt(dnnl_f32) {}
+
+    dynamic_params_t(Xbyak_aarch64::XReg reg_oc_off,
+            const std::map<size_t, int> &vmm_idx_off, data_type_t dst_dt)
+        : reg_oc_off(reg_oc_off), vmm_idx_off(vmm_idx_off), dst_dt(dst_dt) {}
+
+    Xbyak_aarch64::XReg reg_oc_off;
+    std::map<size_t, int> vmm_idx_off;
+    data_type_t dst_dt;
+};
+
+} // namespace quantization_injector
+
+/*
+ * Applies quantization_quantize and quantization_quantize_dequantize post-ops
+ * to f32 vector registers: crop, input scale and shift with rounding, output
+ * scale and shift. Per-channel parameters are read by full vectors, so the
+ * buffers are expected to be padded up to the vector length as on x64.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_quantization_injector_f32 {
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+
+    jit_uni_quantization_injector_f32(jit_generator *host,
+            const post_ops_t::entry_t &post_op, TReg vmm_d_weights,
+            TReg vmm_d_bias, Xbyak_aarch64::XReg reg_d_weights,
+            Xbyak_aarch64::XReg reg_d_bias)
+        : h(host)
+        , post_op_(post_op)
+        , vmm_d_weights_(vmm_d_weights)
+        , vmm_d_bias_(vmm_d_bias)
+        , reg_d_weights_(reg_d_weights)
+        , reg_d_bias_(reg_d_bias) {
+        assert(post_op.is_quantization());
+        assert(utils::one_of(post_op.quantization.alg,
+                alg_kind::quantization_quantize,
+                alg_kind::quantization_quantize_dequantize));
+
+        do_dequantization = post_op_.quantization.alg
+                == alg_kind::quantization_quantize_dequantize;
+    }
+
+    /*
+     * Load the post-op data pointer from `reg_table + table_off` and move
+     * the per-channel parameters pointers to the channel offset.
+     */
+    void init_crop_ptrs(const Xbyak_aarch64::XReg &reg_table,
+            size_t table_off, const Xbyak_aarch64::XReg &ch_off);
+    void init_input_scale_shift_ptrs(const Xbyak_aarch64::XReg &reg_table,
+            size_t table_off, const Xbyak_aarch64::XReg &ch_off);
+    void init_output_scale_shift_ptrs(const Xbyak_aarch64::XReg &reg_table,
+            size_t table_off, const Xbyak_aarch64::XReg &ch_off);
+
+    void compute_crop(const std::set<size_t> &vmm_idxs, int offset,
+            bool is_broadcast = false);
+    void compute_input_scale_shift(const std::set<size_t> &vmm_idxs,
+            int offset, bool do_rounding, bool is_broadcast = false);
+    void compute_output_scale_shift(const std::set<size_t> &vmm_idxs,
+            int offset, bool is_broadcast = false);
+
+    // in bytes
+    static constexpr size_t memoryStep() { return sizeof(float *); }
+
+private:
+    using quantization_fields
+            = post_ops_t::entry_t::quantization_t::quantization_fields;
+
+    void init_ptrs(const Xbyak_aarch64::XReg &reg_table, size_t table_off,
+            const Xbyak_aarch64::XReg &ch_off, quantization_fields weights,
+            quantization_fields bias);
+    void load_param(const TReg &vmm, const Xbyak_aarch64::XReg &reg_base,
+            quantization_fields field, int offset, bool is_broadcast);
+
+    jit_generator *h;
+
+    post_ops_t::entry_t post_op_;
+
+    TReg vmm_d_weights_;
+    TReg vmm_d_bias_;
+
+    Xbyak_aarch64::XReg reg_d_weights_;
+    Xbyak_aarch64::XReg reg_d_bias_;
+
+    bool do_dequantization;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
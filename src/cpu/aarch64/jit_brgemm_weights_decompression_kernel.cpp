@@ -0,0 +1,230 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_brgemm_weights_decompression_kernel.hpp"
+
+#define GET_OFF(field) \
+    (uint32_t) offsetof(weights_decompression_runtime_params_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+using namespace Xbyak_aarch64;
+
+namespace {
+bool is_4bit(data_type_t dt) {
+    return one_of(dt, data_type::u4, data_type::s4);
+}
+} // namespace
+
+template <cpu_isa_t isa>
+bool jit_brgemm_weights_decompression_kernel_t<isa>::is_supported(
+        const weights_decompression_compile_params_t &jcp) {
+    namespace dt = data_type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const size_t oc_blocks_num = div_up(jcp.oc_size, vlen);
+    return mayiuse(isa)
+            && one_of(jcp.weights_dt, dt::u8, dt::s8, dt::u4, dt::s4)
+            && oc_blocks_num > 0 && oc_blocks_num <= (size_t)unroll_factor
+            && IMPLICATION(is_4bit(jcp.weights_dt),
+                    jcp.ic_internal_size % 2 == 0)
+            && IMPLICATION(
+                    jcp.with_scales, one_of(jcp.scales_dt, dt::f32, dt::u8))
+            && IMPLICATION(jcp.with_zero_points,
+                    one_of(jcp.zero_points_dt, dt::f32, dt::u8))
+            && (jcp.decomp_buffer_dt == dt::f32
+                    || (jcp.decomp_buffer_dt == dt::bf16 && mayiuse_bf16()
+                            && jcp.ic_internal_size == 2));
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_weights_decompression_kernel_t<isa>::init_decomp_params(
+        int first_vmm_idx, const XReg &reg_params, bool broadcast_values,
+        data_type_t element_type) {
+    const size_t oc_blocks_num = div_up(jcp_.oc_size, vec_size);
+    const size_t dt_size = types::data_type_size(element_type);
+    for (size_t ocb = 0; ocb < oc_blocks_num; ocb++) {
+        const ZReg vmm(first_vmm_idx + ocb);
+        if (broadcast_values) {
+            switch (element_type) {
+                case data_type::f32:
+                    ld1rw(vmm.s, P_ALL_ONE / T_z, ptr(reg_params));
+                    break;
+                case data_type::u8:
+                    ld1rb(vmm.s, P_ALL_ONE / T_z, ptr(reg_params));
+                    ucvtf(vmm.s, P_ALL_ONE / T_m, vmm.s);
+                    break;
+                default: assert(!"unsupported data type");
+            }
+        } else {
+            const auto mask = oc_mask(ocb);
+            add_imm(X_DEFAULT_ADDR, reg_params, ocb * vec_size * dt_size,
+                    X_TMP_0);
+            switch (element_type) {
+                case data_type::f32:
+                    ld1w(vmm.s, mask / T_z, ptr(X_DEFAULT_ADDR));
+                    break;
+                case data_type::u8:
+                    ld1b(vmm.s, mask / T_z, ptr(X_DEFAULT_ADDR));
+                    ucvtf(vmm.s, P_ALL_ONE / T_m, vmm.s);
+                    break;
+                default: assert(!"unsupported data type");
+            }
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_weights_decompression_kernel_t<isa>::load_weights(
+        const ZReg &vmm_load, size_t ocb, int ic) {
+    const auto mask = oc_mask(ocb);
+    // Weights are [ic][oc], 4-bit ones keep a pair of input channels per byte.
+    const size_t ic_pack = is_4bit(jcp_.weights_dt) ? 2 : 1;
+    const size_t offset = (ic / ic_pack) * jcp_.oc_size + ocb * vec_size;
+    add_imm(X_DEFAULT_ADDR, reg_weights, offset, X_TMP_0);
+
+    switch (jcp_.weights_dt) {
+        case data_type::u8:
+        case data_type::u4:
+            ld1b(vmm_load.s, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::s8:
+        case data_type::s4:
+            ld1sb(vmm_load.s, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        default: assert(!"unsupported data type");
+    }
+
+    if (jcp_.weights_dt == data_type::u4) {
+        if (ic % 2 == 0) {
+            lsr(vmm_load.s, vmm_load.s, 4);
+        } else {
+            lsl(vmm_load.s, vmm_load.s, 28);
+            lsr(vmm_load.s, vmm_load.s, 28);
+        }
+    } else if (jcp_.weights_dt == data_type::s4) {
+        if (ic % 2 == 0) {
+            asr(vmm_load.s, vmm_load.s, 4);
+        } else {
+            lsl(vmm_load.s, vmm_load.s, 28);
+            asr(vmm_load.s, vmm_load.s, 28);
+        }
+    }
+    scvtf(vmm_load.s, P_ALL_ONE / T_m, vmm_load.s);
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_weights_decompression_kernel_t<isa>::generate() {
+    preamble();
+
+    ldr(reg_weights, ptr(param1, GET_OFF(weights_ptr)));
+    ldr(reg_decomp_buffer, ptr(param1, GET_OFF(decomp_buffer_ptr)));
+    if (jcp_.with_scales) ldr(reg_scales, ptr(param1, GET_OFF(scales_ptr)));
+    if (jcp_.with_zero_points)
+        ldr(reg_zero_points, ptr(param1, GET_OFF(zero_points_ptr)));
+    ldr(reg_ic_size, ptr(param1, GET_OFF(ic_size)));
+
+    const size_t oc_tail = jcp_.oc_size % vec_size;
+    if (oc_tail) set_preg(p_oc_tail.s, oc_tail, X_TMP_0, X_TMP_1);
+
+    if (jcp_.with_scales)
+        init_decomp_params(vmm_scales(0).getIdx(), reg_scales,
+                jcp_.broadcast_scales, jcp_.scales_dt);
+    if (jcp_.with_zero_points)
+        init_decomp_params(vmm_zero_points(0).getIdx(), reg_zero_points,
+                jcp_.broadcast_zero_points, jcp_.zero_points_dt);
+
+    const size_t oc_blocks_num = div_up(jcp_.oc_size, vec_size);
+    const size_t ic_pack = is_4bit(jcp_.weights_dt) ? 2 : 1;
+    const size_t decomp_buf_dt_size
+            = types::data_type_size(jcp_.decomp_buffer_dt);
+
+    auto decompress = [&](const ZReg &vmm, size_t ocb, int ic) {
+        load_weights(vmm, ocb, ic);
+        if (jcp_.with_zero_points) fsub(vmm.s, vmm.s, vmm_zero_points(ocb).s);
+        if (jcp_.with_scales) fmul(vmm.s, vmm.s, vmm_scales(ocb).s);
+    };
+
+    Label ic_loop_label;
+    Label ic_end_label;
+
+    L(ic_loop_label);
+    {
+        cmp(reg_ic_size, 1);
+        b(LT, ic_end_label);
+
+        if (jcp_.decomp_buffer_dt == data_type::bf16) {
+            // A pair of input channels for an output channel makes a 32-bit
+            // lane: the even channel goes to the lower half.
+            for (size_t ocb = 0; ocb < oc_blocks_num; ocb++) {
+                const auto vmm_even = vmm_weights(0);
+                const auto vmm_odd = vmm_weights(1);
+                decompress(vmm_even, ocb, 0);
+                decompress(vmm_odd, ocb, 1);
+                // `bfcvt` zeroes upper halves of 32-bit lanes.
+                bfcvt(vmm_even.h, P_ALL_ONE / T_m, vmm_even.s);
+                bfcvt(vmm_odd.h, P_ALL_ONE / T_m, vmm_odd.s);
+                lsl(vmm_odd.s, vmm_odd.s, 16);
+                orr(vmm_even.d, vmm_even.d, vmm_odd.d);
+
+                const size_t decomp_buffer_offset
+                        = ocb * jcp_.ic_internal_size * vec_size
+                        * decomp_buf_dt_size;
+                add_imm(X_DEFAULT_ADDR, reg_decomp_buffer, decomp_buffer_offset,
+                        X_TMP_0);
+                st1w(vmm_even.s, oc_mask(ocb), ptr(X_DEFAULT_ADDR));
+            }
+        } else {
+            for_(size_t ocb = 0; ocb < oc_blocks_num; ocb++)
+            for (size_t ic = 0; ic < jcp_.ic_internal_size; ic++) {
+                const auto vmm = vmm_weights(ic % unroll_factor);
+                decompress(vmm, ocb, (int)ic);
+
+                const size_t decomp_buffer_offset
+                        = (ic * jcp_.oc_size + ocb * vec_size)
+                        * decomp_buf_dt_size;
+                add_imm(X_DEFAULT_ADDR, reg_decomp_buffer, decomp_buffer_offset,
+                        X_TMP_0);
+                st1w(vmm.s, oc_mask(ocb), ptr(X_DEFAULT_ADDR));
+            }
+        }
+
+        sub(reg_ic_size, reg_ic_size, 1);
+        add_imm(reg_weights, reg_weights,
+                jcp_.oc_size * jcp_.ic_internal_size / ic_pack, X_TMP_0);
+        add_imm(reg_decomp_buffer, reg_decomp_buffer,
+                decomp_buf_dt_size * jcp_.oc_size * jcp_.ic_internal_size,
+                X_TMP_0);
+
+        b(ic_loop_label);
+    }
+    L(ic_end_label);
+
+    postamble();
+}
+
+template struct jit_brgemm_weights_decompression_kernel_t<sve_512>;
+template struct jit_brgemm_weights_decompression_kernel_t<sve_256>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
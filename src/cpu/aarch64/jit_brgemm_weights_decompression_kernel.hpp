@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_BRGEMM_WEIGHTS_DECOMPRESSION_KERNEL_HPP
+#define CPU_AARCH64_JIT_BRGEMM_WEIGHTS_DECOMPRESSION_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Same interface as the x64 kernel: weights are processed in blocks of
+// `oc_size` output channels times `ic_internal_size` input channels, `ic_size`
+// blocks per call. 4-bit weights keep two consecutive input channels in a
+// byte, the even one in the upper nibble.
+struct weights_decompression_compile_params_t {
+    bool with_scales;
+    bool with_zero_points;
+    bool broadcast_scales;
+    bool broadcast_zero_points;
+    size_t oc_size;
+    size_t ic_internal_size;
+    data_type_t weights_dt;
+    data_type_t decomp_buffer_dt;
+    data_type_t scales_dt;
+    data_type_t zero_points_dt;
+};
+
+struct weights_decompression_runtime_params_t {
+    const void *weights_ptr;
+    const void *decomp_buffer_ptr;
+    const void *scales_ptr;
+    const void *zero_points_ptr;
+    size_t ic_size;
+};
+
+struct jit_weights_decompression_kernel_t {
+    void operator()(const weights_decompression_runtime_params_t *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_weights_decompression_kernel_t(
+            const weights_decompression_compile_params_t &jcp)
+        : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_weights_decompression_kernel_t() {}
+
+    virtual status_t create_kernel() = 0;
+
+protected:
+    void (*ker_)(const weights_decompression_runtime_params_t *);
+
+    weights_decompression_compile_params_t jcp_;
+};
+
+// Supported weights data types are u8, s8, u4 and s4. Decompressed weights are
+// f32, or bf16 packed in pairs along input channels (`ic_internal_size` = 2)
+// to be consumed by `bfdot`.
+template <cpu_isa_t isa>
+struct jit_brgemm_weights_decompression_kernel_t
+    : public jit_weights_decompression_kernel_t,
+      public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_weights_decompression_kernel_t)
+
+    jit_brgemm_weights_decompression_kernel_t(
+            const weights_decompression_compile_params_t &jcp)
+        : jit_weights_decompression_kernel_t(jcp)
+        , jit_generator(nullptr, MAX_CODE_SIZE, true, isa)
+        , vec_size(cpu_isa_traits<isa>::vlen / sizeof(float)) {}
+
+    status_t create_kernel() override {
+        CHECK(jit_generator::create_kernel());
+        ker_ = (decltype(ker_))jit_ker();
+        return status::success;
+    }
+
+    static bool is_supported(
+            const weights_decompression_compile_params_t &jcp);
+
+private:
+    using ZReg = Xbyak_aarch64::ZReg;
+    using XReg = Xbyak_aarch64::XReg;
+    using PReg = Xbyak_aarch64::PReg;
+
+    void generate() override;
+    void init_decomp_params(int first_vmm_idx, const XReg &reg_params,
+            bool broadcast_values, data_type_t element_type);
+    void load_weights(const ZReg &vmm_load, size_t ocb, int ic);
+
+    PReg oc_mask(size_t ocb) const {
+        return (ocb + 1) * vec_size > jcp_.oc_size ? p_oc_tail : P_ALL_ONE;
+    }
+
+    ZReg vmm_scales(int ocb) const { return ZReg(unroll_factor + ocb); }
+    ZReg vmm_zero_points(int ocb) const {
+        return ZReg(2 * unroll_factor + ocb);
+    }
+    ZReg vmm_weights(int ic) const {
+        assert(ic < unroll_factor);
+        return ZReg(ic);
+    }
+
+    const XReg reg_weights = x8;
+    const XReg reg_decomp_buffer = x9;
+    const XReg reg_scales = x10;
+    const XReg reg_zero_points = x11;
+    const XReg reg_ic_size = x12;
+
+    const PReg p_oc_tail = p1;
+
+    const size_t vec_size;
+
+    // Weights use the first `unroll_factor` registers, scales and zero points
+    // one register per output channels block each.
+    static constexpr int unroll_factor = 4;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_AARCH64_JIT_BRGEMM_WEIGHTS_DECOMPRESSION_KERNEL_HPP
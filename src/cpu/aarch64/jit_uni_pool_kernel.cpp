@@ -63,10 +63,14 @@ jit_uni_pool_kernel<isa>::jit_uni_pool_kernel(
 
         const binary_injector::static_params_t bsp {
                 reg_param, get_supported_bcast_strategies(), rhs_sp};
+        const quantization_injector::static_params_t qsp(
+                vmm_d_weights.getIdx(), vmm_d_bias.getIdx(), reg_d_weights,
+                reg_d_bias);
 
         postops_injector_
                 = utils::make_unique<injector::jit_uni_postops_injector_t<isa>>(
-                        this, jpp.post_ops, bsp);
+                        this, jpp.post_ops, bsp,
+                        eltwise_injector::static_params_t(), qsp);
     }
 }
 
@@ -123,7 +127,8 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     jpp.c_without_padding = src_d.dims()[1];
     switch (isa) {
         case sve_512: jpp.c_block = 16; break;
-        default: jpp.c_block = 8; break;
+        case sve_256: jpp.c_block = 8; break;
+        default: jpp.c_block = 4; break;
     }
 
     jpp.alg = pd.alg_kind;
@@ -132,7 +137,9 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     using namespace format_tag;
     const auto blocked_fmt_tag = utils::one_of(isa, sve_512)
             ? utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c)
-            : utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c);
+            : utils::one_of(isa, sve_256)
+                    ? utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c)
+                    : utils::pick(ndims - 3, nCw4c, nChw4c, nCdhw4c);
 
     // src_d.data_type() is equal to dst_d.data_type(). This is checked in init
     auto ncsp_fmt_tag = format_tag::undef;
@@ -378,6 +385,8 @@ bool jit_uni_pool_kernel<isa>::post_ops_ok(jit_pool_conf_t &jpp,
     jpp.with_postops = false;
     jpp.with_eltwise = false;
     jpp.with_binary = false;
+    jpp.with_depthwise = false;
+    jpp.with_quantization = false;
 
     if (!jpp.is_backward) {
         for (const auto &entry : entries) {
@@ -390,11 +399,16 @@ bool jit_uni_pool_kernel<isa>::post_ops_ok(jit_pool_conf_t &jpp,
                     return false;
 
                 jpp.with_binary = true;
+            } else if (entry.is_depthwise()) {
+                jpp.with_depthwise = true;
+            } else if (entry.is_quantization()) {
+                jpp.with_quantization = true;
             } else
                 return false;
         }
 
-        jpp.with_postops = jpp.with_eltwise || jpp.with_binary;
+        jpp.with_postops = jpp.with_eltwise || jpp.with_binary
+                || jpp.with_depthwise || jpp.with_quantization;
     }
 
     return binary_injector::binary_args_broadcast_supported(
@@ -441,7 +455,36 @@ void jit_uni_pool_kernel<isa>::apply_postops(int ur_bc, int ur_w, int c_block,
             }
         }
     }
-    postops_injector_->compute_vector_range(start_idx, end_idx, rhs_arg_params);
+
+    if (!jpp.with_depthwise && !jpp.with_quantization) {
+        postops_injector_->compute_vector_range(
+                start_idx, end_idx, rhs_arg_params);
+        return;
+    }
+
+    // Byte offset of the first channel of the processed blocks, the
+    // per-channel depthwise and quantization parameters are read from it.
+    ldr(reg_oc_off, ptr(reg_param, GET_OFF(b_c)));
+    mov_imm(X_TMP_0, c_block * sizeof(float));
+    mul(reg_oc_off, reg_oc_off, X_TMP_0);
+
+    std::map<size_t, int> vmm_idx_off;
+    for (int jj = 0; jj < ur_w; jj++) {
+        for (int bci = 0; bci < ur_bc; bci++) {
+            const auto vmm_idx
+                    = vreg(reg_ind(0, bci, jj, ur_bc, ur_w)).getIdx();
+            vmm_idx_off.emplace(vmm_idx, bci * c_block * sizeof(float));
+        }
+    }
+
+    const depthwise_injector::dynamic_params_t ddp(vmm_d_weights.getIdx(),
+            vmm_d_bias.getIdx(), reg_d_weights, reg_d_bias, reg_oc_off,
+            vmm_idx_off);
+    const quantization_injector::dynamic_params_t qdp(
+            reg_oc_off, vmm_idx_off, data_type::f32);
+
+    postops_injector_->compute_vector_range(
+            start_idx, end_idx, rhs_arg_params, ddp, qdp);
 }
 
 template <cpu_isa_t isa>
@@ -1061,6 +1104,7 @@ void jit_uni_pool_kernel<isa>::generate() {
 
 template struct jit_uni_pool_kernel<sve_512>;
 template struct jit_uni_pool_kernel<sve_256>;
+template struct jit_uni_pool_kernel<sve_128>;
 
 } // namespace aarch64
 } // namespace cpu
@@ -89,6 +89,11 @@ private:
 
     ZReg z_tmp0 = z4;
 
+    // Depthwise and quantization post-ops parameters, the registers are free
+    // once the accumulators are computed.
+    TReg vmm_d_weights = TReg(0);
+    TReg vmm_d_bias = TReg(1);
+
     PReg k_c_tail_mask_s = p4;
     PReg k_c_tail_mask_s_not = p2;
     PReg k_c_tail_mask_b = p7;
@@ -115,6 +120,10 @@ private:
     xreg_t reg_ker_area_h = x2;
     xreg_t reg_nbc = x1;
 
+    xreg_t reg_d_weights = x8;
+    xreg_t reg_d_bias = x9;
+    xreg_t reg_oc_off = x11;
+
     xreg_t reg_zero_ptr = x5;
     xreg_t reg_zero_id = x13;
     xreg_t reg_zero_ih = x14;
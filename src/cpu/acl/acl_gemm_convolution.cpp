@@ -30,8 +30,12 @@ status_t acl_gemm_convolution_fwd_t<src_type, wei_type, dst_type,
     // Lock here is needed because resource_mapper does not support
     // concurrent multithreaded access.
     std::lock_guard<std::mutex> _lock {this->mtx};
-    // Retrieve primitive resource and configured Compute Library objects
+    // Retrieve primitive resource and configured Compute Library objects,
+    // which may be shared with other primitives using the same weights
     auto *acl_resource = ctx.get_resource_mapper()->get<acl_resource_t>(this);
+    CHECK(acl_resource->configure(pd()->acp_, *pd()->desc(), *pd()->attr(),
+            CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS)));
+    std::lock_guard<std::mutex> _obj_lock {acl_resource->get_mutex()};
     acl_obj_t<arm_compute::NEGEMMConvolutionLayer> &acl_obj
             = acl_resource->get_acl_obj();
 
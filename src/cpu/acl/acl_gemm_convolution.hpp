@@ -21,41 +21,57 @@
 
 #include "cpu/acl/acl_convolution_utils.hpp"
 #include "cpu/acl/acl_post_ops.hpp"
+#include "cpu/acl/acl_weights_cache.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace acl {
 
+using acl_gemm_conv_weights_cache_t = acl_weights_cache_t<convolution_desc_t,
+        acl_obj_t<arm_compute::NEGEMMConvolutionLayer>>;
+
 struct acl_resource_t : public resource_t {
-    acl_resource_t()
-        : acl_obj_(utils::make_unique<
-                acl_obj_t<arm_compute::NEGEMMConvolutionLayer>>()) {}
-
-    status_t configure(const acl_conv_conf_t &acp) {
-        if (!acl_obj_) return status::out_of_memory;
-
-        // Init Compute Library tensors based on info from descriptor
-        acl_obj_->src_tensor.allocator()->init(acp.src_tensor_info);
-        acl_obj_->wei_tensor.allocator()->init(acp.wei_tensor_info);
-        acl_obj_->dst_tensor.allocator()->init(acp.dst_tensor_info);
-        acl_obj_->bia_tensor.allocator()->init(acp.bia_tensor_info);
-
-        acl_obj_->conv.configure(&acl_obj_->src_tensor, &acl_obj_->wei_tensor,
-                acp.with_bias ? &acl_obj_->bia_tensor : nullptr,
-                &acl_obj_->dst_tensor, acp.padstride_info, acp.weights_info,
-                acp.dilation_info, acp.act_info, acp.fast_math);
+    acl_resource_t() : weights_(nullptr) {}
+
+    // Binds the resource to the Compute Library objects configured for the
+    // weights handle, the objects are shared with other primitives.
+    status_t configure(const acl_conv_conf_t &acp,
+            const convolution_desc_t &desc, const primitive_attr_t &attr,
+            const void *weights) {
+        if (acl_obj_ && weights == weights_) return status::success;
+
+        using obj_t = acl_obj_t<arm_compute::NEGEMMConvolutionLayer>;
+        auto configure_obj = [&](obj_t &obj) {
+            // Init Compute Library tensors based on info from descriptor
+            obj.src_tensor.allocator()->init(acp.src_tensor_info);
+            obj.wei_tensor.allocator()->init(acp.wei_tensor_info);
+            obj.dst_tensor.allocator()->init(acp.dst_tensor_info);
+            obj.bia_tensor.allocator()->init(acp.bia_tensor_info);
+
+            obj.conv.configure(&obj.src_tensor, &obj.wei_tensor,
+                    acp.with_bias ? &obj.bia_tensor : nullptr, &obj.dst_tensor,
+                    acp.padstride_info, acp.weights_info, acp.dilation_info,
+                    acp.act_info, acp.fast_math);
+            return status::success;
+        };
+        CHECK(acl_gemm_conv_weights_cache_t::get_instance().get_or_create(
+                acl_obj_, desc, attr, weights, configure_obj));
+        weights_ = weights;
+
         return status::success;
     }
 
+    std::mutex &get_mutex() const { return acl_obj_->mtx; }
     acl_obj_t<arm_compute::NEGEMMConvolutionLayer> &get_acl_obj() const {
-        return *acl_obj_;
+        return acl_obj_->obj;
     }
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(acl_resource_t);
 
 private:
-    std::unique_ptr<acl_obj_t<arm_compute::NEGEMMConvolutionLayer>> acl_obj_;
+    acl_gemm_conv_weights_cache_t::value_t acl_obj_;
+    const void *weights_;
 
 }; // acl_resource_t
 
@@ -124,8 +140,8 @@ struct acl_gemm_convolution_fwd_t : public primitive_t {
         auto r = utils::make_unique<acl_resource_t>();
         if (!r) return status::out_of_memory;
 
-        // Configure the resource based on information from primitive descriptor
-        CHECK(r->configure(pd()->acp_));
+        // Compute Library objects are bound to the resource on the first
+        // execution when the weights handle is known
         mapper.add(this, std::move(r));
 
         CHECK(pd()->post_ops.create_resource(engine, mapper));
@@ -30,15 +30,20 @@ status_t acl_inner_product_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     bool with_bias = pd()->aip.with_bias;
     bool use_dst_acc = pd()->aip.use_dst_acc;
 
-    // Retrieve primitive resource and configured Compute Library objects
-    acl_ip_obj_t &acl_obj = ctx.get_resource_mapper()
-                                    ->get<acl_ip_resource_t>(this)
-                                    ->get_acl_obj();
+    auto wei_base = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+
+    // Retrieve primitive resource and configured Compute Library objects,
+    // which may be shared with other primitives using the same weights
+    auto *acl_resource
+            = ctx.get_resource_mapper()->get<acl_ip_resource_t>(this);
+    CHECK(acl_resource->configure(
+            pd()->aip, *pd()->desc(), *pd()->attr(), wei_base));
+    std::lock_guard<std::mutex> _obj_lock {acl_resource->get_mutex()};
+    acl_ip_obj_t &acl_obj = acl_resource->get_acl_obj();
 
     auto src_base = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     acl_obj.src_tensor.allocator()->import_memory(const_cast<void *>(src_base));
 
-    auto wei_base = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
     acl_obj.wei_tensor.allocator()->import_memory(const_cast<void *>(wei_base));
 
     if (use_dst_acc) {
@@ -21,6 +21,7 @@
 #include "cpu/cpu_inner_product_pd.hpp"
 
 #include "cpu/acl/acl_post_ops.hpp"
+#include "cpu/acl/acl_weights_cache.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -48,37 +49,53 @@ struct acl_ip_conf_t {
     // Additional information about the weights not included in wei_tensor_info
     arm_compute::WeightsInfo weights_info;
 };
+using acl_ip_weights_cache_t
+        = acl_weights_cache_t<inner_product_desc_t, acl_ip_obj_t>;
+
 struct acl_ip_resource_t : public resource_t {
-    acl_ip_resource_t() : acl_ip_obj_(utils::make_unique<acl_ip_obj_t>()) {}
-
-    status_t configure(const acl_ip_conf_t &aip) {
-        if (!acl_ip_obj_) return status::out_of_memory;
-
-        // Init Compute Library tensors based on info from descriptor
-        acl_ip_obj_->src_tensor.allocator()->init(aip.src_tensor_info);
-        acl_ip_obj_->wei_tensor.allocator()->init(aip.wei_tensor_info);
-        acl_ip_obj_->dst_tensor.allocator()->init(aip.dst_tensor_info);
-        acl_ip_obj_->bia_tensor.allocator()->init(aip.bia_tensor_info);
-
-        // clang-format off
-        acl_ip_obj_->fc.configure(
-            &acl_ip_obj_->src_tensor,
-            &acl_ip_obj_->wei_tensor,
-            aip.with_bias ? &acl_ip_obj_->bia_tensor : nullptr,
-            &acl_ip_obj_->dst_tensor,
-            aip.fc_info,
-            aip.weights_info);
-        // clang-format on
+    acl_ip_resource_t() : weights_(nullptr) {}
+
+    // Binds the resource to the Compute Library objects configured for the
+    // weights handle, the objects are shared with other primitives.
+    status_t configure(const acl_ip_conf_t &aip,
+            const inner_product_desc_t &desc, const primitive_attr_t &attr,
+            const void *weights) {
+        if (acl_ip_obj_ && weights == weights_) return status::success;
+
+        auto configure_obj = [&](acl_ip_obj_t &obj) {
+            // Init Compute Library tensors based on info from descriptor
+            obj.src_tensor.allocator()->init(aip.src_tensor_info);
+            obj.wei_tensor.allocator()->init(aip.wei_tensor_info);
+            obj.dst_tensor.allocator()->init(aip.dst_tensor_info);
+            obj.bia_tensor.allocator()->init(aip.bia_tensor_info);
+
+            // clang-format off
+            obj.fc.configure(
+                &obj.src_tensor,
+                &obj.wei_tensor,
+                aip.with_bias ? &obj.bia_tensor : nullptr,
+                &obj.dst_tensor,
+                aip.fc_info,
+                aip.weights_info);
+            // clang-format on
+
+            return status::success;
+        };
+        CHECK(acl_ip_weights_cache_t::get_instance().get_or_create(
+                acl_ip_obj_, desc, attr, weights, configure_obj));
+        weights_ = weights;
 
         return status::success;
     }
 
-    acl_ip_obj_t &get_acl_obj() const { return *acl_ip_obj_; }
+    std::mutex &get_mutex() const { return acl_ip_obj_->mtx; }
+    acl_ip_obj_t &get_acl_obj() const { return acl_ip_obj_->obj; }
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(acl_ip_resource_t);
 
 private:
-    std::unique_ptr<acl_ip_obj_t> acl_ip_obj_;
+    acl_ip_weights_cache_t::value_t acl_ip_obj_;
+    const void *weights_;
 }; // acl_ip_resource_t
 
 struct acl_inner_product_fwd_t : public primitive_t {
@@ -306,8 +323,8 @@ struct acl_inner_product_fwd_t : public primitive_t {
         auto r = utils::make_unique<acl_ip_resource_t>();
         if (!r) return status::out_of_memory;
 
-        // Configure the resource based on information from primitive descriptor
-        CHECK(r->configure(pd()->aip));
+        // Compute Library objects are bound to the resource on the first
+        // execution when the weights handle is known
         mapper.add(this, std::move(r));
 
         CHECK(pd()->post_ops.create_resource(engine, mapper));
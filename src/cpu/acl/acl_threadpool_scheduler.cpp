@@ -30,6 +30,7 @@
 #include "arm_compute/runtime/IScheduler.h"
 
 // BARRIER
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -83,7 +84,6 @@ unsigned int ThreadpoolScheduler::num_threads() const {
 }
 
 void ThreadpoolScheduler::set_num_threads(unsigned int num_threads) {
-    arm_compute::lock_guard<std::mutex> lock(this->_run_workloads_mutex);
     _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
 }
 
@@ -91,28 +91,100 @@ void ThreadpoolScheduler::schedule(ICPPKernel *kernel, const Hints &hints) {
     ITensorPack tensors;
     // Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
     acl_thread_utils::acl_set_threadpool_num_threads();
-    schedule_common(kernel, hints, kernel->window(), tensors);
+    schedule_window(kernel, hints, kernel->window(), tensors);
 }
 
 void ThreadpoolScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints,
         const Window &window, ITensorPack &tensors) {
     // Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
     acl_thread_utils::acl_set_threadpool_num_threads();
-    schedule_common(kernel, hints, window, tensors);
+    schedule_window(kernel, hints, window, tensors);
 }
 
-void ThreadpoolScheduler::run_workloads(
-        std::vector<arm_compute::IScheduler::Workload> &workloads) {
+void ThreadpoolScheduler::schedule_window(ICPPKernel *kernel,
+        const Hints &hints, const Window &window, ITensorPack &tensors) {
+    // 2D splits are left to the generic Compute Library implementation
+    if (hints.split_dimension() == IScheduler::split_dimensions_all) {
+        schedule_common(kernel, hints, window, tensors);
+        return;
+    }
 
-    arm_compute::lock_guard<std::mutex> lock(this->_run_workloads_mutex);
+    const size_t split_dim = hints.split_dimension();
+    const unsigned int num_iterations = window.num_iterations(split_dim);
+    if (num_iterations == 0) return;
+
+    const unsigned int nthr = num_threads();
+    unsigned int num_windows = 1;
+    if (kernel->is_parallelisable() && nthr > 1) {
+        // Dynamic strategy asks for more windows than threads to balance the
+        // load, the threads pick them up one by one.
+        const bool is_dynamic
+                = hints.strategy() == IScheduler::StrategyHint::DYNAMIC;
+        num_windows = is_dynamic && hints.threshold() > 0
+                ? static_cast<unsigned int>(hints.threshold())
+                : nthr;
+        // Do not make windows smaller than the kernel minimal workload size
+        const size_t mws
+                = std::max<size_t>(1, kernel->get_mws(cpu_info(), nthr));
+        num_windows = std::min<size_t>(
+                num_windows, std::max<size_t>(1, num_iterations / mws));
+        num_windows = std::min(num_windows, num_iterations);
+    }
+
+    auto run_window = [&](const Window &win, const ThreadInfo &info) {
+        if (tensors.empty())
+            kernel->run(win, info);
+        else
+            kernel->run_op(tensors, win, info);
+    };
 
+    // Small problems run in the calling thread, which saves the threadpool
+    // dispatch and synchronization.
+    if (num_windows == 1) {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        run_window(window, info);
+        return;
+    }
+
+    const Window::Dimension &dim = window[split_dim];
+    std::vector<IScheduler::Workload> workloads(num_windows);
+    for (unsigned int iwin = 0; iwin < num_windows; iwin++) {
+        workloads[iwin] = [&, iwin](const ThreadInfo &info) {
+            int start {0}, end {0};
+            balance211(static_cast<int>(num_iterations),
+                    static_cast<int>(num_windows), static_cast<int>(iwin),
+                    start, end);
+            Window win = window;
+            win.set(split_dim,
+                    Window::Dimension(dim.start() + start * dim.step(),
+                            dim.start() + end * dim.step(), dim.step()));
+            win.validate();
+            run_window(win, info);
+        };
+    }
+    run_workloads(workloads);
+}
+
+void ThreadpoolScheduler::run_workloads(
+        std::vector<arm_compute::IScheduler::Workload> &workloads) {
     const unsigned int num_threads
             = std::min(static_cast<unsigned int>(_num_threads),
                     static_cast<unsigned int>(workloads.size()));
     if (num_threads < 1) { return; }
-    ThreadFeeder feeder(num_threads, workloads.size());
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
+
+    // Nothing to share: run in the calling thread without the dispatch
+    if (num_threads == 1 || tp == nullptr) {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        for (auto &workload : workloads)
+            workload(info);
+        return;
+    }
+
+    ThreadFeeder feeder(num_threads, workloads.size());
     bool is_async = tp->get_flags()
             & dnnl::threadpool_interop::threadpool_iface::ASYNCHRONOUS;
     counting_barrier_t b;
@@ -21,8 +21,9 @@
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 
+#include <atomic>
+
 #include "arm_compute/runtime/IScheduler.h"
-#include "support/Mutex.h"
 
 namespace dnnl {
 namespace impl {
@@ -54,8 +55,14 @@ protected:
     void run_workloads(std::vector<Workload> &workloads) override;
 
 private:
-    uint _num_threads {};
-    arm_compute::Mutex _run_workloads_mutex {};
+    /// Splits the window along the hinted dimension the same way oneDNN
+    /// partitions work between threads and runs the pieces.
+    void schedule_window(arm_compute::ICPPKernel *kernel,
+            const arm_compute::IScheduler::Hints &hints,
+            const arm_compute::Window &window,
+            arm_compute::ITensorPack &tensors);
+
+    std::atomic<unsigned int> _num_threads {};
 };
 
 } // namespace acl
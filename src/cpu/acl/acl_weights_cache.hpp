@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2024 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_ACL_WEIGHTS_CACHE_HPP
+#define CPU_ACL_WEIGHTS_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace acl {
+
+// Configured Compute Library objects shared by primitives. Runs have to be
+// serialized with `mtx` since the objects keep imported tensors.
+template <typename obj_t>
+struct acl_shared_obj_t {
+    std::mutex mtx;
+    obj_t obj;
+};
+
+// Process-wide cache of configured Compute Library objects keyed on the
+// operation descriptor, the attributes and the weights handle. Compute Library
+// functions prepare (reshape) the weights on the first run and keep the result,
+// so the primitives created for the same problem and weights share a single
+// copy. The cache outlives primitives: a primitive re-created after eviction
+// from the primitive cache does not re-pack the weights.
+//
+// As for a single primitive, the weights behind a handle are assumed to be
+// constant.
+//
+// The number of entries is set by ONEDNN_ACL_WEIGHTS_CACHE_CAPACITY (1024 by
+// default), 0 disables the sharing.
+template <typename desc_t, typename obj_t>
+struct acl_weights_cache_t {
+    using value_t = std::shared_ptr<acl_shared_obj_t<obj_t>>;
+
+    static acl_weights_cache_t &get_instance() {
+        static acl_weights_cache_t cache;
+        return cache;
+    }
+
+    // Returns the object for the key in `value`, a new one is configured with
+    // `configure(obj_t &)` on a miss.
+    template <typename configure_t>
+    status_t get_or_create(value_t &value, const desc_t &desc,
+            const primitive_attr_t &attr, const void *weights,
+            const configure_t &configure) {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            if (it->weights != weights || !(it->desc == desc)
+                    || !(it->attr == attr))
+                continue;
+            // Most recently used entries go first
+            entries_.splice(entries_.begin(), entries_, it);
+            value = it->value;
+            return status::success;
+        }
+
+        auto new_value = std::make_shared<acl_shared_obj_t<obj_t>>();
+        if (!new_value) return status::out_of_memory;
+        CHECK(configure(new_value->obj));
+
+        if (capacity_ > 0) {
+            entries_.push_front({desc, attr, weights, new_value});
+            if ((int)entries_.size() > capacity_) entries_.pop_back();
+        }
+        value = new_value;
+        return status::success;
+    }
+
+private:
+    acl_weights_cache_t()
+        : capacity_(getenv_int_user("ACL_WEIGHTS_CACHE_CAPACITY", 1024)) {}
+
+    struct entry_t {
+        desc_t desc;
+        primitive_attr_t attr;
+        const void *weights;
+        value_t value;
+    };
+
+    std::mutex mtx_;
+    std::list<entry_t> entries_;
+    const int capacity_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(acl_weights_cache_t);
+};
+
+} // namespace acl
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
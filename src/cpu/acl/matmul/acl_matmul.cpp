@@ -41,6 +41,14 @@ status_t acl_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
     acl_matmul_obj_t &acl_obj = acl_resource->get_acl_obj();
 
     const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    if (pd()->amp_.with_runtime_m) {
+        CHECK(acl_matmul_utils::update_runtime_m(acl_obj, pd()->amp_,
+                ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md()),
+                memory_desc_wrapper(pd()->weights_md()),
+                ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md())));
+    }
+
     // [WA] ACL Matmul produces wrong results in case it is not reconfigured on each inference
     if (do_transC) {
         acl_obj.gemm.configure(&acl_obj.wei_tensor, &acl_obj.src_tensor,
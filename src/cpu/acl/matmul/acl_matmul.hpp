@@ -122,10 +122,24 @@ struct acl_matmul_t : public primitive_t {
                             | smask_t::post_ops | smask_t::fpmath_mode),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_MATMUL(attr_oscale_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
-            VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
-                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
-            if (weights_format_kind_ == format_kind::any) {
+            amp_.with_runtime_m = false;
+            if (has_runtime_dims_or_strides()) {
+                // A runtime M (e.g. sequence length) is served by one
+                // primitive with pre-packed fixed-format weights. Unfused
+                // post-ops need a known dst, so only an eltwise that fuses
+                // into the gemm is allowed.
+                const auto &po = attr()->post_ops_;
+                VDISPATCH_MATMUL(weights_format_kind_ == format_kind::any
+                                && !memory_desc_wrapper(weights_md())
+                                            .has_runtime_dims_or_strides()
+                                && (po.len() == 0
+                                        || (po.len() == 1
+                                                && po.entry_[0].is_eltwise())),
+                        VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+                CHECK(acl_matmul_utils::init_conf_matmul_runtime_m(
+                        amp_, src_md_, weights_md_, dst_md_, *desc(), *attr()));
+            } else if (weights_format_kind_ == format_kind::any) {
                 CHECK(acl_matmul_utils::init_conf_matmul<true>(
                         amp_, src_md_, weights_md_, dst_md_, *desc(), *attr()));
             } else {
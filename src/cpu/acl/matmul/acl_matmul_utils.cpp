@@ -173,6 +173,73 @@ status_t init_conf_matmul(acl_matmul_conf_t &amp, memory_desc_t &src_md,
     return status::success;
 }
 
+status_t init_conf_matmul_runtime_m(acl_matmul_conf_t &amp,
+        const memory_desc_t &src_md, memory_desc_t &wei_md,
+        const memory_desc_t &dst_md, const matmul_desc_t &md,
+        const primitive_attr_t &attr) {
+    using namespace format_tag;
+
+    // The fixed-format kernel, and hence the weights layout, is selected for
+    // this M. It does not depend on M for the kernels ACL provides.
+    constexpr dim_t nominal_M = 64;
+
+    auto src_tag = memory_desc_matches_one_of_tag(src_md, abcd, abc, ab);
+    auto dst_tag = memory_desc_matches_one_of_tag(dst_md, abcd, abc, ab);
+    ACL_CHECK_SUPPORT(utils::one_of(format_tag::undef, src_tag, dst_tag),
+            "runtime M requires plain src and dst");
+
+    // Only M may be unknown
+    for (const auto *d : {&src_md, &dst_md})
+        for (int i = 0; i < d->ndims; i++)
+            ACL_CHECK_SUPPORT(
+                    i != d->ndims - 2 && is_runtime_value(d->dims[i]),
+                    "only M can be a runtime dimension");
+
+    auto init_nominal = [&](memory_desc_t &nominal_md,
+                                const memory_desc_t &base_md,
+                                format_tag_t tag) {
+        dims_t dims;
+        utils::array_copy(dims, base_md.dims, base_md.ndims);
+        dims[base_md.ndims - 2] = nominal_M;
+        return memory_desc_init_by_tag(
+                nominal_md, base_md.ndims, dims, base_md.data_type, tag);
+    };
+
+    memory_desc_t src_nominal_md, dst_nominal_md;
+    CHECK(init_nominal(src_nominal_md, src_md, src_tag));
+    CHECK(init_nominal(dst_nominal_md, dst_md, dst_tag));
+
+    CHECK(init_conf_matmul<true>(
+            amp, src_nominal_md, wei_md, dst_nominal_md, md, attr));
+    amp.with_runtime_m = true;
+
+    return status::success;
+}
+
+status_t update_runtime_m(acl_matmul_obj_t &acl_obj,
+        const acl_matmul_conf_t &amp, const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &wei_d, const memory_desc_wrapper &dst_d) {
+    using namespace format_tag;
+
+    if (!src_d.matches_one_of_tag(abcd, abc, ab)
+            || !dst_d.matches_one_of_tag(abcd, abc, ab))
+        return status::invalid_arguments;
+
+    cpu::matmul::matmul_helper_t helper(src_d, wei_d, dst_d);
+    const dim_t M = helper.M();
+    const dim_t N = helper.N();
+    const dim_t K = helper.K();
+
+    acl_obj.src_tensor.allocator()->init(arm_compute::TensorInfo(
+            arm_compute::TensorShape(K, M, 1, helper.src_batch()), 1,
+            amp.src_tensor_info.data_type()));
+    acl_obj.dst_tensor.allocator()->init(arm_compute::TensorInfo(
+            arm_compute::TensorShape(N, M, 1, helper.batch()), 1,
+            amp.dst_tensor_info.data_type()));
+
+    return status::success;
+}
+
 status_t init_scratchpad(memory_tracking::registrar_t &scratchpad,
         acl_matmul_conf_t &amp, memory_desc_t &dst_md) {
     if (amp.use_dst_acc_for_sum) {
@@ -46,6 +46,9 @@ struct acl_matmul_conf_t {
     // If this is true, the result of the matmul goes into a temporarily
     // allocated ACL tensor to be accumulated into the oneDNN dst during postops
     bool use_dst_acc_for_sum;
+    // M is DNNL_RUNTIME_DIM_VAL: ACL objects are configured for a nominal M
+    // and the src/dst shapes are updated before every run.
+    bool with_runtime_m;
     arm_compute::TensorInfo src_tensor_info;
     arm_compute::TensorInfo wei_tensor_info;
     arm_compute::TensorInfo dst_tensor_info;
@@ -62,6 +65,18 @@ status_t init_conf_matmul(acl_matmul_conf_t &amp, memory_desc_t &src_md,
         memory_desc_t &wei_md, memory_desc_t &dst_md, const matmul_desc_t &md,
         const primitive_attr_t &attr);
 
+// Configures fixed-format weights for src/dst with a runtime M (the
+// second-to-last dimension). Only plain row-major src and dst are supported.
+status_t init_conf_matmul_runtime_m(acl_matmul_conf_t &amp,
+        const memory_desc_t &src_md, memory_desc_t &wei_md,
+        const memory_desc_t &dst_md, const matmul_desc_t &md,
+        const primitive_attr_t &attr);
+
+// Re-initializes the src and dst tensors for the actual M of an execution.
+status_t update_runtime_m(acl_matmul_obj_t &acl_obj,
+        const acl_matmul_conf_t &amp, const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &wei_d, const memory_desc_wrapper &dst_d);
+
 status_t init_scratchpad(memory_tracking::registrar_t &scratchpad,
         acl_matmul_conf_t &amp, memory_desc_t &dst_md);
 
@@ -50,6 +50,9 @@
 #include "cpu/x64/jit_brgemm_conv_bwd.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_strided.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+#include "cpu/x64/jit_brgemm_grouped_conv.hpp"
+#include "cpu/x64/jit_brgemm_planar_conv.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
@@ -87,11 +90,14 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         // FWD fp
         {{forward, f32, f32, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t, avx512_core_amx)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx, true)
             CPU_INSTANCE_AVX512(jit_avx512_common_planar_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_planar_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_grouped_convolution_fwd_t, avx512_core)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t, avx512_core)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core, true)
@@ -101,6 +107,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(jit_avx512_common_convolution_fwd_t, f32)
             CPU_INSTANCE_AVX2(jit_avx2_planar_convolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_avx2_dw_convolution_fwd_t)
+            CPU_INSTANCE_AVX2(brgemm_grouped_convolution_fwd_t, avx2)
             CPU_INSTANCE_AVX2(brgemm_1x1_convolution_fwd_t, avx2)
             CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t, avx2)
             CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t, avx2, true)
@@ -133,6 +140,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx, true)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_grouped_convolution_fwd_t, avx512_core_bf16)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t, avx512_core_bf16)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16, true)
@@ -155,6 +163,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx, true)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_grouped_convolution_fwd_t, avx512_core_bf16)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t, avx512_core_bf16)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16, true)
@@ -222,6 +231,67 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE(ref_convolution_fwd_t)
             nullptr,
         }},
+        // FWD weights decompression
+        {{forward, f32, s8, f32}, {
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core)
+            CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t, avx2)
+            nullptr,
+        }},
+        {{forward, bf16, s8, f32}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, bf16, s8, bf16}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, f32, u8, f32}, {
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core)
+            CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t, avx2)
+            nullptr,
+        }},
+        {{forward, bf16, u8, f32}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, bf16, u8, bf16}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, f32, s4, f32}, {
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core)
+            CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t, avx2)
+            nullptr,
+        }},
+        {{forward, bf16, s4, f32}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, bf16, s4, bf16}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, f32, u4, f32}, {
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core)
+            CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t, avx2)
+            nullptr,
+        }},
+        {{forward, bf16, u4, f32}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
+        {{forward, bf16, u4, bf16}, {
+            CPU_INSTANCE_AMX(brgemm_convolution_fwd_t, avx512_core_amx)
+            CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t, avx512_core_bf16)
+            nullptr,
+        }},
         // BWD_D fp
         {{backward_data, f32, f32, f32}, REG_BWD_D_PK({
             CPU_INSTANCE_X64(ip_convolution_bwd_data_t)
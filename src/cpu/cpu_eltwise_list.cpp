@@ -28,6 +28,11 @@ using namespace dnnl::impl::cpu::x64;
 #include "cpu/aarch64/jit_uni_eltwise.hpp"
 #include "cpu/aarch64/jit_uni_eltwise_int.hpp"
 using namespace dnnl::impl::cpu::aarch64;
+#elif DNNL_RV64
+#if DNNL_RISCV_USE_RVV_INTRINSICS
+#include "cpu/rv64/rvv_eltwise.hpp"
+using namespace dnnl::impl::cpu::rv64;
+#endif // DNNL_RISCV_USE_RVV_INTRINSICS
 #endif
 #if DNNL_USE_ACL
 #include "cpu/acl/acl_eltwise.hpp"
@@ -48,6 +53,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
         {{forward}, {
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t, avx512_core, f32)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t, avx512_core, bf16)
+            CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t, avx512_core_fp16, f16)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t, avx2_vnni_2, bf16)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t, avx2, f32)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t, avx, f32)
@@ -68,6 +74,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t, sve_512, s8)
             CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t, sve_512, u8)
             CPU_INSTANCE_ACL(acl_eltwise_fwd_t)
+            CPU_INSTANCE_RV64GCV(riscv_eltwise_fwd_t<f32>)
             CPU_INSTANCE(ref_eltwise_fwd_t, f32)
             CPU_INSTANCE(ref_eltwise_fwd_t, bf16)
             CPU_INSTANCE(ref_eltwise_fwd_t, s32)
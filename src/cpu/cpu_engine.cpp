@@ -29,7 +29,7 @@ namespace cpu {
 
 status_t cpu_engine_t::create_memory_storage(
         memory_storage_t **storage, unsigned flags, size_t size, void *handle) {
-    auto _storage = new cpu_memory_storage_t(this);
+    auto _storage = new cpu_memory_storage_t(this, cpu_malloc_, cpu_free_);
     if (_storage == nullptr) return status::out_of_memory;
     status_t status = _storage->init(flags, size, handle);
     if (status != status::success) {
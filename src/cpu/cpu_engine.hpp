@@ -26,6 +26,7 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/serialization_stream.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -117,9 +118,44 @@ public:
     // clang-format on
 };
 
+// CPU engines with different user allocators must not share primitives
+// through the primitive cache, as primitives own scratchpads allocated by the
+// allocator of their engine.
+struct cpu_engine_id_impl_t : public engine_id_impl_t {
+    cpu_engine_id_impl_t(
+            dnnl_cpu_allocate_f cpu_malloc, dnnl_cpu_deallocate_f cpu_free)
+        : engine_id_impl_t(engine_kind::cpu, get_cpu_native_runtime(), 0)
+        , cpu_malloc_(cpu_malloc)
+        , cpu_free_(cpu_free) {}
+
+    ~cpu_engine_id_impl_t() override = default;
+
+private:
+    bool compare_resource(const engine_id_impl_t *id_impl) const override {
+        const auto *typed_id
+                = utils::downcast<const cpu_engine_id_impl_t *>(id_impl);
+        return cpu_malloc_ == typed_id->cpu_malloc_
+                && cpu_free_ == typed_id->cpu_free_;
+    }
+
+    size_t hash_resource() const override {
+        size_t seed = 0;
+        seed = hash_combine(seed, cpu_malloc_);
+        seed = hash_combine(seed, cpu_free_);
+        return seed;
+    }
+
+    dnnl_cpu_allocate_f cpu_malloc_;
+    dnnl_cpu_deallocate_f cpu_free_;
+};
+
 class cpu_engine_t : public engine_t {
 public:
-    cpu_engine_t() : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0) {}
+    cpu_engine_t(dnnl_cpu_allocate_f cpu_malloc = nullptr,
+            dnnl_cpu_deallocate_f cpu_free = nullptr)
+        : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0)
+        , cpu_malloc_(cpu_malloc)
+        , cpu_free_(cpu_free) {}
 
     /* implementation part */
 
@@ -155,11 +191,28 @@ public:
 
     engine_id_t engine_id() const override {
         // Non-sycl CPU engine doesn't have device and context.
-        return {};
+        if (!has_user_allocator()) return {};
+        return engine_id_t(new cpu_engine_id_impl_t(cpu_malloc_, cpu_free_));
+    }
+
+    bool has_user_allocator() const override { return cpu_malloc_ != nullptr; }
+
+    // JIT-generated code depends on the ISA and the ISA hints the library
+    // dispatches to rather than on a physical device.
+    status_t serialize_device(serialization_stream_t &sstream) const override {
+        const auto isa = platform::get_effective_cpu_isa();
+        const auto isa_hints = platform::get_cpu_isa_hints();
+        sstream.write(&isa);
+        sstream.write(&isa_hints);
+        return status::success;
     }
 
 protected:
     ~cpu_engine_t() override = default;
+
+private:
+    dnnl_cpu_allocate_f cpu_malloc_;
+    dnnl_cpu_deallocate_f cpu_free_;
 };
 
 class cpu_engine_factory_t : public engine_factory_t {
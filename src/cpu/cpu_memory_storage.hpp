@@ -33,8 +33,13 @@ namespace cpu {
 
 class cpu_memory_storage_t : public memory_storage_t {
 public:
-    cpu_memory_storage_t(engine_t *engine)
-        : memory_storage_t(engine), data_(nullptr, release) {}
+    cpu_memory_storage_t(engine_t *engine,
+            dnnl_cpu_allocate_f cpu_malloc = nullptr,
+            dnnl_cpu_deallocate_f cpu_free = nullptr)
+        : memory_storage_t(engine)
+        , data_(nullptr, release)
+        , cpu_malloc_(cpu_malloc)
+        , cpu_free_(cpu_free) {}
 
     status_t get_data_handle(void **handle) const override {
         *handle = data_.get();
@@ -86,6 +91,12 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
+        if (cpu_malloc_) {
+            void *ptr = cpu_malloc_(size, platform::get_cache_line_size());
+            if (!ptr) return status::out_of_memory;
+            data_ = decltype(data_)(ptr, cpu_free_);
+            return status::success;
+        }
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
@@ -94,6 +105,8 @@ protected:
 
 private:
     std::unique_ptr<void, void (*)(void *)> data_;
+    dnnl_cpu_allocate_f cpu_malloc_;
+    dnnl_cpu_deallocate_f cpu_free_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
@@ -64,6 +64,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t, sse41, f32)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t, sve_512, f32)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t, sve_256, f32)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t, sve_128, f32)
             CPU_INSTANCE_ACL(acl_pooling_fwd_t)
             CPU_INSTANCE_RV64GCV(riscv_nchw_pooling_fwd_t<f32>)
             CPU_INSTANCE(nchw_pooling_fwd_t, bf16)
@@ -95,6 +96,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_pooling_bwd_t, sse41, f32)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t, sve_512, f32)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t, sve_256, f32)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t, sve_128, f32)
             CPU_INSTANCE(nchw_pooling_bwd_t, bf16)
             CPU_INSTANCE(nchw_pooling_bwd_t, f32)
             CPU_INSTANCE(nchw_pooling_bwd_t, f16)
@@ -27,6 +27,11 @@ using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
 #include "cpu/aarch64/jit_uni_softmax.hpp"
 using namespace dnnl::impl::cpu::aarch64;
+#elif DNNL_RV64
+#if DNNL_RISCV_USE_RVV_INTRINSICS
+#include "cpu/rv64/rvv_softmax.hpp"
+using namespace dnnl::impl::cpu::rv64;
+#endif // DNNL_RISCV_USE_RVV_INTRINSICS
 #endif
 #if DNNL_USE_ACL
 #include "cpu/acl/acl_softmax.hpp"
@@ -53,6 +58,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_AARCH64(jit_uni_softmax_fwd_t, sve_256)
             CPU_INSTANCE_AARCH64(jit_uni_softmax_fwd_t, sve_128)
             CPU_INSTANCE_ACL(acl_softmax_fwd_t)
+            CPU_INSTANCE_RV64GCV(riscv_softmax_fwd_t<f32>)
             CPU_INSTANCE(ref_softmax_fwd_t)
             nullptr,
         }},
@@ -0,0 +1,269 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/primitive_iface.hpp"
+
+#include "cpu/cpu_stream.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+// Every worker of an out-of-order stream runs a team of threads, so only a few
+// primitives are executed concurrently.
+constexpr int max_concurrency = 8;
+
+// Executes the primitives of an out-of-order stream on worker threads. A new
+// worker is started whenever there are more queued primitives than idle
+// workers, up to `max_workers_`. The workers are kept until the stream is
+// destroyed, which also keeps their threading runtime teams alive between
+// executions.
+struct cpu_stream_t::async_executor_t {
+    async_executor_t(cpu_stream_t *stream)
+        : stream_(stream)
+        , max_workers_(std::max(1,
+                  std::min(max_concurrency, (int)platform::get_num_cores()))) {
+    }
+
+    ~async_executor_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shutdown_ = true;
+        }
+        task_cv_.notify_all();
+        for (auto &worker : workers_)
+            worker.join();
+    }
+
+    void submit(
+            const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx) {
+        auto task = std::make_shared<task_t>(primitive_iface, ctx);
+        const_cast<primitive_iface_t *>(primitive_iface)->retain();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &t : in_flight_)
+            if (task->depends_on(*t)) task->deps.push_back(t);
+        in_flight_.push_back(task);
+        queue_.push_back(task);
+        if ((int)queue_.size() > idle_workers_
+                && (int)workers_.size() < max_workers_)
+            workers_.emplace_back(&async_executor_t::worker_loop, this);
+        else
+            task_cv_.notify_one();
+    }
+
+    // Blocks until all submitted primitives have completed.
+    void drain() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return in_flight_.empty(); });
+    }
+
+    // Blocks until all submitted primitives have completed and returns the
+    // first error since the previous call.
+    status_t wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return in_flight_.empty(); });
+        const status_t status = status_;
+        status_ = status::success;
+        return status;
+    }
+
+private:
+    struct task_t {
+        task_t(const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx)
+            : primitive_iface(primitive_iface), ctx(ctx) {
+            for (const auto &arg : ctx.args()) {
+                void *handle = nullptr;
+                arg.second.mem->get_data_handle(&handle);
+                if (handle == nullptr) continue;
+                (arg.second.is_const ? inputs : outputs).push_back(handle);
+            }
+        }
+
+        // Memory objects are matched by the data handles they have at
+        // submission, so they must not change their handles or be destroyed
+        // until the primitive completes. Overlapping buffers with different
+        // handles are not detected.
+        bool depends_on(const task_t &other) const {
+            auto intersects = [](const std::vector<void *> &a,
+                                      const std::vector<void *> &b) {
+                for (void *p : a)
+                    if (std::find(b.begin(), b.end(), p) != b.end())
+                        return true;
+                return false;
+            };
+            return intersects(inputs, other.outputs)
+                    || intersects(outputs, other.inputs)
+                    || intersects(outputs, other.outputs);
+        }
+
+        const primitive_iface_t *primitive_iface;
+        exec_ctx_t ctx;
+        std::vector<void *> inputs;
+        std::vector<void *> outputs;
+        std::vector<std::shared_ptr<task_t>> deps;
+        bool done = false;
+    };
+
+    void worker_loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            idle_workers_++;
+            task_cv_.wait(lock, [&] { return shutdown_ || !queue_.empty(); });
+            idle_workers_--;
+            if (queue_.empty()) return;
+
+            auto task = queue_.front();
+            queue_.pop_front();
+            // The dependencies were queued earlier, hence they are already
+            // taken by other workers and waiting for them cannot deadlock,
+            // whatever the number of workers is.
+            done_cv_.wait(lock, [&] {
+                for (const auto &dep : task->deps)
+                    if (!dep->done) return false;
+                return true;
+            });
+            task->deps.clear();
+            lock.unlock();
+
+            const status_t status = execute(*task);
+
+            lock.lock();
+            task->done = true;
+            if (status_ == status::success) status_ = status;
+            in_flight_.erase(
+                    std::find(in_flight_.begin(), in_flight_.end(), task));
+            done_cv_.notify_all();
+        }
+    }
+
+    status_t execute(task_t &task) const {
+        stream_->bind_threads();
+        max_threads_limit_guard_t max_threads_guard(
+                task.primitive_iface->pd()->attr()->max_threads_);
+        const status_t status
+                = stream_->execute_primitive(task.primitive_iface, task.ctx);
+        const_cast<primitive_iface_t *>(task.primitive_iface)->release();
+        return status;
+    }
+
+    cpu_stream_t *stream_;
+    const int max_workers_;
+    std::mutex mutex_;
+    // Signaled when a primitive is queued or on shutdown.
+    std::condition_variable task_cv_;
+    // Signaled when a primitive completes.
+    std::condition_variable done_cv_;
+    std::deque<std::shared_ptr<task_t>> queue_;
+    std::vector<std::shared_ptr<task_t>> in_flight_;
+    std::vector<std::thread> workers_;
+    int idle_workers_ = 0;
+    bool shutdown_ = false;
+    status_t status_ = status::success;
+};
+
+cpu_stream_t::cpu_stream_t(engine_t *engine, unsigned flags)
+    : stream_t(engine, flags) {
+    if (flags & stream_flags::out_of_order)
+        async_executor_.reset(new async_executor_t(this));
+}
+
+cpu_stream_t::~cpu_stream_t() = default;
+
+status_t cpu_stream_t::wait() {
+    // In-order execution is synchronous so return immediately
+    if (!async_executor_) return status::success;
+    return async_executor_->wait();
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (!async_executor_) return execute_primitive(primitive_iface, ctx);
+
+    // The global scratchpad belongs to the thread that created the primitive
+    // and is shared with the other primitives of this thread, so such
+    // primitives are executed synchronously. So are the primitives of callers
+    // that reuse or release the memory objects right after the submission.
+    if (primitive_iface->uses_global_scratchpad()
+            || sync_exec_scope_t::is_active()) {
+        async_executor_->drain();
+        return execute_primitive(primitive_iface, ctx);
+    }
+
+    async_executor_->submit(primitive_iface, ctx);
+    return status::success;
+}
+#endif
+
+status_t cpu_stream_t::execute_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (!is_profiling_enabled()) return primitive_iface->execute(ctx);
+
+    cpu_stream_profiler_t::scope_t profiling_scope(profiler_);
+    return primitive_iface->execute(ctx);
+}
+
+#if defined(__GLIBC__) \
+        && (DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+                || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ)
+namespace {
+// The affinity last applied to the team of the calling thread.
+size_t &get_threadlocal_affinity_id() {
+    static thread_local size_t affinity_id = 0;
+    return affinity_id;
+}
+} // namespace
+
+status_t cpu_stream_t::set_cpu_affinity(const std::vector<int> &cpus) {
+    static std::atomic<size_t> next_affinity_id {1};
+
+    if (cpus.empty()) return status::invalid_arguments;
+    cpus_ = cpus;
+    affinity_id_ = next_affinity_id++;
+    return status::success;
+}
+
+void cpu_stream_t::bind_threads() const {
+    if (affinity_id_ == 0) return;
+
+    size_t &applied_affinity_id = get_threadlocal_affinity_id();
+    if (applied_affinity_id == affinity_id_) return;
+
+    // Each thread of the team gets its own CPU from the list. Memory first
+    // touched by the primitives, e.g. the scratchpad, is then allocated on the
+    // NUMA node of these CPUs.
+    const int ncpus = (int)cpus_.size();
+    parallel(0, [&](int ithr, int nthr) {
+        platform::set_thread_affinity({cpus_[ithr % ncpus]});
+    });
+    applied_affinity_id = affinity_id_;
+}
+#endif
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
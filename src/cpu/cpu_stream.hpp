@@ -17,6 +17,9 @@
 #ifndef CPU_CPU_STREAM_HPP
 #define CPU_CPU_STREAM_HPP
 
+#include <memory>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_config.h"
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -27,11 +30,32 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/cpu_stream_profiler.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    cpu_stream_t(engine_t *engine, unsigned flags);
+    ~cpu_stream_t() override;
+
+    // Out-of-order streams execute primitives asynchronously, see
+    // enqueue_primitive().
+    dnnl::impl::status_t wait() override;
+
+    // For out-of-order streams, submits the primitive to a worker thread and
+    // returns. The primitive starts after all previously submitted primitives
+    // that write its inputs or access its outputs have completed, so results
+    // match the in-order execution, while independent primitives run
+    // concurrently. The memory objects of the primitive must keep their data
+    // handles and stay alive until it completes, otherwise the primitive is
+    // to be executed within a `sync_exec_scope_t`.
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override;
+#else
     cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {}
     virtual ~cpu_stream_t() = default;
 
@@ -40,7 +64,6 @@ struct cpu_stream_t : public stream_t {
         return dnnl::impl::status::success;
     }
 
-#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
         : stream_t(engine, threadpool) {}
@@ -54,6 +77,65 @@ struct cpu_stream_t : public stream_t {
     void after_exec_hook() override {
         threadpool_utils::deactivate_threadpool();
     }
+
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override {
+        return execute_primitive(primitive_iface, ctx);
+    }
+#endif
+
+    dnnl::impl::status_t reset_profiling() override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        profiler_.reset();
+        return status::success;
+    }
+
+    dnnl::impl::status_t get_profiling_data(
+            dnnl::impl::profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        return profiler_.get_info(data_kind, num_entries, data);
+    }
+
+    dnnl::impl::status_t notify_profiling_complete() const override {
+        return status::success;
+    }
+
+#if defined(__GLIBC__) \
+        && (DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+                || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ)
+    status_t set_cpu_affinity(const std::vector<int> &cpus) override;
+
+    void before_exec_hook() override { bind_threads(); }
+#endif
+
+private:
+    // Executes the primitive on the calling thread and records its duration
+    // when profiling is enabled.
+    dnnl::impl::status_t execute_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx);
+
+    cpu_stream_profiler_t profiler_;
+
+#if defined(__GLIBC__) \
+        && (DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+                || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ)
+    // Binds the threads of the calling thread's team to `cpus_`. The binding
+    // persists, so it is only done once per calling thread and affinity.
+    void bind_threads() const;
+
+    std::vector<int> cpus_;
+    // A unique identifier of the `cpus_` value, 0 means no affinity.
+    size_t affinity_id_ = 0;
+#else
+    void bind_threads() const {}
+#endif
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    struct async_executor_t;
+    std::unique_ptr<async_executor_t> async_executor_;
 #endif
 };
 
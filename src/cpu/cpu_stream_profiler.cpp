@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+
+#if DNNL_X64
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+#include "cpu/cpu_stream_profiler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+uint64_t get_nsec() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(
+            steady_clock::now().time_since_epoch())
+            .count();
+}
+
+// Time stamp counter, 0 when it is not available.
+uint64_t get_cycles() {
+#if DNNL_X64
+    return (uint64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+} // namespace
+
+cpu_stream_profiler_t::scope_t::scope_t(cpu_stream_profiler_t &profiler)
+    : profiler_(profiler)
+    , begin_nsec_(get_nsec())
+    , begin_cycles_(get_cycles()) {}
+
+cpu_stream_profiler_t::scope_t::~scope_t() {
+    const uint64_t end_cycles = get_cycles();
+    const uint64_t end_nsec = get_nsec();
+
+    std::lock_guard<std::mutex> lock(profiler_.mutex_);
+    profiler_.entries_.push_back(
+            {end_nsec - begin_nsec_, end_cycles - begin_cycles_});
+}
+
+void cpu_stream_profiler_t::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+status_t cpu_stream_profiler_t::get_info(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) const {
+    if (!num_entries) return status::invalid_arguments;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!data) {
+        *num_entries = (int)entries_.size();
+        return status::success;
+    }
+
+    const bool is_cycles = data_kind == profiling_data_kind::cycles;
+    if (!is_cycles && data_kind != profiling_data_kind::time)
+        return status::invalid_arguments;
+    if (is_cycles && get_cycles() == 0) return status::unimplemented;
+
+    const int n = std::min(*num_entries, (int)entries_.size());
+    for (int i = 0; i < n; i++)
+        data[i] = is_cycles ? entries_[i].cycles : entries_[i].nsec;
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
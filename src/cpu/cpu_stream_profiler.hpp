@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <mutex>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Collects the duration of each primitive executed on a CPU stream with
+// enabled profiling. CPU execution is synchronous with respect to the
+// executing thread, so the host clock at the begin and the end of the
+// execution is used.
+struct cpu_stream_profiler_t {
+    // Measures the execution in the scope of the object.
+    struct scope_t {
+        scope_t(cpu_stream_profiler_t &profiler);
+        ~scope_t();
+
+    private:
+        cpu_stream_profiler_t &profiler_;
+        uint64_t begin_nsec_;
+        uint64_t begin_cycles_;
+
+        DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+    };
+
+    void reset();
+
+    // Returns one entry per execution in the order of completion.
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const;
+
+private:
+    struct entry_t {
+        uint64_t nsec;
+        uint64_t cycles;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<entry_t> entries_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
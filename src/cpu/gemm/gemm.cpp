@@ -47,6 +47,11 @@ using namespace dnnl::impl::cpu::x64;
 using namespace dnnl::impl::cpu::ppc64;
 #elif DNNL_S390X
 #include "cpu/s390x/gemm.h"
+#elif DNNL_RV64
+#if DNNL_RISCV_USE_RVV_INTRINSICS
+#include "cpu/rv64/gemm/rvv_gemm_f32.hpp"
+#include "cpu/rv64/gemm/rvv_gemm_s8x8s32.hpp"
+#endif // DNNL_RISCV_USE_RVV_INTRINSICS
 #endif
 
 namespace dnnl {
@@ -143,6 +148,31 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
                 force_jit_nocopy_gemm);
         if (status != status::unimplemented) return status;
     }
+#elif DNNL_PPC64
+#ifdef __MMA__
+    if (*M != 0 && *N != 0) {
+        int ATflag = (*transa == 'T') || (*transa == 't');
+        int BTflag = (*transb == 'T') || (*transb == 't');
+
+        auto status = gemm_f32_ppc64(ATflag, BTflag, *M, *N, *K, *alpha, A,
+                *lda, B, *ldb, *beta, C, *ldc, bias);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+#elif DNNL_S390X
+#if defined(__VX__)
+    {
+        auto status = s390x::gemm_f32(transa, transb, *M, *N, *K, *alpha, A,
+                *lda, B, *ldb, *beta, C, *ldc, bias);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+#elif DNNL_RV64 && DNNL_RISCV_USE_RVV_INTRINSICS
+    {
+        auto status = rv64::rvv_gemm_f32(transa, transb, M, N, K, alpha, A,
+                lda, B, ldb, beta, C, ldc, bias);
+        if (status != status::unimplemented) return status;
+    }
 #endif
 
     return ref_gemm<float>(
@@ -220,6 +250,9 @@ dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
     return s390x::gemmx8x8s32(transa, transb, offsetc, *M, *N, *K, *alpha, A,
             *LDA, ao, B, *LDB, bo, *beta, C, *LDC, co);
 #endif
+#elif DNNL_RV64 && DNNL_RISCV_USE_RVV_INTRINSICS
+    return rv64::rvv_gemm_s8x8s32(transa, transb, offsetc, M, N, K, alpha, A,
+            LDA, ao, B, LDB, bo, beta, C, LDC, co);
 #endif
 
     return ref_gemm_s8x8s32(transa, transb, offsetc, M, N, K, alpha, A, LDA, ao,
@@ -277,6 +310,9 @@ dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
     return s390x::gemmx8x8s32(transa, transb, offsetc, *M, *N, *K, *alpha, A,
             *LDA, ao, B, *LDB, bo, *beta, C, *LDC, co);
 #endif
+#elif DNNL_RV64 && DNNL_RISCV_USE_RVV_INTRINSICS
+    return rv64::rvv_gemm_s8x8s32(transa, transb, offsetc, M, N, K, alpha, A,
+            LDA, ao, B, LDB, bo, beta, C, LDC, co);
 #endif
 
     return ref_gemm_s8x8s32(transa, transb, offsetc, M, N, K, alpha, A, LDA, ao,
@@ -314,6 +350,15 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             (const bfloat16 *)A, *lda, (const bfloat16 *)B, *ldb, *beta, C,
             *ldc);
     return dnnl_success;
+#elif defined(__MMA__)
+    if (*M != 0 && *N != 0) {
+        int ATflag = (*transa == 'T') || (*transa == 't');
+        int BTflag = (*transb == 'T') || (*transb == 't');
+
+        auto status = gemm_bf16bf16f32_ppc64(ATflag, BTflag, *M, *N, *K,
+                *alpha, A, *lda, B, *ldb, *beta, C, *ldc);
+        if (status != status::unimplemented) return status;
+    }
 #endif
 #endif
 
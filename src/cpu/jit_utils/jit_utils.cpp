@@ -109,24 +109,40 @@ void register_jit_code_vtune(const void *code, size_t code_size,
 #endif
 }
 
+bool need_code_regions() {
+#if DNNL_ENABLE_JIT_PROFILING && defined(__linux__)
+    return get_jit_profiling_flags()
+            & (DNNL_JIT_PROFILE_LINUX_JITDUMP | DNNL_JIT_PROFILE_LINUX_PERFMAP);
+#else
+    return false;
+#endif
+}
+
 void register_jit_code_linux_perf(const void *code, size_t code_size,
-        const char *code_name, const char *source_file_name) {
+        const char *code_name, const char *source_file_name,
+        const std::vector<code_region_t> &regions) {
 #if DNNL_ENABLE_JIT_PROFILING && defined(__linux__)
     unsigned flags = get_jit_profiling_flags();
     if (flags & DNNL_JIT_PROFILE_LINUX_JITDUMP)
-        linux_perf_jitdump_record_code_load(code, code_size, code_name);
+        linux_perf_jitdump_record_code_load(
+                code, code_size, code_name, regions);
     if (flags & DNNL_JIT_PROFILE_LINUX_PERFMAP)
-        linux_perf_perfmap_record_code_load(code, code_size, code_name);
+        linux_perf_perfmap_record_code_load(
+                code, code_size, code_name, regions);
 #else
     UNUSED(code);
     UNUSED(code_size);
     UNUSED(code_name);
+    UNUSED(regions);
 #endif
     UNUSED(source_file_name);
 }
 
 void register_jit_code(const void *code, size_t code_size,
-        const char *code_name, const char *source_file_name) {
+        const char *code_name, const char *source_file_name,
+        const std::vector<code_region_t> &regions) {
+    jit_code_size_tracker_t::add(code_size);
+
     // The #ifdef guards are required to avoid generating a function that only
     // consists of lock and unlock code
 #if DNNL_ENABLE_JIT_PROFILING || DNNL_ENABLE_JIT_DUMP
@@ -146,12 +162,13 @@ void register_jit_code(const void *code, size_t code_size,
     // unique method_id
     register_jit_code_vtune(code, code_size, code_name, source_file_name);
     register_jit_code_linux_perf(
-            code, code_size, unique_code_name, source_file_name);
+            code, code_size, unique_code_name, source_file_name, regions);
 #else
     UNUSED(code);
     UNUSED(code_size);
     UNUSED(code_name);
     UNUSED(source_file_name);
+    UNUSED(regions);
 #endif
 }
 
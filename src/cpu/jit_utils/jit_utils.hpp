@@ -18,14 +18,28 @@
 #define CPU_JIT_UTILS_JIT_UTILS_HPP
 
 #include <cstdlib>
+#include <vector>
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace jit_utils {
 
+// A named part of a JIT kernel, e.g. a K-loop or post-ops, which starts at
+// `offset` bytes from the kernel entry and lasts until the next region or the
+// end of the kernel. `name` must be a string literal.
+struct code_region_t {
+    size_t offset;
+    const char *name;
+};
+
+// Returns `true` if the registered code is recorded for Linux perf, which is
+// the only consumer of the code regions.
+bool need_code_regions();
+
 void register_jit_code(const void *code, size_t code_size,
-        const char *code_name, const char *source_file_name);
+        const char *code_name, const char *source_file_name,
+        const std::vector<code_region_t> &regions = {});
 
 }
 } // namespace cpu
@@ -41,6 +41,7 @@
 #include <cstring>
 #include <ctime>
 
+#include <algorithm>
 #include <string>
 
 #include "common/utils.hpp"
@@ -72,9 +73,13 @@ public:
         finalize();
     }
 
-    void record_code_load(
-            const void *code, size_t code_size, const char *code_name) {
-        if (is_active()) write_code_load(code, code_size, code_name);
+    void record_code_load(const void *code, size_t code_size,
+            const char *code_name, const std::vector<code_region_t> &regions) {
+        if (!is_active()) return;
+        // Debug info must precede the code load record it refers to.
+        if (!regions.empty())
+            write_code_debug_info(code, code_size, code_name, regions);
+        write_code_load(code, code_size, code_name);
     }
 
 private:
@@ -259,6 +264,56 @@ private:
         return write_or_fail(&c, sizeof(c));
     }
 
+    bool write_code_debug_info(const void *code, size_t code_size,
+            const char *code_name, const std::vector<code_region_t> &regions) {
+        struct {
+            uint32_t id;
+            uint32_t total_size;
+            uint64_t timestamp;
+            uint64_t code_addr;
+            uint64_t nr_entry;
+        } d;
+        struct {
+            uint64_t code_addr;
+            uint32_t line;
+            uint32_t discrim;
+        } e;
+
+        // A region name is reported as the file name with the region number
+        // as the line, so that repeated regions (e.g. K-loops of different
+        // blocks) can be told apart.
+        auto file_name = [&](const code_region_t &r) {
+            return std::string(code_name) + ":" + r.name;
+        };
+
+        size_t total_size = sizeof(d);
+        uint64_t nr_entry = 0;
+        for (const auto &r : regions) {
+            if (r.offset >= code_size) continue;
+            total_size += sizeof(e) + file_name(r).length() + 1;
+            nr_entry++;
+        }
+
+        d.id = 2; // JIT_CODE_DEBUG_INFO
+        d.total_size = static_cast<uint32_t>(total_size);
+        d.timestamp = get_timestamp(use_tsc_);
+        d.code_addr = (uint64_t)code;
+        d.nr_entry = nr_entry;
+        write_or_fail(&d, sizeof(d));
+
+        uint32_t line = 1;
+        for (const auto &r : regions) {
+            if (r.offset >= code_size) continue;
+            e.code_addr = (uint64_t)code + r.offset;
+            e.line = line++;
+            e.discrim = 0;
+            const std::string name = file_name(r);
+            write_or_fail(&e, sizeof(e));
+            write_or_fail(name.c_str(), name.length() + 1);
+        }
+        return !failed_;
+    }
+
     bool write_code_load(
             const void *code, size_t code_size, const char *code_name) {
         // XXX (rsdubtso): There is no limit on code_size or code_name. This
@@ -297,19 +352,37 @@ private:
     bool use_tsc_;
 };
 
-void linux_perf_jitdump_record_code_load(
-        const void *code, size_t code_size, const char *code_name) {
+void linux_perf_jitdump_record_code_load(const void *code, size_t code_size,
+        const char *code_name, const std::vector<code_region_t> &regions) {
     static linux_perf_jitdump_t jitdump;
-    jitdump.record_code_load(code, code_size, code_name);
+    jitdump.record_code_load(code, code_size, code_name, regions);
 }
 
 class linux_perf_jitmap_t {
 public:
     linux_perf_jitmap_t() : fp_ {nullptr}, failed_ {false} {}
     ~linux_perf_jitmap_t() = default;
-    void record_symbol(
-            const void *code, size_t code_size, const char *code_name) {
-        if (is_initialized()) write_symbol_info(code, code_size, code_name);
+    void record_symbol(const void *code, size_t code_size,
+            const char *code_name, const std::vector<code_region_t> &regions) {
+        if (!is_initialized()) return;
+
+        // The code before the first region keeps the kernel name.
+        const size_t head_size = regions.empty()
+                ? code_size
+                : std::min(regions[0].offset, code_size);
+        if (head_size > 0) write_symbol_info(code, head_size, code_name);
+
+        for (size_t i = 0; i < regions.size(); i++) {
+            const size_t begin = regions[i].offset;
+            const size_t end = i + 1 < regions.size()
+                    ? std::min(regions[i + 1].offset, code_size)
+                    : code_size;
+            if (begin >= end) continue;
+            const std::string name
+                    = std::string(code_name) + ":" + regions[i].name;
+            write_symbol_info((const uint8_t *)code + begin, end - begin,
+                    name.c_str());
+        }
     }
 
 private:
@@ -357,10 +430,10 @@ private:
     bool failed_;
 };
 
-void linux_perf_perfmap_record_code_load(
-        const void *code, size_t code_size, const char *code_name) {
+void linux_perf_perfmap_record_code_load(const void *code, size_t code_size,
+        const char *code_name, const std::vector<code_region_t> &regions) {
     static linux_perf_jitmap_t jitmap;
-    jitmap.record_symbol(code, code_size, code_name);
+    jitmap.record_symbol(code, code_size, code_name, regions);
 }
 
 } // namespace jit_utils
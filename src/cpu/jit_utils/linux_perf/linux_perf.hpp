@@ -19,17 +19,23 @@
 
 #ifdef __linux__
 #include <cstddef>
+#include <vector>
+
+#include "cpu/jit_utils/jit_utils.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace jit_utils {
 
-void linux_perf_jitdump_record_code_load(
-        const void *code, size_t code_size, const char *code_name);
+// The code regions are written as debug info, so that `perf annotate` and
+// `perf report --sort srcline` show a region name as the source file.
+void linux_perf_jitdump_record_code_load(const void *code, size_t code_size,
+        const char *code_name, const std::vector<code_region_t> &regions);
 
-void linux_perf_perfmap_record_code_load(
-        const void *code, size_t code_size, const char *code_name);
+// The code regions are written as separate `<code_name>:<region>` symbols.
+void linux_perf_perfmap_record_code_load(const void *code, size_t code_size,
+        const char *code_name, const std::vector<code_region_t> &regions);
 } // namespace jit_utils
 } // namespace cpu
 } // namespace impl
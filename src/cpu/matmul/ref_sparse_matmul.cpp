@@ -65,18 +65,23 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         const auto src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
         const auto src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
-        parallel_nd(M, [&](dim_t m) {
-            const dim_t row_start = src_pointers[m];
-            const dim_t row_end = src_pointers[m + 1];
-            for (dim_t k = row_start; k < row_end; k++) {
-                for (dim_t n = 0; n < N; n++) {
-                    const dim_t dst_idx = m * N + n;
-                    const dim_t wei_idx = src_indices[k] * N + n;
-                    dst[dst_idx]
-                            = dst[dst_idx] + src_values[k] * weights[wei_idx];
-                }
-            }
-        });
+        // The number of non-zero elements varies from row to row, hence the
+        // rows are scheduled dynamically.
+        parallel_nd_dynamic(
+                M,
+                [&](dim_t m) {
+                    const dim_t row_start = src_pointers[m];
+                    const dim_t row_end = src_pointers[m + 1];
+                    for (dim_t k = row_start; k < row_end; k++) {
+                        for (dim_t n = 0; n < N; n++) {
+                            const dim_t dst_idx = m * N + n;
+                            const dim_t wei_idx = src_indices[k] * N + n;
+                            dst[dst_idx] = dst[dst_idx]
+                                    + src_values[k] * weights[wei_idx];
+                        }
+                    }
+                },
+                dynamic_schedule_t::always);
     }
 
     return status::success;
@@ -84,6 +84,15 @@ status_t ncsp_group_normalization_fwd_t::execute_forward(
         float m = 0.0f;
         float v = 0.0f;
         if (calculate_stats) {
+            // Single read of the source: accumulate data shifted by the first
+            // value of the group, which keeps `E[x^2] - E[x]^2` accurate.
+            const size_t g_off = (size_t)n * C * SP + get_c_start(g) * SP;
+            const float pivot = io::load_float_value(src_d.data_type(),
+                    reinterpret_cast<const char *>(src)
+                            + g_off * src_d.data_type_size(),
+                    0);
+            float s_sum = 0.0f;
+            float s_sum_sq = 0.0f;
             for (dim_t c = get_c_start(g); c < get_c_start(g + 1); ++c) {
                 const size_t s_off = (size_t)n * C * SP + c * SP;
                 const char *__restrict _src
@@ -101,10 +110,11 @@ status_t ncsp_group_normalization_fwd_t::execute_forward(
                         src_f32 = reinterpret_cast<const float *__restrict>(
                                 _src);
                     }
-                    PRAGMA_OMP_SIMD(reduction(+ : m))
+                    PRAGMA_OMP_SIMD(reduction(+ : s_sum, s_sum_sq))
                     for (dim_t sp = 0; sp < sp_block_nelems; sp++) {
-                        float s = src_f32[sp];
-                        m += s;
+                        float s0 = src_f32[sp] - pivot;
+                        s_sum += s0;
+                        s_sum_sq += s0 * s0;
                     }
                     _src += sp_block_nelems * src_d.data_type_size();
                 }
@@ -120,61 +130,17 @@ status_t ncsp_group_normalization_fwd_t::execute_forward(
                         src_f32 = reinterpret_cast<const float *__restrict>(
                                 _src);
                     }
-                    PRAGMA_OMP_SIMD(reduction(+ : m))
+                    PRAGMA_OMP_SIMD(reduction(+ : s_sum, s_sum_sq))
                     for (dim_t sp = 0; sp < sp_block_reminder; sp++) {
-                        float s = src_f32[sp];
-                        m += s;
+                        float s0 = src_f32[sp] - pivot;
+                        s_sum += s0;
+                        s_sum_sq += s0 * s0;
                     }
                 }
             }
-            m /= SP * C_PER_G;
-
-            for (dim_t c = get_c_start(g); c < get_c_start(g + 1); ++c) {
-                const size_t s_off = (size_t)n * C * SP + c * SP;
-                const char *__restrict _src
-                        = reinterpret_cast<const char *>(src)
-                        + s_off * src_d.data_type_size();
-                for (dim_t sp_block = 0; sp_block < n_sp_block; sp_block++) {
-                    const float *__restrict src_f32 {nullptr};
-                    if (src_dt != data_type::f32) {
-                        float *tmp = cvt_scratch + sp_block_nelems * ithr;
-                        for (dim_t sp = 0; sp < sp_block_nelems; ++sp)
-                            tmp[sp] = io::load_float_value(
-                                    src_d.data_type(), _src, sp);
-                        src_f32 = tmp;
-                    } else {
-                        src_f32 = reinterpret_cast<const float *__restrict>(
-                                _src);
-                    }
-                    PRAGMA_OMP_SIMD(reduction(+ : v))
-                    for (dim_t sp = 0; sp < sp_block_nelems; sp++) {
-                        float s = src_f32[sp];
-                        float s0 = s - m;
-                        v += s0 * s0;
-                    }
-                    _src += sp_block_nelems * src_d.data_type_size();
-                }
-                if (sp_block_reminder) {
-                    const float *__restrict src_f32 {nullptr};
-                    if (src_dt != data_type::f32) {
-                        float *tmp = cvt_scratch + sp_block_nelems * ithr;
-                        for (dim_t sp = 0; sp < sp_block_reminder; ++sp)
-                            tmp[sp] = io::load_float_value(
-                                    src_d.data_type(), _src, sp);
-                        src_f32 = tmp;
-                    } else {
-                        src_f32 = reinterpret_cast<const float *__restrict>(
-                                _src);
-                    }
-                    PRAGMA_OMP_SIMD(reduction(+ : v))
-                    for (dim_t sp = 0; sp < sp_block_reminder; sp++) {
-                        float s = src_f32[sp];
-                        float s0 = s - m;
-                        v += s0 * s0;
-                    }
-                }
-            }
-            v /= SP * C_PER_G;
+            const float s_mean = s_sum / (SP * C_PER_G);
+            m = pivot + s_mean;
+            v = nstl::max(0.0f, s_sum_sq / (SP * C_PER_G) - s_mean * s_mean);
         } else {
             m = mean[n * G + g];
             v = variance[n * G + g];
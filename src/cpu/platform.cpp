@@ -20,13 +20,20 @@
 
 #include "cpu/platform.hpp"
 
+#if defined(__GLIBC__)
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <sched.h>
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include <algorithm>
 
 #if defined(_WIN32)
 #include <windows.h>
-#elif defined(__GLIBC__)
-#include <sched.h>
 #endif
 #endif
 
@@ -180,27 +187,131 @@ float s8s8_weights_scale_factor() {
 #endif
 }
 
-unsigned get_per_core_cache_size(int level) {
-    auto guess = [](int level) {
-        switch (level) {
-            case 1: return 32U * 1024;
-            case 2: return 512U * 1024;
-            case 3: return 1024U * 1024;
-            default: return 0U;
+namespace {
+#if defined(__GLIBC__)
+// Parses a list of logical CPUs in the "0-3,8,10-11" format.
+void parse_cpu_list(std::istream &list, std::vector<int> &cpus) {
+    std::string range;
+    while (std::getline(list, range, ',')) {
+        int first = 0, last = 0;
+        char dash = 0;
+        std::istringstream iss(range);
+        if (!(iss >> first)) break;
+        last = (iss >> dash >> last && dash == '-') ? last : first;
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+}
+
+struct cache_topology_t {
+    static constexpr int max_levels = 3;
+    unsigned size[max_levels] = {};
+    unsigned num_sharing_cores[max_levels] = {};
+};
+
+// Reads the data cache hierarchy of the first CPU from sysfs. It is used when
+// CPUID is not available, e.g. on Arm clusters with a shared L2.
+const cache_topology_t &get_sysfs_cache_topology() {
+    static const cache_topology_t topology = [] {
+        cache_topology_t t;
+        const std::string cpu0 = "/sys/devices/system/cpu/cpu0/";
+        std::vector<int> smt_siblings;
+        std::ifstream siblings(cpu0 + "topology/thread_siblings_list");
+        parse_cpu_list(siblings, smt_siblings);
+        const size_t smt_width = std::max<size_t>(smt_siblings.size(), 1);
+
+        for (int idx = 0;; idx++) {
+            const std::string dir
+                    = cpu0 + "cache/index" + std::to_string(idx) + "/";
+            int level = 0;
+            std::ifstream level_file(dir + "level");
+            if (!(level_file >> level)) break;
+            std::string type;
+            std::ifstream type_file(dir + "type");
+            type_file >> type;
+            if (type == "Instruction" || level < 1
+                    || level > cache_topology_t::max_levels)
+                continue;
+
+            // The size has the "48K" or "2048K" format.
+            unsigned size = 0;
+            char unit = 0;
+            std::ifstream size_file(dir + "size");
+            if (!(size_file >> size)) continue;
+            if (size_file >> unit) {
+                if (unit == 'K') size *= 1024;
+                if (unit == 'M') size *= 1024 * 1024;
+            }
+
+            std::vector<int> sharing_cpus;
+            std::ifstream shared(dir + "shared_cpu_list");
+            parse_cpu_list(shared, sharing_cpus);
+            t.size[level - 1] = size;
+            t.num_sharing_cores[level - 1] = (unsigned)std::max<size_t>(
+                    sharing_cpus.size() / smt_width, 1);
         }
-    };
+        return t;
+    }();
+    return topology;
+}
+#endif
+
+unsigned guess_per_core_cache_size(int level) {
+    switch (level) {
+        case 1: return 32U * 1024;
+        case 2: return 512U * 1024;
+        case 3: return 1024U * 1024;
+        default: return 0U;
+    }
+}
+} // namespace
+
+unsigned get_per_core_cache_size(int level) {
+#if DNNL_X64
+    using namespace x64;
+    if (cpu().getDataCacheLevels() == 0)
+        return guess_per_core_cache_size(level);
+#elif defined(__GLIBC__)
+    if (get_sysfs_cache_topology().size[0] == 0)
+        return guess_per_core_cache_size(level);
+#else
+    return guess_per_core_cache_size(level);
+#endif
+    return get_cache_size(level) / get_num_cores_sharing_cache(level);
+}
 
+unsigned get_cache_size(int level) {
 #if DNNL_X64
     using namespace x64;
-    if (cpu().getDataCacheLevels() == 0) return guess(level);
+    if (cpu().getDataCacheLevels() == 0)
+        return guess_per_core_cache_size(level);
+    if (level > 0 && (unsigned)level <= cpu().getDataCacheLevels())
+        return cpu().getDataCacheSize(level - 1);
+    return 0;
+#elif defined(__GLIBC__)
+    const auto &topology = get_sysfs_cache_topology();
+    if (topology.size[0] == 0) return guess_per_core_cache_size(level);
+    if (level > 0 && level <= cache_topology_t::max_levels)
+        return topology.size[level - 1];
+    return 0;
+#else
+    return guess_per_core_cache_size(level);
+#endif
+}
 
-    if (level > 0 && (unsigned)level <= cpu().getDataCacheLevels()) {
-        unsigned l = level - 1;
-        return cpu().getDataCacheSize(l) / cpu().getCoresSharingDataCache(l);
-    } else
-        return 0;
+unsigned get_num_cores_sharing_cache(int level) {
+#if DNNL_X64
+    using namespace x64;
+    if (level > 0 && (unsigned)level <= cpu().getDataCacheLevels())
+        return nstl::max(cpu().getCoresSharingDataCache(level - 1), 1U);
+    return 1;
+#elif defined(__GLIBC__)
+    const auto &topology = get_sysfs_cache_topology();
+    if (level > 0 && level <= cache_topology_t::max_levels)
+        return std::max(topology.num_sharing_cores[level - 1], 1U);
+    return 1;
 #else
-    return guess(level);
+    return 1;
 #endif
 }
 
@@ -214,6 +325,50 @@ unsigned get_num_cores() {
 #endif
 }
 
+bool is_hybrid() {
+#if DNNL_X64
+    // CPUID.07H:EDX[15] reports a hybrid part.
+    static const bool hybrid = [] {
+        uint32_t data[4] = {};
+        Xbyak::util::Cpu::getCpuid(0, data);
+        if (data[0] < 7) return false;
+        Xbyak::util::Cpu::getCpuidEx(7, 0, data);
+        return ((data[3] >> 15) & 1) == 1;
+    }();
+    return hybrid;
+#else
+    return false;
+#endif
+}
+
+bool set_thread_affinity(const std::vector<int> &cpus) {
+#if defined(__GLIBC__)
+    if (cpus.empty()) return false;
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+        CPU_SET(cpu, &cpu_set);
+    }
+    return ::sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool get_numa_node_cpus(int node, std::vector<int> &cpus) {
+    cpus.clear();
+#if defined(__GLIBC__)
+    if (node < 0) return false;
+    std::ifstream cpulist("/sys/devices/system/node/node"
+            + std::to_string(node) + "/cpulist");
+    parse_cpu_list(cpulist, cpus);
+    return !cpus.empty();
+#else
+    return false;
+#endif
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 // The purpose of this function is to return the potential maximum number of
 // threads in user's threadpool. It is assumed that the number of threads in an
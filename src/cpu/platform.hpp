@@ -18,6 +18,8 @@
 #ifndef CPU_PLATFORM_HPP
 #define CPU_PLATFORM_HPP
 
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_config.h"
 
 #include "common/c_types_map.hpp"
@@ -186,7 +188,23 @@ bool DNNL_API has_training_support(data_type_t data_type);
 float DNNL_API s8s8_weights_scale_factor();
 
 unsigned DNNL_API get_per_core_cache_size(int level);
+// Returns the size of a single instance of the data cache at a given level,
+// which may be shared by several cores (e.g. an L2 of a core cluster or an L3
+// of a sub-NUMA cluster). Returns 0 if the level does not exist.
+unsigned DNNL_API get_cache_size(int level);
+// Returns the number of cores sharing a single instance of the data cache at
+// a given level, or 1 if the topology is unknown.
+unsigned DNNL_API get_num_cores_sharing_cache(int level);
 unsigned DNNL_API get_num_cores();
+// Returns true if the CPU combines cores of different types, e.g. performance
+// and efficient cores of Intel hybrid architectures.
+bool DNNL_API is_hybrid();
+// Binds the calling thread to the given logical CPUs. Returns false if the
+// binding failed or is not supported on the platform.
+bool DNNL_API set_thread_affinity(const std::vector<int> &cpus);
+// Returns the logical CPUs of a NUMA node in `cpus`. Returns false if the node
+// does not exist or the query is not supported on the platform.
+bool DNNL_API get_numa_node_cpus(int node, std::vector<int> &cpus);
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
 #endif
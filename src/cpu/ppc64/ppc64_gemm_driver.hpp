@@ -26,6 +26,14 @@ dnnl_status_t cblas_gemm_s8x8s32_ppc64(int, int, char const *, dim_t, dim_t,
         dim_t, float, int8_t const *, dim_t, int8_t const *, uint8_t const *,
         dim_t, uint8_t const *, int *, float, dim_t, int const *, int);
 
+dnnl_status_t gemm_f32_ppc64(int, int, dim_t, dim_t, dim_t, float,
+        float const *, dim_t, float const *, dim_t, float, float *, dim_t,
+        float const *);
+
+dnnl_status_t gemm_bf16bf16f32_ppc64(int, int, dim_t, dim_t, dim_t, float,
+        bfloat16_t const *, dim_t, bfloat16_t const *, dim_t, float, float *,
+        dim_t);
+
 } // namespace ppc64
 } // namespace cpu
 } // namespace impl
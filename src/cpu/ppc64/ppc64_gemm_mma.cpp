@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2024 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __MMA__
+#include <altivec.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ppc64/ppc64_gemm_driver.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace ppc64 {
+
+namespace {
+
+typedef __vector unsigned char vec_t;
+typedef __vector float vec_f32_t;
+
+// The micro-kernel computes an 8 x 8 tile of C with 2 x 2 accumulators of
+// 4 x 4 floats.
+constexpr dim_t tile_m = 8;
+constexpr dim_t tile_n = 8;
+
+// xvbf16ger2 multiplies pairs of adjacent elements, so bf16 panels
+// interleave k by pairs.
+template <typename data_t>
+struct mma_traits_t;
+
+template <>
+struct mma_traits_t<float> {
+    static constexpr dim_t k_step = 1;
+    static void ger(__vector_quad *acc, vec_t x, vec_t y) {
+        __builtin_mma_xvf32gerpp(acc, x, y);
+    }
+};
+
+template <>
+struct mma_traits_t<bfloat16_t> {
+    static constexpr dim_t k_step = 2;
+    static void ger(__vector_quad *acc, vec_t x, vec_t y) {
+        __builtin_mma_xvbf16ger2pp(acc, x, y);
+    }
+};
+
+// Packs `tile` rows of op(A) (or columns of op(B)) starting at `start` so
+// that every k step of the kernel reads two consecutive vectors: 4 rows by
+// k_step elements each. The panel is padded with zeros in both dimensions.
+template <typename data_t, typename accessor_t>
+void pack_panel(data_t *dst, dim_t tile, dim_t start, dim_t dim, dim_t k,
+        dim_t k_cap, const accessor_t &src) {
+    constexpr dim_t s = mma_traits_t<data_t>::k_step;
+    for (dim_t kk = 0; kk < k_cap; kk++) {
+        data_t *d = &dst[(kk / s) * tile * s + kk % s];
+        for (dim_t r = 0; r < tile; r++) {
+            const dim_t idx = start + r;
+            d[(r / 4) * 4 * s + (r % 4) * s]
+                    = (idx < dim && kk < k) ? src(idx, kk) : data_t(0.f);
+        }
+    }
+}
+
+// Stores up to 4 x 4 elements of an accumulator. The kernel passes B as the
+// first operand, so each row of the accumulator is a column of C.
+void store_acc(__vector_quad *acc, float *C, dim_t ldc, dim_t m0, dim_t n0,
+        dim_t m_rem, dim_t n_rem, float alpha, float beta, const float *bias) {
+    if (m_rem <= 0 || n_rem <= 0) return;
+
+    vec_f32_t res[4];
+    __builtin_mma_disassemble_acc((void *)res, acc);
+
+    const vec_f32_t alpha_v = vec_splats(alpha);
+    const vec_f32_t beta_v = vec_splats(beta);
+    for (dim_t j = 0; j < nstl::min(n_rem, dim_t(4)); j++) {
+        float *c = &C[m0 + (n0 + j) * ldc];
+        if (m_rem >= 4) {
+            vec_f32_t r = alpha_v * res[j];
+            // C is not read for beta == 0 as it may be uninitialized.
+            if (beta != 0.f) r += beta_v * vec_xl(0, c);
+            if (bias) r += vec_xl(0, &bias[m0]);
+            vec_xst(r, 0, c);
+        } else {
+            for (dim_t i = 0; i < m_rem; i++) {
+                float v = alpha * res[j][i];
+                if (beta != 0.f) v += beta * c[i];
+                if (bias) v += bias[m0 + i];
+                c[i] = v;
+            }
+        }
+    }
+}
+
+template <typename data_t>
+dnnl_status_t gemm_mma(int ATflag, int BTflag, dim_t m, dim_t n, dim_t k,
+        float alpha, const data_t *A, dim_t lda, const data_t *B, dim_t ldb,
+        float beta, float *C, dim_t ldc, const float *bias) {
+    using traits_t = mma_traits_t<data_t>;
+    constexpr dim_t s = traits_t::k_step;
+
+    // Nothing to pack, the reference handles scaling of C.
+    if (k == 0) return dnnl_unimplemented;
+
+    const dim_t k_cap = utils::rnd_up(k, s);
+    const dim_t nb_m = utils::div_up(m, tile_m);
+    const dim_t nb_n = utils::div_up(n, tile_n);
+
+    data_t *AP = (data_t *)malloc(nb_m * tile_m * k_cap * sizeof(data_t), 4096);
+    data_t *BP = (data_t *)malloc(nb_n * tile_n * k_cap * sizeof(data_t), 4096);
+    if (utils::any_null(AP, BP)) {
+        free(AP);
+        free(BP);
+        return dnnl_out_of_memory;
+    }
+
+    parallel_nd(nb_m, [&](dim_t bm) {
+        pack_panel(&AP[bm * tile_m * k_cap], tile_m, bm * tile_m, m, k, k_cap,
+                [&](dim_t i, dim_t kk) {
+                    return ATflag ? A[kk + i * lda] : A[i + kk * lda];
+                });
+    });
+    parallel_nd(nb_n, [&](dim_t bn) {
+        pack_panel(&BP[bn * tile_n * k_cap], tile_n, bn * tile_n, n, k, k_cap,
+                [&](dim_t j, dim_t kk) {
+                    return BTflag ? B[j + kk * ldb] : B[kk + j * ldb];
+                });
+    });
+
+    parallel_nd(nb_n, nb_m, [&](dim_t bn, dim_t bm) {
+        const data_t *ap = &AP[bm * tile_m * k_cap];
+        const data_t *bp = &BP[bn * tile_n * k_cap];
+
+        __vector_quad acc0, acc1, acc2, acc3;
+        __builtin_mma_xxsetaccz(&acc0);
+        __builtin_mma_xxsetaccz(&acc1);
+        __builtin_mma_xxsetaccz(&acc2);
+        __builtin_mma_xxsetaccz(&acc3);
+
+        for (dim_t kk = 0; kk < k_cap; kk += s) {
+            const auto *pa = (const unsigned char *)&ap[kk * tile_m];
+            const auto *pb = (const unsigned char *)&bp[kk * tile_n];
+            const vec_t a0 = vec_xl(0, pa);
+            const vec_t a1 = vec_xl(16, pa);
+            const vec_t b0 = vec_xl(0, pb);
+            const vec_t b1 = vec_xl(16, pb);
+            traits_t::ger(&acc0, b0, a0);
+            traits_t::ger(&acc1, b0, a1);
+            traits_t::ger(&acc2, b1, a0);
+            traits_t::ger(&acc3, b1, a1);
+        }
+
+        const dim_t m0 = bm * tile_m;
+        const dim_t n0 = bn * tile_n;
+        store_acc(&acc0, C, ldc, m0, n0, m - m0, n - n0, alpha, beta, bias);
+        store_acc(&acc1, C, ldc, m0 + 4, n0, m - m0 - 4, n - n0, alpha, beta,
+                bias);
+        store_acc(&acc2, C, ldc, m0, n0 + 4, m - m0, n - n0 - 4, alpha, beta,
+                bias);
+        store_acc(&acc3, C, ldc, m0 + 4, n0 + 4, m - m0 - 4, n - n0 - 4,
+                alpha, beta, bias);
+    });
+
+    free(AP);
+    free(BP);
+    return dnnl_success;
+}
+
+} // namespace
+
+dnnl_status_t gemm_f32_ppc64(int ATflag, int BTflag, dim_t m, dim_t n,
+        dim_t k, float alpha, const float *A, dim_t lda, const float *B,
+        dim_t ldb, float beta, float *C, dim_t ldc, const float *bias) {
+    return gemm_mma<float>(ATflag, BTflag, m, n, k, alpha, A, lda, B, ldb,
+            beta, C, ldc, bias);
+}
+
+dnnl_status_t gemm_bf16bf16f32_ppc64(int ATflag, int BTflag, dim_t m, dim_t n,
+        dim_t k, float alpha, const bfloat16_t *A, dim_t lda,
+        const bfloat16_t *B, dim_t ldb, float beta, float *C, dim_t ldc) {
+    return gemm_mma<bfloat16_t>(ATflag, BTflag, m, n, k, alpha, A, lda, B,
+            ldb, beta, C, ldc, nullptr);
+}
+
+} // namespace ppc64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // __MMA__
@@ -135,6 +135,37 @@ float compute_eltwise_scalar_bwd(
     return ds;
 }
 
+int fold_linear_post_ops(const post_ops_t &post_ops, int idx,
+        post_ops_t::entry_t::eltwise_t &folded) {
+    const auto is_linear = [&](int i) {
+        return i < post_ops.len() && post_ops.entry_[i].is_eltwise()
+                && post_ops.entry_[i].eltwise.alg == eltwise_linear;
+    };
+
+    int len = 0;
+    // scale * (alpha * (a * x + b) + beta)
+    //     = (scale * alpha * a) * x + scale * (alpha * b + beta)
+    float a = 1.f, b = 0.f;
+    while (is_linear(idx + len)) {
+        const auto &e = post_ops.entry_[idx + len].eltwise;
+        b = e.scale * (e.alpha * b + e.beta);
+        a = e.scale * e.alpha * a;
+        len++;
+    }
+    if (len == 0) return 0;
+
+    folded.alg = eltwise_linear;
+    folded.scale = 1.f;
+    folded.alpha = a;
+    folded.beta = b;
+    return len;
+}
+
+bool is_identity_eltwise(const post_ops_t::entry_t::eltwise_t &eltwise) {
+    return eltwise.alg == eltwise_linear && eltwise.scale == 1.f
+            && eltwise.alpha == 1.f && eltwise.beta == 0.f;
+}
+
 ref_binary_scalar_t::ref_binary_scalar_t(alg_kind_t alg) : alg_(alg) {
     assert(utils::one_of(alg_, alg_kind::binary_add, alg_kind::binary_max,
             alg_kind::binary_min, alg_kind::binary_mul, alg_kind::binary_div,
@@ -34,6 +34,16 @@ float compute_eltwise_scalar_fwd(
 float compute_eltwise_scalar_bwd(
         const alg_kind_t alg, float dd, float s, float alpha, float beta);
 
+// Composes the run of consecutive linear eltwise post-ops starting at
+// position `idx` into a single linear one with unit scale, written to
+// `folded`. Returns the length of the run, zero if the entry at `idx` is not
+// a linear eltwise.
+int fold_linear_post_ops(const post_ops_t &post_ops, int idx,
+        post_ops_t::entry_t::eltwise_t &folded);
+
+// Returns true if the eltwise post-op leaves its input unchanged.
+bool is_identity_eltwise(const post_ops_t::entry_t::eltwise_t &eltwise);
+
 struct ref_binary_scalar_t {
     ref_binary_scalar_t(alg_kind_t alg);
     ref_binary_scalar_t(const post_ops_t::entry_t::binary_t &binary);
@@ -42,7 +42,9 @@ struct ref_concat_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using sm = primitive_attr_t::skip_mask_t;
-            VDISPATCH_CONCAT(attr()->has_default_values(sm::scales_runtime),
+            VDISPATCH_CONCAT(
+                    attr()->has_default_values(
+                            sm::scales_runtime | sm::zero_points_runtime),
                     VERBOSE_UNSUPPORTED_ATTR);
             status_t status = cpu_concat_pd_t::init();
             if (status != status::success) {
@@ -58,10 +60,19 @@ struct ref_concat_t : public primitive_t {
                         VERBOSE_PRIMITIVE_CREATION_FAIL, "concat");
             }
 
+            // The destination scale and zero point are applied by every
+            // per-input reorder, so requantization happens in the same pass
+            // as the copy. The final reorder from `tent_dst_md_` is a plain
+            // copy of already quantized values.
             const auto &sc = attr()->scales_;
+            const auto &zp = attr()->zero_points_;
             reorder_pds_.resize(n_ + use_tent_dst());
             for (int i = 0; i < n_; ++i) {
                 primitive_attr_t r_attr;
+                if (!sc.get(DNNL_ARG_DST).has_default_values())
+                    CHECK(r_attr.scales_.set(DNNL_ARG_DST, 0));
+                if (!zp.has_default_values(DNNL_ARG_DST))
+                    CHECK(r_attr.zero_points_.set(DNNL_ARG_DST, 0));
                 if (!sc.get(DNNL_ARG_MULTIPLE_SRC + i).has_default_values()) {
                     int mask = 0;
                     CHECK(sc.get(DNNL_ARG_MULTIPLE_SRC + i, &mask, nullptr));
@@ -131,6 +142,13 @@ struct ref_concat_t : public primitive_t {
             r_args[DNNL_ARG_DST] = dst;
             if (src_scales)
                 r_args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC] = *src_scales;
+            if (r_num < n) {
+                for (int arg : {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST,
+                             DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST}) {
+                    const auto it = ctx.args().find(arg);
+                    if (it != ctx.args().end()) r_args[arg] = it->second;
+                }
+            }
             exec_ctx_t r_ctx(ctx, std::move(r_args));
 
             nested_scratchpad_t ns(ctx, key_nested_multiple + r_num, reorder);
@@ -22,6 +22,7 @@
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_io_helper.hpp"
 #include "cpu/ref_pooling.hpp"
 #include "cpu/simple_q10n.hpp"
@@ -198,6 +199,9 @@ status_t ref_pooling_fwd_t<src_type, dst_type, acc_type>::execute_forward(
 
     const bool is_max_pool = alg == alg_kind::pooling_max;
 
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
     float base_res
             = is_max_pool ? (float)numeric_limits<src_data_t>::lowest() : 0.f;
     using ker_t
@@ -211,12 +215,14 @@ status_t ref_pooling_fwd_t<src_type, dst_type, acc_type>::execute_forward(
                         = (((mb * OC + oc) * OD + od) * OH + oh) * OW + ow;
                 float res = base_res;
                 kernel(res, mb, oc, od, oh, ow);
+                res *= src_scales[0];
 
                 ref_post_ops_t::args_t args;
                 args.ctx = &ctx;
                 args.l_offset = data_l_off;
                 args.dst_md = pd()->dst_md();
                 ref_post_ops->execute(res, args);
+                res *= dst_scales[0];
 
                 dst[data_p_off] = cpu::q10n::saturate_and_round<dst_data_t>(res);
             });
@@ -56,7 +56,10 @@ struct ref_pooling_fwd_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_POOLING(desc()->accum_data_type == acc_type,
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_POOLING(attr()->has_default_values(sm::post_ops),
+            VDISPATCH_POOLING(
+                    attr()->has_default_values(
+                            sm::post_ops | sm::scales_runtime)
+                            && attr_scales_ok(),
                     VERBOSE_UNSUPPORTED_ATTR);
             // VDISPATCH_POOLING(
             //         ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
@@ -68,6 +68,7 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
     const auto dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
 
     const int nthr = pd()->nthr_;
+    const float softmax_scale = pd()->attr()->softmax_params_.scale_;
 
     parallel_nd_ext(nthr, outer_size_, [&](int ithr, int, dim_t ou) {
         const void *src_data = reinterpret_cast<const char *>(src)
@@ -94,22 +95,25 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
             float max_val = -FLT_MAX;
             for (int i = 0; i < channels_; i++) {
                 max_val = max_wrapper(max_val,
-                        io::load_float_value(src_d.data_type(), src_data, i));
+                        softmax_scale
+                                * io::load_float_value(
+                                        src_d.data_type(), src_data, i));
             }
             space_max = max_val;
         } else {
             float max_values[unroll_factor];
 
             for (int i = 0; i < unroll_factor; i++) {
-                max_values[i]
-                        = io::load_float_value(src_d.data_type(), src_data, i);
+                max_values[i] = softmax_scale
+                        * io::load_float_value(src_d.data_type(), src_data, i);
             }
             for (int i = unroll_factor; i < channels_; i += unroll_factor) {
                 int offset = min_wrapper(i, channels_ - unroll_factor);
                 for (int j = 0; j < unroll_factor; j++) {
                     max_values[j] = max_wrapper(max_values[j],
-                            io::load_float_value(
-                                    src_d.data_type(), src_data, offset + j));
+                            softmax_scale
+                                    * io::load_float_value(src_d.data_type(),
+                                            src_data, offset + j));
                 }
             }
             float max_val = -FLT_MAX;
@@ -121,7 +125,9 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
 #else
         for (int c = 0; c < channels_; ++c)
             space_max = nstl::max(space_max,
-                    io::load_float_value(src_d.data_type(), src_data, c));
+                    softmax_scale
+                            * io::load_float_value(
+                                    src_d.data_type(), src_data, c));
 #endif
 
         // sub + exp + sum
@@ -129,8 +135,9 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
         for (int i = 0; i < channels_ - tail; i += unroll_factor) {
             PRAGMA_OMP_SIMD(reduction(+ : space_denom))
             for (int j = 0; j < unroll_factor; j++) {
-                float s = io::load_float_value(
-                        src_d.data_type(), src_data, i + j);
+                float s = softmax_scale
+                        * io::load_float_value(
+                                src_d.data_type(), src_data, i + j);
                 float d = s - space_max;
                 if (pd()->is_softmax()) {
                     d = expf(d);
@@ -143,7 +150,8 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
             }
         }
         for (int i = channels_ - tail; i < channels_; i++) {
-            float s = io::load_float_value(src_d.data_type(), src_data, i);
+            float s = softmax_scale
+                    * io::load_float_value(src_d.data_type(), src_data, i);
             float d = s - space_max;
             if (pd()->is_softmax()) {
                 d = expf(d);
@@ -233,8 +241,22 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
     const auto axis_size = pd()->axis_size(true);
     const int nthr = pd()->nthr_;
 
+    const auto &softmax_params = pd()->attr()->softmax_params_;
+    const float softmax_scale = softmax_params.scale_;
+    const bool with_causal_mask = softmax_params.mask_ == softmax_mask::causal;
+    // Causal mask implies the axis is the last dimension, thus, `ou` walks
+    // over rows of the last two dimensions.
+    const dim_t n_queries
+            = with_causal_mask ? dst_d.dims()[dst_d.ndims() - 2] : 1;
+
     parallel_nd_ext(nthr, outer_size_, [&](int ithr, int, dim_t ou) {
         const dim_t thr_shift = ithr * axis_size;
+        // Masked elements are not read and produce zero before post-ops.
+        const dim_t n_valid = with_causal_mask
+                ? nstl::max(dim_t(0),
+                        nstl::min(dim_t(channels_),
+                                ou % n_queries + 1 + channels_ - n_queries))
+                : channels_;
 
         float space_max_val = 0, space_denom_val = 0;
         float *space_max = &space_max_val, *space_denom = &space_denom_val;
@@ -251,15 +273,17 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
         for (int in = 0; in < inner_size_; in++) {
             dim_t ou_in_offset = ou * channels_ * inner_size_ + in;
 
-            for (int c = 0; c < channels_; c++) {
+            for (int c = 0; c < n_valid; c++) {
                 size_t off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, off);
+                float s = softmax_scale
+                        * io::load_float_value(src_d.data_type(), src, off);
                 space_max[in] = nstl::max(space_max[in], s);
             }
 
-            for (int c = 0; c < channels_; c++) {
+            for (int c = 0; c < n_valid; c++) {
                 size_t src_off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, src_off);
+                float s = softmax_scale
+                        * io::load_float_value(src_d.data_type(), src, src_off);
                 float d = s - space_max[in];
                 if (pd()->is_softmax()) {
                     d = expf(d);
@@ -283,13 +307,16 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                 size_t interim_off = pd()->need_intermediate_scratchpad()
                         ? thr_shift + c
                         : dst_off;
-                float d = io::load_float_value(
-                        interim_dt, interim_ptr, interim_off);
-                float sd = space_denom[in];
-                if (pd()->is_softmax()) {
-                    d /= sd;
-                } else if (pd()->is_logsoftmax()) {
-                    d -= sd;
+                float d = 0;
+                if (c < n_valid) {
+                    d = io::load_float_value(
+                            interim_dt, interim_ptr, interim_off);
+                    float sd = space_denom[in];
+                    if (pd()->is_softmax()) {
+                        d /= sd;
+                    } else if (pd()->is_logsoftmax()) {
+                        d -= sd;
+                    }
                 }
                 d *= src_scales[0];
 
@@ -60,7 +60,8 @@ struct ref_softmax_fwd_t : public primitive_t {
 
             VCHECK_SOFTMAX(
                     attr()->has_default_values(skip_mask_t::scales_runtime
-                            | skip_mask_t::post_ops),
+                            | skip_mask_t::post_ops
+                            | skip_mask_t::softmax_params),
                     VERBOSE_UNSUPPORTED_ATTR);
             VCHECK_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
             VCHECK_SOFTMAX(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
@@ -125,9 +126,12 @@ struct ref_softmax_fwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
+        // The dense version may walk over outer dimensions in physical order
+        // and doesn't know the query index a causal mask needs.
         use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size
+                && pd()->attr()->softmax_params_.mask_ == softmax_mask::none;
 
         ref_post_ops
                 = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
@@ -44,6 +44,8 @@ regular_impl_list_map() {
             {{u8, data_type::undef, 0}, &regular_u8_impl_list_map()},
             {{f32, s4, 0}, &regular_s4_impl_list_map()},
             {{f32, u4, 0}, &regular_u4_impl_list_map()},
+            {{bf16, s4, 0}, &regular_s4_impl_list_map()},
+            {{bf16, u4, 0}, &regular_u4_impl_list_map()},
             {{s4, f32, 0}, &regular_s4_impl_list_map()},
             {{u4, f32, 0}, &regular_u4_impl_list_map()},
             {{bin, data_type::undef, 0}, &regular_bin_impl_list_map()},
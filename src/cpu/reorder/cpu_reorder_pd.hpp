@@ -31,12 +31,19 @@ namespace cpu {
 struct cpu_reorder_pd_t : public reorder_pd_t {
     using reorder_pd_t::reorder_pd_t;
 
-    status_t init(
-            engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    // Reorders support an optional sum post-op. Implementations that can
+    // also apply eltwise post-ops after it enable them with
+    // `allow_eltwise_post_ops`.
+    status_t init(engine_t *engine, engine_t *src_engine, engine_t *dst_engine,
+            bool allow_eltwise_post_ops = false) {
         const auto &post_ops = attr()->post_ops_;
-        bool args_ok = IMPLICATION(post_ops.len() != 0,
-                post_ops.len() == 1
-                        && post_ops.entry_[0].kind == primitive_kind::sum);
+        bool args_ok = true;
+        for (int i = 0; i < post_ops.len(); i++) {
+            const auto &e = post_ops.entry_[i];
+            args_ok = args_ok
+                    && ((e.kind == primitive_kind::sum && i == 0)
+                            || (e.is_eltwise() && allow_eltwise_post_ops));
+        }
         VDISPATCH_REORDER(args_ok, VERBOSE_UNSUPPORTED_POSTOP);
         return status::success;
     }
@@ -28,6 +28,10 @@ const impl_list_map_t &regular_s4_impl_list_map() {
             REG_SR(f32, any, s4, any, fmt_order::any, spec::reference)
             nullptr,
         }},
+        {{bf16, s4, 0}, {
+            REG_SR(bf16, any, s4, any, fmt_order::any, spec::reference)
+            nullptr,
+        }},
         {{s4, data_type::undef, 0}, {
             REG_SR(s4, any, s4, OI8i8o2i, fmt_order_keep)
             REG_SR(s4, any, s4, OI8i16o2i, fmt_order_keep)
@@ -28,6 +28,10 @@ const impl_list_map_t &regular_u4_impl_list_map() {
             REG_SR(f32, any, u4, any, fmt_order::any, spec::reference)
             nullptr,
         }},
+        {{bf16, u4, 0}, {
+            REG_SR(bf16, any, u4, any, fmt_order::any, spec::reference)
+            nullptr,
+        }},
         {{u4, data_type::undef, 0}, {
             REG_SR(u4, any, u4, OI8i8o2i, fmt_order_keep)
             REG_SR(u4, any, u4, OI8i16o2i, fmt_order_keep)
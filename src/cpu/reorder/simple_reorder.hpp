@@ -2216,7 +2216,13 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const auto num_blocks = nelems / block_size;
         const auto rem_elems = nelems % block_size;
 
-        parallel(0, [&](const int ithr, const int nthr) {
+        parallel_cost_t cost;
+        cost.bytes = nelems * (sizeof(data_t<type_i>) + sizeof(data_t<type_o>));
+        cost.ops = nelems;
+        const int nthr = adjust_num_threads(
+                0, nstl::max(num_blocks, (size_t)1), cost);
+
+        parallel(nthr, [&](const int ithr, const int nthr) {
             size_t start {0}, end {0};
             balance211(num_blocks, nthr, ithr, start, end);
             start = start * block_size;
@@ -2285,15 +2291,27 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 template <SIMPLE_REORDER_TEMPL_DECL>
 struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         typename utils::enable_if<tag_i == format_tag::any
-                        && tag_o == format_tag::any && type_i == dnnl_f32
+                        && tag_o == format_tag::any
+                        && utils::one_of(type_i, dnnl_f32, dnnl_bf16)
                         && utils::one_of(type_o, dnnl_s4, dnnl_u4),
                 spec::reference>::type> {
     static bool is_applicable(const memory_desc_wrapper &input_d,
             const memory_desc_wrapper &output_d, const primitive_attr_t *attr) {
+        using smask_t = primitive_attr_t::skip_mask_t;
+        const auto &zp = attr->zero_points_;
+        int src_mask = 0, dst_mask = 0;
         return !input_d.has_runtime_dims_or_strides() && input_d.is_dense()
                 && output_d.is_dense()
                 && output_d.strides()[output_d.ndims() - 1] == 1
-                && simple_attr_check(attr, false, true);
+                && attr->has_default_values(smask_t::scales_runtime
+                        | smask_t::zero_points_runtime | smask_t::post_ops)
+                && attr->scales_.has_default_groups()
+                && get_scales_mask(attr, &src_mask, &dst_mask)
+                        == status::success
+                && src_mask == 0 && dst_mask == 0
+                && zp.has_default_values(DNNL_ARG_SRC)
+                && IMPLICATION(!zp.has_default_values(DNNL_ARG_DST),
+                        zp.get(DNNL_ARG_DST) == 0);
     }
 
     GET_SCRATCHPAD_SIZE_ZERO();
@@ -2305,10 +2323,36 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         input += input_d.blk_off(0);
         output += output_d.blk_off(0);
 
+        const auto quantize = [&](data_t<type_i> in) {
+            return _qz_a1b0<data_type::f32, type_o>()(
+                    alpha * static_cast<float>(in) + dst_zp);
+        };
+
         // To avoid clashes between threads each byte (or 2 elements)
         // is handled by a single thread
         const dim_t work_amount = input_d.nelems() / 2;
 
+        // Layouts with the same strides are traversed linearly, so pairs of
+        // elements are packed without offset computations.
+        const bool is_linear = input_d.similar_to(output_d, true, false)
+                && input_d.nelems() % 2 == 0;
+        if (is_linear) {
+            uint8_t *out_u8 = reinterpret_cast<uint8_t *>(output);
+            parallel(0, [&](const int ithr, const int nthr) {
+                dim_t start {0}, end {0};
+                balance211(work_amount, nthr, ithr, start, end);
+                PRAGMA_OMP_SIMD()
+                for (dim_t idx = start; idx < end; idx++) {
+                    const auto lo = quantize(input[2 * idx]);
+                    const auto hi = quantize(input[2 * idx + 1]);
+                    out_u8[idx] = hi.insert(
+                            lo.insert(0, int4_extract_t::low_half),
+                            int4_extract_t::high_half);
+                }
+            });
+            return status::success;
+        }
+
         parallel(0, [&](const int ithr, const int nthr) {
             dim_t start {0}, end {0};
             balance211(work_amount, nthr, ithr, start, end);
@@ -2319,7 +2363,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 const auto o_off = output_d.off_l(2 * idx + i);
                 const auto shift = i % 2 ? int4_extract_t::high_half
                                          : int4_extract_t::low_half;
-                auto src_val = _qz_a1b0<data_type::f32, type_o>()(input[i_off]);
+                auto src_val = quantize(input[i_off]);
                 const uint8_t dst_val = i == 0
                         ? 0
                         : reinterpret_cast<uint8_t *>(output)[o_off / 2];
@@ -1039,6 +1039,14 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
               };
 
     // We run the grid of computation
+    // Note: cell (lay, iter) only depends on (lay - 1, iter) and
+    // (lay, iter - 1), so the cells of a layer + iter diagonal are
+    // independent and could run concurrently on separate thread groups.
+    // This is not done because the cells share state that is sized for a
+    // single cell in flight: scratch_gates_ (unless the GEMMs are merged),
+    // scratch_ht_ and the per-thread brgemm buffers indexed by the global
+    // thread id; a merged layer GEMM additionally needs the whole previous
+    // layer to be finished.
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
         const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
@@ -1906,7 +1914,7 @@ static void apply_bias_compensation(const rnn_utils::rnn_conf_t &rnn,
         const float data_scale, const float *const weights_scales,
         const bool scale_per_oc) {
 
-    for (int i = 0; i < rnn.n_layer * rnn.n_dir; i++)
+    parallel_nd(static_cast<dim_t>(rnn.n_layer) * rnn.n_dir, [&](dim_t i) {
         for (int j = 0; j < rnn.n_bias * rnn.dhc; j++) {
             const size_t off = i * rnn.n_bias * rnn.dhc + j;
             const float weights_scale
@@ -1914,6 +1922,7 @@ static void apply_bias_compensation(const rnn_utils::rnn_conf_t &rnn,
             scratch_bias_[off] -= (w_iter_comp[off] + w_layer_comp[off])
                     * data_shift / (weights_scale * data_scale);
         }
+    });
 }
 
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
@@ -2106,18 +2115,18 @@ status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     const memory_desc_t *weights_layer_md = pd()->weights_md(0);
     const memory_desc_t *weights_iter_md = pd()->weights_md(1);
 
-    const auto tag = rnn.n_block == 64 ? format_tag::ldgOI64o2i
-                                       : format_tag::ldgOI32o2i;
-    memory_desc_t wei_layer_desc;
-    CHECK(memory_desc_init_by_tag(wei_layer_desc, weights_layer_md->ndims,
-            weights_layer_md->dims, data_type::bf16, tag));
-
-    memory_desc_t wei_iter_desc;
-    CHECK(memory_desc_init_by_tag(wei_iter_desc, weights_iter_md->ndims,
-            weights_iter_md->dims, data_type::bf16, tag));
-
 #if DNNL_X64
+    memory_desc_t wei_layer_desc, wei_iter_desc;
     if (rnn.is_bf32()) {
+        // Only bf32 needs the descriptors; with T = 1 streaming calls the
+        // per-call setup is a noticeable part of the execution time.
+        const auto tag = rnn.n_block == 64 ? format_tag::ldgOI64o2i
+                                           : format_tag::ldgOI32o2i;
+        CHECK(memory_desc_init_by_tag(wei_layer_desc, weights_layer_md->ndims,
+                weights_layer_md->dims, data_type::bf16, tag));
+        CHECK(memory_desc_init_by_tag(wei_iter_desc, weights_iter_md->ndims,
+                weights_iter_md->dims, data_type::bf16, tag));
+
         if (rnn.is_augru) {
             const auto bf32_augru_attention
                     = scratchpad.template get<src_layer_t>(
@@ -0,0 +1,135 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/rv64/gemm/rvv_gemm_f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+// The micro-kernel computes a vector of rows of C by n_unroll columns. The
+// vector length is queried at run time, so the same code covers every VLEN.
+constexpr dim_t n_unroll = 4;
+
+struct gemm_args_t {
+    bool trans_a, trans_b;
+    dim_t K;
+    float alpha, beta;
+    const float *A;
+    dim_t lda;
+    const float *B;
+    dim_t ldb;
+    float *C;
+    dim_t ldc;
+    const float *bias;
+};
+
+inline vfloat32m4_t load_a(
+        const gemm_args_t &p, dim_t m, dim_t k, size_t vl) {
+    if (p.trans_a)
+        return vlse32_v_f32m4(
+                &p.A[k + m * p.lda], p.lda * sizeof(float), vl);
+    return vle32_v_f32m4(&p.A[m + k * p.lda], vl);
+}
+
+inline float load_b(const gemm_args_t &p, dim_t k, dim_t n) {
+    return p.trans_b ? p.B[n + k * p.ldb] : p.B[k + n * p.ldb];
+}
+
+inline void store_c(const gemm_args_t &p, vfloat32m4_t acc, dim_t m,
+        dim_t n, size_t vl) {
+    float *c = &p.C[m + n * p.ldc];
+    acc = vfmul_vf_f32m4(acc, p.alpha, vl);
+    // C is not read for beta == 0 as it may be uninitialized.
+    if (p.beta != 0.f)
+        acc = vfmacc_vf_f32m4(acc, p.beta, vle32_v_f32m4(c, vl), vl);
+    if (p.bias) acc = vfadd_vv_f32m4(acc, vle32_v_f32m4(&p.bias[m], vl), vl);
+    vse32_v_f32m4(c, acc, vl);
+}
+
+void kernel_n4(const gemm_args_t &p, dim_t m, dim_t n, size_t vl) {
+    vfloat32m4_t acc0 = vfmv_v_f_f32m4(0.f, vl);
+    vfloat32m4_t acc1 = vfmv_v_f_f32m4(0.f, vl);
+    vfloat32m4_t acc2 = vfmv_v_f_f32m4(0.f, vl);
+    vfloat32m4_t acc3 = vfmv_v_f_f32m4(0.f, vl);
+
+    for (dim_t k = 0; k < p.K; k++) {
+        const vfloat32m4_t a = load_a(p, m, k, vl);
+        acc0 = vfmacc_vf_f32m4(acc0, load_b(p, k, n + 0), a, vl);
+        acc1 = vfmacc_vf_f32m4(acc1, load_b(p, k, n + 1), a, vl);
+        acc2 = vfmacc_vf_f32m4(acc2, load_b(p, k, n + 2), a, vl);
+        acc3 = vfmacc_vf_f32m4(acc3, load_b(p, k, n + 3), a, vl);
+    }
+
+    store_c(p, acc0, m, n + 0, vl);
+    store_c(p, acc1, m, n + 1, vl);
+    store_c(p, acc2, m, n + 2, vl);
+    store_c(p, acc3, m, n + 3, vl);
+}
+
+void kernel_n1(const gemm_args_t &p, dim_t m, dim_t n, size_t vl) {
+    vfloat32m4_t acc = vfmv_v_f_f32m4(0.f, vl);
+    for (dim_t k = 0; k < p.K; k++)
+        acc = vfmacc_vf_f32m4(acc, load_b(p, k, n), load_a(p, m, k, vl), vl);
+    store_c(p, acc, m, n, vl);
+}
+} // namespace
+
+dnnl_status_t rvv_gemm_f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *A, const dim_t *lda, const float *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc, const float *bias) {
+    if (!(utils::one_of(*transa, 'n', 'N', 't', 'T')
+                && utils::one_of(*transb, 'n', 'N', 't', 'T')))
+        return dnnl_unimplemented;
+
+    if (*M == 0 || *N == 0) return dnnl_success;
+
+    const gemm_args_t p {utils::one_of(*transa, 't', 'T'),
+            utils::one_of(*transb, 't', 'T'), *K, *alpha, *beta, A, *lda, B,
+            *ldb, C, *ldc, bias};
+
+    const dim_t m_block = vsetvlmax_e32m4();
+    const dim_t nb_m = utils::div_up(*M, m_block);
+    const dim_t nb_n = utils::div_up(*N, n_unroll);
+
+    parallel_nd(nb_n, nb_m, [&](dim_t bn, dim_t bm) {
+        const dim_t m = bm * m_block;
+        const dim_t n = bn * n_unroll;
+        const size_t vl = vsetvl_e32m4(*M - m);
+
+        if (*N - n >= n_unroll) {
+            kernel_n4(p, m, n, vl);
+        } else {
+            for (dim_t j = n; j < *N; j++)
+                kernel_n1(p, m, j, vl);
+        }
+    });
+
+    return dnnl_success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
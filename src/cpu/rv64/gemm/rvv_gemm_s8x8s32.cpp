@@ -0,0 +1,180 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/rv64/gemm/rvv_gemm_s8x8s32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+// Same blocking as the f32 kernel. Operands with offsets applied fit int16
+// and products are accumulated to int32 with widening multiply-adds.
+constexpr dim_t n_unroll = 4;
+
+template <typename b_dt>
+struct gemm_args_t {
+    bool trans_a, trans_b;
+    char offsetc;
+    dim_t K;
+    float alpha, beta;
+    const int8_t *A;
+    dim_t lda;
+    int16_t ao;
+    const b_dt *B;
+    dim_t ldb;
+    int16_t bo;
+    int32_t *C;
+    dim_t ldc;
+    const int32_t *co;
+};
+
+template <typename b_dt>
+inline vint16m2_t load_a(
+        const gemm_args_t<b_dt> &p, dim_t m, dim_t k, size_t vl) {
+    const vint8m1_t a = p.trans_a
+            ? vlse8_v_i8m1(&p.A[k + m * p.lda], p.lda, vl)
+            : vle8_v_i8m1(&p.A[m + k * p.lda], vl);
+    return vsub_vx_i16m2(vwadd_vx_i16m2(a, 0, vl), p.ao, vl);
+}
+
+template <typename b_dt>
+inline int16_t load_b(const gemm_args_t<b_dt> &p, dim_t k, dim_t n) {
+    const b_dt b = p.trans_b ? p.B[n + k * p.ldb] : p.B[k + n * p.ldb];
+    return static_cast<int16_t>(b - p.bo);
+}
+
+template <typename b_dt>
+inline void store_c(const gemm_args_t<b_dt> &p, vint32m4_t acc, dim_t m,
+        dim_t n, size_t vl) {
+    int32_t *c = &p.C[m + n * p.ldc];
+    const bool is_col_off = utils::one_of(p.offsetc, 'C', 'c');
+    const bool is_row_off = utils::one_of(p.offsetc, 'R', 'r');
+
+    if (p.alpha == 1.f && utils::one_of(p.beta, 0.f, 1.f)) {
+        // Exact integer path with saturation as in the reference.
+        if (p.beta == 1.f) acc = vsadd_vv_i32m4(acc, vle32_v_i32m4(c, vl), vl);
+        if (is_col_off)
+            acc = vsadd_vv_i32m4(acc, vle32_v_i32m4(&p.co[m], vl), vl);
+        else
+            acc = vsadd_vx_i32m4(acc, is_row_off ? p.co[n] : p.co[0], vl);
+        vse32_v_i32m4(c, acc, vl);
+        return;
+    }
+
+    vfloat32m4_t res = vfmul_vf_f32m4(vfcvt_f_x_v_f32m4(acc, vl), p.alpha, vl);
+    if (p.beta != 0.f)
+        res = vfmacc_vf_f32m4(
+                res, p.beta, vfcvt_f_x_v_f32m4(vle32_v_i32m4(c, vl), vl), vl);
+    if (is_col_off)
+        res = vfadd_vv_f32m4(res,
+                vfcvt_f_x_v_f32m4(vle32_v_i32m4(&p.co[m], vl), vl), vl);
+    else
+        res = vfadd_vf_f32m4(
+                res, (float)(is_row_off ? p.co[n] : p.co[0]), vl);
+    // Rounds to nearest even and saturates.
+    vse32_v_i32m4(c, vfcvt_x_f_v_i32m4(res, vl), vl);
+}
+
+template <typename b_dt>
+void kernel_n4(const gemm_args_t<b_dt> &p, dim_t m, dim_t n, size_t vl) {
+    vint32m4_t acc0 = vmv_v_x_i32m4(0, vl);
+    vint32m4_t acc1 = vmv_v_x_i32m4(0, vl);
+    vint32m4_t acc2 = vmv_v_x_i32m4(0, vl);
+    vint32m4_t acc3 = vmv_v_x_i32m4(0, vl);
+
+    for (dim_t k = 0; k < p.K; k++) {
+        const vint16m2_t a = load_a(p, m, k, vl);
+        acc0 = vwmacc_vx_i32m4(acc0, load_b(p, k, n + 0), a, vl);
+        acc1 = vwmacc_vx_i32m4(acc1, load_b(p, k, n + 1), a, vl);
+        acc2 = vwmacc_vx_i32m4(acc2, load_b(p, k, n + 2), a, vl);
+        acc3 = vwmacc_vx_i32m4(acc3, load_b(p, k, n + 3), a, vl);
+    }
+
+    store_c(p, acc0, m, n + 0, vl);
+    store_c(p, acc1, m, n + 1, vl);
+    store_c(p, acc2, m, n + 2, vl);
+    store_c(p, acc3, m, n + 3, vl);
+}
+
+template <typename b_dt>
+void kernel_n1(const gemm_args_t<b_dt> &p, dim_t m, dim_t n, size_t vl) {
+    vint32m4_t acc = vmv_v_x_i32m4(0, vl);
+    for (dim_t k = 0; k < p.K; k++)
+        acc = vwmacc_vx_i32m4(acc, load_b(p, k, n), load_a(p, m, k, vl), vl);
+    store_c(p, acc, m, n, vl);
+}
+} // namespace
+
+template <typename b_dt>
+dnnl_status_t rvv_gemm_s8x8s32(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const int8_t *A, const dim_t *LDA, const int8_t *ao,
+        const b_dt *B, const dim_t *LDB, const b_dt *bo, const float *beta,
+        int32_t *C, const dim_t *LDC, const int32_t *co) {
+    if (!(utils::one_of(*transa, 'n', 'N', 't', 'T')
+                && utils::one_of(*transb, 'n', 'N', 't', 'T')))
+        return dnnl_unimplemented;
+
+    if (*M == 0 || *N == 0) return dnnl_success;
+
+    const gemm_args_t<b_dt> p {utils::one_of(*transa, 't', 'T'),
+            utils::one_of(*transb, 't', 'T'), *offsetc, *K, *alpha, *beta, A,
+            *LDA, static_cast<int16_t>(*ao), B, *LDB,
+            static_cast<int16_t>(*bo), C, *LDC, co};
+
+    const dim_t m_block = vsetvlmax_e32m4();
+    const dim_t nb_m = utils::div_up(*M, m_block);
+    const dim_t nb_n = utils::div_up(*N, n_unroll);
+
+    parallel_nd(nb_n, nb_m, [&](dim_t bn, dim_t bm) {
+        const dim_t m = bm * m_block;
+        const dim_t n = bn * n_unroll;
+        const size_t vl = vsetvl_e32m4(*M - m);
+
+        if (*N - n >= n_unroll) {
+            kernel_n4(p, m, n, vl);
+        } else {
+            for (dim_t j = n; j < *N; j++)
+                kernel_n1(p, m, j, vl);
+        }
+    });
+
+    return dnnl_success;
+}
+
+template dnnl_status_t rvv_gemm_s8x8s32<uint8_t>(const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
+        const dim_t *K, const float *alpha, const int8_t *A, const dim_t *LDA,
+        const int8_t *ao, const uint8_t *B, const dim_t *LDB, const uint8_t *bo,
+        const float *beta, int32_t *C, const dim_t *LDC, const int32_t *co);
+
+template dnnl_status_t rvv_gemm_s8x8s32<int8_t>(const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
+        const dim_t *K, const float *alpha, const int8_t *A, const dim_t *LDA,
+        const int8_t *ao, const int8_t *B, const dim_t *LDB, const int8_t *bo,
+        const float *beta, int32_t *C, const dim_t *LDC, const int32_t *co);
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,44 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_RV64_GEMM_RVV_GEMM_S8X8S32_HPP
+#define CPU_RV64_GEMM_RVV_GEMM_S8X8S32_HPP
+
+#include <cstdint>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Column-major integer gemm with the gemm_s8x8s32() semantics.
+template <typename b_dt>
+dnnl_status_t rvv_gemm_s8x8s32(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const int8_t *A, const dim_t *LDA, const int8_t *ao,
+        const b_dt *B, const dim_t *LDB, const b_dt *bo, const float *beta,
+        int32_t *C, const dim_t *LDC, const int32_t *co);
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,122 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/rv64/rvv_binary.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+void binary_vv(alg_kind_t alg, const float *src0, const float *src1,
+        float *dst, size_t len) {
+    using namespace alg_kind;
+
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m8(len - i);
+        const vfloat32m8_t a = vle32_v_f32m8(&src0[i], vl);
+        const vfloat32m8_t b = vle32_v_f32m8(&src1[i], vl);
+        vfloat32m8_t d;
+        switch (alg) {
+            case binary_add: d = vfadd_vv_f32m8(a, b, vl); break;
+            case binary_mul: d = vfmul_vv_f32m8(a, b, vl); break;
+            case binary_max: d = vfmax_vv_f32m8(a, b, vl); break;
+            case binary_min: d = vfmin_vv_f32m8(a, b, vl); break;
+            case binary_sub: d = vfsub_vv_f32m8(a, b, vl); break;
+            case binary_div: d = vfdiv_vv_f32m8(a, b, vl); break;
+            default: assert(!"unsupported algorithm"); d = a;
+        }
+        vse32_v_f32m8(&dst[i], d, vl);
+        i += vl;
+    }
+}
+
+void binary_vf(alg_kind_t alg, const float *src0, float src1, float *dst,
+        size_t len) {
+    using namespace alg_kind;
+
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m8(len - i);
+        const vfloat32m8_t a = vle32_v_f32m8(&src0[i], vl);
+        vfloat32m8_t d;
+        switch (alg) {
+            case binary_add: d = vfadd_vf_f32m8(a, src1, vl); break;
+            case binary_mul: d = vfmul_vf_f32m8(a, src1, vl); break;
+            case binary_max: d = vfmax_vf_f32m8(a, src1, vl); break;
+            case binary_min: d = vfmin_vf_f32m8(a, src1, vl); break;
+            case binary_sub: d = vfsub_vf_f32m8(a, src1, vl); break;
+            case binary_div: d = vfdiv_vf_f32m8(a, src1, vl); break;
+            default: assert(!"unsupported algorithm"); d = a;
+        }
+        vse32_v_f32m8(&dst[i], d, vl);
+        i += vl;
+    }
+}
+} // namespace
+
+template <data_type_t d_type>
+riscv_binary_t<d_type>::riscv_binary_t(const pd_t *apd) : primitive_t(apd) {}
+
+template <>
+status_t riscv_binary_t<data_type::f32>::execute(const exec_ctx_t &ctx) const {
+    auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    src0 += src0_d.offset0();
+    src1 += src1_d.offset0();
+    dst += dst_d.offset0();
+
+    const dim_t nelems = src0_d.nelems(true);
+    const bool is_scalar_src1 = src1_d.nelems() == 1;
+    const auto alg = pd()->desc()->alg_kind;
+
+    // Chunks are aligned to a cache line to avoid false sharing on dst.
+    const dim_t block = 16;
+    const dim_t nblocks = utils::div_up(nelems, block);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nblocks, nthr, ithr, start, end);
+        start = nstl::min(nelems, start * block);
+        end = nstl::min(nelems, end * block);
+        if (start >= end) return;
+
+        const size_t len = end - start;
+        if (is_scalar_src1)
+            binary_vf(alg, &src0[start], src1[0], &dst[start], len);
+        else
+            binary_vv(alg, &src0[start], &src1[start], &dst[start], len);
+    });
+
+    return status::success;
+}
+
+template struct riscv_binary_t<data_type::f32>;
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,77 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_RV64_RVV_BINARY_HPP
+#define CPU_RV64_RVV_BINARY_HPP
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_binary_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Element-wise binary operation on tensors of the same shape and layout, or
+// with a single-element src1.
+template <data_type_t d_type>
+struct riscv_binary_t : public primitive_t {
+    struct pd_t : public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T_("RISCV64GCV", riscv_binary_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+            using namespace alg_kind;
+
+            const bool ok = utils::one_of(desc()->alg_kind, binary_add,
+                                    binary_mul, binary_max, binary_min,
+                                    binary_sub, binary_div)
+                    && utils::everyone_is(d_type, src_md(0)->data_type,
+                            src_md(1)->data_type, dst_md()->data_type)
+                    && platform::has_data_type_support(d_type)
+                    && !has_zero_dim_memory() && attr()->has_default_values()
+                    && set_default_params() == status::success
+                    && memory_desc_wrapper(src_md(0)).is_dense()
+                    && memory_desc_wrapper(src_md(0))
+                            == memory_desc_wrapper(dst_md())
+                    && (memory_desc_wrapper(src_md(0))
+                                    == memory_desc_wrapper(src_md(1))
+                            || memory_desc_wrapper(src_md(1)).nelems() == 1);
+
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    riscv_binary_t(const pd_t *apd);
+
+    using data_t = typename prec_traits<d_type>::type;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,130 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/rv64/rvv_eltwise.hpp"
+#include "cpu/rv64/rvv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+// Algorithms without transcendental functions are computed with LMUL = 8.
+void eltwise_linear_ops(alg_kind_t alg, const float *src, float *dst,
+        size_t len, float alpha, float beta) {
+    using namespace alg_kind;
+
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m8(len - i);
+        vfloat32m8_t v = vle32_v_f32m8(&src[i], vl);
+        switch (alg) {
+            case eltwise_relu: {
+                const vbool4_t neg = vmflt_vf_f32m8_b4(v, 0.f, vl);
+                v = vfmul_vf_f32m8_m(neg, v, v, alpha, vl);
+            } break;
+            case eltwise_linear:
+                v = vfadd_vf_f32m8(vfmul_vf_f32m8(v, alpha, vl), beta, vl);
+                break;
+            case eltwise_clip:
+                v = vfmin_vf_f32m8(vfmax_vf_f32m8(v, alpha, vl), beta, vl);
+                break;
+            case eltwise_abs: v = vfabs_v_f32m8(v, vl); break;
+            case eltwise_square: v = vfmul_vv_f32m8(v, v, vl); break;
+            case eltwise_sqrt: v = vfsqrt_v_f32m8(v, vl); break;
+            default: assert(!"unsupported algorithm");
+        }
+        vse32_v_f32m8(&dst[i], v, vl);
+        i += vl;
+    }
+}
+
+// The exp-based algorithms need more live registers, hence LMUL = 4.
+void eltwise_exp_ops(
+        alg_kind_t alg, const float *src, float *dst, size_t len) {
+    using namespace alg_kind;
+
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m4(len - i);
+        vfloat32m4_t v = vle32_v_f32m4(&src[i], vl);
+        if (alg == eltwise_exp) {
+            v = vexp_f32m4(v, vl);
+        } else {
+            // logistic(x) = 1 / (1 + exp(-x))
+            v = vexp_f32m4(vfneg_v_f32m4(v, vl), vl);
+            v = vfrdiv_vf_f32m4(vfadd_vf_f32m4(v, 1.f, vl), 1.f, vl);
+        }
+        vse32_v_f32m4(&dst[i], v, vl);
+        i += vl;
+    }
+}
+} // namespace
+
+template <data_type_t d_type>
+riscv_eltwise_fwd_t<d_type>::riscv_eltwise_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <>
+status_t riscv_eltwise_fwd_t<data_type::f32>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    src += src_d.offset0();
+    dst += dst_d.offset0();
+
+    const dim_t nelems = src_d.nelems(true);
+    const auto alg = pd()->desc()->alg_kind;
+    const float alpha = pd()->desc()->alpha;
+    const float beta = pd()->desc()->beta;
+    const bool is_exp_based = utils::one_of(
+            alg, alg_kind::eltwise_exp, alg_kind::eltwise_logistic);
+
+    // Chunks are aligned to a cache line to avoid false sharing on dst.
+    const dim_t block = 16;
+    const dim_t nblocks = utils::div_up(nelems, block);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nblocks, nthr, ithr, start, end);
+        start = nstl::min(nelems, start * block);
+        end = nstl::min(nelems, end * block);
+        if (start >= end) return;
+
+        const size_t len = end - start;
+        if (is_exp_based)
+            eltwise_exp_ops(alg, &src[start], &dst[start], len);
+        else
+            eltwise_linear_ops(
+                    alg, &src[start], &dst[start], len, alpha, beta);
+    });
+
+    return status::success;
+}
+
+template struct riscv_eltwise_fwd_t<data_type::f32>;
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,112 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cfloat>
+#include <cmath>
+#include <riscv_vector.h>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/rv64/rvv_softmax.hpp"
+#include "cpu/rv64/rvv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+namespace {
+float reduce_max(const float *src, size_t len) {
+    vfloat32m1_t vmax = vfmv_s_f_f32m1(vundefined_f32m1(), -FLT_MAX, 1);
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m8(len - i);
+        const vfloat32m8_t v = vle32_v_f32m8(&src[i], vl);
+        vmax = vfredmax_vs_f32m8_f32m1(vmax, v, vmax, vl);
+        i += vl;
+    }
+    return vfmv_f_s_f32m1_f32(vmax);
+}
+
+// Returns sum(exp(src - max)), the exponents are stored to dst if it is not
+// null.
+float exp_sum(const float *src, float *dst, float max, size_t len) {
+    vfloat32m1_t vsum = vfmv_s_f_f32m1(vundefined_f32m1(), 0.f, 1);
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m4(len - i);
+        vfloat32m4_t v = vle32_v_f32m4(&src[i], vl);
+        v = vexp_f32m4(vfsub_vf_f32m4(v, max, vl), vl);
+        if (dst) vse32_v_f32m4(&dst[i], v, vl);
+        vsum = vfredusum_vs_f32m4_f32m1(vsum, v, vsum, vl);
+        i += vl;
+    }
+    return vfmv_f_s_f32m1_f32(vsum);
+}
+
+// dst = dst * scale + shift
+void scale_shift(const float *src, float *dst, float scale, float shift,
+        size_t len) {
+    for (size_t i = 0; i < len;) {
+        const size_t vl = vsetvl_e32m8(len - i);
+        vfloat32m8_t v = vle32_v_f32m8(&src[i], vl);
+        v = vfadd_vf_f32m8(vfmul_vf_f32m8(v, scale, vl), shift, vl);
+        vse32_v_f32m8(&dst[i], v, vl);
+        i += vl;
+    }
+}
+} // namespace
+
+template <data_type_t d_type>
+riscv_softmax_fwd_t<d_type>::riscv_softmax_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <>
+status_t riscv_softmax_fwd_t<data_type::f32>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t outer_size = pd()->outer_size();
+    const dim_t axis_size = pd()->axis_size();
+    const bool is_logsoftmax = pd()->is_logsoftmax();
+
+    parallel_nd(outer_size, [&](dim_t ou) {
+        // The axis is the innermost dimension, so a row starts at the
+        // logical offset of its first element.
+        const float *s = &src[src_d.off_l(ou * axis_size)];
+        float *d = &dst[dst_d.off_l(ou * axis_size)];
+
+        const float max = reduce_max(s, axis_size);
+        if (is_logsoftmax) {
+            const float sum = exp_sum(s, nullptr, max, axis_size);
+            scale_shift(s, d, 1.f, -max - logf(sum), axis_size);
+        } else {
+            const float sum = exp_sum(s, d, max, axis_size);
+            scale_shift(d, d, 1.f / sum, 0.f, axis_size);
+        }
+    });
+
+    return status::success;
+}
+
+template struct riscv_softmax_fwd_t<data_type::f32>;
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
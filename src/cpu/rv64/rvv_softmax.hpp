@@ -0,0 +1,76 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_RV64_RVV_SOFTMAX_HPP
+#define CPU_RV64_RVV_SOFTMAX_HPP
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_softmax_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Softmax and logsoftmax over a dense innermost axis: every row of the axis
+// is contiguous in memory.
+template <data_type_t d_type>
+struct riscv_softmax_fwd_t : public primitive_t {
+    struct pd_t : public cpu_softmax_fwd_pd_t {
+        using cpu_softmax_fwd_pd_t::cpu_softmax_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T_("RISCV64GCV", riscv_softmax_fwd_t)
+
+        status_t init(engine_t *engine) {
+            UNUSED(engine);
+
+            const memory_desc_wrapper src_d(src_md());
+
+            const bool ok = is_fwd()
+                    && utils::everyone_is(
+                            d_type, src_md()->data_type, dst_md()->data_type)
+                    && platform::has_data_type_support(d_type)
+                    && !has_zero_dim_memory() && attr()->has_default_values()
+                    && set_default_formats() == status::success
+                    && src_d.is_plain() && src_d.is_dense()
+                    && src_d == memory_desc_wrapper(dst_md())
+                    && inner_size() == 1 && axis_stride() == 1;
+
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    riscv_softmax_fwd_t(const pd_t *apd);
+
+    using data_t = typename prec_traits<d_type>::type;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,62 @@
+/******************************************************************************
+* Copyright 2024 KNS Group LLC (YADRO)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_RV64_RVV_UTILS_HPP
+#define CPU_RV64_RVV_UTILS_HPP
+
+#include <riscv_vector.h>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Vector length agnostic exp(x): x = n * ln2 + r, exp(x) = 2^n * exp(r) with
+// the Cephes polynomial for exp(r). 2^(n - 1) is built in the exponent bits
+// and doubled afterwards so that n = 128 does not overflow.
+inline vfloat32m4_t vexp_f32m4(vfloat32m4_t x, size_t vl) {
+    const float exp_hi = 88.3762626647949f;
+    const float exp_lo = -87.3365447504019f;
+    const float log2e = 1.44269504088896341f;
+    const float ln2 = 0.693147180559945f;
+
+    x = vfmin_vf_f32m4(vfmax_vf_f32m4(x, exp_lo, vl), exp_hi, vl);
+
+    const vint32m4_t n = vfcvt_x_f_v_i32m4(vfmul_vf_f32m4(x, log2e, vl), vl);
+    const vfloat32m4_t fn = vfcvt_f_x_v_f32m4(n, vl);
+    const vfloat32m4_t r = vfnmsac_vf_f32m4(x, ln2, fn, vl);
+
+    vfloat32m4_t p = vfmv_v_f_f32m4(1.9875691500E-4f, vl);
+    p = vfmadd_vv_f32m4(p, r, vfmv_v_f_f32m4(1.3981999507E-3f, vl), vl);
+    p = vfmadd_vv_f32m4(p, r, vfmv_v_f_f32m4(8.3334519073E-3f, vl), vl);
+    p = vfmadd_vv_f32m4(p, r, vfmv_v_f_f32m4(4.1665795894E-2f, vl), vl);
+    p = vfmadd_vv_f32m4(p, r, vfmv_v_f_f32m4(1.6666665459E-1f, vl), vl);
+    p = vfmadd_vv_f32m4(p, r, vfmv_v_f_f32m4(5.0000001201E-1f, vl), vl);
+    // exp(r) = p * r^2 + r + 1
+    p = vfmadd_vv_f32m4(p, vfmul_vv_f32m4(r, r, vl), r, vl);
+    p = vfadd_vf_f32m4(p, 1.f, vl);
+
+    const vint32m4_t pow2n = vsll_vx_i32m4(vadd_vx_i32m4(n, 126, vl), 23, vl);
+    p = vfmul_vv_f32m4(p, vreinterpret_v_i32m4_f32m4(pow2n), vl);
+    return vfmul_vf_f32m4(p, 2.f, vl);
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
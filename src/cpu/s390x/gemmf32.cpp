@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2024 IBM Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(__VX__)
+
+#include <cstdint>
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "cpu/s390x/helpers.h"
+#include "gemm.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+namespace {
+
+// 16x4 register tile: 16 accumulators, 4 A vectors and the broadcasts fit
+// into the 32 vector registers.
+constexpr dim_t MC = 256;
+constexpr dim_t KC = 256;
+constexpr dim_t NC = 512;
+constexpr int MR = 16;
+constexpr int NR = 4;
+
+using vType = typename vec_type_t<float>::Type;
+constexpr int VLEN = vec_type_t<float>::size();
+
+// Packs an m x k block of op(A) into MR-row panels, zero padding the tail.
+void packA(bool transA, dim_t m, dim_t k, const float *A, dim_t ldA,
+        float *__restrict dst) {
+    for (dim_t i = 0; i < m; i += MR) {
+        const dim_t ib = nstl::min<dim_t>(MR, m - i);
+        for (dim_t p = 0; p < k; p++) {
+            for (dim_t ii = 0; ii < ib; ii++)
+                dst[ii] = transA ? aPtr(p, i + ii) : aPtr(i + ii, p);
+            for (dim_t ii = ib; ii < MR; ii++)
+                dst[ii] = 0.f;
+            dst += MR;
+        }
+    }
+}
+
+// Packs a k x n block of op(B) into NR-column panels, zero padding the tail.
+void packB(bool transB, dim_t k, dim_t n, const float *B, dim_t ldB,
+        float *__restrict dst) {
+    for (dim_t j = 0; j < n; j += NR) {
+        const dim_t jb = nstl::min<dim_t>(NR, n - j);
+        for (dim_t p = 0; p < k; p++) {
+            for (dim_t jj = 0; jj < jb; jj++)
+                dst[jj] = transB ? bPtr(j + jj, p) : bPtr(p, j + jj);
+            for (dim_t jj = jb; jj < NR; jj++)
+                dst[jj] = 0.f;
+            dst += NR;
+        }
+    }
+}
+
+// Computes an MR x NR tile of packed A by packed B into `acc` (column major).
+inline void kernel(dim_t k, const float *__restrict MP_A,
+        const float *__restrict MP_B, float *__restrict acc) {
+    vType Caux[MR / VLEN][NR] = {};
+
+    for (dim_t p = 0; p < k; p++) {
+        vType Ak[MR / VLEN];
+        for (int i = 0; i < MR / VLEN; i++)
+            Ak[i] = *reinterpret_cast<const vType *>(&MP_A[i * VLEN]);
+        for (int j = 0; j < NR; j++) {
+            const float b = MP_B[j];
+            for (int i = 0; i < MR / VLEN; i++)
+                Caux[i][j] += Ak[i] * b;
+        }
+        MP_A += MR;
+        MP_B += NR;
+    }
+
+    for (int j = 0; j < NR; j++)
+        for (int i = 0; i < MR / VLEN; i++)
+            *reinterpret_cast<vType *>(&acc[j * MR + i * VLEN]) = Caux[i][j];
+}
+
+// Merges a tile into C: the first K block applies beta (C is not read when
+// beta is zero), the last one adds the bias.
+inline void addResults(dim_t m, dim_t n, const float *acc, float alpha,
+        float beta, bool first, const float *bias, float *C, dim_t ldC) {
+    for (dim_t j = 0; j < n; j++) {
+        for (dim_t i = 0; i < m; i++) {
+            float val = alpha * acc[j * MR + i];
+            if (!first)
+                val += gPtr(i, j);
+            else if (beta != 0.f)
+                val += beta * gPtr(i, j);
+            if (bias) val += bias[i];
+            gPtr(i, j) = val;
+        }
+    }
+}
+
+void LoopNC(bool transA, bool transB, dim_t m, dim_t n, dim_t k, float alpha,
+        const float *A, dim_t ldA, const float *B, dim_t ldB, float beta,
+        float *C, dim_t ldC, const float *bias, float *Apacked,
+        float *Bpacked) {
+    alignas(VLEN_BYTES) float acc[MR * NR];
+
+    for (dim_t j = 0; j < n; j += NC) {
+        const dim_t jb = nstl::min(NC, n - j);
+        for (dim_t p = 0; p < k; p += KC) {
+            const dim_t pb = nstl::min(KC, k - p);
+            const bool first = p == 0;
+            const float *localBias = p + pb == k ? bias : nullptr;
+            packB(transB, pb, jb, transB ? &bPtr(j, p) : &bPtr(p, j), ldB,
+                    Bpacked);
+
+            for (dim_t i = 0; i < m; i += MC) {
+                const dim_t ib = nstl::min(MC, m - i);
+                packA(transA, ib, pb, transA ? &aPtr(p, i) : &aPtr(i, p), ldA,
+                        Apacked);
+
+                for (dim_t jr = 0; jr < jb; jr += NR) {
+                    for (dim_t ir = 0; ir < ib; ir += MR) {
+                        kernel(pb, &Apacked[ir * pb], &Bpacked[jr * pb], acc);
+                        addResults(nstl::min<dim_t>(MR, ib - ir),
+                                nstl::min<dim_t>(NR, jb - jr), acc, alpha,
+                                beta, first,
+                                localBias ? &localBias[i + ir] : nullptr,
+                                &gPtr(i + ir, j + jr), ldC);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+dnnl_status_t gemm_f32(const char *transa, const char *transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t ldA,
+        const float *B, dim_t ldB, float beta, float *C, dim_t ldC,
+        const float *bias) {
+    // Degenerate sizes are left to the reference implementation.
+    if (M <= 0 || N <= 0 || K <= 0) return dnnl_unimplemented;
+
+    const bool trA = *transa == 't' || *transa == 'T';
+    const bool trB = *transb == 't' || *transb == 'T';
+
+    // Split N between threads when there are enough columns, otherwise split
+    // M so that matrix-vector products in inference are threaded as well.
+    const int thr_count = dnnl_get_current_num_threads();
+    const bool split_n = N >= thr_count * NR;
+    const dim_t dim = split_n ? N : M;
+    const dim_t step = split_n ? NR : MR;
+    const dim_t chunk = utils::rnd_up(
+            utils::div_up(dim, nstl::max<dim_t>(1, thr_count)), step);
+    const dim_t nPanels = utils::div_up(dim, chunk);
+
+    bool ok = true;
+    parallel(static_cast<int>(nPanels), [&](int ithr, int nthr) {
+        for (dim_t t = ithr; t < nPanels; t += nthr) {
+            const dim_t start = t * chunk;
+            const dim_t len = nstl::min(chunk, dim - start);
+            const dim_t localM = split_n ? M : len;
+            const dim_t localN = split_n ? len : N;
+            const dim_t kC = nstl::min(KC, K);
+
+            auto Apack = (float *)malloc(
+                    MC * kC * sizeof(float) + VLEN_BYTES, 4096);
+            auto Bpack = (float *)malloc(
+                    kC * utils::rnd_up(nstl::min(NC, localN), NR)
+                                    * sizeof(float)
+                            + VLEN_BYTES,
+                    4096);
+            if (utils::any_null(Apack, Bpack)) {
+                free(Apack);
+                free(Bpack);
+                ok = false;
+                return;
+            }
+
+            auto localA = split_n
+                    ? A
+                    : (trA ? &aPtr(0, start) : &aPtr(start, 0));
+            auto localB = !split_n
+                    ? B
+                    : (trB ? &bPtr(start, 0) : &bPtr(0, start));
+            auto localC = split_n ? &gPtr(0, start) : &gPtr(start, 0);
+            auto localBias = (bias && !split_n) ? &bias[start] : bias;
+
+            LoopNC(trA, trB, localM, localN, K, alpha, localA, ldA, localB,
+                    ldB, beta, localC, ldC, localBias, Apack, Bpack);
+
+            free(Apack);
+            free(Bpack);
+        }
+    });
+    return ok ? dnnl_success : dnnl_out_of_memory;
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
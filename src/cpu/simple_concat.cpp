@@ -51,6 +51,15 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         }
         iptrs[a] = iptr + i_d.blk_off(0);
         optrs[a] = o_base_ptr + o_d.blk_off(0);
+        // A source that is a view of its part of the destination, e.g. when a
+        // producer wrote its result directly into the destination, is
+        // already in place and doesn't need to be copied.
+        if (iptrs[a] == optrs[a]
+                && types::blocking_desc_is_equal(*i_d.md_, *o_d.md_)) {
+            iptrs[a] = nullptr;
+            nelems_to_copy[a] = 0;
+            continue;
+        }
         nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
             if (i < perm[concat_dim])
@@ -117,6 +117,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
     const auto calculate_stats = !pd()->stats_are_src();
+    const auto skip_mean = pd()->skip_mean();
     const auto src_dt = pd()->src_md()->data_type;
     const auto dst_dt = pd()->dst_md()->data_type;
     const auto eps = pd()->desc()->layer_norm_epsilon;
@@ -138,13 +139,15 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
         for (size_t offset = 0; offset < block_size; offset++) {
             float v_mean = 0, v_variance = 0;
             if (calculate_stats) {
-                PRAGMA_OMP_SIMD(reduction(+ : v_mean))
-                for (dim_t c = 0; c < C; ++c) {
-                    float s = io::load_float_value(
-                            src_dt, src_ptr, c + C * offset);
-                    v_mean += s;
+                if (!skip_mean) {
+                    PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+                    for (dim_t c = 0; c < C; ++c) {
+                        float s = io::load_float_value(
+                                src_dt, src_ptr, c + C * offset);
+                        v_mean += s;
+                    }
+                    v_mean /= C_f;
                 }
-                v_mean /= C_f;
 
                 PRAGMA_OMP_SIMD(reduction(+ : v_variance))
                 for (dim_t c = 0; c < C; ++c) {
@@ -155,7 +158,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 }
                 v_variance /= C_f;
             } else {
-                v_mean = mean_ptr[offset];
+                if (!skip_mean) v_mean = mean_ptr[offset];
                 v_variance = var_ptr[offset];
             }
 
@@ -228,7 +231,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 }
             }
             if (calculate_stats && save_stats) {
-                mean_ptr[offset] = v_mean;
+                if (!skip_mean) mean_ptr[offset] = v_mean;
                 var_ptr[offset] = v_variance;
             }
         }
@@ -329,6 +332,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
     const auto diff_src_dt = pd()->diff_src_md()->data_type;
     const auto eps = pd()->desc()->layer_norm_epsilon;
     const auto calculate_diff_stats = !pd()->stats_are_src();
+    const auto skip_mean = pd()->skip_mean();
 
     parallel(max_nthr, [&](int ithr, int nthr) {
         dim_t N_start = 0, N_end = 0;
@@ -355,14 +359,14 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
 
         for (size_t offset = 0; offset < block_size; offset++) {
             inv_sqrtvar_ptr[offset] = 1.f / sqrtf(var_ptr[offset] + eps);
+            const float v_mean = skip_mean ? 0.f : mean_ptr[offset];
 
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C; c++) {
                 const size_t off = c + C * offset;
                 float s = io::load_float_value(src_dt, src_ptr, off);
                 float dd = io::load_float_value(diff_dst_dt, diff_dst_ptr, off);
-                my_diff_gamma[c] += (s - mean_ptr[offset]) * dd
-                        * inv_sqrtvar_ptr[offset];
+                my_diff_gamma[c] += (s - v_mean) * dd * inv_sqrtvar_ptr[offset];
                 my_diff_beta[c] += dd;
             }
         }
@@ -397,6 +401,8 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
         //       see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
         float dd_gamma, dd_gamma_x;
         for (size_t offset = 0; offset < block_size; offset++) {
+            const float v_mean = skip_mean ? 0.f : mean_ptr[offset];
+
             // reduce gamma
             dd_gamma = dd_gamma_x = 0;
             if (calculate_diff_stats) {
@@ -408,7 +414,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                         float dd = io::load_float_value(
                                 diff_dst_dt, diff_dst_ptr, off);
                         dd_gamma += dd * scale[c];
-                        dd_gamma_x += dd * scale[c] * (s - mean_ptr[offset]);
+                        dd_gamma_x += dd * scale[c] * (s - v_mean);
                     }
                 } else {
                     PRAGMA_OMP_SIMD(reduction(+ : dd_gamma, dd_gamma_x))
@@ -418,7 +424,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                         float dd = io::load_float_value(
                                 diff_dst_dt, diff_dst_ptr, off);
                         dd_gamma += dd;
-                        dd_gamma_x += dd * (s - mean_ptr[offset]);
+                        dd_gamma_x += dd * (s - v_mean);
                     }
                 }
                 dd_gamma_x *= inv_sqrtvar_ptr[offset];
@@ -434,8 +440,9 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                     float ds = dd * scale[c];
                     if (calculate_diff_stats) {
                         float s = io::load_float_value(src_dt, src_ptr, off);
-                        ds -= dd_gamma / C_f;
-                        ds -= (s - mean_ptr[offset]) * dd_gamma_x
+                        // The mean term vanishes for RMS normalization.
+                        if (!skip_mean) ds -= dd_gamma / C_f;
+                        ds -= (s - v_mean) * dd_gamma_x
                                 * inv_sqrtvar_ptr[offset] / C_f;
                     }
                     ds *= inv_sqrtvar_ptr[offset];
@@ -450,8 +457,9 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                     float ds = dd;
                     if (calculate_diff_stats) {
                         float s = io::load_float_value(src_dt, src_ptr, off);
-                        ds -= dd_gamma / C_f;
-                        ds -= (s - mean_ptr[offset]) * dd_gamma_x
+                        // The mean term vanishes for RMS normalization.
+                        if (!skip_mean) ds -= dd_gamma / C_f;
+                        ds -= (s - v_mean) * dd_gamma_x
                                 * inv_sqrtvar_ptr[offset] / C_f;
                     }
                     ds *= inv_sqrtvar_ptr[offset];
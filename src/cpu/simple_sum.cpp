@@ -30,7 +30,11 @@ status_t simple_sum_t<src_data_type, dst_data_type>::execute(
     const memory_desc_wrapper o_d(pd()->dst_md());
     output += o_d.blk_off(0);
     const int num_arrs = pd()->n_inputs();
-    const src_data_t *input_ptrs[max_num_arrs];
+    // Any number of inputs is summed in a single pass over each cache block
+    // of dst, so no intermediate accumulation through dst memory is needed.
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto input_ptrs = scratchpad.template get<const src_data_t *>(
+            memory_tracking::names::key_sum_srcs_ptrs);
 
     for (int a = 0; a < num_arrs; ++a) {
         const memory_desc_wrapper i_d(pd()->src_md(a));
@@ -50,7 +54,6 @@ status_t simple_sum_t<src_data_type, dst_data_type>::execute(
         const bool is_dst_xf16
                 = utils::one_of(dst_data_type, data_type::bf16, data_type::f16);
         const auto xf16_params = pd()->xf16_params_;
-        const auto scratchpad = ctx.get_scratchpad_grantor();
         acc_data_t *wspace = scratchpad.template get<acc_data_t>(
                 memory_tracking::names::key_sum_srcs_cvt);
         acc_data_t *my_ws = &wspace[ithr * xf16_params.ws_elements_per_thread_];
@@ -51,8 +51,6 @@ struct simple_sum_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_SUM(cpu_sum_pd_t::init(engine) == status::success,
                     VERBOSE_BAD_ENGINE_KIND);
-            VDISPATCH_SUM(n <= max_num_arrs,
-                    "number of inputs exceed max number of arrays");
 
             const memory_desc_wrapper o_d(dst_md());
             VDISPATCH_SUM(o_d.data_type() == dst_data_type,
@@ -92,6 +90,9 @@ struct simple_sum_t : public primitive_t {
         }
 
         void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<const void *>(
+                    memory_tracking::names::key_sum_srcs_ptrs, n_inputs());
             if (utils::one_of(src_data_type, data_type::bf16, data_type::f16)) {
                 const bool is_dst_xf16 = utils::one_of(
                         dst_data_type, data_type::bf16, data_type::f16);
@@ -112,7 +113,6 @@ struct simple_sum_t : public primitive_t {
                         + xf16_params_.ws_acc_elements_per_thread_;
                 const dim_t cvt_buf_sz
                         = xf16_params_.ws_elements_per_thread_ * nthr_;
-                auto scratchpad = scratchpad_registry().registrar();
                 scratchpad.template book<acc_data_t>(
                         memory_tracking::names::key_sum_srcs_cvt, cvt_buf_sz);
             }
@@ -123,7 +123,6 @@ struct simple_sum_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
-    enum { max_num_arrs = 16 };
     typedef typename prec_traits<src_data_type>::type src_data_t;
     typedef typename prec_traits<dst_data_type>::type dst_data_t;
     typedef typename prec_traits<data_type::f32>::type acc_data_t;
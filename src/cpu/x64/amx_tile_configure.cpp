@@ -35,7 +35,10 @@ struct jit_amx_tilecfg_t : public jit_generator {
     // TODO: merge into a single call. Keep both versions for now until there's
     // a clear path lazy initialization API used across the library.
     void tile_lazy_configure(const char *palette) const {
-        (*this)(palette, palette_store_);
+        // The current configuration is stored per call: the kernel object is
+        // shared by all threads.
+        alignas(64) char palette_store[AMX_PALETTE_SIZE];
+        (*this)(palette, palette_store);
     }
 
 private:
@@ -45,12 +48,11 @@ private:
     // According to measurements, the impact on performance is marginal compared
     // to manual handling of when palette should be loaded.
     bool is_lazy_;
-    char palette_store_[AMX_PALETTE_SIZE];
 
     void generate() override {
         if (is_lazy_) {
             Xbyak::Label skip_tilecfg;
-            // Store currect tilecfg into `palette_store_`.
+            // Store current tilecfg into the `palette_store` buffer.
             sttilecfg(ptr[abi_param2]);
             // Move tilecfg into Zmm for further comparison.
             vmovdqu64(Xbyak::Zmm(0), ptr[abi_param2]);
@@ -441,6 +441,20 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     const auto binary_ind = post_ops.find(primitive_kind::binary);
     const auto prelu_ind = post_ops.find(primitive_kind::prelu);
     brg->with_binary = !everyone_is(-1, binary_ind, prelu_ind);
+    brg->with_depthwise = post_ops.find(primitive_kind::depthwise) != -1;
+    brg->with_quantization = post_ops.find(primitive_kind::quantization) != -1;
+
+    // Depthwise and quantization post-ops are implemented in brdgmm kernel
+    // only. Their pointers are expected at the beginning of the post-ops
+    // arguments vector, so they are not combined with binary post-ops.
+    const bool with_dw_quant = brg->with_depthwise || brg->with_quantization;
+    if (with_dw_quant && (!brg->is_dgmm || brg->with_binary))
+        return status::unimplemented;
+    std::vector<post_op_type> accepted_post_ops = {sum, eltwise, binary};
+    if (with_dw_quant) {
+        accepted_post_ops.push_back(depthwise);
+        accepted_post_ops.push_back(quantization);
+    }
 
     // NOTE: Using brg->isa_impl here is a bit dangerous as it can change before
     //       kernel creation, so there is no gaurantee that the isa checked here
@@ -451,7 +465,7 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     //       but there is no guarantee that will always be the case.
     if ((brg->with_binary && !dst_md)
             || !injector::post_ops_ok(
-                    post_ops_ok_args_t(brg->isa_impl, {sum, eltwise, binary},
+                    post_ops_ok_args_t(brg->isa_impl, accepted_post_ops,
                             post_ops, &dst_d, false /*sum_at_pos_0_only*/,
                             false /*sum_requires_scale_one*/,
                             false /*sum_requires_zp_zero*/,
@@ -464,6 +478,7 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
                                     broadcasting_strategy_t::per_w,
                                     broadcasting_strategy_t::batch,
                                     broadcasting_strategy_t::spatial,
+                                    broadcasting_strategy_t::shared_axes,
                                     broadcasting_strategy_t::no_broadcast})))
         return status::unimplemented;
 
@@ -531,7 +546,8 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     if (brg->is_dgmm) {
         const bool sum_needs_vmm = (!is_superset(brg->isa_impl, avx512_core))
                 && brg->with_sum && brg->sum_scale != 1.f;
-        if (is_zp_src || sum_needs_vmm) CHECK(brdgmm_blocking(brg));
+        if (is_zp_src || sum_needs_vmm || with_dw_quant)
+            CHECK(brdgmm_blocking(brg));
     } else if (is_zp_src || brg->is_bf16_emu)
         CHECK(brgemm_blocking(brg));
 
@@ -793,6 +809,8 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(sum_dt);
     CMP_BRGEMM_FIELD(with_eltwise);
     CMP_BRGEMM_FIELD(with_binary);
+    CMP_BRGEMM_FIELD(with_depthwise);
+    CMP_BRGEMM_FIELD(with_quantization);
     CMP_BRGEMM_FIELD(with_scales);
 
     CMP_BRGEMM_FIELD(zp_type_a);
@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <mutex>
+#include <unordered_map>
+
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/brgemm/jit_brdgmm_kernel.hpp"
 
@@ -26,19 +29,82 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
-std::set<std::shared_ptr<brgemm_kernel_t>,
-        decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-brgemm_kernel_container_t::get_set() {
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ = std::set<std::shared_ptr<brgemm_kernel_t>,
-                    decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
-                    brgemm_kernel_container_t::brgemm_kernel_cmp);
-#endif
-    return set_;
+namespace {
+
+// Global storage of the generated brgemm kernels indexed by a hash of their
+// code. It holds weak references to avoid extending the lifetime of kernels
+// beyond the lifetime of primitives that use them.
+struct brgemm_kernel_storage_t {
+    std::shared_ptr<brgemm_kernel_t> get_or_add(
+            const std::shared_ptr<brgemm_kernel_t> &kernel) {
+        const auto *jit = kernel->get_jit_generator();
+        const auto *code = jit->CodeGenerator::getCode();
+        const size_t size = jit->getSize();
+
+        size_t hash = size;
+        for (size_t i = 0; i < size; i++)
+            hash = hash_combine(hash, code[i]);
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto &bucket = kernels_[hash];
+        for (auto it = bucket.begin(); it != bucket.end();) {
+            auto existing = it->lock();
+            if (!existing) {
+                it = bucket.erase(it);
+                n_entries_--;
+                continue;
+            }
+            if (!brgemm_kernel_container_t::brgemm_kernel_cmp(existing, kernel)
+                    && !brgemm_kernel_container_t::brgemm_kernel_cmp(
+                            kernel, existing))
+                return existing;
+            ++it;
+        }
+        bucket.emplace_back(kernel);
+        n_entries_++;
+        // Expired references in buckets that are never looked up again are
+        // dropped once the number of entries doubles since the last sweep, so
+        // the cost of the sweeps is amortized over the insertions.
+        if (n_entries_ > 2 * n_entries_after_compact_ + min_entries_to_compact)
+            compact();
+        return kernel;
+    }
+
+private:
+    static constexpr size_t min_entries_to_compact = 64;
+
+    void compact() {
+        for (auto b = kernels_.begin(); b != kernels_.end();) {
+            auto &bucket = b->second;
+            for (auto it = bucket.begin(); it != bucket.end();) {
+                if (it->expired()) {
+                    it = bucket.erase(it);
+                    n_entries_--;
+                } else
+                    ++it;
+            }
+            if (bucket.empty())
+                b = kernels_.erase(b);
+            else
+                ++b;
+        }
+        n_entries_after_compact_ = n_entries_;
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<size_t, std::vector<std::weak_ptr<brgemm_kernel_t>>>
+            kernels_;
+    size_t n_entries_ = 0;
+    size_t n_entries_after_compact_ = 0;
+};
+
+brgemm_kernel_storage_t &global_kernel_storage() {
+    static brgemm_kernel_storage_t storage;
+    return storage;
 }
 
+} // namespace
+
 bool brgemm_desc_container_t::insert(int idx, brgemm_desc_t &brg,
         const std::vector<char> &bd_mask,
         const std::vector<brgemm_batch_element_t> &static_offsets) {
@@ -104,15 +170,18 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // key (we can check if brgemm descriptor is unique inside brgemm primitive)
     // 2. Only if we do not find entry in local brgemm_map_  then try to find
     // entry in kernel storage using kernel code as key
+    // 3. Only if the code is unique inside the primitive then look it up in the
+    // global storage of kernels shared by all primitives
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
         brgemm_kernel_t *brg_kernel = nullptr;
         CHECK(brgemm_kernel_create(&brg_kernel, *brg));
         std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
-        lock_write();
-        const auto kernel_ret = get_set().insert(sptr);
-        refs_[idx] = kernel_ret.first->get();
-        unlock_write();
+        auto kernel_it = set_.find(sptr);
+        if (kernel_it == set_.end())
+            kernel_it = set_.insert(global_kernel_storage().get_or_add(sptr))
+                                .first;
+        refs_[idx] = kernel_it->get();
         const auto brgemm_ret = brgemm_map_.insert({brg, refs_[idx]});
         if (!brgemm_ret.second) return status::runtime_error;
     } else {
@@ -121,6 +190,35 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     return status::success;
 }
 
+status_t brgemm_lazy_kernel_container_t::insert(
+        int idx, const brgemm_desc_t *brg) {
+    brgemm_kernel_t *brg_kernel = nullptr;
+    CHECK(brgemm_kernel_create(&brg_kernel, *brg));
+    kernels_[idx].reset(brg_kernel);
+    refs_[idx].store(brg_kernel, std::memory_order_release);
+    return status::success;
+}
+
+const brgemm_kernel_t *brgemm_lazy_kernel_container_t::get(
+        int idx, const brgemm_desc_t *brg) const {
+    const auto *kernel = refs_[idx].load(std::memory_order_acquire);
+    if (kernel) return kernel;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    kernel = refs_[idx].load(std::memory_order_relaxed);
+    if (kernel) return kernel;
+
+    brgemm_kernel_t *brg_kernel = nullptr;
+    const status_t st = brgemm_kernel_create(&brg_kernel, *brg);
+    if (st != status::success) {
+        status_.store(st);
+        return nullptr;
+    }
+    kernels_[idx].reset(brg_kernel);
+    refs_[idx].store(brg_kernel, std::memory_order_release);
+    return brg_kernel;
+}
+
 bool brgemm_palette_container_t::insert(int idx, const brgemm_desc_t *brg) {
     S_t kernel_palette;
     auto status = brgemm_init_tiles(*brg, kernel_palette.data());
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 #define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
+#include <atomic>
+#include <mutex>
 #include <set>
 #include "common/rw_mutex.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -67,9 +69,11 @@ private:
     std::vector<std::vector<brgemm_batch_element_t>> static_offsets_list_;
 };
 
-// global storage disabled for now
-// #define BRGEMM_KERNEL_GLOBAL_STORAGE
-
+// Kernels are deduplicated by their generated code: a kernel that is
+// byte-identical to a kernel of any other live primitive is replaced with the
+// existing one, so primitives with similar shapes share a single code buffer.
+// The global storage keeps weak references only, the code is released once the
+// last primitive using it is destroyed.
 struct brgemm_kernel_container_t {
     brgemm_kernel_container_t() {}
     brgemm_kernel_container_t(size_t ns) { resize(ns); }
@@ -84,32 +88,43 @@ struct brgemm_kernel_container_t {
 
 private:
     std::vector<const brgemm_kernel_t *> refs_;
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
-
-#else
     std::set<std::shared_ptr<brgemm_kernel_t>,
             decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
             set_ {std::set<std::shared_ptr<brgemm_kernel_t>,
                     decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
                     brgemm_kernel_container_t::brgemm_kernel_cmp)};
 
-    void lock_write() {}
-    void unlock_write() {}
-#endif
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-    get_set();
-
     std::map<const brgemm_desc_t *, const brgemm_kernel_t *> brgemm_map_;
 };
 
+// Container of brgemm kernels that may be generated on first use instead of
+// at primitive creation. It is intended for kernel variants that are rarely
+// executed, e.g. the tails of runtime dimensions, to avoid paying for their
+// generation at primitive creation.
+struct brgemm_lazy_kernel_container_t {
+    brgemm_lazy_kernel_container_t(size_t ns)
+        : kernels_(ns), refs_(new std::atomic<const brgemm_kernel_t *>[ns]) {
+        for (size_t i = 0; i < ns; i++)
+            refs_[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Generates the kernel at primitive creation.
+    status_t insert(int idx, const brgemm_desc_t *brg);
+
+    // Returns the kernel, generating it if it was not generated yet. Safe to
+    // call concurrently. Returns nullptr if the generation failed; the error
+    // is reported by `status()`.
+    const brgemm_kernel_t *get(int idx, const brgemm_desc_t *brg) const;
+
+    status_t status() const { return status_.load(); }
+
+private:
+    mutable std::vector<std::unique_ptr<brgemm_kernel_t>> kernels_;
+    std::unique_ptr<std::atomic<const brgemm_kernel_t *>[]> refs_;
+    mutable std::mutex mutex_;
+    mutable std::atomic<status_t> status_ {status::success};
+};
+
 struct brgemm_palette_container_t {
     typedef std::array<char, AMX_PALETTE_SIZE> S_t;
 
@@ -122,9 +137,15 @@ struct brgemm_palette_container_t {
     bool insert(int idx, const brgemm_desc_t *brg);
     bool insert(int idx, const brgemm_desc_t &brg) { return insert(idx, &brg); }
 
+    // Configures tiles for the `new_idx` palette unless `idx`, the palette
+    // last configured by the calling thread, is an identical one. For the
+    // first configuration (`idx < 0`) the palette still loaded on the core,
+    // e.g. by a previous primitive, is compared and reused when identical.
     inline void maybe_tile_configure(bool is_amx, int &idx, int new_idx) const {
         if (idx == new_idx) return;
-        if (is_amx && (idx < 0 || refs_[idx] != refs_[new_idx]))
+        if (is_amx && idx < 0)
+            amx_tile_lazy_configure(refs_[new_idx]->data());
+        else if (is_amx && refs_[idx] != refs_[new_idx])
             amx_tile_configure(refs_[new_idx]->data());
         idx = new_idx;
     }
@@ -232,6 +232,8 @@ struct brgemm_desc_t {
     impl::data_type_t sum_dt = data_type::undef;
     bool with_eltwise = false;
     bool with_binary = false;
+    bool with_depthwise = false;
+    bool with_quantization = false;
     bool with_scales = false;
     bool skip_zp_b_compensation = false;
     bool skip_scales = false;
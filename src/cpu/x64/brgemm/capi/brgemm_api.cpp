@@ -103,6 +103,11 @@ status_t dnnl_brgemm_create(brgemm_t **brgemm, dim_t M, dim_t N, dim_t K,
     // compensation on their own as a binary post-op.
     brgemm_desc.req_s8s8_compensation = false;
 
+    _brgemm->palette_.fill(0);
+    if (brgemm_init_tiles(brgemm_desc, _brgemm->palette_.data())
+            != status::success)
+        _brgemm->palette_.fill(0);
+
     *brgemm = _brgemm;
     return status::success;
 }
@@ -117,11 +122,11 @@ status_t dnnl_brgemm_get_scratchpad_size(const brgemm_t *brgemm, size_t *size) {
 status_t dnnl_brgemm_set_hw_context(const brgemm_t *brgemm) {
     if (brgemm == nullptr) return invalid_arguments;
 
-    const auto &brgemm_desc = brgemm->brgemm_desc_;
-    char palette[AMX_PALETTE_SIZE] = {};
-    auto status = brgemm_init_tiles(brgemm_desc, palette);
-    if (status == status::success) {
-        status = amx_tile_lazy_configure(palette);
+    // The palette is computed once per object, and the lazy configuration
+    // skips `ldtilecfg` when the same palette is already loaded on the core.
+    const char *palette = brgemm->palette_.data();
+    if (palette[0] != 0) {
+        auto status = amx_tile_lazy_configure(palette);
         VCHECK_BRGEMM_STATUS(
                 status, status == status::success, "amx_tile_configure failed");
     }
@@ -129,6 +134,15 @@ status_t dnnl_brgemm_set_hw_context(const brgemm_t *brgemm) {
     return status::success;
 }
 
+status_t dnnl_brgemm_is_same_hw_context(
+        const brgemm_t *brgemm, const brgemm_t *other_brgemm, int *is_same) {
+    if (utils::any_null(brgemm, other_brgemm, is_same))
+        return invalid_arguments;
+
+    *is_same = brgemm->palette_ == other_brgemm->palette_;
+    return status::success;
+}
+
 status_t dnnl_brgemm_release_hw_context() {
     if (mayiuse(avx512_core_amx)) {
         VCHECK_BRGEMM(amx_tile_release() == status::success,
@@ -213,24 +227,29 @@ status_t dnnl_brgemm_destroy(brgemm_t *brgemm) {
     return status::success;
 }
 
-dnnl_brgemm_pack_B::dnnl_brgemm_pack_B(dim_t K, dim_t N, dim_t in_ld,
-        dim_t out_ld, data_type_t in_dt, data_type_t out_dt) {
-    // So far, only `ab` input format (dense or strided) is supported.
-    assert(in_ld >= N);
+dnnl_brgemm_pack_B::dnnl_brgemm_pack_B(dim_t K, dim_t N, bool is_trans,
+        dim_t in_ld, dim_t out_ld, data_type_t in_dt, data_type_t out_dt)
+    : bmc_(), in_ld_(in_ld) {
+    // Only plain `ab` and `ba` input formats (dense or strided) are supported.
+    assert(in_ld >= (is_trans ? K : N));
     // Only special N_blk sizes are supported by matmul copy routines. Rest
     // will crash.
     assert(utils::one_of(out_ld, 16, 32, 48, 64));
 
-    auto status = matmul::init_conf(
-            bmc_, /* batch = */ 1, K, N, out_ld, in_dt, out_dt, format_tag::ab);
+    auto status = matmul::init_conf(bmc_, /* batch = */ 1, K, N, out_ld, in_dt,
+            out_dt, is_trans ? format_tag::ba : format_tag::ab);
     assert(status == status::success);
     if (status != status::success) return;
+
+    bmc_.copy_B_wei_stride = in_ld * bmc_.b_dt_sz;
 }
 
 bool brgemm_pack_B_t::need_pack() const {
     // TODO: move on unified method from the library.
-    return bmc_.orig_wei_dt != data_type::f32
-            && bmc_.orig_wei_dt != data_type::f16;
+    // A transposed input always requires a transform.
+    return bmc_.transposed_B
+            || (bmc_.orig_wei_dt != data_type::f32
+                    && bmc_.orig_wei_dt != data_type::f16);
 }
 
 void brgemm_pack_B_t::generate() {
@@ -254,6 +273,11 @@ void brgemm_pack_B_t::execute(const void *src, void *dst) const {
     const auto i_dt_sz = kernel_conf.b_dt_sz;
     const auto o_dt_sz = kernel_conf.a_dt_sz;
 
+    // Offset of the (k, n) element in elements of the plain input.
+    const auto get_src_off = [&](dim_t k, dim_t n) {
+        return kernel_conf.transposed_B ? n * in_ld_ + k : k * in_ld_ + n;
+    };
+
     for (dim_t n_blk_idx = 0; n_blk_idx < n_blks; n_blk_idx++) {
         const auto n = n_blk_idx * kernel_conf.N_blk;
         const bool is_N_tail = (kernel_conf.N - n) < kernel_conf.N_blk;
@@ -264,11 +288,9 @@ void brgemm_pack_B_t::execute(const void *src, void *dst) const {
         int k_blk_idx = 0;
         for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++) {
             const auto k = k_blk_idx * kernel_conf.K_blk;
-            assert(kernel_conf.wei_tag == format_tag::ab);
-            // Since only `ab` is supported so far, hard code the stride.
-            const auto src_offset = i_dt_sz * (k * kernel_conf.N + n);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
+            const auto src_offset = i_dt_sz * get_src_off(k, n);
+            const auto dst_offset = o_dt_sz
+                    * (k_blk_idx * blk_size + n_blk_idx * k_blks * blk_size);
             ker_exec_ctx.src = &src_ptr[src_offset];
             ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
             ker_exec_ctx.current_K_start = k;
@@ -277,11 +299,9 @@ void brgemm_pack_B_t::execute(const void *src, void *dst) const {
         }
         if (kernel_conf.K_tail > 0) {
             const auto k = k_blk_idx * kernel_conf.K_blk;
-            assert(kernel_conf.wei_tag == format_tag::ab);
-            // Since only `ab` is supported so far, hard code the stride.
-            const auto src_offset = i_dt_sz * (k * kernel_conf.N + n);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
+            const auto src_offset = i_dt_sz * get_src_off(k, n);
+            const auto dst_offset = o_dt_sz
+                    * (k_blk_idx * blk_size + n_blk_idx * k_blks * blk_size);
             ker_exec_ctx.src = &src_ptr[src_offset];
             ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
             ker_exec_ctx.current_K_start = k;
@@ -296,9 +316,27 @@ status_t dnnl_brgemm_pack_B_create(brgemm_pack_B_t **brgemm_pack_B, dim_t K,
         data_type_t out_dt) {
     if (brgemm_pack_B == nullptr) return status::invalid_arguments;
 
-    *brgemm_pack_B = new brgemm_pack_B_t(K, N, in_ld, out_ld, in_dt, out_dt);
+    *brgemm_pack_B = new brgemm_pack_B_t(K, N, /* is_trans = */ false, in_ld,
+            out_ld, in_dt, out_dt);
+    return status::success;
+}
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+// `dnnl_pack_type_t` is only available with the experimental ukernel API.
+status_t dnnl_brgemm_pack_B_create_v2(brgemm_pack_B_t **brgemm_pack_B,
+        dim_t K, dim_t N, dnnl_pack_type_t in_pack_type, dim_t in_ld,
+        dim_t out_ld, data_type_t in_dt, data_type_t out_dt) {
+    if (brgemm_pack_B == nullptr) return status::invalid_arguments;
+    VCHECK_BRGEMM(utils::one_of(in_pack_type, dnnl_pack_type_no_trans,
+                          dnnl_pack_type_trans),
+            VERBOSE_BAD_PARAM, "in_pack_type");
+
+    const bool is_trans = in_pack_type == dnnl_pack_type_trans;
+    *brgemm_pack_B = new brgemm_pack_B_t(
+            K, N, is_trans, in_ld, out_ld, in_dt, out_dt);
     return status::success;
 }
+#endif
 
 status_t dnnl_brgemm_pack_B_need_pack(
         const brgemm_pack_B_t *brgemm_pack_B, int *need_pack) {
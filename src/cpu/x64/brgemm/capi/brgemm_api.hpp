@@ -17,11 +17,13 @@
 #ifndef CPU_X64_BRGEMM_CAPI_BRGEMM_API_HPP
 #define CPU_X64_BRGEMM_CAPI_BRGEMM_API_HPP
 
+#include <array>
 #include <memory>
 
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 
+#include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm_types.hpp"
 
 struct dnnl_brgemm : public dnnl::impl::c_compatible {
@@ -32,6 +34,11 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
     // Once becamoes, internal C API can be re-factored.
     dnnl::impl::cpu::x64::brgemm_desc_t brgemm_desc_;
     dnnl::impl::cpu::x64::brgemm_kernel_t *brgemm_kernel_;
+
+    // The palette is initialized once the descriptor is final to avoid
+    // re-computing it on every `set_hw_context` call. An empty palette (all
+    // zeros) means no tiles are used.
+    std::array<char, dnnl::impl::cpu::x64::AMX_PALETTE_SIZE> palette_;
 };
 
 struct dnnl_brgemm_pack_B : public dnnl::impl::c_compatible {
@@ -39,8 +46,9 @@ struct dnnl_brgemm_pack_B : public dnnl::impl::c_compatible {
 
     // Ctor that follows a call to initialize matmul conf struct.
     dnnl_brgemm_pack_B(dnnl::impl::dim_t K, dnnl::impl::dim_t N,
-            dnnl::impl::dim_t in_ld, dnnl::impl::dim_t out_ld,
-            dnnl::impl::data_type_t in_type, dnnl::impl::data_type_t out_type);
+            bool is_trans, dnnl::impl::dim_t in_ld,
+            dnnl::impl::dim_t out_ld, dnnl::impl::data_type_t in_type,
+            dnnl::impl::data_type_t out_type);
 
     // Returns the flag is packing for VNNI is needed.
     // Note: not completely aligned with primitives logic.
@@ -53,6 +61,7 @@ struct dnnl_brgemm_pack_B : public dnnl::impl::c_compatible {
     void execute(const void *src, void *dst) const;
 
     dnnl::impl::cpu::x64::matmul::brgemm_matmul_conf_t bmc_;
+    dnnl::impl::dim_t in_ld_ = 0;
     // unique_ptr is required by API that generates a kernel.
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t>
             kernel_;
@@ -50,7 +50,8 @@ jit_brdgmm_kernel_base_t<Wmm>::jit_brdgmm_kernel_base_t(
     , has_bpad_(brg.brgattr.max_top_bpad > 0 || brg.brgattr.max_bottom_bpad > 0)
     , vmm_alloc(brg) {
 
-    if (brg.with_eltwise || brg.with_binary || brg.with_sum) {
+    if (brg.with_eltwise || brg.with_binary || brg.with_sum
+            || with_depthwise_quantization()) {
 
         static constexpr bool preserve_gpr = true;
         static constexpr bool preserve_vmm = false;
@@ -69,10 +70,13 @@ jit_brdgmm_kernel_base_t<Wmm>::jit_brdgmm_kernel_base_t(
                 dst_md_wrapper, tail, k_mask, use_exact_tail_scalar_bcast};
         const binary_injector::static_params_t bsp {
                 this->param1, enabled_bcast_strategy, rhs_sp};
+        const quantization_injector::static_params_t qsp {
+                vmm_tmp(0).getIdx(), vmm_tmp(1).getIdx(), reg_d_weights,
+                reg_d_bias};
 
         auto st = safe_ptr_assign(postops_injector_,
                 injector::jit_uni_postops_injector_base_t<Vmm>::create(
-                        this, brg.isa_impl, brg.attr()->post_ops_, bsp));
+                        this, brg.isa_impl, brg.attr()->post_ops_, bsp, qsp));
         if (st != status::success) {
             assert(!"postops_injector creation failed");
         }
@@ -154,7 +158,8 @@ void jit_brdgmm_kernel_base_t<Wmm>::read_params() {
         mov(ptr[rsp + zp_compensation_], reg_tmp);
     }
 
-    if (brg.with_binary) mov(ptr[rsp + abi_param1_offs_], param1);
+    if (brg.with_binary || with_depthwise_quantization())
+        mov(ptr[rsp + abi_param1_offs_], param1);
 }
 
 template <typename Wmm>
@@ -358,7 +363,49 @@ void jit_brdgmm_kernel_base_t<Wmm>::apply_post_ops(
                 primitive_kind::sum, sum_injector);
     }
 
-    postops_injector_->compute_vector_range(vmm_idxs_param, rhs_arg_params);
+    if (!with_depthwise_quantization()) {
+        postops_injector_->compute_vector_range(
+                vmm_idxs_param, rhs_arg_params);
+        return;
+    }
+
+    // Depthwise and quantization post-ops read per-channel data: reg_oc_off
+    // holds the byte offset of the current n block, offsets of the
+    // accumulators within the block are passed through vmm_idx_off.
+    push(reg_d_weights);
+    push(reg_d_bias);
+    push(reg_oc_off);
+    const int base_post_ops_data_offset
+            = stack_space_needed_ + 3 * reg64_size;
+
+    mov(reg_oc_off, ptr[rsp + 3 * reg64_size + abi_param1_offs_]);
+    mov(reg_oc_off, ptr[reg_oc_off + GET_OFF(oc_logical_off)]);
+    add(reg_oc_off, reg_aux_N);
+    shl(reg_oc_off, 2); // sizeof(float)
+
+    std::map<size_t, int> vmm_idx_off;
+    for_(int v_i = 0; v_i < v_substep; ++v_i)
+    for_(int m_i = 0; m_i < m_blocks; ++m_i)
+    for (int n_i = 0; n_i < n_blocks; ++n_i) {
+        if (get_substep_simd(n_i, v_i, has_n_tail) <= 0) continue;
+        const auto vmm_idx = accm(m_blocks, n_blocks, m_i, n_i, v_i).getIdx();
+        vmm_idx_off.insert({vmm_idx,
+                static_cast<int>(sizeof(float))
+                        * (n_i * n_block1() + v_i * simd_w_)});
+    }
+
+    const depthwise_injector::dynamic_params_t ddp {vmm_tmp(0).getIdx(),
+            vmm_tmp(1).getIdx(), reg_d_weights, reg_d_bias, reg_oc_off,
+            vmm_idx_off, rsp, base_post_ops_data_offset};
+    const quantization_injector::dynamic_params_t qdp {reg_oc_off,
+            vmm_idx_off, brg.dt_d, rsp, base_post_ops_data_offset};
+
+    postops_injector_->compute_vector_range(
+            vmm_idxs_param, rhs_arg_params, ddp, qdp);
+
+    pop(reg_oc_off);
+    pop(reg_d_bias);
+    pop(reg_d_weights);
 }
 
 template <typename Wmm>
@@ -1344,6 +1391,9 @@ template <typename Wmm>
 void jit_brdgmm_kernel_base_t<Wmm>::generate() {
 
     preamble();
+    if (with_depthwise_quantization())
+        postops_injector_->push_post_ops_data_on_stack(param1,
+                GET_OFF(post_ops_binary_rhs_arg_vec), reg_tmp, reg_d_weights);
     sub(rsp, stack_space_needed_);
 
     init_masks();
@@ -1354,6 +1404,7 @@ void jit_brdgmm_kernel_base_t<Wmm>::generate() {
     compute_loop();
 
     add(rsp, stack_space_needed_);
+    if (with_depthwise_quantization()) postops_injector_->reset_stack_pointer();
     postamble();
 
     if (brg.with_eltwise)
@@ -62,7 +62,9 @@ struct jit_brdgmm_kernel_base_t : public jit_generator {
             , idx_vmm_bcast_(-1)
             , idx_vmm_s8s8_comp_(-1) {
 
-            if (brg.with_sum || brg.with_scales) vmm_tmp_count_ = 2;
+            if (brg.with_sum || brg.with_scales || brg.with_depthwise
+                    || brg.with_quantization)
+                vmm_tmp_count_ = 2;
 
             // assign aux vmms
             if (is_fast_vnni_int8(brg)) idx_vmm_permute_ = aux_vmm_count_++;
@@ -211,6 +213,10 @@ private:
     const reg64_t reg_ptr_sum_scale = reg_aux_A_vpad_top;
     const reg64_t reg_ptr_sum_zp = reg_aux_A_vpad_bottom;
     const reg64_t reg_s8s8_comp = reg_aux_A_vpad_top;
+    // depthwise and quantization post-ops
+    const reg64_t reg_d_weights = reg_aux_A_vpad_top;
+    const reg64_t reg_d_bias = reg_aux_A_vpad_bottom;
+    const reg64_t reg_oc_off = reg_table_base;
 
     Xbyak::Opmask k_mask = Xbyak::Opmask(2);
     Xbyak::Opmask k_tail_mask = Xbyak::Opmask(3);
@@ -249,6 +255,7 @@ private:
     constexpr static int src_zp_value_ = 72;
     constexpr static int zp_compensation_ = 80;
     constexpr static int stack_space_needed_ = 88;
+    constexpr static int reg64_size = 8;
 
     bool with_binary_non_scalar_bcast_ = false;
 
@@ -284,6 +291,9 @@ private:
         return brg.is_bf16 && mayiuse(avx512_core_amx);
     }
 
+    bool with_depthwise_quantization() const {
+        return brg.with_depthwise || brg.with_quantization;
+    }
     bool req_vmm_reload() { return brg.is_bf16_emu; }
     bool assign_data_vmm_once() { return !req_vmm_reload(); }
 
@@ -78,6 +78,7 @@ struct jit_brgemm_kernel_t : public jit_generator {
                             broadcasting_strategy_t::per_w,
                             broadcasting_strategy_t::batch,
                             broadcasting_strategy_t::spatial,
+                            broadcasting_strategy_t::shared_axes,
                             broadcasting_strategy_t::no_broadcast};
             const binary_injector::rhs_arg_static_params_t rhs_sp {
                     static_cast<size_t>(vmm_tmp(0).getIdx()), this->r14,
@@ -87,10 +88,13 @@ struct jit_brgemm_kernel_t : public jit_generator {
                     ld_tail_mask, use_exact_tail_scalar_bcast};
             const binary_injector::static_params_t bsp {
                     this->param1, enabled_bcast_strategy, rhs_sp};
+            eltwise_injector::static_params_t esp;
+            esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                    brg.attr()->fpmath_.mode_);
 
             auto st = safe_ptr_assign(postops_injector_,
-                    po_injector_t::create(
-                            this, brg.isa_impl, brg.attr()->post_ops_, bsp));
+                    po_injector_t::create(this, brg.isa_impl,
+                            brg.attr()->post_ops_, bsp, esp));
             if (st != status::success) {
                 assert(!"postops_injector creation failed");
             }
@@ -1334,6 +1338,7 @@ void jit_brgemm_kernel_t<Wmm>::apply_post_ops(
 template <typename Wmm>
 void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(
         int bd_block, int ld_block2, int ldb_and_bdb_offset, bool is_ld_tail) {
+    annotate("post_ops");
     auto k_mask = (!is_ld_tail) ? ld_full_mask : ld_tail_mask;
 
     // if (brg.is_int8 && alpha_or_beta_applicable && !beta_uses_vadd) ->
@@ -1605,6 +1610,7 @@ void jit_brgemm_kernel_t<Wmm>::apply_compensation(
 template <typename Wmm>
 void jit_brgemm_kernel_t<Wmm>::store_accumulators_without_post_ops(
         int bd_block, int ld_block2, bool is_ld_tail) {
+    annotate("store");
 
     // if (brg.is_int8 && alpha_or_beta_applicable && !beta_uses_vadd) ->
     // accumulated values are converted to ps in apply_alpha_beta()
@@ -1666,6 +1672,7 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(int bd_block2,
     const bool need_generate_zp_a_compensation
             = brg.is_int8 && (brg.req_s8s8_compensation || has_zero_points);
 
+    annotate("store");
     maybe_set_avx_mask(is_ld_tail);
 
     if (brg.is_tmm) {
@@ -1707,6 +1714,7 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(int bd_block2,
                     int idx = (is_ld_tail) ? brg.ld_block2 : ldb;
                     if (need_to_apply_alpha_beta || are_post_ops_applicable
                             || apply_zp_a_compensation) {
+                        annotate("tile_store");
                         if (skip_accumulation) {
                             for (int bd = 0; bd < adj_bd_block; bd++) {
                                 auto vreg_acc = accm(1, bd, 0);
@@ -2053,6 +2061,7 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel_amx(int bd_block2,
     };
     int rbd_block = (is_rd_tail) ? 1 : brg.rdb;
     for (int rdb = 0; rdb < rbd_block; rdb++) {
+        annotate("tile_load");
         for (int bdb = 0; bdb < bd_block2; bdb++) {
             maybe_tileloadd_nt(matrix_kind_t::matrix_A, bdb,
                     rdb * rdb_A_offset() + A_offset(bdb, 0, true), is_rd_tail,
@@ -2061,9 +2070,11 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel_amx(int bd_block2,
         for (int ldb = 0; ldb < ld_block2; ldb++) {
 
             const int idx = (is_ld_tail) ? brg.ld_block2 : ldb;
+            if (ldb > 0) annotate("tile_load");
             maybe_tileloadd_nt(matrix_kind_t::matrix_B, idx,
                     rdb * rdb_B_offset() + B_offset(ldb, 0, true), is_rd_tail,
                     is_ld_tail);
+            annotate("tile_compute");
             for (int bdb = 0; bdb < bd_block2; bdb++) {
                 tdpbxxd(Tmm(brg.get_C_tensor(
                                 bdb, idx, is_bdb_tail, is_ld_tail)),
@@ -2404,6 +2415,9 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(int bd_block2, bool is_bdb_tail,
     if (!is_valid_bd) return;
 
     bool is_emdbd = brg.embd_bcst;
+    // With fewer rows than B vectors (e.g. M = 1 GEMV) the B prefetches
+    // issued once per row leave part of the next B rows without a prefetch.
+    const bool prefetch_remaining_B = brg.bcast_dim <= 4;
 
     int rd_loop = 0, rd_tail_size = 0;
     if (is_rd_tail) {
@@ -2819,6 +2833,9 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(int bd_block2, bool is_bdb_tail,
                         }
                     }
                 }
+                while (prefetch_remaining_B && prefetch_count_B < ld_block2)
+                    prefetcht0(ptr[reg_aux_B + B_offset(prefetch_count_B++, rd)
+                            + brg.LDB * brg.rd_block * brg.typesize_B]);
             }
 
             if (brg.with_wei_decomp_scales && brg.bd_block == 1) {
@@ -2901,6 +2918,9 @@ void jit_brgemm_kernel_t<Wmm>::gemm_microkernel(int bd_block2, bool is_bdb_tail,
                         dot_product(vmm, load(ld), bcst());
                 }
             }
+            while (prefetch_remaining_B && prefetch_count_B < ld_block2)
+                prefetcht0(ptr[reg_aux_B + B_offset(prefetch_count_B++, rd)
+                        + brg.LDB * brg.rd_block * brg.typesize_B]);
         }
     }
 }
@@ -2933,6 +2953,7 @@ void jit_brgemm_kernel_t<Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
         } else {
             if (brg.rdb > 0) {
                 Label rdb_loop_label;
+                annotate("k_loop");
                 mov(reg_rdb_loop, brg.rdb);
                 L_aligned(rdb_loop_label, 64);
                 {
@@ -2999,6 +3020,7 @@ void jit_brgemm_kernel_t<Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
         }
         if (brg.rdb_tail != 0) {
             const bool is_rd_tail = true;
+            annotate("k_tail");
             if (brg.is_tmm) {
                 gemm_microkernel_amx(bd_block2, is_bdb_tail, ld_block2,
                         is_rd_tail, is_ld_tail);
@@ -3015,6 +3037,7 @@ void jit_brgemm_kernel_t<Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
 
     L_aligned(ldb_loop_label, 64);
     {
+        annotate("zero_acc");
         zero_accumulators(bd_block2, is_bdb_tail, ld_block2, is_ld_tail,
                 skip_accumulation);
 
@@ -3415,10 +3438,12 @@ void jit_brgemm_kernel_t<Wmm>::generate() {
 
     bdb_loop();
 
+    annotate("epilogue");
     add(rsp, stack_space_needed_);
 
     postamble();
 
+    annotate("data");
     align(32);
     const int simd = vreg_traits<Vmm>::vlen / sizeof(float);
     if (!isa_has_masks(brg.isa_impl) && brg.ldb_tail > 0) {
@@ -15,6 +15,19 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <atomic>
+#include <climits>
+#include <thread>
+
+#include <immintrin.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/thread_trace.hpp"
 
 #include "cpu/x64/cpu_barrier.hpp"
 
@@ -80,23 +93,78 @@ void generate(
 #undef BAR_SENSE_OFF
 }
 
-/** jit barrier generator */
-struct jit_t : public jit_generator {
+namespace {
+// The barrier context fields are accessed with atomic operations here, while
+// the injected barrier above accesses them directly.
+template <typename T>
+std::atomic<T> &as_atomic(volatile T &v) {
+    static_assert(sizeof(std::atomic<T>) == sizeof(T),
+            "atomic type must have the same size as the underlying type");
+    return *reinterpret_cast<std::atomic<T> *>(const_cast<T *>(&v));
+}
 
-    void generate() override {
-        simple_barrier::generate(*this, abi_param1, abi_param2);
-        ret();
-    }
+int get_spin_count() {
+    static const int spin_count
+            = getenv_int_user("BARRIER_SPIN_COUNT", 1 << 14);
+    return spin_count;
+}
 
-    // TODO: Need to check status
-    jit_t() : jit_generator(jit_name()) { create_kernel(); }
+// Sleeps while the low 32 bits of `sense` are equal to `val`. May return
+// spuriously.
+void park(volatile size_t &sense, size_t val) {
+#ifdef __linux__
+    // The low 32 bits of the word go first on x64.
+    syscall(SYS_futex, reinterpret_cast<volatile uint32_t *>(&sense),
+            FUTEX_WAIT_PRIVATE, (uint32_t)val, nullptr, nullptr, 0);
+#else
+    MAYBE_UNUSED(sense);
+    MAYBE_UNUSED(val);
+    std::this_thread::yield();
+#endif
+}
 
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_t)
-};
+void unpark_all(volatile size_t &sense) {
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<volatile uint32_t *>(&sense),
+            FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    MAYBE_UNUSED(sense);
+#endif
+}
+} // namespace
 
 void barrier(ctx_t *ctx, int nthr) {
-    static jit_t j; /* XXX: constructed on load ... */
-    j(ctx, nthr);
+    if (nthr <= 1) return;
+
+    thread_trace::event_scope_t trace_scope("barrier", "barrier",
+            thread_trace::current_primitive());
+
+    auto &ctr = as_atomic(ctx->ctr);
+    auto &sense = as_atomic(ctx->sense);
+    auto &nparked = as_atomic(ctx->nparked);
+
+    const size_t cur_sense = sense.load();
+    if (ctr.fetch_add(1) + 1 == (size_t)nthr) {
+        // The last thread resets the context and releases the others.
+        ctr.store(0);
+        sense.store(~cur_sense);
+        if (nparked.load() > 0) unpark_all(ctx->sense);
+        return;
+    }
+
+    const int spin_count = get_spin_count();
+    for (int i = 0; spin_count < 0 || i < spin_count; i++) {
+        if (sense.load(std::memory_order_acquire) != cur_sense) return;
+        _mm_pause();
+    }
+
+    // Sequentially consistent accesses to `nparked` and `sense` guarantee that
+    // either the last thread sees the parked thread or the parked thread sees
+    // the new sense.
+    nparked.fetch_add(1);
+    while (sense.load() == cur_sense)
+        park(ctx->sense, cur_sense);
+    nparked.fetch_sub(1);
 }
 
 } // namespace simple_barrier
@@ -41,7 +41,9 @@ STRUCT_ALIGN(
             volatile size_t ctr;
             char pad1[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
             volatile size_t sense;
-            char pad2[CACHE_LINE_SIZE - 1 * sizeof(size_t)];
+            // The number of threads sleeping in barrier() after spinning.
+            volatile int nparked;
+            char pad2[CACHE_LINE_SIZE - 1 * sizeof(size_t) - sizeof(int)];
         });
 
 /* TODO: remove ctx_64_t once batch normalization switches to barrier-less
@@ -64,7 +66,12 @@ template <typename ctx_t>
 inline void ctx_init(ctx_t *ctx) {
     *ctx = utils::zero<ctx_t>();
 }
-void barrier(ctx_t *ctx, int nthr);
+/** waits until `nthr` threads reach the barrier
+ *
+ * A waiting thread spins for ONEDNN_BARRIER_SPIN_COUNT iterations (a negative
+ * value means forever) and then sleeps until the last thread arrives, so that
+ * waiting threads do not burn cores on oversubscribed systems. */
+void DNNL_API barrier(ctx_t *ctx, int nthr);
 
 /** injects actual barrier implementation into another jitted code
  * @params:
@@ -86,6 +86,8 @@ dnnl_cpu_isa_hints_t init_cpu_isa_hints() {
     if (!hints_val.empty()) {
         if (hints_val.compare("prefer_ymm") == 0)
             cpu_isa_hints_val = dnnl_cpu_isa_prefer_ymm;
+        else if (hints_val.compare("prefer_ymm_auto") == 0)
+            cpu_isa_hints_val = dnnl_cpu_isa_prefer_ymm_auto;
     }
     return cpu_isa_hints_val;
 }
@@ -246,6 +248,17 @@ status_t set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints) {
         return runtime_error;
 }
 
+bool prefer_ymm(dnnl_cpu_isa_hints_t attr_isa_hints, bool is_memory_bound) {
+    const dnnl_cpu_isa_hints_t isa_hints
+            = attr_isa_hints != dnnl_cpu_isa_no_hints ? attr_isa_hints
+                                                      : get_cpu_isa_hints();
+    switch (isa_hints) {
+        case dnnl_cpu_isa_prefer_ymm: return true;
+        case dnnl_cpu_isa_prefer_ymm_auto: return is_memory_bound;
+        default: return false;
+    }
+}
+
 namespace amx {
 
 int get_max_palette() {
@@ -96,6 +96,12 @@ enum cpu_isa_bit_t : unsigned {
 
 dnnl_cpu_isa_hints_t DNNL_API get_cpu_isa_hints(bool soft = false);
 status_t set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
+// Returns true if a primitive should use Ymm registers instead of Zmm ones.
+// The primitive attribute hints take precedence over the global ones. The
+// prefer_ymm_auto hint applies to memory-bound primitives only, for which the
+// higher core frequency outweighs the shorter vector length.
+bool DNNL_API prefer_ymm(
+        dnnl_cpu_isa_hints_t attr_isa_hints, bool is_memory_bound);
 
 namespace cpu_isa_hints_utils {
 /* hints_1 | hints_2 | ... | hints_n where hints_i are hint specific
@@ -106,6 +112,8 @@ static unsigned cvt2mask(dnnl_cpu_isa_hints_t hints) {
     switch (hints) {
         case dnnl_cpu_isa_no_hints: return 0;
         case dnnl_cpu_isa_prefer_ymm: return prefer_ymm_bit;
+        // Implementations query the hint for their primitive kind instead.
+        case dnnl_cpu_isa_prefer_ymm_auto: return 0;
     }
     assert(!"Unexpected CPU ISA hint");
     return 0;
@@ -36,6 +36,7 @@ static bcast_set_t get_all_strategies_supported_by_injector() {
             broadcasting_strategy_t::per_mb_spatial,
             broadcasting_strategy_t::per_mb_w, broadcasting_strategy_t::per_w,
             broadcasting_strategy_t::batch, broadcasting_strategy_t::spatial,
+            broadcasting_strategy_t::shared_axes,
             broadcasting_strategy_t::no_broadcast};
 }
 
@@ -78,6 +79,44 @@ static bool src1_desc_layout_same_as_dst_d(
             && lhs.offset0 == rhs.offset0;
 }
 
+static bool is_plain_strided(const memory_desc_wrapper &mdw) {
+    return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0;
+}
+
+shared_axes_dims_t get_shared_axes_dims(
+        const dnnl::impl::memory_desc_t &src1_desc,
+        const memory_desc_wrapper &dst_d) {
+    const memory_desc_wrapper src1_d(src1_desc);
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    const auto &src1_strides = src1_d.blocking_desc().strides;
+
+    shared_axes_dims_t dims;
+    for (int d = 0; d < dst_d.ndims(); d++) {
+        // Unit dimensions do not contribute to the offsets.
+        if (dst_d.dims()[d] == 1) continue;
+        const bool is_bcast = src1_d.dims()[d] != dst_d.dims()[d];
+        dims.push_back({dst_strides[d], is_bcast ? 0 : src1_strides[d]});
+    }
+    std::stable_sort(dims.begin(), dims.end(),
+            [](const shared_axes_dim_t &a, const shared_axes_dim_t &b) {
+                return a.dst_stride > b.dst_stride;
+            });
+    return dims;
+}
+
+static bool is_shared_axes_bcast_supported(
+        const dnnl::impl::memory_desc_t &src1_desc,
+        const memory_desc_wrapper &dst_d) {
+    const memory_desc_wrapper src1_d(src1_desc);
+    if (!is_plain_strided(dst_d) || !is_plain_strided(src1_d)) return false;
+
+    // A vector covers consecutive points of the innermost dimension of the
+    // destination, they have to be consecutive in src1 as well.
+    const auto dims = get_shared_axes_dims(src1_desc, dst_d);
+    return !dims.empty() && dims.back().dst_stride == 1
+            && dims.back().src1_stride == 1;
+}
+
 bool is_bcast_supported(const dnnl::impl::memory_desc_t &src1_desc,
         const memory_desc_wrapper &dst_d,
         const bcast_set_t &supported_strategy_set) {
@@ -89,6 +128,10 @@ bool is_bcast_supported(const dnnl::impl::memory_desc_t &src1_desc,
         if (!src1_desc_layout_same_as_dst_d(src1_desc, dst_d)) return false;
     }
 
+    if (bcast_type == broadcasting_strategy_t::shared_axes
+            && !is_shared_axes_bcast_supported(src1_desc, dst_d))
+        return false;
+
     return bcast_type != broadcasting_strategy_t::unsupported;
 }
 
@@ -421,7 +464,8 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
                     broadcasting_strategy_t::per_mb_spatial,
                     broadcasting_strategy_t::per_mb_w,
                     broadcasting_strategy_t::per_mb,
-                    broadcasting_strategy_t::batch);
+                    broadcasting_strategy_t::batch,
+                    broadcasting_strategy_t::shared_axes);
     const bool should_preserve_w_offset_conversion_regs = use_offset_conversions
             && rhs_broadcasting_strategy == broadcasting_strategy_t::per_w;
     const bool should_preserve_spatial_offset_conversion_regs
@@ -616,6 +660,17 @@ Xbyak::Address jit_uni_binary_injector_t<isa, Vmm>::prepare_rhs_arg_addr(
 
             return host_->ptr[rhs_addr_reg];
         }
+        case broadcasting_strategy_t::shared_axes: {
+            const auto dims = get_shared_axes_dims(
+                    get_src1_desc(post_op, rhs_arg_static_params_.dst_d),
+                    rhs_arg_static_params_.dst_d);
+            append_shared_axes_offset(dims, rhs_arg_params.vmm_idx_to_out_addr,
+                    rhs_arg_params.vmm_idx_to_out_reg,
+                    rhs_arg_params.vmm_idx_to_out_elem_off_val, vmm_idx,
+                    rhs_addr_reg, rhs_helper_reg, rhs_arg_elem_size, is_first);
+
+            return host_->ptr[rhs_addr_reg];
+        }
         default: assert(false && "Broadcasting type not supported");
     }
 
@@ -2278,6 +2333,118 @@ void jit_uni_binary_injector_t<isa, Vmm>::calculate_mb_oc_cspn_partial(
                                 : offset_adj);
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::append_shared_axes_offset(
+        const shared_axes_dims_t &dims,
+        const std::map<int, Xbyak::Address> &vmm_idx_to_out_addr,
+        const std::map<int, Xbyak::Reg64> &vmm_idx_to_out_reg,
+        const std::map<int, size_t> &vmm_idx_to_out_elem_off_val, int vmm_idx,
+        const Xbyak::Reg64 &addr_reg, const Xbyak::Reg64 &tmp_reg,
+        std::size_t elem_size_bytes, bool is_first) const {
+
+    const auto it_out_addr = vmm_idx_to_out_addr.find(vmm_idx);
+    const auto it_out_reg = vmm_idx_to_out_reg.find(vmm_idx);
+
+    const bool is_out_addr = it_out_addr != vmm_idx_to_out_addr.end();
+    const bool is_out_reg = it_out_reg != vmm_idx_to_out_reg.end();
+
+    if (is_out_addr || is_out_reg) {
+        Xbyak::Address out_addr = is_out_addr ? it_out_addr->second
+                                              : host_->ptr[it_out_reg->second];
+        const auto it_off_val = vmm_idx_to_out_elem_off_val.find(vmm_idx);
+        const auto &addr_cache_reg = rhs_arg_static_params_.rhs_addr_cache_reg;
+
+        if (is_first) {
+            calculate_no_broadcast_base(out_addr, tmp_reg);
+
+            const auto rax = host_->rax;
+            const auto rdx = host_->rdx;
+            const auto r8 = host_->r8;
+            const auto r9 = host_->r9;
+
+            const injector_utils::conditional_register_preserve_guard_t
+                    register_guard {is_out_reg
+                                    ? utils::one_of(it_out_reg->second, rax,
+                                            rdx, r8, r9)
+                                    : false,
+                            host_,
+                            {is_out_reg ? it_out_reg->second : Xbyak::Reg64()}};
+
+            calculate_shared_axes_base(dims, tmp_reg);
+
+            if (elem_size_bytes == 1) {
+                host_->add(addr_reg, rax);
+            } else {
+                const int shift_val = std::log2(elem_size_bytes);
+                host_->mov(tmp_reg, rax);
+                host_->sal(tmp_reg, shift_val);
+                host_->add(addr_reg, tmp_reg);
+            }
+            host_->mov(addr_cache_reg, addr_reg);
+        } else {
+            host_->mov(addr_reg, addr_cache_reg);
+        }
+
+        if (it_off_val != vmm_idx_to_out_elem_off_val.end()) {
+            calculate_shared_axes_partial(
+                    dims, it_off_val->second, tmp_reg, elem_size_bytes);
+            host_->add(addr_reg, tmp_reg);
+        }
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::calculate_shared_axes_base(
+        const shared_axes_dims_t &dims, const Xbyak::Reg64 &tmp_reg) const {
+    // The destination offset is split into coordinates, dimension by
+    // dimension in the order of decreasing strides, and the coordinates of
+    // the dimensions present in src1 are multiplied by src1 strides.
+    // off_src1 = sum_d (off_dst / stride_dst_d % dim_d) * stride_src1_d
+    // output = rax
+    const auto rax = host_->rax;
+    const auto rdx = host_->rdx;
+    const auto r8 = host_->r8;
+    const auto r9 = host_->r9;
+
+    host_->mov(rax, tmp_reg);
+    host_->xor_(r8, r8);
+    for (const auto &dim : dims) {
+        if (dim.dst_stride != 1) {
+            host_->mov(r9, dim.dst_stride);
+            host_->xor_(rdx, rdx);
+            host_->div(r9);
+            // rax = coordinate, rdx = remaining offset
+        }
+        if (dim.src1_stride != 0) {
+            if (dim.src1_stride != 1) {
+                host_->mov(r9, dim.src1_stride);
+                host_->imul(rax, r9);
+            }
+            host_->add(r8, rax);
+        }
+        if (dim.dst_stride == 1) break;
+        host_->mov(rax, rdx);
+    }
+    host_->mov(rax, r8);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::calculate_shared_axes_partial(
+        const shared_axes_dims_t &dims, const std::size_t offset,
+        const Xbyak::Reg64 &tmp_reg, std::size_t elem_size_bytes) const {
+    auto offset_rem = static_cast<dim_t>(
+            offset >> math::ilog2q(types::data_type_size(
+                    rhs_arg_static_params_.dst_d.data_type())));
+    dim_t offset_adj = 0;
+    for (const auto &dim : dims) {
+        offset_adj += (offset_rem / dim.dst_stride) * dim.src1_stride;
+        offset_rem %= dim.dst_stride;
+    }
+    host_->mov(tmp_reg,
+            elem_size_bytes > 1 ? offset_adj << math::ilog2q(elem_size_bytes)
+                                : offset_adj);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_injector_t<isa, Vmm>::inject_binary(
         const dnnl_post_ops::entry_t &post_op, Vmm dst,
@@ -3412,9 +3579,13 @@ void jit_uni_binary_injector_t<isa, Vmm>::execute_prelu(
         Vmm dst_vmm = Vmm(dst.getIdx());
         Xbyak::Opmask maybe_tail_kmask = Xbyak::Opmask(dst.getOpmaskIdx());
         Xbyak::Opmask aux_kmask = get_aux_kmask();
-        host_->vxorps(tmp_vmm, tmp_vmm, tmp_vmm);
-        host_->vcmpps(aux_kmask | maybe_tail_kmask, dst_vmm, tmp_vmm,
-                jit_generator::_cmp_le_os);
+        // Classify negative values (finite and -inf) directly instead of
+        // comparing against a zeroed register: one instruction less per
+        // vector and no dependency on the helper register. Zeros are left
+        // as is, which matches `x * slope` up to the sign of zero.
+        const uint8_t negative_finite_or_inf = 0x50;
+        host_->vfpclassps(aux_kmask | maybe_tail_kmask, dst_vmm,
+                negative_finite_or_inf);
         host_->vmulps(dst_vmm | aux_kmask, dst_vmm, rhs);
     } else if (is_superset(isa, avx)) {
         // Three operand version
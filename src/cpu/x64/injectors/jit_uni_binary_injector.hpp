@@ -226,6 +226,24 @@ struct rhs_arg_dynamic_params_t {
  */
 bool is_data_supported(cpu_isa_t isa, data_type_t data_type);
 
+/*
+ * Dimension of the destination taking part in shared_axes broadcast offset
+ * computations. src1_stride is zero for broadcast dimensions.
+ */
+struct shared_axes_dim_t {
+    dim_t dst_stride;
+    dim_t src1_stride;
+};
+using shared_axes_dims_t = std::vector<shared_axes_dim_t>;
+
+/*
+ * Returns non-unit dimensions of the destination sorted by decreasing
+ * destination strides.
+ */
+shared_axes_dims_t get_shared_axes_dims(
+        const dnnl::impl::memory_desc_t &src1_desc,
+        const memory_desc_wrapper &dst_d);
+
 /*
  * Checks if broadcast of src1 is supported by binary injector.
  */
@@ -505,6 +523,19 @@ private:
             const std::size_t offset, const Xbyak::Reg64 &tmp_reg,
             std::size_t elem_size_bytes) const;
 
+    void append_shared_axes_offset(const shared_axes_dims_t &dims,
+            const std::map<int, Xbyak::Address> &vmm_idx_to_out_addr,
+            const std::map<int, Xbyak::Reg64> &vmm_idx_to_out_reg,
+            const std::map<int, size_t> &vmm_idx_to_out_elem_off_val,
+            int vmm_idx, const Xbyak::Reg64 &addr_reg,
+            const Xbyak::Reg64 &tmp_reg, std::size_t elem_size_bytes,
+            bool is_first) const;
+    void calculate_shared_axes_base(
+            const shared_axes_dims_t &dims, const Xbyak::Reg64 &tmp_reg) const;
+    void calculate_shared_axes_partial(const shared_axes_dims_t &dims,
+            const std::size_t offset, const Xbyak::Reg64 &tmp_reg,
+            std::size_t elem_size_bytes) const;
+
     template <typename T>
     typename std::enable_if<std::is_same<T, Xbyak::Zmm>::value
             || std::is_same<T, Xbyak::Address>::value>::type
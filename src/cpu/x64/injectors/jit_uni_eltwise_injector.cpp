@@ -51,6 +51,13 @@ bool is_supported(cpu_isa_t isa, alg_kind_t alg) {
     return is_isa_supported(isa) && is_alg_supported(alg);
 }
 
+bool is_fast_approx_allowed(fpmath_mode_t fpmath_mode) {
+    // The modes that allow down-conversion to bf16 or f16 tolerate errors of
+    // the order of their epsilon, which covers the approximations.
+    return utils::one_of(
+            fpmath_mode, fpmath_mode::bf16, fpmath_mode::f16, fpmath_mode::any);
+}
+
 } // namespace eltwise_injector
 
 using namespace Xbyak;
@@ -385,6 +392,11 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::test_mask() {
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::exp_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_ && is_avx512_ && vlen_ == 64) {
+        exp_table_approx_compute_vector_fwd(vmm_src);
+        return;
+    }
+
     // exp(x) =
     // = exp(n * ln(2) + r) // divide x by ln(2) and get quot and rem
     // = 2^n * exp(r) // simplify the exp(n*ln(2)) expression
@@ -435,11 +447,17 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::exp_compute_vector_fwd(
     blend_with_mask(vmm_aux(1), vmm_src);
 
     // compute polynomial
-    h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 3));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 2));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 1));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 0));
+    if (fast_approx_) {
+        h->uni_vmovups(vmm_src, table_val(exp_approx_pol, 2));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_approx_pol, 1));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_approx_pol, 0));
+    } else {
+        h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 3));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 2));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 1));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_pol, 0));
+    }
     h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(one));
     // y = y * 2^n
     h->uni_vmulps(vmm_src, vmm_src, vmm_aux(1));
@@ -481,6 +499,11 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::elu_compute_vector_fwd(
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::tanh_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_) {
+        tanh_approx_compute_vector_fwd(vmm_src);
+        return;
+    }
+
     // we add a check as the avx2 code cannot be used for avx
     assert(IMPLICATION(isa == avx2, mayiuse(avx2)));
 
@@ -687,6 +710,11 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::tanh_compute_vector_fwd(
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::gelu_tanh_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_) {
+        gelu_tanh_approx_compute_vector_fwd(vmm_src);
+        return;
+    }
+
     h->uni_vmovups(vmm_aux(0), vmm_src);
 
     // compute G(x) = sqrt_root_two_over_pi * x * (1 + fitting_const * x * x)
@@ -921,6 +949,11 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::soft_relu_compute_vector_fwd(
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::logistic_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_) {
+        logistic_approx_compute_vector_fwd(vmm_src);
+        return;
+    }
+
     // To avoid exp(x) overflow happened at x > logf(FLT_MAX), negate positive,
     // compute exp(x), where x <= 0 to get 0 <= exp(x) <= 1 and restore value
     // sign at the end. This is possible due to logistic is symmetric function.
@@ -954,6 +987,11 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::logistic_compute_vector_fwd(
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::swish_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_) {
+        swish_approx_compute_vector_fwd(vmm_src);
+        return;
+    }
+
     // Save src data on stack for later usage
     h->uni_vmovups(h->ptr[reg_vmm_stack_ptr_], vmm_src);
     // x*alpha
@@ -1877,6 +1915,133 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::round_half_away_from_zero_compute_v
     }
 }
 
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa, Wmm>::approx_div(
+        const Vmm &vmm_dst, const Vmm &vmm_src) {
+    // Computes vmm_dst = vmm_dst / vmm_src, vmm_src may be spoiled.
+    // On avx512 the 14-bit reciprocal estimate is precise enough for the fast
+    // approximations and much cheaper than the division.
+    if (is_avx512_) {
+        h->vrcp14ps(vmm_src, vmm_src);
+        h->uni_vmulps(vmm_dst, vmm_dst, vmm_src);
+    } else {
+        h->uni_vdivps(vmm_dst, vmm_dst, vmm_src);
+    }
+}
+
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa, Wmm>::
+        exp_table_approx_compute_vector_fwd(const Vmm &vmm_src) {
+    // exp(x) = 2^(x * log2(e)) = 2^(m / 16) * 2^(r / 16), where m is
+    // x * 16 * log2(e) rounded to the nearest integer and |r| <= 0.5.
+    // 2^(m / 16) = 2^floor(m / 16) * 2^((m mod 16) / 16), the latter factor is
+    // taken from a 16-entry table and the former one is applied by vscalefps
+    // which also takes care of overflow and underflow.
+    // 2^(r / 16) is approximated by a polynomial of degree 2, the maximum
+    // relative error is below 1e-5.
+    h->uni_vminps(vmm_src, vmm_src, table_val(exp_ln_flt_max_f));
+    h->uni_vmaxps(vmm_src, vmm_src, table_val(exp_approx_ln_min_f));
+
+    // m = round(x * 16 * log2(e)), r = x * 16 * log2(e) - m
+    h->uni_vmulps(vmm_aux(0), vmm_src, table_val(exp_approx_log2ef_x16));
+    h->vrndscaleps(vmm_aux(1), vmm_aux(0), _op_near);
+    h->uni_vsubps(vmm_aux(0), vmm_aux(0), vmm_aux(1));
+
+    // compute polynomial
+    h->uni_vmovups(vmm_src, table_val(exp_approx_tbl_pol, 1));
+    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(exp_approx_tbl_pol, 0));
+    h->uni_vfmadd213ps(vmm_src, vmm_aux(0), table_val(one));
+
+    // y = y * 2^((m mod 16) / 16), vpermps uses 4 lower bits of an index
+    h->vcvtps2dq(vmm_aux(0), vmm_aux(1));
+    const Zmm zmm_idx(vmm_aux(0).getIdx());
+    h->vpermps(zmm_idx, zmm_idx, table_val(exp_approx_tbl));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux(0));
+
+    // y = y * 2^floor(m / 16)
+    h->uni_vmulps(vmm_aux(1), vmm_aux(1), table_val(exp_approx_one_sixteenth));
+    h->vscalefps(vmm_src, vmm_src, vmm_aux(1));
+}
+
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa, Wmm>::tanh_approx_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // tanh(x) = sign(x) * (1 - exp(-2|x|)) / (1 + exp(-2|x|)), which can't
+    // overflow. For small |x| the subtraction loses precision, so
+    // tanh(x) = x - x^3 / 3 + 2 * x^5 / 15 is used there instead.
+    h->uni_vmovups(vmm_aux(2), vmm_src);
+    h->uni_vmovups(vmm_aux(3), vmm_src);
+    h->uni_vandps(vmm_aux(3), vmm_aux(3), table_val(positive_mask));
+    h->uni_vmovups(vmm_src, vmm_aux(3));
+    h->uni_vmulps(vmm_src, vmm_src, table_val(minus_two));
+    exp_compute_vector_fwd(vmm_src); // pollutes vmm_aux(0), vmm_aux(1)
+
+    h->uni_vmovups(vmm_aux(0), table_val(one));
+    h->uni_vsubps(vmm_aux(0), vmm_aux(0), vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one));
+    approx_div(vmm_aux(0), vmm_src);
+
+    // polynomial for small |x|
+    h->uni_vmovups(vmm_src, vmm_aux(3));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_src);
+    h->uni_vmovups(vmm_aux(1), table_val(tanh_approx_pol, 1));
+    h->uni_vfmadd213ps(vmm_aux(1), vmm_src, table_val(tanh_approx_pol, 0));
+    h->uni_vmulps(vmm_aux(1), vmm_aux(1), vmm_src);
+    h->uni_vfmadd213ps(vmm_aux(1), vmm_aux(3), vmm_aux(3));
+    compute_cmp_mask(vmm_aux(3), table_val(tanh_approx_ubound), _cmp_lt_os);
+    blend_with_mask(vmm_aux(0), vmm_aux(1));
+
+    // restore the sign
+    h->uni_vandps(vmm_aux(2), vmm_aux(2), table_val(sign_mask));
+    h->uni_vxorps(vmm_aux(0), vmm_aux(0), vmm_aux(2));
+    h->uni_vmovups(vmm_src, vmm_aux(0));
+}
+
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa, Wmm>::logistic_approx_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // logistic(x) = 1 / (1 + exp(-x)). exp(-x) saturates instead of
+    // overflowing, so the result goes to zero for large negative x.
+    h->uni_vxorps(vmm_src, vmm_src, table_val(sign_mask));
+    exp_compute_vector_fwd(vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one));
+    h->uni_vmovups(vmm_aux(2), table_val(one));
+    approx_div(vmm_aux(2), vmm_src);
+    h->uni_vmovups(vmm_src, vmm_aux(2));
+}
+
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa, Wmm>::swish_approx_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // swish(x) = x / (1 + exp(-alpha * x))
+    h->uni_vmovups(vmm_aux(2), vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(alpha));
+    h->uni_vxorps(vmm_src, vmm_src, table_val(sign_mask));
+    exp_compute_vector_fwd(vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one));
+    approx_div(vmm_aux(2), vmm_src);
+    h->uni_vmovups(vmm_src, vmm_aux(2));
+}
+
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa,
+        Wmm>::gelu_tanh_approx_compute_vector_fwd(const Vmm &vmm_src) {
+    // gelu_tanh(x) = 0.5 * x * (1 + tanh(G(x))) = x / (1 + exp(-2 * G(x))),
+    // where G(x) = sqrt_root_two_over_pi * x * (1 + fitting_const * x * x)
+    h->uni_vmovups(vmm_aux(2), vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_src);
+    h->uni_vmovups(vmm_aux(1), table_val(gelu_tanh_fitting_const));
+    h->uni_vfmadd213ps(vmm_src, vmm_aux(1), table_val(one));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux(2));
+    h->uni_vmulps(vmm_src, vmm_src, table_val(gelu_tanh_sqrt_two_over_pi));
+    h->uni_vmulps(vmm_src, vmm_src, table_val(minus_two));
+
+    exp_compute_vector_fwd(vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one));
+    approx_div(vmm_aux(2), vmm_src);
+    h->uni_vmovups(vmm_src, vmm_aux(2));
+}
+
 template <cpu_isa_t isa, typename Wmm>
 size_t jit_uni_eltwise_injector_f32<isa, Wmm>::aux_vecs_count(
         alg_kind_t alg, bool is_fwd, float alpha) {
@@ -1962,6 +2127,16 @@ size_t jit_uni_eltwise_injector_f32<isa, Wmm>::aux_vecs_count(
     return n_vmms + need_mask_register(alg, is_fwd, alpha);
 }
 
+template <cpu_isa_t isa, typename Wmm>
+bool jit_uni_eltwise_injector_f32<isa, Wmm>::has_fast_approx(alg_kind_t alg) {
+    // Fast approximations use at most as many auxiliary registers as the
+    // accurate versions of the algorithms do.
+    using namespace alg_kind;
+    return utils::one_of(alg, eltwise_exp, eltwise_exp_use_dst_for_bwd,
+            eltwise_logistic, eltwise_logistic_use_dst_for_bwd, eltwise_swish,
+            eltwise_tanh, eltwise_tanh_use_dst_for_bwd, eltwise_gelu_tanh);
+}
+
 template <cpu_isa_t isa, typename Wmm>
 bool jit_uni_eltwise_injector_f32<isa, Wmm>::need_mask_register(
         alg_kind_t alg, bool is_fwd, float alpha) {
@@ -2254,6 +2429,42 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
             {exp_pol, {0x3c07cfce, true}} // p5 = 0.00828929059f
     };
 
+    // exp(x) lower degree polynomial approximation for fast_approx mode,
+    // maximum relative error is 1.2e-4
+    static const table_t exp_approx_polynomial {
+            // p0 = 1.0f
+            {exp_approx_pol, {0x3f800a78, true}}, // p1 = 1.00031948f
+            {exp_approx_pol, {0x3f010fa0, true}}, // p2 = 0.504144669f
+            {exp_approx_pol, {0x3e27dd57, true}} // p3 = 0.163930282f
+    };
+
+    // exp(x) table-based approximation for fast_approx mode on avx512
+    static const table_t exp_approx_table {
+            {exp_approx_ln_min_f, {0xc2d00000, true}}, // -104.f
+            {exp_approx_log2ef_x16, {0x41b8aa3b, true}}, // 23.0831203f
+            {exp_approx_one_sixteenth, {0x3d800000, true}}, // 0.0625f
+            // polynomial for 2^(r / 16), p0 = 1.0f
+            {exp_approx_tbl_pol, {0x3d317218, true}}, // p1 = ln(2) / 16
+            {exp_approx_tbl_pol, {0x3a75fdf0, true}}, // p2 = (ln(2) / 16)^2 / 2
+            // 2^(j / 16), j = 0..15
+            {exp_approx_tbl, {0x3f800000, false}},
+            {exp_approx_tbl, {0x3f85aac3, false}},
+            {exp_approx_tbl, {0x3f8b95c2, false}},
+            {exp_approx_tbl, {0x3f91c3d3, false}},
+            {exp_approx_tbl, {0x3f9837f0, false}},
+            {exp_approx_tbl, {0x3f9ef532, false}},
+            {exp_approx_tbl, {0x3fa5fed7, false}},
+            {exp_approx_tbl, {0x3fad583f, false}},
+            {exp_approx_tbl, {0x3fb504f3, false}},
+            {exp_approx_tbl, {0x3fbd08a4, false}},
+            {exp_approx_tbl, {0x3fc5672a, false}},
+            {exp_approx_tbl, {0x3fce248c, false}},
+            {exp_approx_tbl, {0x3fd744fd, false}},
+            {exp_approx_tbl, {0x3fe0ccdf, false}},
+            {exp_approx_tbl, {0x3feac0c7, false}},
+            {exp_approx_tbl, {0x3ff5257d, false}},
+    };
+
     // mish(x) constants
     static const table_t mish_consts {
             {fwd_mish_max_x_for_equation_f, {0x42317217, true}},
@@ -2265,6 +2476,13 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
             {tanh_linear_ubound, {0x39ddb3d7, true}},
             {tanh_saturation_lbound, {0x41102cb3, true}}};
 
+    // tanh(x) constants for fast_approx mode
+    static const table_t tanh_approx_consts {
+            {tanh_approx_ubound, {0x3e800000, true}}, // 0.25f
+            {tanh_approx_pol, {0xbeaaaaab, true}}, // p3 = -1.f / 3
+            {tanh_approx_pol, {0x3e088889, true}}, // p5 = 2.f / 15
+    };
+
     // tanh(x) polynomial approximation
     // For each coefficient, there is 32 entries
     static const table_t tanh_polynomial_table {
@@ -2950,11 +3168,18 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
     push_arg_entry_of(alpha, float2int(alpha_), true);
     push_arg_entry_of(beta, float2int(beta_), true);
     push_entries_of(common_values);
-    if (need.exp()) push_entries_of(exp_consts);
-    if (need.exp()) push_entries_of(exp_polynomial);
+    // Fast approximations of tanh and gelu_tanh are based on exp(x).
+    const bool need_exp = need.exp() || (fast_approx_ && need.tanh());
+    if (need_exp) push_entries_of(exp_consts);
+    if (need_exp) push_entries_of(exp_polynomial);
+    if (need_exp && fast_approx_) push_entries_of(exp_approx_polynomial);
+    if (need_exp && fast_approx_ && is_avx512_)
+        push_entries_of(exp_approx_table);
     if (need.mish()) push_entries_of(mish_consts);
-    if (need.tanh()) push_entries_of(tanh_consts);
-    if (need.tanh()) push_entries_of(tanh_polynomial_table);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_consts);
+    if (need.tanh() && !fast_approx_)
+        push_entries_of(tanh_polynomial_table);
+    if (need.tanh() && fast_approx_) push_entries_of(tanh_approx_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_polynomial);
     if (need.gelu_tanh()) push_entries_of(gelu_tanh_consts);
@@ -40,14 +40,15 @@ struct static_params_t {
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true, bool fast_approx = false)
         : save_state(save_state)
         , p_table_(p_table)
         , k_mask_(k_mask)
         , is_fwd(is_fwd)
         , use_dst(use_dst)
         , preserve_vmm(preserve_vmm)
-        , preserve_p_table(preserve_p_table) {}
+        , preserve_p_table(preserve_p_table)
+        , fast_approx(fast_approx) {}
 
     bool save_state;
     Xbyak::Reg64 p_table_;
@@ -56,6 +57,7 @@ struct static_params_t {
     bool use_dst;
     bool preserve_vmm;
     bool preserve_p_table;
+    bool fast_approx;
 };
 
 /*
@@ -73,6 +75,12 @@ bool is_alg_supported(alg_kind_t alg);
  */
 bool is_supported(cpu_isa_t isa, alg_kind_t alg);
 
+/*
+ * Checks if fast approximations of eltwise algorithms are allowed for given
+ * fpmath mode.
+ */
+bool is_fast_approx_allowed(fpmath_mode_t fpmath_mode);
+
 } // namespace eltwise_injector
 
 template <cpu_isa_t isa, typename Wmm = typename cpu_isa_traits<isa>::Vmm>
@@ -91,12 +99,15 @@ struct jit_uni_eltwise_injector_f32 {
     //   - algorithm derivative.
     // use_dst - defines whether source or destination point is passed to alg
     //   code. Depends on algorithm. See `_use_dst_for_bwd` algs definition.
+    // fast_approx - when true, forward exp, logistic, swish, tanh and
+    //   gelu_tanh use lower-degree approximations with relative error up to
+    //   5e-4. See `is_fast_approx_allowed()`.
     jit_uni_eltwise_injector_f32(jit_generator *host, alg_kind_t alg,
             float alpha, float beta, float scale, bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true, bool fast_approx = false)
         : alg_(alg)
         , alpha_(alpha)
         , beta_(beta)
@@ -109,6 +120,7 @@ struct jit_uni_eltwise_injector_f32 {
         , use_dst_(use_dst)
         , preserve_vmm_(preserve_vmm)
         , preserve_p_table_(preserve_p_table)
+        , fast_approx_(fast_approx && is_fwd && has_fast_approx(alg))
         , n_vregs_to_preserve_(aux_vecs_count(alg_, is_fwd_, alpha_)) {
         assert(eltwise_injector::is_supported(isa, alg_));
 
@@ -121,10 +133,10 @@ struct jit_uni_eltwise_injector_f32 {
             Xbyak::Reg64 p_table = Xbyak::Reg64(Xbyak::Operand::RAX),
             Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true,
             bool use_dst = false, bool preserve_vmm = true,
-            bool preserve_p_table = true)
+            bool preserve_p_table = true, bool fast_approx = false)
         : jit_uni_eltwise_injector_f32(host, eltwise.alg, eltwise.alpha,
                 eltwise.beta, eltwise.scale, save_state, p_table, k_mask,
-                is_fwd, use_dst, preserve_vmm, preserve_p_table) {}
+                is_fwd, use_dst, preserve_vmm, preserve_p_table, fast_approx) {}
 
     void compute_vector_range(size_t start_compute_idx, size_t end_compute_idx,
             const injector_utils::vmm_index_set_t &vmm_aux_indices = {});
@@ -159,6 +171,7 @@ private:
     const bool use_dst_;
     const bool preserve_vmm_;
     const bool preserve_p_table_;
+    const bool fast_approx_;
 
     Xbyak::Label l_table_;
 
@@ -198,6 +211,7 @@ private:
     Xbyak::Ymm ymm_tmp_;
     Xbyak::Xmm xmm_tmp_;
 
+    static bool has_fast_approx(alg_kind_t alg);
     static bool need_mask_register(alg_kind_t alg, bool is_fwd, float alpha);
     static size_t aux_gprs_count(alg_kind_t alg, bool is_fwd, float alpha);
     static bool need_vmm_stack_ptr(alg_kind_t alg, bool is_fwd, float alpha);
@@ -221,6 +235,8 @@ private:
     void blend_with_mask(const Vmm &vmm_dst, const Xbyak::Operand &src);
     void test_mask();
 
+    void approx_div(const Vmm &vmm_dst, const Vmm &vmm_src);
+
     void exp_compute_vector_fwd(const Vmm &vmm_src);
     void relu_compute_vector_fwd(const Vmm &vmm_src);
     void relu_zero_ns_compute_vector_fwd(const Vmm &vmm_src);
@@ -247,6 +263,12 @@ private:
     void round_half_to_even_compute_vector_fwd(const Vmm &vmm_src);
     void round_half_away_from_zero_compute_vector_fwd(const Vmm &vmm_src);
 
+    void exp_table_approx_compute_vector_fwd(const Vmm &vmm_src);
+    void tanh_approx_compute_vector_fwd(const Vmm &vmm_src);
+    void logistic_approx_compute_vector_fwd(const Vmm &vmm_src);
+    void swish_approx_compute_vector_fwd(const Vmm &vmm_src);
+    void gelu_tanh_approx_compute_vector_fwd(const Vmm &vmm_src);
+
     void exp_compute_vector_bwd(const Vmm &vmm_src);
     void relu_compute_vector_bwd(const Vmm &vmm_src);
     void elu_compute_vector_bwd(const Vmm &vmm_src);
@@ -288,6 +310,12 @@ private:
         exp_ln_flt_max_f, // logf(FLT_MAX) - max normal value
         exp_ln_flt_min_f, // logf(FLT_MIN) - min normal value
         exp_pol, // see correspondent table for float values
+        exp_approx_pol, // see correspondent table for float values
+        exp_approx_ln_min_f, // -104.f, exp() of it is below min denormal
+        exp_approx_log2ef_x16, // 16 * log2(e)
+        exp_approx_one_sixteenth, // 1.f / 16
+        exp_approx_tbl_pol, // see correspondent table for float values
+        exp_approx_tbl, // 2^(j / 16), j = 0..15
         // e^(2*x)+2*e^x+2 = FLT_MAX; x =~ 44.36141952603634
         fwd_mish_max_x_for_equation_f,
         // e^x(e^3x+4e^2x+e^x*(6+4*x)+4*(1+x)) = FLT_MAX; x =~ 22.18070976278534
@@ -297,6 +325,8 @@ private:
         tanh_linear_ubound, // arg below which tanh(x) = x
         tanh_saturation_lbound, // arg after which tanh(x) = 1.f
         tanh_pol_table, // table of polynomial coefficients
+        tanh_approx_ubound, // arg below which tanh(x) is a polynomial
+        tanh_approx_pol, // see correspondent table for float values
         soft_relu_one_twenty_six, // 126.f
         soft_relu_mantissa_sign_mask, // mask for mantissa bits and sign
         soft_relu_twenty, // 20.f
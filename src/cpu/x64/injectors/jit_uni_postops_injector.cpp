@@ -15,6 +15,7 @@
 *******************************************************************************/
 #include <cassert>
 #include "common/verbose.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 
 namespace dnnl {
@@ -39,10 +40,15 @@ jit_uni_postops_injector_t<isa, Vmm>::jit_uni_postops_injector_t(
         const auto &post_op = post_ops_.entry_[i];
 
         if (post_op.is_eltwise()) {
-            alg_to_eltwise_injector_.emplace(i,
-                                             jit_uni_eltwise_injector_f32<isa, Vmm>(host_, post_op.eltwise,
-                                                                               esp.save_state, esp.p_table_, esp.k_mask_, esp.is_fwd,
-                                                                               esp.use_dst));
+            auto eltwise = post_op.eltwise;
+            const int n_folded = fold_linear_post_ops(post_ops_, i, eltwise);
+            if (!is_identity_eltwise(eltwise))
+                alg_to_eltwise_injector_.emplace(i,
+                                                 jit_uni_eltwise_injector_f32<isa, Vmm>(host_, eltwise,
+                                                                                   esp.save_state, esp.p_table_, esp.k_mask_, esp.is_fwd,
+                                                                                   esp.use_dst, esp.preserve_vmm, esp.preserve_p_table,
+                                                                                   esp.fast_approx));
+            if (n_folded > 1) i += n_folded - 1;
         } else if (post_op.is_depthwise()) {
             depthwise_injectors.emplace_back(new jit_uni_depthwise_injector_f32<isa>(
                     host,
@@ -80,11 +86,18 @@ jit_uni_postops_injector_t<isa, Vmm>::jit_uni_postops_injector_t(
 
         if (post_op.is_eltwise()) {
             is_eltwise = true;
-            alg_to_eltwise_injector_.emplace(i,
-                    jit_uni_eltwise_injector_f32<isa, Vmm>(host_,
-                            post_op.eltwise, esp.save_state, esp.p_table_,
-                            esp.k_mask_, esp.is_fwd, esp.use_dst,
-                            esp.preserve_vmm, esp.preserve_p_table));
+            // A run of linear post-ops is composed into a single one kept
+            // at the position of its first entry, and identities are
+            // dropped. Entries without an injector are skipped at compute.
+            auto eltwise = post_op.eltwise;
+            const int n_folded = fold_linear_post_ops(post_ops_, i, eltwise);
+            if (!is_identity_eltwise(eltwise))
+                alg_to_eltwise_injector_.emplace(i,
+                        jit_uni_eltwise_injector_f32<isa, Vmm>(host_, eltwise,
+                                esp.save_state, esp.p_table_, esp.k_mask_,
+                                esp.is_fwd, esp.use_dst, esp.preserve_vmm,
+                                esp.preserve_p_table, esp.fast_approx));
+            if (n_folded > 1) i += n_folded - 1;
         } else if (post_op.is_like_binary()) {
             is_like_binary = true;
         } else if (post_op.is_depthwise()) {
@@ -156,13 +169,17 @@ template <>
 jit_uni_postops_injector_base_t<Xbyak::Zmm> *
 jit_uni_postops_injector_base_t<Xbyak::Zmm>::create(jit_generator *host,
         cpu_isa_t isa, const post_ops_t &post_ops,
-        const binary_injector::static_params_t &binary_static_params) {
+        const binary_injector::static_params_t &binary_static_params,
+        const eltwise_injector::static_params_t &eltwise_static_params,
+        const quantization_injector::static_params_t
+                &quantization_static_params) {
 
 // Exact match case goes first and required to force `isa` passed by user.
 #define CASE_EXACT_MATCH(_isa) \
     if (isa == (_isa)) \
         return new jit_uni_postops_injector_t<_isa, Xbyak::Zmm>( \
-                host, post_ops, binary_static_params);
+                host, post_ops, binary_static_params, \
+                eltwise_static_params, quantization_static_params);
 
     CASE_EXACT_MATCH(avx512_core_fp16);
     CASE_EXACT_MATCH(avx512_core_bf16);
@@ -175,7 +192,8 @@ jit_uni_postops_injector_base_t<Xbyak::Zmm>::create(jit_generator *host,
 #define CASE_MAYIUSE(_isa) \
     if (mayiuse(_isa)) \
         return new jit_uni_postops_injector_t<_isa, Xbyak::Zmm>( \
-                host, post_ops, binary_static_params);
+                host, post_ops, binary_static_params, \
+                eltwise_static_params, quantization_static_params);
 
     CASE_MAYIUSE(avx512_core_fp16);
     CASE_MAYIUSE(avx512_core_bf16);
@@ -191,13 +209,17 @@ template <>
 jit_uni_postops_injector_base_t<Xbyak::Ymm> *
 jit_uni_postops_injector_base_t<Xbyak::Ymm>::create(jit_generator *host,
         cpu_isa_t isa, const post_ops_t &post_ops,
-        const binary_injector::static_params_t &binary_static_params) {
+        const binary_injector::static_params_t &binary_static_params,
+        const eltwise_injector::static_params_t &eltwise_static_params,
+        const quantization_injector::static_params_t
+                &quantization_static_params) {
 
 // Exact match case goes first and required to force `isa` passed by user.
 #define CASE_EXACT_MATCH(_isa) \
     if (isa == (_isa)) \
         return new jit_uni_postops_injector_t<_isa, Xbyak::Ymm>( \
-                host, post_ops, binary_static_params);
+                host, post_ops, binary_static_params, \
+                eltwise_static_params, quantization_static_params);
 
     CASE_EXACT_MATCH(avx512_core_fp16);
     CASE_EXACT_MATCH(avx512_core);
@@ -212,7 +234,8 @@ jit_uni_postops_injector_base_t<Xbyak::Ymm>::create(jit_generator *host,
 #define CASE_MAYIUSE(_isa) \
     if (mayiuse(_isa)) \
         return new jit_uni_postops_injector_t<_isa, Xbyak::Ymm>( \
-                host, post_ops, binary_static_params);
+                host, post_ops, binary_static_params, \
+                eltwise_static_params, quantization_static_params);
 
     CASE_MAYIUSE(avx512_core_fp16);
     CASE_MAYIUSE(avx512_core);
@@ -230,13 +253,17 @@ template <>
 jit_uni_postops_injector_base_t<Xbyak::Xmm> *
 jit_uni_postops_injector_base_t<Xbyak::Xmm>::create(jit_generator *host,
         cpu_isa_t isa, const post_ops_t &post_ops,
-        const binary_injector::static_params_t &binary_static_params) {
+        const binary_injector::static_params_t &binary_static_params,
+        const eltwise_injector::static_params_t &eltwise_static_params,
+        const quantization_injector::static_params_t
+                &quantization_static_params) {
 
 // Exact match case goes first and required to force `isa` passed by user.
 #define CASE_EXACT_MATCH(_isa) \
     if (isa == (_isa)) \
         return new jit_uni_postops_injector_t<_isa, Xbyak::Xmm>( \
-                host, post_ops, binary_static_params);
+                host, post_ops, binary_static_params, \
+                eltwise_static_params, quantization_static_params);
 
     CASE_EXACT_MATCH(avx512_core_fp16);
     CASE_EXACT_MATCH(avx512_core);
@@ -252,7 +279,8 @@ jit_uni_postops_injector_base_t<Xbyak::Xmm>::create(jit_generator *host,
 #define CASE_MAYIUSE(_isa) \
     if (mayiuse(_isa)) \
         return new jit_uni_postops_injector_t<_isa, Xbyak::Xmm>( \
-                host, post_ops, binary_static_params);
+                host, post_ops, binary_static_params, \
+                eltwise_static_params, quantization_static_params);
 
     CASE_MAYIUSE(avx512_core_fp16);
     CASE_MAYIUSE(avx512_core);
@@ -322,7 +350,9 @@ void jit_uni_postops_injector_t<isa, Vmm>::compute_vector_range(
         const auto &post_op = post_ops_.entry_[i];
 
         if (post_op.is_eltwise()) {
-            alg_to_eltwise_injector_.at(i).compute_vector_range(vmm_idxs);
+            const auto it = alg_to_eltwise_injector_.find(i);
+            if (it != alg_to_eltwise_injector_.end())
+                it->second.compute_vector_range(vmm_idxs);
         } else if (post_op.is_like_binary()) {
             binary_injector_->compute_vector_range(
                     vmm_idxs, rhs_arg_idx, post_op, rhs_arg_params);
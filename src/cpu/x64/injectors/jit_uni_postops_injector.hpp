@@ -65,9 +65,27 @@ public:
     // cases it's aligned with the former kernel ISA if such enum value is
     // instantiated for injectors. If not, uses the next available isa enum
     // value in compliance with same vector length.
+    // @quantization_static_params <optional> - registers used by depthwise
+    // and quantization injectors.
     static jit_uni_postops_injector_base_t *create(jit_generator *host,
             cpu_isa_t isa, const post_ops_t &post_ops,
-            const binary_injector::static_params_t &binary_static_params);
+            const binary_injector::static_params_t &binary_static_params,
+            const quantization_injector::static_params_t
+                    &quantization_static_params
+            = quantization_injector::static_params_t()) {
+        return create(host, isa, post_ops, binary_static_params,
+                eltwise_injector::static_params_t(),
+                quantization_static_params);
+    }
+    // @eltwise_static_params - eltwise injector settings, e.g. fast
+    // approximations.
+    static jit_uni_postops_injector_base_t *create(jit_generator *host,
+            cpu_isa_t isa, const post_ops_t &post_ops,
+            const binary_injector::static_params_t &binary_static_params,
+            const eltwise_injector::static_params_t &eltwise_static_params,
+            const quantization_injector::static_params_t
+                    &quantization_static_params
+            = quantization_injector::static_params_t());
 
     virtual ~jit_uni_postops_injector_base_t() = default;
 
@@ -123,6 +141,16 @@ public:
     virtual void set_lambda_injector(lambda_jit_injectors_t::key_type,
             const lambda_jit_injectors_t::mapped_type &jit_injector)
             = 0;
+
+    // Copies pointers of depthwise and quantization post-ops to the stack
+    // where the injectors expect them; the stack is restored with
+    // `reset_stack_pointer()`.
+    virtual void push_post_ops_data_on_stack(
+            const Xbyak::Reg64 &post_ops_data_reg,
+            std::size_t post_ops_data_offset, const Xbyak::Reg64 &aux_reg0,
+            const Xbyak::Reg64 &aux_reg1)
+            = 0;
+    virtual void reset_stack_pointer() = 0;
 };
 
 // A parent isa-specific post-ops injector class. A specific instance is
@@ -212,8 +240,8 @@ public:
             const lambda_jit_injectors_t::mapped_type &jit_injector) override;
 
     void push_post_ops_data_on_stack(const Xbyak::Reg64& post_ops_data_reg, std::size_t post_ops_data_offset,
-                                     const Xbyak::Reg64& aux_reg0, const Xbyak::Reg64& aux_reg1);
-    void reset_stack_pointer();
+                                     const Xbyak::Reg64& aux_reg0, const Xbyak::Reg64& aux_reg1) override;
+    void reset_stack_pointer() override;
 
 private:
     post_ops_t post_ops_;
@@ -126,6 +126,9 @@ void jit_uni_quantization_injector_f32<isa, Vmm>::compute_input_scale_shift_impl
         const std::set<size_t>& vmmIdxs, int offset, bool do_rounding, bool is_scalar, bool is_broadcast) {
     size_t weights_off =  post_op_.quantization.offset[post_op_.quantization.inp_scale] * sizeof(float);
     size_t bias_off =  post_op_.quantization.offset[post_op_.quantization.inp_shift] * sizeof(float);
+    // A shift that is known to be all zeros is skipped together with its load.
+    const bool with_shift = !(post_op_.quantization.per_channel[post_op_.quantization.inp_shift]
+            && post_op_.quantization.all_default[post_op_.quantization.inp_shift]);
 
     if (is_scalar) {
         if (!post_op_.quantization.per_channel[post_op_.quantization.inp_scale])
@@ -141,7 +144,7 @@ void jit_uni_quantization_injector_f32<isa, Vmm>::compute_input_scale_shift_impl
             h->uni_vmovups(vmm_d_weights_, h->ptr[reg_d_weights_ + offset + weights_off]);
     }
 
-    if (vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx()) {
+    if (vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx() || !with_shift) {
         for (auto vmmIdx : vmmIdxs) {
             Vmm vmm_dst = Vmm(vmmIdx);
 
@@ -149,6 +152,17 @@ void jit_uni_quantization_injector_f32<isa, Vmm>::compute_input_scale_shift_impl
         }
     }
 
+    if (!with_shift) {
+        if (do_rounding) {
+            for (auto vmmIdx : vmmIdxs) {
+                Vmm vmm_dst = Vmm(vmmIdx);
+
+                h->uni_vroundps(vmm_dst, vmm_dst, 0);
+            }
+        }
+        return;
+    }
+
     if (is_scalar) {
         if (!post_op_.quantization.per_channel[post_op_.quantization.inp_shift])
             h->uni_vmovss(xmm_d_bias_, h->ptr[reg_d_bias_ + bias_off]);
@@ -213,6 +227,9 @@ template <cpu_isa_t isa, typename Vmm>
 void jit_uni_quantization_injector_f32<isa, Vmm>::compute_output_scale_shift_impl(const std::set<size_t>& vmmIdxs, int offset, bool is_scalar, bool is_broadcast) {
     size_t weights_off =  post_op_.quantization.offset[post_op_.quantization.output_scale] * sizeof(float);
     size_t bias_off =  post_op_.quantization.offset[post_op_.quantization.output_shift] * sizeof(float);
+    // A shift that is known to be all zeros is skipped together with its load.
+    const bool with_shift = !(post_op_.quantization.per_channel[post_op_.quantization.output_shift]
+            && post_op_.quantization.all_default[post_op_.quantization.output_shift]);
 
     if (!do_dequantization)
         return;
@@ -231,7 +248,7 @@ void jit_uni_quantization_injector_f32<isa, Vmm>::compute_output_scale_shift_imp
             h->uni_vmovups(vmm_d_weights_, h->ptr[reg_d_weights_ + offset + weights_off]);
     }
 
-    if (vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx()) {
+    if (vmm_d_weights_.getIdx() == vmm_d_bias_.getIdx() || !with_shift) {
         for (auto &vmmIdx : vmmIdxs) {
             Vmm vmm_dst = Vmm(vmmIdx);
 
@@ -239,6 +256,9 @@ void jit_uni_quantization_injector_f32<isa, Vmm>::compute_output_scale_shift_imp
         }
     }
 
+    if (!with_shift)
+        return;
+
     if (is_scalar) {
         if (!post_op_.quantization.per_channel[post_op_.quantization.output_shift])
             h->uni_vmovss(xmm_d_bias_, h->ptr[reg_d_bias_ + bias_off]);
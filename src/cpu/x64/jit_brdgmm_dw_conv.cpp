@@ -81,8 +81,17 @@ bool post_ops_ok(jit_brdgmm_conv_conf_t &jcp, const primitive_attr_t &attr,
 
     const auto &post_ops = attr.post_ops_;
 
+    // Pointers of depthwise and quantization post-ops are taken from the
+    // beginning of the post-ops arguments vector by the kernel, hence these
+    // post-ops can't be mixed with binary ones.
+    const bool with_dw_quant = post_ops.find(primitive_kind::depthwise) != -1
+            || post_ops.find(primitive_kind::quantization) != -1;
+    const bool with_binary = post_ops.find(primitive_kind::binary) != -1
+            || post_ops.find(primitive_kind::prelu) != -1;
+    if (with_dw_quant && with_binary) return false;
+
     return injector::post_ops_ok(post_ops_ok_args_t(get_max_cpu_isa(),
-            {sum, eltwise, binary}, post_ops, &dst_d,
+            {sum, eltwise, binary, depthwise, quantization}, post_ops, &dst_d,
             false /*sum_at_pos_0_only*/, false /*sum_requires_scale_one*/,
             false /*sum_requires_zp_zero*/, true /*sum_requires_same_params*/,
             {broadcasting_strategy_t::per_oc, broadcasting_strategy_t::scalar,
@@ -79,8 +79,28 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(zero_points_ok(), VERBOSE_UNSUPPORTED_ZP_CFG);
     VDISPATCH_CONV(arg_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
 
-    CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+    with_dw_conv_ = attr()->post_ops_.find(primitive_kind::convolution) != -1;
+    convolution_desc_t cd_1x1 = *desc();
+    if (with_dw_conv_) CHECK(init_dw_conv_po(engine, cd_1x1));
+
+    CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, cd_1x1, src_md_,
+            weights_md_, with_dw_conv_ ? dst_1x1_md_ : dst_md_, bias_md_,
+            with_dw_conv_ ? attr_1x1_ : attr_, dnnl_get_max_threads()));
+
+    if (with_dw_conv_) {
+        VDISPATCH_CONV(!jcp_.is_rtus, VERBOSE_UNSUPPORTED_FEATURE,
+                "reduce to unit stride with depthwise post-op");
+        // The depthwise kernel consumes the 1x1 output row by row, so the
+        // spatial blocking is restricted to a single row.
+        if (jcp_.is_os_blocking) {
+            jcp_.is_os_blocking = false;
+            jcp_.ow_block = nstl::min(jcp_.ow, jcp_.os_block);
+            jcp_.nb_ow = div_up(jcp_.ow, jcp_.ow_block);
+            jcp_.M = jcp_.brgM = jcp_.ow_block;
+            jcp_.M_tail = jcp_.brgM_tail = jcp_.ow % jcp_.ow_block;
+            jcp_.buffer_size = jcp_.LDC * jcp_.M;
+        }
+    }
 
     brgs_ = std::make_shared<brgemm_containers::brgemm_desc_container_t>(32);
 
@@ -146,11 +166,107 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(init_brgemm_desc());
 
     brgemm_convolution_utils::set_amx_wsp_per_thread(jcp_);
+    const size_t scratchpad_limit = attr()->scratchpad_limit_;
+    CHECK(brgemm_convolution_utils::fit_scratchpad_limit(
+            jcp_, scratchpad_limit));
     auto scratchpad = scratchpad_registry().registrar();
     brgemm_convolution_utils::init_scratchpad(scratchpad, jcp_);
+    if (with_dw_conv_) {
+        // kh rows of the 1x1 output ring buffer plus a zero row used for the
+        // top and bottom padding of the depthwise convolution
+        const size_t dw_buffer_size = static_cast<size_t>(jcp_.nthr)
+                * (jcp_dw_.kh + 1) * jcp_.ow * jcp_.oc_without_padding;
+        scratchpad.book(key_dw_conv_buffer, dw_buffer_size, sizeof(float));
+    }
     if (jcp_.with_scales)
         book_precomputed_scales(scratchpad, attr()->scales_, OC(),
                 jcp_.scale_adjust_factor != 1.0f);
+    VDISPATCH_CONV(IMPLICATION(scratchpad_limit > 0,
+                           scratchpad_registry().size() <= scratchpad_limit),
+            VERBOSE_SCRATCHPAD_LIMIT);
+
+    VINFO(primitive, create, explain, convolution,
+            "%s,M:%d N:%d K:%d os_blocking:%d os_block:%d ow_block:%d"
+            " oc_block:%d ic_block:%d nb_ic_blocking:%d nthr:%d rtus:%d"
+            " buffer:%d",
+            info(engine), jcp_.M, jcp_.N, jcp_.K, jcp_.is_os_blocking,
+            jcp_.os_block, jcp_.ow_block, jcp_.oc_block, jcp_.ic_block,
+            jcp_.nb_ic_blocking, jcp_.nthr, jcp_.is_rtus, jcp_.use_buffer);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_dw_conv_po(
+        engine_t *engine, convolution_desc_t &cd_1x1) {
+    using namespace format_tag;
+
+    const auto &po = attr()->post_ops_;
+    const int dw_po_idx = po.find(primitive_kind::convolution);
+    const auto &dw_po = po.entry_[dw_po_idx].depthwise_conv_old;
+
+    VDISPATCH_CONV(isa == avx512_core, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(everyone_is(f32, src_md(0)->data_type,
+                           weights_md(0)->data_type, dst_md(0)->data_type,
+                           dw_po.in_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(IMPLICATION(with_bias(), weights_md(1)->data_type == f32),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    // Blocked layouts are handled by the jit_1x1_with_dw_conv implementation.
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, nhwc)
+                    && memory_desc_matches_tag(dst_md_, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(everyone_is(1, KSH(), KSW()), VERBOSE_UNSUPPORTED_FEATURE,
+            "non-unit stride with depthwise post-op");
+    VDISPATCH_CONV(everyone_is(0, padT(), padL()),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "with depthwise post-op");
+    VDISPATCH_CONV(dw_po.in_h == IH() && dw_po.in_w == IW(),
+            VERBOSE_INCONSISTENT_DIM, "src", (int)IW(), "dw_conv", dw_po.in_w);
+    VDISPATCH_CONV(OH() == div_up(dw_po.in_h, dw_po.str_h)
+                    && OW() == div_up(dw_po.in_w, dw_po.str_w),
+            VERBOSE_INCONSISTENT_DIM, "dst", (int)OW(), "dw_conv",
+            dw_po.in_w);
+    // the depthwise weights come in 16-channel blocks without padding
+    VDISPATCH_CONV(OC() % 16 == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "channel tail with depthwise post-op");
+    VDISPATCH_CONV(attr()->scales_.has_default_values()
+                    && attr()->zero_points_.has_default_values(),
+            VERBOSE_UNSUPPORTED_ATTR);
+    for (int i = 0; i < dw_po_idx; i++)
+        VDISPATCH_CONV(po.entry_[i].is_eltwise(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    // The 1x1 part gets the post-ops preceding the depthwise one and writes
+    // an intermediate tensor of the depthwise input shape.
+    CHECK(attr_1x1_.copy_from(*attr()));
+    attr_1x1_.post_ops_.entry_.assign(
+            po.entry_.cbegin(), po.entry_.cbegin() + dw_po_idx);
+
+    const dims_t dst_1x1_dims = {MB(), OC(), dw_po.in_h, dw_po.in_w};
+    CHECK(memory_desc_init_by_tag(
+            dst_1x1_md_, 4, dst_1x1_dims, dw_po.in_dt, nhwc));
+    cd_1x1.dst_desc = dst_1x1_md_;
+    cd_1x1.padding[1][0] = 0;
+    cd_1x1.padding[1][1] = 0;
+
+    // The depthwise weights come in 16-channel blocks.
+    const dims_t dw_weights_dims = {OC(), 1, 1, dw_po.ker_h, dw_po.ker_w};
+    CHECK(memory_desc_init_by_tag(
+            dw_weights_md_, 5, dw_weights_dims, f32, Goihw16g));
+    const dims_t dw_bias_dims = {OC()};
+    CHECK(memory_desc_init_by_tag(dw_bias_md_, 1, dw_bias_dims, f32, x));
+
+    jit_1x1_conv_conf_t jcp_1x1 {};
+    jcp_1x1.oc = static_cast<int>(OC());
+    jcp_1x1.dw_conv_oh = static_cast<int>(OH());
+    jcp_1x1.dw_conv_ow = static_cast<int>(OW());
+    jcp_1x1.dst_dt = dw_po.in_dt;
+    jcp_1x1.dw_conv_dst_dt = dst_md(0)->data_type;
+    jcp_1x1.bia_dt = f32;
+    jcp_dw_ = jit_conv_conf_t {};
+    CHECK(jit_uni_dw_conv_row_f32<avx512_core>::init_conf(
+            jcp_1x1, jcp_dw_, *attr()));
 
     return status::success;
 }
@@ -204,7 +320,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
         brgattr.use_uker = jcp_.use_uker;
         brgattr.use_interleave_stores = jcp_.use_interleave_stores;
         brgattr.hint_prefetching = jcp_.hint_prefetching;
-        brgattr.fpmath_mode = attr()->fpmath_.mode_;
+        brgattr.fpmath_mode = attr_1x1()->fpmath_.mode_;
         // if post-ops are required and there are no intermediate calculations
         // (like ic_chunks > 1) then we don't need code without post-ops in
         // brgemm kernel
@@ -213,11 +329,11 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
 
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
         auto LDD = jcp_.oc_without_padding;
-        const auto &p = attr()->post_ops_;
+        const auto &p = attr_1x1()->post_ops_;
         brg.with_sum = p.find(primitive_kind::sum) != -1;
         brg.with_weights_scale_adjust = jcp_.scale_adjust_factor != 1.0f;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
+                &brg, attr_1x1(), dst_1x1_md(), LDD, jcp_.bia_dt));
         jcp_.amx_buf_size_per_thread = nstl::max(
                 brg.get_wsp_buffer_size(), jcp_.amx_buf_size_per_thread);
         brgs_->insert(brg_idx, brg);
@@ -290,6 +406,14 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
         }
     }
 
+    if (pd()->with_dw_conv_) {
+        const auto &jcp_dw = pd()->jcp_dw_;
+        CHECK(safe_ptr_assign(kernel_dw_,
+                new jit_uni_dw_conv_row_f32<avx512_core>(jcp_dw, *attr,
+                        jcp_dw.oc, jcp.oc_without_padding)));
+        CHECK(kernel_dw_->create_kernel());
+    }
+
     for (auto &params : pd()->brgemm_init_params_) {
         const auto brg_idx = get_brg_idx(jcp, params);
         const auto &brgs = *(pd()->brgs_);
@@ -393,11 +517,12 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
         int od, int oh, int ow, int icc, int *last_brg_idx,
         const float *oscales, int32_t src_zp_vals, int32_t *src_zp_comp,
         int32_t *dst_zp_vals, int32_t *s8s8_compensation,
-        const float *dst_scales, const bool is_last_os) const {
+        const float *dst_scales, const bool is_last_os,
+        char *const dst_override) const {
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper dst_d(pd()->dst_1x1_md());
     const size_t src_dt_size = types::data_type_size(src_d.data_type());
     const size_t wei_dt_size = types::data_type_size(weights_d.data_type());
     const size_t dst_dt_size = types::data_type_size(dst_d.data_type());
@@ -450,10 +575,14 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
 
     const auto wei_offset = g * wei_g_stride + ocb * wei_ocb_stride;
     const auto wei_base = weights + wei_dt_size * wei_offset;
-    const auto ptr_D = dst
-            + dst_dt_size
-                    * (n * dst_d_sz + od * dst_h_sz + oh * dst_w_sz
-                            + ow * jcp.oc_without_padding + g_oc);
+    // dst_override points to the beginning of an output row
+    char *const dst_row = dst_override
+            ? dst_override
+            : dst
+                    + dst_dt_size
+                            * (n * dst_d_sz + od * dst_h_sz + oh * dst_w_sz);
+    const auto ptr_D
+            = dst_row + dst_dt_size * (ow * jcp.oc_without_padding + g_oc);
     char *const ptr_C = (jcp.use_buffer) ? c_buffer : (char *)ptr_D;
 
     const auto bias_w
@@ -679,6 +808,120 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
     });
 }
 
+template <cpu_isa_t isa>
+void brgemm_1x1_convolution_fwd_t<isa>::execute_fused_dw(const exec_ctx_t &ctx,
+        const brgemm_exec_ctx_t &brgemm_ctx,
+        brgemm_batch_element_t *const brg_batch_global, const float *dst_scales,
+        const float *oscales, char *const c_buffer_global) const {
+
+    const auto &jcp = pd()->jcp_;
+    const auto &jcp_dw = pd()->jcp_dw_;
+    // row kernel only supports 3x3 depthwise convolutions with unit padding
+    constexpr int dw_kh = 3;
+    assert(jcp_dw.kh == dw_kh);
+
+    const auto weights_dw = CTX_IN_MEM(
+            const float *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    const auto bias_dw = CTX_IN_MEM(
+            const float *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+    float *const dst = reinterpret_cast<float *>(brgemm_ctx.dst);
+    const auto post_ops_binary_rhs_arg_vec_dw
+            = binary_injector::prepare_binary_args(jcp_dw.post_ops, ctx,
+                    pd()->attr_1x1()->post_ops_.len() + 1);
+
+    const size_t row_size
+            = static_cast<size_t>(jcp.ow) * jcp.oc_without_padding;
+    float *const dw_buffer_global
+            = ctx.get_scratchpad_grantor().template get<float>(
+                    key_dw_conv_buffer);
+
+    const int work_amount = jcp.mb * jcp.nb_oc * jcp_dw.oh;
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        if (ithr >= work_amount) return;
+        brgemm_batch_element_t *const brg_batch
+                = brg_batch_global + (size_t)ithr * jcp.adjusted_batch_size;
+        char *const c_buffer = (jcp.use_buffer)
+                ? c_buffer_global + ithr * acc_dsz * jcp.LDC * jcp.M
+                : nullptr;
+        float *const ring_buffer
+                = dw_buffer_global + ithr * (dw_kh + 1) * row_size;
+        float *const zero_row = ring_buffer + dw_kh * row_size;
+        std::memset(zero_row, 0, row_size * sizeof(float));
+        // The row kernel always adds a bias, so never pass it a null one.
+        const float *const bias_dw_row = bias_dw ? bias_dw : zero_row;
+
+        // input row of the depthwise convolution stored in each ring slot
+        int ring_ih[dw_kh];
+        int last_n = -1;
+        int last_ocb = -1;
+        int last_brg_idx = -1;
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        int n {0}, ocb {0}, oh {0};
+        nd_iterator_init(start, n, jcp.mb, ocb, jcp.nb_oc, oh, jcp_dw.oh);
+
+        for (auto work = start; work < end; work++) {
+            if (n != last_n || ocb != last_ocb)
+                for (int i = 0; i < dw_kh; i++)
+                    ring_ih[i] = -1;
+
+            const float *rows[dw_kh];
+            for (int kh = 0; kh < dw_kh; kh++) {
+                const int ih = oh * jcp_dw.stride_h - 1 + kh;
+                if (ih < 0 || ih >= jcp.oh) {
+                    rows[kh] = zero_row;
+                    continue;
+                }
+                const int slot = ih % dw_kh;
+                float *const row = ring_buffer + slot * row_size;
+                if (ring_ih[slot] != ih) {
+                    for_(int owb = 0; owb < jcp.nb_ow; owb++)
+                    for (int icc = 0; icc < pd()->ic_chunks_; icc++) {
+                        exec_ker(brgemm_ctx, ithr, brg_batch, c_buffer, nullptr,
+                                0, n, ocb, 0, ih, owb * jcp.ow_block, icc,
+                                &last_brg_idx, oscales, 0, nullptr, nullptr,
+                                nullptr, dst_scales, false,
+                                reinterpret_cast<char *>(row));
+                    }
+                    ring_ih[slot] = ih;
+                }
+                rows[kh] = row;
+            }
+
+            const int chb_start = ocb * jcp.oc_block / jcp_dw.ch_block;
+            const int chb_end = nstl::min(jcp.oc_without_padding,
+                                        (ocb + 1) * jcp.oc_block)
+                    / jcp_dw.ch_block;
+            for (int chb = chb_start; chb < chb_end; chb++) {
+                const size_t ch_off
+                        = static_cast<size_t>(chb) * jcp_dw.ch_block;
+                auto par_conv_dw = jit_conv_call_s();
+                par_conv_dw.src_row0 = rows[0] + ch_off;
+                par_conv_dw.src_row1 = rows[1] + ch_off;
+                par_conv_dw.src_row2 = rows[2] + ch_off;
+                par_conv_dw.dst = dst
+                        + (static_cast<size_t>(n) * jcp_dw.oh + oh) * jcp_dw.ow
+                                * jcp_dw.oc
+                        + ch_off;
+                par_conv_dw.kh_padding = jcp_dw.kh;
+                par_conv_dw.filt = weights_dw
+                        + chb * jcp_dw.kh * jcp_dw.kw * jcp_dw.ch_block;
+                par_conv_dw.bias = bias_dw_row + ch_off;
+                par_conv_dw.ur_w = static_cast<size_t>(jcp_dw.ow);
+                par_conv_dw.oc_work = jcp_dw.ch_block;
+                par_conv_dw.oc_off = ch_off * sizeof(float);
+                par_conv_dw.post_ops_binary_rhs_arg_vec
+                        = post_ops_binary_rhs_arg_vec_dw.data();
+                (*kernel_dw_)(&par_conv_dw);
+            }
+
+            last_n = n;
+            last_ocb = ocb;
+            nd_iterator_step(n, jcp.mb, ocb, jcp.nb_oc, oh, jcp_dw.oh);
+        }
+    });
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
         const exec_ctx_t &ctx) const {
@@ -733,7 +976,10 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
             ? scratchpad.template get<uint8_t>(key_conv_brgemm_inp_buffer_mask)
             : nullptr;
 
-    if (jcp.is_os_blocking) {
+    if (pd()->with_dw_conv_) {
+        execute_fused_dw(ctx, brgemm_ctx, brg_batch_global, dst_scales, oscales,
+                c_buffer_global);
+    } else if (jcp.is_os_blocking) {
         execute_os_blocking(brgemm_ctx, brg_batch_global, dst_scales, oscales,
                 src_zero_point, zp_compensation, dst_zp_vals, s8s8_compensation,
                 c_buffer_global, inp_buffer_base, inp_buffer_mask_base);
@@ -37,6 +37,7 @@
 #include "cpu/x64/jit_brgemm_conv_trans_kernel.hpp"
 #include "cpu/x64/jit_brgemm_conv_utils.hpp"
 #include "cpu/x64/jit_brgemm_post_ops.hpp"
+#include "cpu/x64/jit_uni_dw_conv_row_f32.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -72,6 +73,52 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 
         jit_brgemm_conv_conf_t jcp_;
 
+        // Fused depthwise convolution post-op: the 1x1 output rows are
+        // computed into a per-thread ring buffer and consumed by the
+        // depthwise row kernel, so the intermediate tensor never goes to
+        // memory.
+        bool with_dw_conv_ = false;
+        jit_conv_conf_t jcp_dw_ = utils::zero<jit_conv_conf_t>();
+        memory_desc_t dst_1x1_md_ = types::zero_md();
+        memory_desc_t dw_weights_md_ = types::zero_md();
+        memory_desc_t dw_bias_md_ = types::zero_md();
+        primitive_attr_t attr_1x1_;
+
+        const primitive_attr_t *attr_1x1() const {
+            return with_dw_conv_ ? &attr_1x1_ : attr();
+        }
+        const memory_desc_t *dst_1x1_md() const {
+            return with_dw_conv_ ? &dst_1x1_md_ : dst_md(0);
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override {
+            if (with_dw_conv_) {
+                switch (arg) {
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC:
+                        return &dst_1x1_md_;
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
+                        return &dw_weights_md_;
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
+                        return &dw_bias_md_;
+                    default: break;
+                }
+            }
+            return convolution_fwd_pd_t::arg_md(arg, user_input);
+        }
+
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS)
+                    && with_dw_conv_)
+                return arg_usage_t::input;
+
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS)
+                    && attr_post_op_dw_inputs() > 1)
+                return arg_usage_t::input;
+
+            return convolution_fwd_pd_t::arg_usage(arg);
+        }
+
     protected:
         bool arg_scales_ok() const {
             std::vector<int> supported_args
@@ -89,6 +136,7 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 
     private:
         status_t init_brgemm_desc();
+        status_t init_dw_conv_po(engine_t *engine, convolution_desc_t &cd_1x1);
     };
 
     brgemm_1x1_convolution_fwd_t(const pd_t *apd)
@@ -116,7 +164,7 @@ private:
             , bias(CTX_IN_MEM(const char *, DNNL_ARG_BIAS))
             , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST))
             , post_ops_binary_rhs_arg_vec(binary_injector::prepare_binary_args(
-                      pd->attr()->post_ops_, ctx))
+                      pd->attr_1x1()->post_ops_, ctx))
             , wsp_tile(ctx.get_scratchpad_grantor().template get<char>(
                       memory_tracking::names::key_conv_amx_tile_buffer)) {}
         const char *const __restrict src;
@@ -136,7 +184,8 @@ private:
             int od, int oh, int ow, int icc, int *last_brg_idx,
             const float *oscales, int32_t src_zp_vals, int32_t *src_zp_comp,
             int32_t *dst_zp_vals, int32_t *s8s8_compensation,
-            const float *dst_scales, const bool is_last_os = false) const;
+            const float *dst_scales, const bool is_last_os = false,
+            char *const dst_override = nullptr) const;
     void execute_os_blocking(const brgemm_exec_ctx_t &brgemm_ctx,
             brgemm_batch_element_t *const brg_batch_global,
             const float *dst_scales, const float *oscales, int32_t src_zp_vals,
@@ -148,6 +197,11 @@ private:
             const float *dst_scales, const float *oscales, int32_t src_zp_vals,
             int32_t *src_zp_comp, int32_t *dst_zp_vals,
             int32_t *s8s8_compensation, char *const c_buffer_global) const;
+    void execute_fused_dw(const exec_ctx_t &ctx,
+            const brgemm_exec_ctx_t &brgemm_ctx,
+            brgemm_batch_element_t *const brg_batch_global,
+            const float *dst_scales, const float *oscales,
+            char *const c_buffer_global) const;
 
     status_t execute_forward_all(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
@@ -195,6 +249,7 @@ private:
                     jit_avx512_core_brgemm_conv_rtus_kernel_t>
             rtus_kernel_;
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
+    std::unique_ptr<jit_uni_dw_conv_row_f32<avx512_core>> kernel_dw_;
 
     const memory_desc_wrapper bias_d;
 
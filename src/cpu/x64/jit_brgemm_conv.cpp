@@ -19,6 +19,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
@@ -187,7 +188,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::add_brg_descriptor(
     if (do_init && is_K_tail && jcp_.K > 0) return status::success;
 
     const auto src_type = src_md(0)->data_type;
-    const auto wei_type = weights_md(0)->data_type;
+    const auto wei_type = jcp_.wei_dt;
     const auto is_amx = brgemm_convolution_utils::is_amx(isa);
 
     const float alpha = 1.0;
@@ -416,10 +417,19 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
                     types::is_zero_md(&cd.diff_dst_desc)))
         return status::unimplemented;
 
+    // Weights decompression: integer weights are converted into the source
+    // data type right before the computation, so the kernels only see
+    // floating-point weights.
+    with_wei_decomp_ = one_of(src_type, f32, bf16)
+            && one_of(wei_type, s8, u8, s4, u4);
+
     using skip_mask_t = primitive_attr_t::skip_mask_t;
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
             | skip_mask_t::zero_points_runtime | skip_mask_t::fpmath_mode;
     if (is_int8) skip_mask |= skip_mask_t::scales_runtime;
+    if (with_wei_decomp_)
+        skip_mask |= skip_mask_t::scales_runtime
+                | skip_mask_t::zero_points_runtime_data_type;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
     VDISPATCH_CONV(IMPLICATION(is_int8,
@@ -439,11 +449,76 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
             VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_CONV(zero_points_ok(), VERBOSE_UNSUPPORTED_ZP_CFG);
     VDISPATCH_CONV(arg_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    if (with_wei_decomp_) {
+        VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+                "groups with weights decompression");
+        VDISPATCH_CONV(attr()->scales_.has_default_values({DNNL_ARG_WEIGHTS}),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VDISPATCH_CONV(attr()->scales_.get(DNNL_ARG_WEIGHTS)
+                                .has_default_data_type(),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        // The weights layout is chosen for the decompressed data type and
+        // then applied to the compressed weights as is.
+        weights_md_.data_type = src_type;
+    }
 
     CHECK(brgemm_convolution_utils::init_conf(jcp_, use_inversion, isa, *desc(),
             src_md_, weights_md_, dst_md_, bias_md_, attr_,
             dnnl_get_max_threads()));
 
+    if (with_wei_decomp_) {
+        weights_md_.data_type = wei_type;
+        // The weights scales are applied during decompression.
+        jcp_.with_scales = false;
+        jcp_.is_oc_scale = false;
+
+        // Decompression walks the weights in physical order, so the output
+        // channel of an element is recovered from its offset.
+        const memory_desc_wrapper weights_d(&weights_md_);
+        const auto &bd = weights_d.blocking_desc();
+        decomp_oc_block_ = 1;
+        decomp_oc_block_stride_ = 1;
+        int n_oc_blks = 0;
+        for (int i = bd.inner_nblks - 1; i >= 0; i--) {
+            if (bd.inner_idxs[i] == 0) {
+                decomp_oc_block_ = bd.inner_blks[i];
+                n_oc_blks++;
+            } else if (n_oc_blks == 0) {
+                decomp_oc_block_stride_ *= bd.inner_blks[i];
+            }
+        }
+        VDISPATCH_CONV(n_oc_blks <= 1, VERBOSE_UNSUPPORTED_TAG);
+        decomp_oc_stride_ = bd.strides[0];
+        decomp_nb_oc_ = weights_d.padded_dims()[0] / decomp_oc_block_;
+        // Padded input channels have to stay zero after the zero point is
+        // subtracted, which is not tracked.
+        VDISPATCH_CONV(
+                IMPLICATION(!attr()->zero_points_.has_default_values(
+                                    DNNL_ARG_WEIGHTS),
+                        weights_d.padded_dims()[1] == weights_d.dims()[1]),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+
+        // The JIT decompression needs the output channels either blocked
+        // innermost with the outer dimension outermost, or plain innermost.
+        const dim_t nelems = weights_d.nelems(true);
+        dim_t row_sz = 0, chunk_sz = 0;
+        if (n_oc_blks == 1 && decomp_oc_stride_ * decomp_nb_oc_ == nelems) {
+            row_sz = decomp_oc_block_ * decomp_oc_block_stride_;
+            chunk_sz = decomp_oc_stride_;
+        } else if (n_oc_blks == 0 && decomp_oc_stride_ == 1) {
+            row_sz = weights_d.padded_dims()[0];
+            chunk_sz = nelems;
+        }
+        const dim_t vlen = is_superset(isa, avx512_core) ? 16 : 8;
+        const bool dt_ok = IMPLICATION(src_type == bf16,
+                is_superset(isa, avx512_core) && mayiuse(avx512_core_bf16));
+        if (dt_ok && row_sz > 0 && row_sz % vlen == 0
+                && chunk_sz % row_sz == 0) {
+            decomp_row_sz_ = row_sz;
+            decomp_chunk_sz_ = chunk_sz;
+        }
+    }
+
     // 1. The unrolled kernel can be used for exec_trans and exec_base and for
     // amx only. For exec_base it makes sense to use unrolled kernel only if
     // there is no padding by width.
@@ -723,11 +798,42 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
     brgs_sz_ = brgemm_descriptors_->refs_size();
 
     brgemm_convolution_utils::set_amx_wsp_per_thread(jcp_);
+    const size_t scratchpad_limit = attr()->scratchpad_limit_;
+    CHECK(brgemm_convolution_utils::fit_scratchpad_limit(
+            jcp_, scratchpad_limit));
     auto scratchpad = scratchpad_registry().registrar();
     brgemm_convolution_utils::init_scratchpad(scratchpad, jcp_);
+    if (with_wei_decomp_) {
+        const memory_desc_wrapper weights_d(&weights_md_);
+        scratchpad.book(key_brgemm_primitive_decomp_buf,
+                weights_d.nelems(true), jcp_.wei_dsz, 0,
+                brgemm_convolution_utils::P4K);
+        if (decomp_row_sz_ > 0) {
+            // Scales and zero points of the rows of every chunk
+            const dim_t n_chunks = weights_d.nelems(true) / decomp_chunk_sz_;
+            const dim_t n_params = n_chunks * decomp_row_sz_;
+            scratchpad.template book<float>(
+                    key_decompression_scales, n_params);
+            if (!attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS))
+                scratchpad.template book<float>(
+                        key_decompression_zero_points, n_params);
+        }
+    }
     if (jcp_.with_scales)
         book_precomputed_scales(scratchpad, attr()->scales_, OC(),
                 jcp_.scale_adjust_factor != 1.0f);
+    VDISPATCH_CONV(IMPLICATION(scratchpad_limit > 0,
+                           scratchpad_registry().size() <= scratchpad_limit),
+            VERBOSE_SCRATCHPAD_LIMIT);
+
+    VINFO(primitive, create, explain, convolution,
+            "%s,exec_type:%d loop_order:%d M:%d N:%d K:%d od_block:%d"
+            " oh_block:%d ow_block:%d oc_block:%d ic_block:%d"
+            " nb_oc_blocking:%d max_batch:%d nthr:%d buffer:%d",
+            info(engine), (int)jcp_.exec_type, (int)jcp_.loop_order, jcp_.M,
+            jcp_.N, jcp_.K, jcp_.od_block, jcp_.oh_block, jcp_.ow_block,
+            jcp_.oc_block, jcp_.ic_block, jcp_.nb_oc_blocking, jcp_.max_batch,
+            jcp_.nthr, jcp_.use_buffer);
 
     return status::success;
 }
@@ -972,6 +1078,30 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::init(engine_t *engine) {
         }
     }
 
+    if (_pd->decomp_row_sz_ > 0) {
+        const auto &zp = attr->zero_points_;
+        weights_decompression_compile_params_t dcp = {};
+        dcp.oc_size = _pd->decomp_row_sz_;
+        dcp.ic_internal_size = 1;
+        // The scales also zero the padded output channels.
+        dcp.with_scales = true;
+        dcp.broadcast_scales = false;
+        dcp.with_zero_points = !zp.has_default_values(DNNL_ARG_WEIGHTS);
+        dcp.broadcast_zero_points = false;
+        dcp.weights_dt = _pd->weights_md(0)->data_type;
+        dcp.decomp_buffer_dt = jcp.wei_dt;
+        dcp.scales_dt = data_type::f32;
+        dcp.zero_points_dt = data_type::f32;
+        if (is_superset(isa, avx512_core)) {
+            CHECK(safe_ptr_assign(wei_decomp_kernel_,
+                    new jit_brgemm_weights_decompression_kernel_t<avx512_core>(
+                            dcp)));
+        } else {
+            CHECK(safe_ptr_assign(wei_decomp_kernel_,
+                    new jit_brgemm_weights_decompression_kernel_t<avx2>(dcp)));
+        }
+    }
+
     if (jcp.is_relo_whi()) {
         jit_conv_conf_t ajcp;
         ajcp.is_relo = true;
@@ -1300,10 +1430,14 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
 
     const int wei_scale_mask
             = pd()->attr()->scales_.get(DNNL_ARG_WEIGHTS).mask_;
-    const float *oscales = scale_utils::precompute_scales(scratchpad,
-            src_scales, wei_scales, pd()->IC(), pd()->OC(), false,
-            wei_scale_mask != 0, pd()->attr(), jit_scale_precompute_.get(),
-            jcp.scale_adjust_factor);
+    // With weights decompression the weights scales are applied to the
+    // weights and the source scales are default.
+    const float *oscales = _pd->with_wei_decomp_
+            ? src_scales
+            : scale_utils::precompute_scales(scratchpad, src_scales,
+                    wei_scales, pd()->IC(), pd()->OC(), false,
+                    wei_scale_mask != 0, pd()->attr(),
+                    jit_scale_precompute_.get(), jcp.scale_adjust_factor);
 
     brgemm_exec_ctx_t brgemm_ctx(ctx, _pd);
 
@@ -1360,7 +1494,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
             ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
             : nullptr;
 
-    maybe_conv_weights(ctx, wei, wei);
+    maybe_conv_weights(ctx, wei, wei, wei_scales);
 
     // --------------- Parallel section ------------------------------
     const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
@@ -1732,10 +1866,17 @@ inline void brgemm_convolution_fwd_t<isa, use_inversion>::call_brgemm_kernel(
 template <cpu_isa_t isa, bool use_inversion>
 void brgemm_convolution_fwd_t<isa, use_inversion>::maybe_conv_weights(
         const exec_ctx_t &ctx, const char *__restrict input_weights,
-        const char *__restrict &wei) const {
+        const char *__restrict &wei, const float *wei_scales) const {
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
 
+    if (_pd->with_wei_decomp_) {
+        auto wei_decomp = ctx.get_scratchpad_grantor().template get<char>(
+                key_brgemm_primitive_decomp_buf);
+        decompress_weights(ctx, input_weights, wei_decomp, wei_scales);
+        input_weights = wei_decomp;
+    }
+
     wei = input_weights;
     if (!jcp.is_relo() || !jcp.relo_conv_weights) return;
 
@@ -1785,6 +1926,110 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::maybe_conv_weights(
     wei = wei_buffer;
 }
 
+template <cpu_isa_t isa, bool use_inversion>
+void brgemm_convolution_fwd_t<isa, use_inversion>::decompress_weights(
+        const exec_ctx_t &ctx, const char *__restrict input_weights,
+        char *__restrict wei, const float *wei_scales) const {
+    const auto _pd = pd();
+    const auto &jcp = _pd->jcp_;
+    const auto &zp = _pd->attr()->zero_points_;
+
+    const int wei_scale_mask
+            = _pd->attr()->scales_.get(DNNL_ARG_WEIGHTS).mask_;
+    int wei_zp_mask = 0;
+    data_type_t wei_zp_dt = data_type::s32;
+    zp.get(DNNL_ARG_WEIGHTS, &wei_zp_mask, &wei_zp_dt);
+    const void *wei_zero_points = zp.has_default_values(DNNL_ARG_WEIGHTS)
+            ? nullptr
+            : CTX_IN_MEM(const void *,
+                    DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+
+    const memory_desc_wrapper weights_d(_pd->weights_md(0));
+    const auto wei_dt = weights_d.data_type();
+    const dim_t OC = _pd->OC();
+    const dim_t oc_block = _pd->decomp_oc_block_;
+    const dim_t oc_block_stride = _pd->decomp_oc_block_stride_;
+    const dim_t oc_stride = _pd->decomp_oc_stride_;
+    const dim_t nb_oc = _pd->decomp_nb_oc_;
+    const auto get_oc = [&](dim_t p) {
+        return (p / oc_stride) % nb_oc * oc_block
+                + (p / oc_block_stride) % oc_block;
+    };
+
+    if (wei_decomp_kernel_) {
+        const auto &scratchpad = ctx.get_scratchpad_grantor();
+        const dim_t row_sz = _pd->decomp_row_sz_;
+        const dim_t chunk_sz = _pd->decomp_chunk_sz_;
+        const dim_t nchunks = weights_d.nelems(true) / chunk_sz;
+        const dim_t chunk_rows = chunk_sz / row_sz;
+        const dim_t nrows = nchunks * chunk_rows;
+
+        // Expand the scales and zero points to the rows of every chunk. Zero
+        // scales leave the padded output channels zero.
+        float *scales = scratchpad.template get<float>(
+                key_decompression_scales);
+        float *zero_points = wei_zero_points
+                ? scratchpad.template get<float>(
+                        key_decompression_zero_points)
+                : nullptr;
+        parallel_nd(nchunks, row_sz, [&](dim_t chunk, dim_t i) {
+            const dim_t oc = get_oc(chunk * chunk_sz + i);
+            const dim_t idx = chunk * row_sz + i;
+            scales[idx] = oc < OC ? wei_scales[wei_scale_mask ? oc : 0] : 0.f;
+            if (zero_points)
+                zero_points[idx] = oc < OC ? io::load_float_value(wei_zp_dt,
+                                           wei_zero_points,
+                                           wei_zp_mask ? oc : 0)
+                                           : 0.f;
+        });
+
+        const dim_t wei_typesize_scale
+                = utils::one_of(wei_dt, data_type::s4, data_type::u4) ? 2 : 1;
+        const size_t wei_dt_size = types::data_type_size(wei_dt);
+        parallel(0, [&](int ithr, int nthr) {
+            dim_t start {0}, end {0};
+            balance211(nrows, nthr, ithr, start, end);
+            while (start < end) {
+                const dim_t chunk = start / chunk_rows;
+                const dim_t n
+                        = nstl::min(end, (chunk + 1) * chunk_rows) - start;
+                const dim_t off = start * row_sz;
+                weights_decompression_runtime_params_t rt_params = {};
+                rt_params.weights_ptr = input_weights
+                        + off * wei_dt_size / wei_typesize_scale;
+                rt_params.decomp_buffer_ptr = wei + off * jcp.wei_dsz;
+                rt_params.scales_ptr = scales + chunk * row_sz;
+                rt_params.zero_points_ptr
+                        = zero_points ? zero_points + chunk * row_sz : nullptr;
+                rt_params.ic_size = n;
+                (*wei_decomp_kernel_)(&rt_params);
+                start += n;
+            }
+        });
+        return;
+    }
+
+    // The weights are processed in physical order split into nb_oc equal
+    // chunks. Elements of padded output channels are zeroed.
+    const dim_t chunk_sz = weights_d.nelems(true) / nb_oc;
+
+    parallel_nd(nb_oc, [&](dim_t chunk) {
+        for (dim_t i = 0; i < chunk_sz; i++) {
+            const dim_t p = chunk * chunk_sz + i;
+            const dim_t oc = get_oc(p);
+            float w = 0.f;
+            if (oc < OC) {
+                w = io::load_float_value(wei_dt, input_weights, p);
+                if (wei_zero_points)
+                    w -= io::load_float_value(
+                            wei_zp_dt, wei_zero_points, wei_zp_mask ? oc : 0);
+                w *= wei_scales[wei_scale_mask ? oc : 0];
+            }
+            io::store_float_value(jcp.wei_dt, w, wei, p);
+        }
+    });
+}
+
 template <cpu_isa_t isa, bool use_inversion>
 void brgemm_convolution_fwd_t<isa, use_inversion>::maybe_conv_inp(
         brgemm_thread_ctx_t &btc, const brgemm_thread_ctx_t &last_btc,
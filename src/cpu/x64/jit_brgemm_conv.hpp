@@ -41,6 +41,7 @@
 #include "cpu/x64/jit_brgemm_conv_utils.hpp"
 #include "cpu/x64/jit_brgemm_post_ops.hpp"
 #include "cpu/x64/jit_brgemm_transpose_utils.hpp"
+#include "cpu/x64/jit_brgemm_weights_decompression_kernel.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -71,6 +72,16 @@ struct brgemm_convolution_fwd_t : public primitive_t {
         bool with_sum;
         jit_brgemm_conv_conf_t jcp_;
 
+        // Weights decompression: output channel blocking of the weights
+        // layout in elements.
+        bool with_wei_decomp_ {false};
+        dim_t decomp_oc_stride_ {0}, decomp_nb_oc_ {0};
+        dim_t decomp_oc_block_ {1}, decomp_oc_block_stride_ {1};
+        // The JIT decompression processes contiguous chunks of rows of
+        // decomp_row_sz_ elements, the output channels of a row are the same
+        // for all the rows of a chunk. Zero when the layout doesn't allow it.
+        dim_t decomp_row_sz_ {0}, decomp_chunk_sz_ {0};
+
         int ic_chunks;
         bool need_postwork;
         dim_t wei_g_stride, wei_ic_stride, wei_ocb_stride;
@@ -149,6 +160,19 @@ struct brgemm_convolution_fwd_t : public primitive_t {
             int mask_src = 0, mask_dst = 0;
             attr()->zero_points_.get(DNNL_ARG_SRC, &mask_src);
             attr()->zero_points_.get(DNNL_ARG_DST, &mask_dst);
+            if (with_wei_decomp_) {
+                // Per-oc or common weights zero points only
+                using namespace data_type;
+                const auto &zp = attr()->zero_points_;
+                int mask_wei = 0;
+                zp.get(DNNL_ARG_WEIGHTS, &mask_wei);
+                return zp.has_default_values(DNNL_ARG_SRC)
+                        && zp.has_default_values(DNNL_ARG_DST)
+                        && zp.has_default_groups(DNNL_ARG_WEIGHTS)
+                        && utils::one_of(mask_wei, 0, 1)
+                        && utils::one_of(zp.get_data_type(DNNL_ARG_WEIGHTS),
+                                s32, s8, u8);
+            }
             return attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS)
                     && mask_src == 0 && mask_dst == 0;
         }
@@ -226,7 +250,10 @@ private:
 
     void maybe_conv_weights(const exec_ctx_t &ctx,
             const char *__restrict input_weights,
-            const char *__restrict &wei) const;
+            const char *__restrict &wei, const float *wei_scales) const;
+    void decompress_weights(const exec_ctx_t &ctx,
+            const char *__restrict input_weights, char *__restrict wei,
+            const float *wei_scales) const;
 
     status_t add_po_kernel(brgemm_desc_t *bcfg, int ker_idx, bool is_init);
     void add_po_kernels(int i_N, int init_bcast_dim, int po_bcast_dim);
@@ -258,6 +285,7 @@ private:
     std::unique_ptr<jit_generator> comp_vpad_pbuffer_;
 
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
+    std::unique_ptr<jit_weights_decompression_kernel_t> wei_decomp_kernel_;
 
     size_t acc_dsz, bia_dsz, src_dsz, wei_dsz, dst_dsz;
 
@@ -1299,34 +1299,46 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
         return;
     }
 
-    const int work = ti->g_work * ti->oc_b_work * ic_b_kh_work;
-
-    int start {0}, end {0};
-    balance211(work, jcp.nthr_mb, ti->ithr_mb, start, end);
+    // The reduction is balanced over elements rather than over
+    // (g, oc_b, ic_b, kh) rows: with small spatial sizes and many threads the
+    // number of rows may be below nthr_mb, which used to leave most of the
+    // threads idle while the rest reduced every buffer alone. For fixed g and
+    // oc_b the rows of the thread's ic_b range are contiguous, so each
+    // segment is reduced with a single accumulator call. Chunk boundaries
+    // are kept at cache line granularity to avoid false sharing.
+    const size_t row_size = (size_t)jcp.kw * jcp.ic_block * jcp.oc_block
+            * ((jcp.ndims == 5) ? jcp.kh : 1);
+    const size_t seg_size = row_size * ic_b_kh_work;
+    const size_t work = (size_t)ti->g_work * ti->oc_b_work * seg_size;
+    const size_t chunk = 16;
+
+    size_t start {0}, end {0};
+    balance211(utils::div_up(work, chunk), (size_t)jcp.nthr_mb,
+            (size_t)ti->ithr_mb, start, end);
+    start = nstl::min(start * chunk, work);
+    end = nstl::min(end * chunk, work);
     if (!jcp.transform_to_vnni && start == end) return;
 
     const int _start_nthr_mb = 1;
     for (int thr_mb = _start_nthr_mb; thr_mb < jcp.nthr_mb; ++thr_mb) {
-        int w = start;
-        int sub_g_start {0}, sub_oc_b_start {0}, sub_ic_b_kh_start {0};
-        nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
-                ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
+        size_t w = start;
         while (w < end) {
-            const int g = ti->g_start + sub_g_start;
-            const int oc_b = ti->oc_b_start + sub_oc_b_start;
+            const size_t seg = w / seg_size;
+            const size_t seg_off = w % seg_size;
+            const int g = ti->g_start + (int)(seg / ti->oc_b_work);
+            const int oc_b = ti->oc_b_start + (int)(seg % ti->oc_b_work);
+            const int ic_b_kh = (int)(seg_off / row_size);
             const int ic_b = ti->ic_b_start
-                    + sub_ic_b_kh_start / ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
-            const int kX
-                    = sub_ic_b_kh_start % ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
+                    + ic_b_kh / ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
+            const int kX = ic_b_kh % ((jcp.ndims == 5) ? jcp.kd : jcp.kh);
+            const size_t row_off = seg_off % row_size;
 
-            const size_t acc_size = (size_t)jcp.kw * jcp.ic_block * jcp.oc_block
-                    * ((jcp.ndims == 5) ? jcp.kh : 1)
-                    * nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start);
+            const size_t acc_size = nstl::min(end - w, seg_size - seg_off);
 
             const size_t off_ext
-                    = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kX);
+                    = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kX) + row_off;
             const size_t off_int = (jcp.transform_to_vnni)
-                    ? wei_offset_int(g, oc_b, ic_b, kX)
+                    ? wei_offset_int(g, oc_b, ic_b, kX) + row_off
                     : off_ext;
 
             float *wei_reduced = is_f32_out
@@ -1352,8 +1364,7 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
             } else
                 acc_ker_->accumulate(wei_reduced, wei_to_reduce, acc_size);
 
-            nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
-                    ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
+            w += acc_size;
         }
         if (jcp.with_bias && ti->ithr_ic_b == 0 && ti->ic_b_work > 0
                 && ti->ithr_mb == 0 && ti->img_work > 0) {
@@ -1738,7 +1738,13 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
             // Enable the shapes not supported in direct convs
             && is_groups_ok(jcp);
     const bool isa_has_small_group_perf = is_amx(isa) || jcp.isa == avx2;
-    if (is_grouped_small_ic && !isa_has_small_group_perf)
+    // HACK: brgemm_grouped_convolution_fwd_t packs several small groups into
+    // block-diagonal weights and marks the forward descriptor by setting
+    // diff_weights_desc; the packed groups are exactly what this
+    // implementation handles well.
+    const bool is_packed_groups = jcp.prop_kind != prop_kind::backward_weights
+            && !types::is_zero_md(&cd.diff_weights_desc);
+    if (is_grouped_small_ic && !isa_has_small_group_perf && !is_packed_groups)
         VDISPATCH_CONV_IC(!allow_perf_heuristics(jcp),
                 VERBOSE_IMPL_HEURISTIC_FAIL,
                 "no optimization for grouped convolutions with small ic");
@@ -1999,6 +2005,11 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
     const bool relo_supported_isa = IMPLICATION(
             is_int8_convolution, cpu().has(Xbyak::util::Cpu::tAVX512_VBMI));
     const bool relo_reasonable_isa = is_superset(isa, avx512_core);
+    // Without AMX the relocation is used for small-channel first layers
+    // (e.g. RGB input). With a reduction over a few input channels only, the
+    // kernel spends most of the time on the brgemm batch and on the vnni
+    // padding of ic; folding kw (and kh) into the reduction removes both.
+    const int max_stem_ic = 4;
 
     // try_relo_wi
     bool try_relo_wi = false;
@@ -2029,11 +2040,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
                                     wei_per_ic / src_per_ic <= 4)))
                 perf_relo = true;
         } else {
-            if (one_of(jcp.wei_dt, f32, s8)) {
-                if (jcp.ic == 1) perf_relo = true;
-            } else {
-                if (jcp.ic < jcp.vnni_block) perf_relo = true;
-            }
+            if (jcp.ic <= max_stem_ic) perf_relo = true;
         }
         perf_relo = perf_relo && jcp.kw > 1;
 
@@ -2077,11 +2084,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, bool use_inversion,
                     && IMPLICATION(try_relo_wi, rd_whi / rnd_rd_whi > 0.7f))
                 perf_relo = true;
         } else {
-            if (one_of(jcp.wei_dt, f32, s8)) {
-                if (jcp.ic == 1 && jcp.ow > 4) perf_relo = true;
-            } else {
-                if (jcp.ic < jcp.vnni_block && jcp.ow > 4) perf_relo = true;
-            }
+            if (jcp.ic <= max_stem_ic && jcp.ow > 4) perf_relo = true;
         }
         perf_relo = perf_relo && jcp.kh > 1;
 
@@ -2604,6 +2607,36 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
     }
 }
 
+status_t fit_scratchpad_limit(jit_brgemm_conv_conf_t &jcp, size_t limit) {
+    if (limit == 0) return status::success;
+
+    const auto get_scratchpad_size = [&]() {
+        memory_tracking::registry_t registry;
+        auto scratchpad = registry.registrar();
+        init_scratchpad(scratchpad, jcp);
+        return registry.size();
+    };
+
+    // Most of the scratchpad is per-thread buffers, so the size grows almost
+    // linearly with the number of threads. Start from the linear estimate and
+    // correct it for the alignment of the individual buffers.
+    const int nthr = jcp.nthr;
+    jcp.nthr = 1;
+    const size_t size_1thr = get_scratchpad_size();
+    VDISPATCH_CONV_IC(size_1thr <= limit, VERBOSE_SCRATCHPAD_LIMIT);
+    jcp.nthr = nthr;
+    const size_t size_nthr = get_scratchpad_size();
+    if (size_nthr <= limit) return status::success;
+
+    const size_t per_thr_size
+            = nstl::max<size_t>(1, (size_nthr - size_1thr) / (nthr - 1));
+    jcp.nthr = nstl::min<int>(nthr - 1, 1 + (limit - size_1thr) / per_thr_size);
+    while (jcp.nthr > 1 && get_scratchpad_size() > limit)
+        jcp.nthr--;
+
+    return status::success;
+}
+
 void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
 
     const auto os_chunks = jcp.nthr_mb_work;
@@ -56,6 +56,10 @@ void set_amx_wsp_per_thread(jit_brgemm_conv_conf_t &jcp);
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const jit_brgemm_conv_conf_t &jcp);
 
+// Lowers jcp.nthr until the buffers booked by init_scratchpad() fit into
+// limit bytes. 0 means no limit.
+status_t fit_scratchpad_limit(jit_brgemm_conv_conf_t &jcp, size_t limit);
+
 status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
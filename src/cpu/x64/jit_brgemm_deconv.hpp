@@ -34,6 +34,13 @@ namespace impl {
 namespace cpu {
 namespace x64 {
 
+// Forward deconvolution implemented on top of brgemm convolutions. Unit
+// stride deconvolution is a forward convolution with spatially inverted
+// weights. Strided deconvolution is executed as backward-data convolution by
+// brgemm_convolution_bwd_strided_t, which splits the destination into
+// stride_d * stride_h * stride_w phases: every phase only uses the kernel
+// taps that hit it, so it is a dense convolution and no zeros are inserted
+// into the source.
 template <cpu_isa_t isa>
 struct brgemm_deconvolution_fwd_t : public primitive_t {
 
@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_1x1_conv.hpp"
+#include "cpu/x64/jit_brgemm_conv.hpp"
+#include "cpu/x64/jit_brgemm_grouped_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(one_of(src_type, f32, bf16) && wei_type == src_type
+                    && one_of(dst_type, f32, src_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(
+                           skip_mask_t::post_ops | skip_mask_t::sum_dt,
+                           dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(attr()->post_ops_.find(primitive_kind::convolution) == -1,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(with_groups() && G() > 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "only grouped convolutions are supported");
+
+    const dim_t ic = IC() / G();
+    const dim_t oc = OC() / G();
+    VDISPATCH_CONV(!everyone_is(1, ic, oc), VERBOSE_UNSUPPORTED_FEATURE,
+            "depthwise convolutions are not supported");
+
+    // Pack as many groups as fit into one vector of accumulators; the
+    // largest such divisor also guarantees the nested convolution doesn't
+    // come back to this implementation.
+    const dim_t simd_w = isa_max_vlen(isa) / sizeof(float);
+    const dim_t ch = nstl::max(ic, oc);
+    groups_block_ = 1;
+    for (dim_t gb = 2; gb * ch <= simd_w; gb++)
+        if (G() % gb == 0) groups_block_ = gb;
+    VDISPATCH_CONV(groups_block_ > 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "groups are too wide to be packed");
+
+    const auto dat_tag = pick(ndims() - 3, nwc, nhwc, ndhwc);
+    const auto wei_tag = pick(ndims() - 3, goiw, goihw, goidhw);
+    VDISPATCH_CONV(set_default_formats_common(dat_tag, wei_tag, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_CONV(memory_desc_matches_tag(dst_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    const memory_desc_wrapper weights_d(weights_md_);
+    VDISPATCH_CONV(weights_d.is_plain() && weights_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_TAG_S, "weights");
+
+    memory_desc_t packed_wei_md;
+    dims_t packed_wei_dims;
+    array_copy(packed_wei_dims, weights_md_.dims, weights_md_.ndims);
+    packed_wei_dims[0] = G() / groups_block_;
+    packed_wei_dims[1] = oc * groups_block_;
+    packed_wei_dims[2] = ic * groups_block_;
+    CHECK(memory_desc_init_by_tag(packed_wei_md, weights_md_.ndims,
+            packed_wei_dims, wei_type, format_tag::any));
+
+    const convolution_desc_t &cd = *desc();
+    convolution_desc_t conv_d = convolution_desc_t();
+    CHECK(conv_desc_init(&conv_d, cd.prop_kind, alg_kind::convolution_direct,
+            &src_md_, &packed_wei_md, &bias_md_, &dst_md_, cd.strides,
+            cd.dilates, cd.padding[0], cd.padding[1]));
+    // HACK: Set diff_weights_desc as a signal to the brgemm convolution that
+    //       the weights are block-diagonal packed groups (it skips the small
+    //       groups heuristic) and to the primitive descriptor cache that a
+    //       separate cache entry is needed.
+    conv_d.diff_weights_desc = conv_d.weights_desc;
+
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&conv_d), attr(), nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    while (++it != it.end()) {
+        const auto *impl = (*it).get();
+        if (dynamic_cast<const typename brgemm_convolution_fwd_t<isa>::pd_t *>(
+                    impl)
+                || dynamic_cast<const typename brgemm_1x1_convolution_fwd_t<
+                        isa>::pd_t *>(impl)) {
+            conv_pd_ = *it;
+            break;
+        }
+    }
+    VDISPATCH_CONV(conv_pd_ != nullptr, VERBOSE_PRIMITIVE_CREATION_FAIL,
+            "brgemm convolution for packed groups");
+    VDISPATCH_CONV(
+            memory_desc_wrapper(conv_pd_->weights_md()).extra().flags == 0,
+            VERBOSE_UNSUPPORTED_TAG_S, "weights");
+
+    init_name();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+    scratchpad.book(key_conv_grouped_weights,
+            memory_desc_wrapper(conv_pd_->weights_md()).size(), 1);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_convolution_fwd_t<isa>::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_convolution_fwd_t<isa>::pack_weights(
+        const exec_ctx_t &ctx, char *packed_wei) const {
+    const auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper packed_wei_d(pd()->conv_pd_->weights_md(0));
+    const size_t dt_size = wei_d.data_type_size();
+
+    // Off-diagonal blocks and the padded area stay zero.
+    std::memset(packed_wei, 0, packed_wei_d.size());
+
+    const int ndims = wei_d.ndims();
+    const dim_t G = pd()->G();
+    const dim_t OC = pd()->OC() / G;
+    const dim_t IC = pd()->IC() / G;
+    const dim_t GB = pd()->groups_block_;
+    dim_t KS = 1;
+    for (int d = 3; d < ndims; d++)
+        KS *= wei_d.dims()[d];
+
+    parallel_nd(G, OC, [&](dim_t g, dim_t oc) {
+        dims_t pos {g, oc}, packed_pos {g / GB, (g % GB) * OC + oc};
+        for_(dim_t ic = 0; ic < IC; ic++)
+        for (dim_t ks = 0; ks < KS; ks++) {
+            pos[2] = ic;
+            packed_pos[2] = (g % GB) * IC + ic;
+            dim_t rem = ks;
+            for (int d = ndims - 1; d >= 3; d--) {
+                pos[d] = packed_pos[d] = rem % wei_d.dims()[d];
+                rem /= wei_d.dims()[d];
+            }
+            std::memcpy(packed_wei + packed_wei_d.off_v(packed_pos) * dt_size,
+                    wei + wei_d.off_v(pos) * dt_size, dt_size);
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    pack_weights(ctx, scratchpad.template get<char>(key_conv_grouped_weights));
+
+    memory_t packed_wei(ctx.stream()->engine(), pd()->conv_pd_->weights_md(),
+            scratchpad.get_memory_storage(key_conv_grouped_weights));
+
+    exec_args_t conv_args(ctx.args());
+    conv_args[DNNL_ARG_WEIGHTS] = {&packed_wei, true};
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+template struct brgemm_grouped_convolution_fwd_t<avx2>;
+template struct brgemm_grouped_convolution_fwd_t<avx512_core>;
+template struct brgemm_grouped_convolution_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
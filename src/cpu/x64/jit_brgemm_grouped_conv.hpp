@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_GROUPED_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_GROUPED_CONV_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Forward grouped convolution with few channels per group (ResNeXt, RegNet).
+// In nxc layouts the channels of consecutive groups are adjacent, so
+// `groups_block_` groups form one group of a convolution with
+// G / groups_block_ groups whose weights are block-diagonal. The weights are
+// packed into that shape at execution and the convolution is computed by the
+// brgemm convolution, which then fills the vector width with the channels of
+// several groups instead of calling a tiny GEMM per group.
+template <cpu_isa_t isa>
+struct brgemm_grouped_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_convolution_fwd_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , groups_block_(other.groups_block_)
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), brgemm_grouped_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+        // Number of groups packed into one group of the nested convolution.
+        dim_t groups_block_ = 0;
+
+    private:
+        std::string name_ = JIT_IMPL_NAME_HELPER("brg_conv_grp:", isa, "");
+
+        void init_name() {
+            name_.append("+");
+            name_.append(conv_pd_->name());
+        }
+    };
+
+    brgemm_grouped_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    void pack_weights(const exec_ctx_t &ctx, char *packed_wei) const;
+
+    std::shared_ptr<primitive_t> conv_p_;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
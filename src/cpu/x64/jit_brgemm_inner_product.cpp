@@ -147,34 +147,41 @@ status_t brgemm_inner_product_fwd_t<isa>::execute_forward(
         qsrc = scratchpad.template get<int8_t>(key_src_quantized);
         src_dscales = scratchpad.template get<float>(key_src_dequantized_scales);
 
-        int ic_groups = div_up(jbgp.ic, jbgp.src_quant_group_size);
+        const int group_size = jbgp.src_quant_group_size;
+        const int ic_groups = div_up(jbgp.ic, group_size);
         auto src_ptr = reinterpret_cast<const float*>(src);
-        auto qsrc_ptr = qsrc;
-        auto src_dscales_ptr = src_dscales;
-        int vec_loop_end = (ic_groups - 1) * jbgp.src_quant_group_size;
-
-        parallel_nd(jbgp.mb, [&](int mb) {
-            src_quantization_runtime_params_t rt_params = {};
-            rt_params.src_ptr = src_ptr + mb * jbgp.ic;
-            rt_params.qsrc_ptr = qsrc_ptr + mb * jbgp.ic;
-            rt_params.src_scales_ptr = src_dscales_ptr + mb * ic_groups;
-            rt_params.ic_size = vec_loop_end;
-            (*brg_src_quant_kernel_)(&rt_params);
-
-            if (vec_loop_end != jbgp.ic) {
-                float amax = 0;
-                for (int ic = vec_loop_end; ic < jbgp.ic; ic++) {
-                    amax = std::max(amax, std::abs(src_ptr[mb * jbgp.ic + ic]));
-                }
-
-                const float dscale = amax / 127;
-                const float qscale  = (dscale != 0) ? (1.0f / dscale) : 0;
 
-                src_dscales_ptr[mb * ic_groups + ic_groups - 1] = dscale;
-                for (int ic = vec_loop_end; ic < jbgp.ic; ic++) {
-                    qsrc_ptr[mb * jbgp.ic + ic] = std::round(src_ptr[mb * jbgp.ic + ic] * qscale);
-                }
+        // Groups are quantized independently, so parallelize over them as well
+        // to avoid a single-threaded pass over the source in the decode case
+        // where mb is 1.
+        parallel_nd(jbgp.mb, ic_groups, [&](dim_t mb, dim_t g) {
+            const dim_t ic_start = g * group_size;
+            const dim_t ic_end = nstl::min<dim_t>(ic_start + group_size, jbgp.ic);
+            const float *group_src = src_ptr + mb * jbgp.ic + ic_start;
+            int8_t *group_qsrc = qsrc + mb * jbgp.ic + ic_start;
+            float *group_dscale = src_dscales + mb * ic_groups + g;
+
+            if (ic_end - ic_start == group_size) {
+                src_quantization_runtime_params_t rt_params = {};
+                rt_params.src_ptr = group_src;
+                rt_params.qsrc_ptr = group_qsrc;
+                rt_params.src_scales_ptr = group_dscale;
+                rt_params.ic_size = group_size;
+                (*brg_src_quant_kernel_)(&rt_params);
+                return;
             }
+
+            // Partial last group
+            float amax = 0;
+            for (dim_t ic = 0; ic < ic_end - ic_start; ic++)
+                amax = std::max(amax, std::abs(group_src[ic]));
+
+            const float dscale = amax / 127;
+            const float qscale = (dscale != 0) ? (1.0f / dscale) : 0;
+
+            *group_dscale = dscale;
+            for (dim_t ic = 0; ic < ic_end - ic_start; ic++)
+                group_qsrc[ic] = std::round(group_src[ic] * qscale);
         });
 
         src = reinterpret_cast<const char *>(qsrc);
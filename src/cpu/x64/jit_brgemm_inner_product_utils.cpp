@@ -702,7 +702,11 @@ status_t jit_brgemm_ip_fwd_conf_t::init_conf(cpu_isa_t isa,
         auto min_ic_group_size = std::min(jbgp.wei_scales_ic_group_size, jbgp.wei_zero_points_ic_group_size);
         min_ic_group_size = std::min(min_ic_group_size, jbgp.src_quant_group_size);
         if ((jbgp.nb_ic_blocking * k_blk) % min_ic_group_size != 0) {
-            jbgp.nb_ic_blocking = 64;
+            // Round the blocking up so that K covers a whole number of groups
+            // for any group size, e.g. groups larger than 64 * k_blk.
+            const size_t nb_per_group = min_ic_group_size
+                    / math::gcd(static_cast<size_t>(k_blk), min_ic_group_size);
+            jbgp.nb_ic_blocking = static_cast<int>(rnd_up(64, nb_per_group));
         }
         jbgp.K = k_blk * jbgp.nb_ic_blocking;
         jbgp.gemm_batch_size = 1;
@@ -1454,7 +1458,13 @@ status_t jit_brgemm_ip_conf_t::init_conf_base(cpu_isa_t isa,
             jbgp.src_quant_group_size = attr.src_dyn_quant_params_.group_size_;
         }
 
-        if (jbgp.mb > 4 && !jbgp.with_src_dynamic_quant) {
+        // Immediate algorithm decompresses weights in brgemm kernel registers
+        // once per os block, while prepack materializes them in src data type
+        // and reads them back. Sub-byte weights grow 4-8x when prepacked, so
+        // the immediate algorithm stays memory-bound for larger batches.
+        const bool is_sub_byte_wei = one_of(jbgp.wei_dt, nf4, s4, u4, f4_e2m1);
+        const int max_mb_immediate = is_sub_byte_wei ? 16 : 4;
+        if (jbgp.mb > max_mb_immediate && !jbgp.with_src_dynamic_quant) {
             jbgp.wei_decomp_algo = weights_decomp_kind_t::prepack;
         }
 
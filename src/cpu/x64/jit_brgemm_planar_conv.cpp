@@ -0,0 +1,359 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_brgemm_planar_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_planar_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    const auto &cd = *desc();
+    const auto bia_type = cd.bias_desc.data_type;
+    const auto dat_tag = ndims() == 5 ? ncdhw : nchw;
+    const auto wei_tag = ndims() == 5 ? oidhw : oihw;
+
+    isa_ = avx512_core;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(expect_data_types(f32, f32, data_type::undef, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(one_of(bia_type, data_type::undef, f32),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(mayiuse(isa_), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(
+            attr()->has_default_values(primitive_attr_t::skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(one_of(ndims(), 4, 5), VERBOSE_BAD_NDIMS, "src", ndims());
+
+    const auto &po = attr()->post_ops_;
+    const int pool_idx = po.find(primitive_kind::pooling);
+    with_pooling_ = pool_idx != -1;
+    conv_post_ops_ = po;
+    if (with_pooling_) {
+        const auto &pool = po.entry_[pool_idx].pooling;
+        VDISPATCH_CONV(pool_idx == po.len() - 1, VERBOSE_UNSUPPORTED_POSTOP);
+        VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+        // The destination keeps the pooled shape.
+        VDISPATCH_CONV(OH() == pool.in_h / pool.ker_h, VERBOSE_INCONSISTENT_DIM,
+                "dst", (int)OH(), "pooling", (int)(pool.in_h / pool.ker_h));
+        VDISPATCH_CONV(OW() == pool.in_w / pool.ker_w, VERBOSE_INCONSISTENT_DIM,
+                "dst", (int)OW(), "pooling", (int)(pool.in_w / pool.ker_w));
+        // Only element-wise post-ops don't depend on the pre-pooling output
+        // layout.
+        for (int i = 0; i < pool_idx; i++)
+            VDISPATCH_CONV(
+                    po.entry_[i].is_eltwise(), VERBOSE_UNSUPPORTED_POSTOP);
+        pool_alg_ = pool.alg;
+        pool_kh_ = pool.ker_h;
+        pool_kw_ = pool.ker_w;
+        conv_post_ops_.entry_.pop_back();
+    }
+    VDISPATCH_CONV(ref_post_ops_t::primitive_kind_ok(conv_post_ops_)
+                    && conv_post_ops_.check_sum_consistency(f32, false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "grouped convolution");
+    // The single output channel case is served by the planar jit kernel.
+    VDISPATCH_CONV(OC() > 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "single output channel");
+
+    // Only planar layouts requested by the user are taken: with format any
+    // the blocked and channels-last implementations are preferred.
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, dat_tag)
+                    && memory_desc_matches_tag(dst_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(set_default_formats_common(dat_tag, wei_tag, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(weights_md_, wei_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    nthr_ = dnnl_get_max_threads();
+    K_ = IC() * KD() * KH() * KW();
+
+    // The column buffers of a thread (one per row of a pooling window) and
+    // the weights of an oc block are kept in half of L2.
+    const dim_t simd_w = 16;
+    const dim_t L2 = platform::get_per_core_cache_size(2);
+    oc_block_ = nstl::min<dim_t>(OC(), 64);
+    const dim_t L2_elems = L2 / 2 / (dim_t)sizeof(float);
+    const dim_t max_ow_block = (L2_elems - oc_block_ * K_) / (K_ * pool_kh_);
+    ow_block_ = saturate<dim_t>(
+            simd_w, 4 * simd_w, max_ow_block / simd_w * simd_w);
+    // A block covers whole pooling windows.
+    ow_block_ = nstl::min(ow_block_, OW() * pool_kw_);
+    ow_block_ = nstl::max(pool_kw_, ow_block_ / pool_kw_ * pool_kw_);
+
+    const dim_t oc_tail = OC() % oc_block_;
+    const dim_t ow_tail = OW() * pool_kw_ % ow_block_;
+    for_(int i_oc = 0; i_oc < 2; i_oc++)
+    for (int i_ow = 0; i_ow < 2; i_ow++) {
+        const dim_t M = i_oc ? oc_tail : oc_block_;
+        const dim_t N = i_ow ? ow_tail : ow_block_;
+        if (M == 0 || N == 0) continue;
+        auto &brg = brgs_[get_brg_idx(i_oc, i_ow)];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false,
+                false, brgemm_row_major, 1.f, 0.f, K_, ow_block_, ow_block_,
+                M, N, K_));
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.max_top_vpad = 0;
+        brgattr.max_bottom_vpad = 0;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void brgemm_planar_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(
+            key_conv_gemm_col, nthr_ * pool_kh_ * K_ * ow_block_);
+    scratchpad.book<float>(
+            key_brgemm_primitive_buffer, nthr_ * oc_block_ * ow_block_);
+    if (with_pooling_)
+        scratchpad.book<float>(
+                key_pool_reduction, nthr_ * oc_block_ * ow_block_ / pool_kw_);
+}
+
+status_t brgemm_planar_convolution_fwd_t::init(engine_t *engine) {
+    const dim_t oc_tail = pd()->OC() % pd()->oc_block_;
+    const dim_t ow_tail = pd()->OW() * pd()->pool_kw_ % pd()->ow_block_;
+    for_(int i_oc = 0; i_oc < 2; i_oc++)
+    for (int i_ow = 0; i_ow < 2; i_ow++) {
+        if ((i_oc && oc_tail == 0) || (i_ow && ow_tail == 0)) continue;
+        const int idx = pd_t::get_brg_idx(i_oc, i_ow);
+        brgemm_kernel_t *brg_kernel = nullptr;
+        CHECK(brgemm_kernel_create(&brg_kernel, pd()->brgs_[idx]));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], brg_kernel));
+    }
+
+    ref_post_ops_ = utils::make_unique<ref_post_ops_t>(pd()->conv_post_ops_);
+    if (!ref_post_ops_) return status::out_of_memory;
+    return ref_post_ops_->init(pd()->dst_md());
+}
+
+status_t brgemm_planar_convolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *col_global = scratchpad.get<float>(key_conv_gemm_col);
+    float *acc_global = scratchpad.get<float>(key_brgemm_primitive_buffer);
+    float *pool_global = scratchpad.get<float>(key_pool_reduction);
+
+    const dim_t MB = pd()->MB();
+    const dim_t IC = pd()->IC();
+    const dim_t OC = pd()->OC();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t KD = pd()->KD();
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+    const dim_t SD = pd()->KSD();
+    const dim_t SH = pd()->KSH();
+    const dim_t SW = pd()->KSW();
+    const dim_t DD = pd()->KDD() + 1;
+    const dim_t DH = pd()->KDH() + 1;
+    const dim_t DW = pd()->KDW() + 1;
+    const dim_t FP = pd()->padFront();
+    const dim_t TP = pd()->padT();
+    const dim_t LP = pd()->padL();
+    const dim_t K = pd()->K_;
+    const dim_t oc_block = pd()->oc_block_;
+    const dim_t ow_block = pd()->ow_block_;
+    const bool with_pooling = pd()->with_pooling_;
+    const bool is_max_pool = pd()->pool_alg_ == alg_kind::pooling_max;
+    const dim_t pool_kh = pd()->pool_kh_;
+    const dim_t pool_kw = pd()->pool_kw_;
+    const float pool_scale = 1.f / (pool_kh * pool_kw);
+    const dim_t pool_ow_block = ow_block / pool_kw;
+    // Width of the convolution output, before pooling.
+    const dim_t conv_OW = OW * pool_kw;
+    const dim_t nb_oc = div_up(OC, oc_block);
+    const dim_t nb_ow = div_up(conv_OW, ow_block);
+
+    const dim_t src_c_sz = ID * IH * IW;
+    const dim_t dst_c_sz = OD * OH * OW;
+    const bool with_post_ops = pd()->conv_post_ops_.len() > 0;
+
+    // Unrolls the source of the output pixels of row conv_oh into
+    // col[k][ow], where k follows the oi(d)hw order of the weights.
+    auto im2col = [&](float *col, dim_t n, dim_t od, dim_t conv_oh, dim_t ow0,
+                          dim_t cur_ow) {
+        for_(dim_t ic = 0; ic < IC; ic++)
+        for_(dim_t kd = 0; kd < KD; kd++)
+        for (dim_t kh = 0; kh < KH; kh++) {
+            const dim_t id = od * SD - FP + kd * DD;
+            const dim_t ih = conv_oh * SH - TP + kh * DH;
+            const bool row_ok = id >= 0 && id < ID && ih >= 0 && ih < IH;
+            float *c_row = col + ((ic * KD + kd) * KH + kh) * KW * ow_block;
+            if (!row_ok) {
+                std::fill_n(c_row, KW * ow_block, 0.f);
+                continue;
+            }
+            const float *s
+                    = src + (n * IC + ic) * src_c_sz + (id * IH + ih) * IW;
+            for (dim_t kw = 0; kw < KW; kw++) {
+                float *c = c_row + kw * ow_block;
+                const dim_t iw0 = ow0 * SW - LP + kw * DW;
+                PRAGMA_OMP_SIMD()
+                for (dim_t j = 0; j < cur_ow; j++) {
+                    const dim_t iw = iw0 + j * SW;
+                    c[j] = (iw >= 0 && iw < IW) ? s[iw] : 0.f;
+                }
+            }
+        }
+    };
+
+    const dim_t work_amount = MB * OD * OH * nb_ow;
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *col = col_global + ithr * pool_kh * K * ow_block;
+        float *acc = acc_global + ithr * oc_block * ow_block;
+        float *pool = with_pooling
+                ? pool_global + ithr * oc_block * pool_ow_block
+                : nullptr;
+
+        dim_t n {0}, od {0}, oh {0}, owb {0};
+        nd_iterator_init(start, n, MB, od, OD, oh, OH, owb, nb_ow);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t ow0 = owb * ow_block;
+            const dim_t cur_ow = nstl::min(ow_block, conv_OW - ow0);
+
+            // Without pooling this is the single output row oh, with pooling
+            // these are the pool_kh rows reduced into the pooled row oh.
+            for (dim_t r = 0; r < pool_kh; r++)
+                im2col(col + r * K * ow_block, n, od, oh * pool_kh + r, ow0,
+                        cur_ow);
+
+            for (dim_t ocb = 0; ocb < nb_oc; ocb++) {
+                const dim_t oc0 = ocb * oc_block;
+                const dim_t cur_oc = nstl::min(oc_block, OC - oc0);
+                const int brg_idx = pd_t::get_brg_idx(
+                        cur_oc < oc_block, cur_ow < ow_block);
+
+                for (dim_t r = 0; r < pool_kh; r++) {
+                    brgemm_batch_element_t batch;
+                    batch.ptr.A = wei + oc0 * K;
+                    batch.ptr.B = col + r * K * ow_block;
+                    brgemm_kernel_execute(
+                            brg_kernels_[brg_idx].get(), 1, &batch, acc);
+
+                    for (dim_t oc = 0; oc < cur_oc; oc++) {
+                        const float b = bias ? bias[oc0 + oc] : 0.f;
+                        const float *a = acc + oc * ow_block;
+                        if (with_pooling) {
+                            float *p = pool + oc * pool_ow_block;
+                            for (dim_t j = 0; j < cur_ow; j++) {
+                                float res = a[j] + b;
+                                // Only element-wise post-ops precede the
+                                // pooling, they don't use the offsets.
+                                if (with_post_ops)
+                                    ref_post_ops_->execute(
+                                            res, ref_post_ops_t::args_t());
+                                float &v = p[j / pool_kw];
+                                if (r == 0 && j % pool_kw == 0)
+                                    v = res;
+                                else
+                                    v = is_max_pool ? nstl::max(v, res)
+                                                    : v + res;
+                            }
+                            continue;
+                        }
+                        const dim_t dst_off = (n * OC + oc0 + oc) * dst_c_sz
+                                + (od * OH + oh) * OW + ow0;
+                        float *d = dst + dst_off;
+                        if (!with_post_ops) {
+                            PRAGMA_OMP_SIMD()
+                            for (dim_t j = 0; j < cur_ow; j++)
+                                d[j] = a[j] + b;
+                            continue;
+                        }
+                        for (dim_t j = 0; j < cur_ow; j++) {
+                            float res = a[j] + b;
+                            // The destination is dense, so the physical
+                            // offset is the logical one.
+                            ref_post_ops_t::args_t args;
+                            args.dst_val = d[j];
+                            args.ctx = &ctx;
+                            args.l_offset = dst_off + j;
+                            args.dst_md = pd()->dst_md();
+                            ref_post_ops_->execute(res, args, oc0 + oc);
+                            d[j] = res;
+                        }
+                    }
+                }
+                if (!with_pooling) continue;
+
+                const dim_t pow0 = ow0 / pool_kw;
+                const dim_t cur_pow = cur_ow / pool_kw;
+                for (dim_t oc = 0; oc < cur_oc; oc++) {
+                    const float *p = pool + oc * pool_ow_block;
+                    float *d = dst + (n * OC + oc0 + oc) * dst_c_sz
+                            + (od * OH + oh) * OW + pow0;
+                    if (is_max_pool) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t j = 0; j < cur_pow; j++)
+                            d[j] = p[j];
+                    } else {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t j = 0; j < cur_pow; j++)
+                            d[j] = p[j] * pool_scale;
+                    }
+                }
+            }
+            nd_iterator_step(n, MB, od, OD, oh, OH, owb, nb_ow);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_PLANAR_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_PLANAR_CONV_HPP
+
+#include <memory>
+
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Forward convolution working directly on planar (nchw/ncdhw) source and
+// destination. For every output row a block of output pixels is unrolled
+// into a column buffer [ic][kd][kh][kw][ow] that matches the oi(d)hw
+// weights, so a single brgemm call computes an oc block x ow block piece of
+// the row: rows of A are output channels, columns of B and C are output
+// pixels, which are contiguous in the planar destination.
+//
+// With a pooling post-op the rows of one pooling window are computed for an
+// oc block and reduced in a small tile before the pooled row is written, so
+// the pre-pooling output never reaches memory.
+struct brgemm_planar_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_planar:", isa_, ""),
+                brgemm_planar_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        static int get_brg_idx(bool is_oc_tail, bool is_ow_tail) {
+            return 2 * (int)is_oc_tail + (int)is_ow_tail;
+        }
+
+        cpu_isa_t isa_ = isa_undef;
+        int nthr_ = 0;
+        dim_t oc_block_ = 0;
+        dim_t ow_block_ = 0;
+        // Reduction size: ic * kd * kh * kw.
+        dim_t K_ = 0;
+        // Descriptors for full and tail blocks by oc and ow.
+        brgemm_desc_t brgs_[4];
+        // Pooling post-op: non-overlapping pool_kh_ x pool_kw_ windows.
+        bool with_pooling_ = false;
+        alg_kind_t pool_alg_ = alg_kind::undef;
+        dim_t pool_kh_ = 1;
+        dim_t pool_kw_ = 1;
+        // Post-ops applied to the convolution output before pooling.
+        post_ops_t conv_post_ops_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    brgemm_planar_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
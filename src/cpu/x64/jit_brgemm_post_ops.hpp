@@ -394,8 +394,10 @@ struct jit_brgemm_kernel_post_ops : public jit_generator {
             const auto &reserved_eltwise_gpr = reg_reserved_eltwise;
             const auto reserved_eltwise_maskr = Xbyak::Opmask(1);
 
-            const eltwise_injector::static_params_t esp {
+            eltwise_injector::static_params_t esp {
                     save_state, reserved_eltwise_gpr, reserved_eltwise_maskr};
+            esp.fast_approx = eltwise_injector::is_fast_approx_allowed(
+                    attr.fpmath_.mode_);
 
             postops_injector_ = utils::make_unique<
                     injector::jit_uni_postops_injector_t<po_isa_t>>(
@@ -99,6 +99,10 @@ void jit_brgemm_weights_decompression_kernel_t<isa>::load_weights(Vmm vmm_load,
             break;
         }
         case data_type::u4: {
+            if (jcp_.ic_internal_size == 1) {
+                load_int4_plain(vmm_load, addr, false);
+                break;
+            }
             uni_vpmovzxbd(vmm_load, addr);
             if (ic % 2 == 0) {
                 uni_vpsrld(vmm_load, vmm_load, 4);
@@ -110,6 +114,10 @@ void jit_brgemm_weights_decompression_kernel_t<isa>::load_weights(Vmm vmm_load,
             break;
         }
         case data_type::s4: {
+            if (jcp_.ic_internal_size == 1) {
+                load_int4_plain(vmm_load, addr, true);
+                break;
+            }
             uni_vpmovsxbd(vmm_load, addr);
             if (ic % 2 == 0) {
                 vpsrad(vmm_load, vmm_load, 4);
@@ -180,6 +188,37 @@ void jit_brgemm_weights_decompression_kernel_t<isa>::load_weights(Vmm vmm_load,
     }
 }
 
+// Loads consecutive int4 elements stored two per byte, the even element in the
+// low half of the byte.
+template <cpu_isa_t isa>
+void jit_brgemm_weights_decompression_kernel_t<isa>::load_int4_plain(Vmm vmm_load, const Xbyak::Address& addr, bool is_signed) {
+    assert(vmm_load.getIdx() == vmm_weights(0).getIdx());
+    auto xmm_load = Xmm(vmm_load.getIdx());
+    auto xmm_aux = Xmm(vmm_weights(1).getIdx());
+    auto xmm_mask = Xmm(vmm_weights(2).getIdx());
+    // Spread the bytes over words, so that the low half of a byte lands in
+    // the low byte of the word and the high half in the high byte.
+    if (vec_size == 16)
+        vmovq(xmm_load, addr);
+    else
+        vmovd(xmm_load, addr);
+    vpmovzxbw(xmm_load, xmm_load);
+    vpsllw(xmm_aux, xmm_load, 4);
+    mov(reg_tmp.cvt32(), 0x0f000f00);
+    vmovd(xmm_mask, reg_tmp.cvt32());
+    vpbroadcastd(xmm_mask, xmm_mask);
+    vpand(xmm_aux, xmm_aux, xmm_mask);
+    vpsrlw(xmm_mask, xmm_mask, 8);
+    vpand(xmm_load, xmm_load, xmm_mask);
+    vpor(xmm_load, xmm_load, xmm_aux);
+    vpmovzxbd(vmm_load, xmm_load);
+    if (is_signed) {
+        uni_vpslld(vmm_load, vmm_load, 28);
+        vpsrad(vmm_load, vmm_load, 28);
+    }
+    uni_vcvtdq2ps(vmm_load, vmm_load);
+}
+
 template <cpu_isa_t isa>
 void jit_brgemm_weights_decompression_kernel_t<isa>::store_weights(const Xbyak::Address& addr, Vmm vmm_store) {
     switch (jcp_.decomp_buffer_dt) {
@@ -278,14 +317,21 @@ void jit_brgemm_weights_decompression_kernel_t<isa>::generate() {
         }
     }
 
-    if (jcp_.with_scales)
+    size_t oc_blocks_num = div_up(jcp_.oc_size, vec_size);
+    // Scales and zero points of wide rows don't fit into registers and are
+    // read from memory for every row instead.
+    const bool params_in_regs = oc_blocks_num <= unroll_factor;
+    assert(IMPLICATION(!params_in_regs,
+            jcp_.ic_internal_size == 1
+                    && IMPLICATION(jcp_.with_scales, !jcp_.broadcast_scales && jcp_.scales_dt == data_type::f32)
+                    && IMPLICATION(jcp_.with_zero_points, !jcp_.broadcast_zero_points && jcp_.zero_points_dt == data_type::f32)));
+
+    if (jcp_.with_scales && params_in_regs)
         init_decomp_params(std::bind(&jit_brgemm_weights_decompression_kernel_t::vmm_scales, this, _1), reg_scales, jcp_.broadcast_scales, jcp_.scales_dt);
 
-    if (jcp_.with_zero_points)
+    if (jcp_.with_zero_points && params_in_regs)
         init_decomp_params(std::bind(&jit_brgemm_weights_decompression_kernel_t::vmm_zero_points, this, _1), reg_zero_points, jcp_.broadcast_zero_points, jcp_.zero_points_dt);
 
-    size_t oc_blocks_num = div_up(jcp_.oc_size, vec_size);
-
     Xbyak::Label ic_loop_label;
     Xbyak::Label ic_end_label;
 
@@ -298,7 +344,7 @@ void jit_brgemm_weights_decompression_kernel_t<isa>::generate() {
         cmp(reg_ic_size, 1);
         jl(ic_end_label, T_NEAR);
 
-        if (jcp_.decomp_buffer_dt == data_type::bf16) {
+        if (jcp_.decomp_buffer_dt == data_type::bf16 && jcp_.ic_internal_size == 2) {
             for (size_t ocb = 0; ocb < oc_blocks_num; ocb++) {
                 for (size_t ic = 0; ic < jcp_.ic_internal_size; ic++) {
                     size_t weights_offset;
@@ -342,10 +388,18 @@ void jit_brgemm_weights_decompression_kernel_t<isa>::generate() {
                     const auto weights_addr = ptr[reg_weights + weights_offset];
                     load_weights(vmm_weights(0), weights_addr, ic);
 
-                    if (jcp_.with_zero_points)
-                        uni_vsubps(vmm_weights(0), vmm_weights(0), vmm_zero_points(ocb));
-                    if (jcp_.with_scales)
-                        uni_vmulps(vmm_weights(0), vmm_weights(0), vmm_scales(ocb));
+                    if (jcp_.with_zero_points) {
+                        if (params_in_regs)
+                            uni_vsubps(vmm_weights(0), vmm_weights(0), vmm_zero_points(ocb));
+                        else
+                            uni_vsubps(vmm_weights(0), vmm_weights(0), ptr[reg_zero_points + ocb * vec_size * sizeof(float)]);
+                    }
+                    if (jcp_.with_scales) {
+                        if (params_in_regs)
+                            uni_vmulps(vmm_weights(0), vmm_weights(0), vmm_scales(ocb));
+                        else
+                            uni_vmulps(vmm_weights(0), vmm_weights(0), ptr[reg_scales + ocb * vec_size * sizeof(float)]);
+                    }
 
                     size_t decomp_buffer_offset = (ic * jcp_.oc_size + ocb * vec_size) * decomp_buf_dt_size;
                     const auto decomp_buffer_addr = ptr[reg_decomp_buffer + decomp_buffer_offset];
@@ -36,6 +36,9 @@ struct weights_decompression_compile_params_t {
     bool broadcast_scales;
     bool broadcast_zero_points;
     size_t oc_size;
+    // The number of input channels interleaved in a row of oc_size output
+    // channels. When it is 1, int4 weights are expected in the plain order,
+    // two consecutive elements of a row per byte.
     size_t ic_internal_size;
     data_type_t weights_dt;
     data_type_t decomp_buffer_dt;
@@ -84,6 +87,7 @@ private:
     void generate() override;
     void init_decomp_params(std::function<Vmm(int)> vmm_params, Xbyak::Reg64 reg_params, bool broadcast_values, data_type_t element_type);
     void load_weights(Vmm vmm_load, const Xbyak::Address& addr, int ic);
+    void load_int4_plain(Vmm vmm_load, const Xbyak::Address& addr, bool is_signed);
     void store_weights(const Xbyak::Address& addr, Vmm vmm_store);
 
     Vmm vmm_scales(int ocb) {
@@ -0,0 +1,365 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+constexpr int tile_size = brgemm_wino_convolution_fwd_t::pd_t::tile_size;
+constexpr int alpha = brgemm_wino_convolution_fwd_t::pd_t::alpha;
+constexpr int n_wino = brgemm_wino_convolution_fwd_t::pd_t::n_wino;
+// Number of channels transformed at once; the inner loops are vectorized
+// along channels.
+constexpr int simd_w = 16;
+
+// Transform matrices of F(4x4, 3x3): Y = AT * [(G g GT) . (BT d B)] * A.
+const float BT[alpha][alpha] = {
+        {4.f, 0.f, -5.f, 0.f, 1.f, 0.f},
+        {0.f, -4.f, -4.f, 1.f, 1.f, 0.f},
+        {0.f, 4.f, -4.f, -1.f, 1.f, 0.f},
+        {0.f, -2.f, -1.f, 2.f, 1.f, 0.f},
+        {0.f, 2.f, -1.f, -2.f, 1.f, 0.f},
+        {0.f, 4.f, 0.f, -5.f, 0.f, 1.f},
+};
+
+const float G[alpha][3] = {
+        {1.f / 4, 0.f, 0.f},
+        {-1.f / 6, -1.f / 6, -1.f / 6},
+        {-1.f / 6, 1.f / 6, -1.f / 6},
+        {1.f / 24, 1.f / 12, 1.f / 6},
+        {1.f / 24, -1.f / 12, 1.f / 6},
+        {0.f, 0.f, 1.f},
+};
+
+const float AT[tile_size][alpha] = {
+        {1.f, 1.f, 1.f, 1.f, 1.f, 0.f},
+        {0.f, 1.f, -1.f, 2.f, -2.f, 0.f},
+        {0.f, 1.f, 1.f, 4.f, 4.f, 0.f},
+        {0.f, 1.f, -1.f, 8.f, -8.f, 1.f},
+};
+
+// Computes out = L * in * RT for `len` channels, where L and R are
+// `rows x cols` matrices and `in` is a `cols x cols` tile.
+template <int rows, int cols>
+void transform_tile(const float (&L)[rows][cols], const float (&R)[rows][cols],
+        const float (&in)[cols][cols][simd_w], float (&out)[rows][rows][simd_w],
+        int len) {
+    float tmp[rows][cols][simd_w];
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < cols; j++) {
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < len; v++) {
+                float acc = 0.f;
+                for (int k = 0; k < cols; k++)
+                    acc += L[i][k] * in[k][j][v];
+                tmp[i][j][v] = acc;
+            }
+        }
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < rows; j++) {
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < len; v++) {
+                float acc = 0.f;
+                for (int k = 0; k < cols; k++)
+                    acc += tmp[i][k][v] * R[j][k];
+                out[i][j][v] = acc;
+            }
+        }
+}
+
+} // namespace
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    const auto &cd = *desc();
+    const auto bia_type = cd.bias_desc.data_type;
+
+    isa_ = avx512_core;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    // Winograd changes the numerics of the convolution, so this
+    // implementation is only used when the algorithm is requested explicitly.
+    VDISPATCH_CONV(cd.alg_kind == alg_kind::convolution_winograd,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(expect_data_types(f32, f32, data_type::undef, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(one_of(bia_type, data_type::undef, f32),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(mayiuse(isa_), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "grouped convolution");
+    VDISPATCH_CONV(KH() == 3 && KW() == 3, VERBOSE_UNSUPPORTED_FEATURE,
+            "kernel size other than 3x3");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "non-unit strides");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations");
+    VDISPATCH_CONV(everyone_is(true, padT() <= 1, padB() <= 1, padL() <= 1,
+                           padR() <= 1),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "padding larger than 1");
+
+    VDISPATCH_CONV(set_default_formats_common(nhwc, hwio, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, nhwc)
+                    && memory_desc_matches_tag(dst_md_, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_wrapper(weights_md_).is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    nthr_ = dnnl_get_max_threads();
+    n_tiles_h_ = div_up(OH(), tile_size);
+    n_tiles_w_ = div_up(OW(), tile_size);
+
+    // Keep the transformed source and the brgemm output of a tile block in
+    // half of L2, but leave enough blocks to load all the threads.
+    const dim_t n_tiles = MB() * n_tiles_h_ * n_tiles_w_;
+    const dim_t L2 = platform::get_per_core_cache_size(2);
+    const dim_t tile_bytes = n_wino * (IC() + OC()) * sizeof(float);
+    tile_block_ = saturate<dim_t>(1, 32, L2 / 2 / tile_bytes);
+    tile_block_ = nstl::min(tile_block_, div_up(n_tiles, nthr_));
+
+    CHECK(brgemm_desc_init(&brg_, isa_, brgemm_addr, f32, f32, false, false,
+            brgemm_row_major, 1.f, 0.f, IC(), OC(), OC(), tile_block_, OC(),
+            IC()));
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    brgattr.max_top_vpad = 0;
+    brgattr.max_bottom_vpad = 0;
+    CHECK(brgemm_desc_set_attr(&brg_, brgattr));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(key_wino_U, n_wino * IC() * OC());
+    scratchpad.book<float>(key_wino_V, nthr_ * n_wino * tile_block_ * IC());
+    scratchpad.book<float>(key_wino_M, nthr_ * n_wino * tile_block_ * OC());
+}
+
+status_t brgemm_wino_convolution_fwd_t::init(engine_t *engine) {
+    brgemm_kernel_t *brg_kernel = nullptr;
+    CHECK(brgemm_kernel_create(&brg_kernel, pd()->brg_));
+    CHECK(safe_ptr_assign(brg_kernel_, brg_kernel));
+    return status::success;
+}
+
+// Transforms the weights as U[k][ic][oc] = (G * g(oc, ic) * GT)[k].
+void brgemm_wino_convolution_fwd_t::transform_weights(
+        const exec_ctx_t &ctx, float *wino_wei) const {
+    const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const dim_t IC = pd()->IC();
+    const dim_t OC = pd()->OC();
+    const dim_t nb_oc = div_up(OC, simd_w);
+
+    parallel_nd(IC, nb_oc, [&](dim_t ic, dim_t ocb) {
+        const dim_t oc0 = ocb * simd_w;
+        const int len = (int)nstl::min<dim_t>(simd_w, OC - oc0);
+
+        float g[3][3][simd_w];
+        for (int kh = 0; kh < 3; kh++)
+            for (int kw = 0; kw < 3; kw++)
+                for (int v = 0; v < len; v++)
+                    g[kh][kw][v]
+                            = weights[weights_d.off(oc0 + v, ic, kh, kw)];
+
+        float u[alpha][alpha][simd_w];
+        transform_tile(G, G, g, u, len);
+
+        for (int k = 0; k < n_wino; k++) {
+            float *U = wino_wei + (k * IC + ic) * OC + oc0;
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < len; v++)
+                U[v] = u[k / alpha][k % alpha][v];
+        }
+    });
+}
+
+status_t brgemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *wino_wei = scratchpad.get<float>(key_wino_U);
+    float *wino_src = scratchpad.get<float>(key_wino_V);
+    float *wino_dst = scratchpad.get<float>(key_wino_M);
+
+    transform_weights(ctx, wino_wei);
+
+    const dim_t MB = pd()->MB();
+    const dim_t IC = pd()->IC();
+    const dim_t OC = pd()->OC();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t t_pad = pd()->padT();
+    const dim_t l_pad = pd()->padL();
+    const dim_t n_tiles_h = pd()->n_tiles_h_;
+    const dim_t n_tiles_w = pd()->n_tiles_w_;
+    const dim_t tile_block = pd()->tile_block_;
+    const dim_t n_tiles = MB * n_tiles_h * n_tiles_w;
+    const dim_t n_blocks = div_up(n_tiles, tile_block);
+
+    const dim_t V_size = n_wino * tile_block * IC;
+    const dim_t M_size = n_wino * tile_block * OC;
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(n_blocks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *V = wino_src + ithr * V_size;
+        float *M = wino_dst + ithr * M_size;
+
+        for (dim_t blk = start; blk < end; blk++) {
+            const dim_t tile_start = blk * tile_block;
+            const dim_t cur_tiles
+                    = nstl::min(tile_block, n_tiles - tile_start);
+
+            // Source transform: V[k][t][ic] = (BT * d(t, ic) * B)[k].
+            for (dim_t t = 0; t < tile_block; t++) {
+                if (t >= cur_tiles) {
+                    for (int k = 0; k < n_wino; k++)
+                        std::fill_n(V + (k * tile_block + t) * IC, IC, 0.f);
+                    continue;
+                }
+                dim_t n {0}, th {0}, tw {0};
+                nd_iterator_init(tile_start + t, n, MB, th, n_tiles_h, tw,
+                        n_tiles_w);
+                const dim_t ih0 = th * tile_size - t_pad;
+                const dim_t iw0 = tw * tile_size - l_pad;
+
+                for (dim_t ic0 = 0; ic0 < IC; ic0 += simd_w) {
+                    const int len = (int)nstl::min<dim_t>(simd_w, IC - ic0);
+
+                    float d[alpha][alpha][simd_w];
+                    for (int i = 0; i < alpha; i++)
+                        for (int j = 0; j < alpha; j++) {
+                            const dim_t ih = ih0 + i;
+                            const dim_t iw = iw0 + j;
+                            if (ih < 0 || ih >= IH || iw < 0 || iw >= IW) {
+                                for (int v = 0; v < len; v++)
+                                    d[i][j][v] = 0.f;
+                                continue;
+                            }
+                            const float *s
+                                    = src + src_d.blk_off(n, ic0, ih, iw);
+                            PRAGMA_OMP_SIMD()
+                            for (int v = 0; v < len; v++)
+                                d[i][j][v] = s[v];
+                        }
+
+                    float w[alpha][alpha][simd_w];
+                    transform_tile(BT, BT, d, w, len);
+
+                    for (int k = 0; k < n_wino; k++) {
+                        float *v_ptr = V + (k * tile_block + t) * IC + ic0;
+                        PRAGMA_OMP_SIMD()
+                        for (int v = 0; v < len; v++)
+                            v_ptr[v] = w[k / alpha][k % alpha][v];
+                    }
+                }
+            }
+
+            // M[k] = V[k] * U[k] for every Winograd point k.
+            for (int k = 0; k < n_wino; k++) {
+                brgemm_batch_element_t batch;
+                batch.ptr.A = V + k * tile_block * IC;
+                batch.ptr.B = wino_wei + k * IC * OC;
+                brgemm_kernel_execute(
+                        brg_kernel_.get(), 1, &batch, M + k * tile_block * OC);
+            }
+
+            // Destination transform: y(t, oc) = AT * M(t, oc) * A.
+            for (dim_t t = 0; t < cur_tiles; t++) {
+                dim_t n {0}, th {0}, tw {0};
+                nd_iterator_init(tile_start + t, n, MB, th, n_tiles_h, tw,
+                        n_tiles_w);
+                const dim_t oh0 = th * tile_size;
+                const dim_t ow0 = tw * tile_size;
+
+                for (dim_t oc0 = 0; oc0 < OC; oc0 += simd_w) {
+                    const int len = (int)nstl::min<dim_t>(simd_w, OC - oc0);
+
+                    float m[alpha][alpha][simd_w];
+                    for (int k = 0; k < n_wino; k++) {
+                        const float *m_ptr
+                                = M + (k * tile_block + t) * OC + oc0;
+                        PRAGMA_OMP_SIMD()
+                        for (int v = 0; v < len; v++)
+                            m[k / alpha][k % alpha][v] = m_ptr[v];
+                    }
+
+                    float y[tile_size][tile_size][simd_w];
+                    transform_tile(AT, AT, m, y, len);
+
+                    for (int i = 0; i < tile_size; i++)
+                        for (int j = 0; j < tile_size; j++) {
+                            const dim_t oh = oh0 + i;
+                            const dim_t ow = ow0 + j;
+                            if (oh >= OH || ow >= OW) continue;
+                            float *d_ptr
+                                    = dst + dst_d.blk_off(n, oc0, oh, ow);
+                            const float *b_ptr = bias
+                                    ? bias + bias_d.blk_off(oc0)
+                                    : nullptr;
+                            PRAGMA_OMP_SIMD()
+                            for (int v = 0; v < len; v++)
+                                d_ptr[v] = y[i][j][v]
+                                        + (b_ptr ? b_ptr[v] : 0.f);
+                        }
+                }
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
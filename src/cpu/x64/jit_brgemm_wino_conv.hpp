@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(4x4, 3x3) forward convolution. Every 4x4 output tile is computed
+// from a 6x6 input tile: the input and weights are transformed into the
+// Winograd domain, the 36 element-wise products become 36 independent GEMMs
+// (tiles x IC by IC x OC) computed with brgemm, and the results are
+// transformed back.
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_wino:", isa_, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        static constexpr int tile_size = 4;
+        static constexpr int alpha = tile_size + 2;
+        static constexpr int n_wino = alpha * alpha;
+
+        cpu_isa_t isa_ = isa_undef;
+        int nthr_ = 0;
+        dim_t n_tiles_h_ = 0;
+        dim_t n_tiles_w_ = 0;
+        // Number of tiles processed by one brgemm call (M dimension).
+        dim_t tile_block_ = 0;
+        brgemm_desc_t brg_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    void transform_weights(const exec_ctx_t &ctx, float *wino_wei) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernel_;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,10 +17,13 @@
 #ifndef CPU_X64_JIT_GENERATOR_HPP
 #define CPU_X64_JIT_GENERATOR_HPP
 
+#include <cstring>
 #include <limits.h>
+#include <utility>
 #include <vector>
 
 #include "common/bit_cast.hpp"
+#include "common/cache_blob.hpp"
 #include "common/compiler_workarounds.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -2817,7 +2820,17 @@ public:
 
     void register_jit_code(const Xbyak::uint8 *code, size_t code_size) const {
         dump_debug_traces(code, code_size);
-        jit_utils::register_jit_code(code, code_size, name(), source_file());
+        jit_utils::register_jit_code(
+                code, code_size, name(), source_file(), code_regions_);
+    }
+
+    // Marks the start of a named region of the kernel (e.g. "k_loop" or
+    // "post_ops") at the current position. The region lasts until the next
+    // mark or the end of the kernel and is reported to Linux perf. @p name
+    // must be a string literal.
+    void annotate(const char *name) {
+        if (!jit_utils::need_code_regions()) return;
+        code_regions_.push_back({getSize(), name});
     }
 
     const Xbyak::uint8 *jit_ker() const { return jit_ker_; }
@@ -2838,8 +2851,73 @@ public:
         return (jit_ker_) ? status::success : status::runtime_error;
     }
 
+    // Re-materializes the kernel from the code previously stored by
+    // `get_cache_blob()`. The `generate()` call is skipped and absolute label
+    // addresses are relocated to the new code buffer. Only kernels that don't
+    // embed other host addresses may be restored this way.
+    status_t create_kernel_from_cache_blob(cache_blob_t cache_blob) {
+        int err_code = Xbyak::GetError();
+        if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
+        if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
+        if (!cache_blob || getSize() != 0) return status::runtime_error;
+
+        const uint8_t *code = nullptr;
+        size_t code_size = 0;
+        CHECK(cache_blob.get_binary(&code, &code_size));
+        size_t n_relocs = 0;
+        CHECK(cache_blob.get_value((uint8_t *)&n_relocs, sizeof(n_relocs)));
+
+        db(code, code_size);
+        for (size_t i = 0; i < n_relocs; i++) {
+            size_t code_offset = 0, label_offset = 0;
+            CHECK(cache_blob.get_value(
+                    (uint8_t *)&code_offset, sizeof(code_offset)));
+            CHECK(cache_blob.get_value(
+                    (uint8_t *)&label_offset, sizeof(label_offset)));
+            if (code_offset + sizeof(size_t) > code_size
+                    || label_offset > code_size)
+                return status::runtime_error;
+            save(code_offset, label_offset, sizeof(size_t),
+                    Xbyak::inner::LaddTop);
+        }
+        jit_ker_ = getCode();
+        return (jit_ker_) ? status::success : status::runtime_error;
+    }
+
+    // Xbyak doesn't expose the absolute label addresses it has written, so
+    // they are found by comparing the code with `twin`, the same kernel
+    // generated into another buffer: such addresses are the only difference.
+    status_t get_cache_blob_size(
+            size_t *size, const jit_generator &twin) const {
+        if (!size) return status::invalid_arguments;
+        std::vector<std::pair<size_t, size_t>> relocs;
+        CHECK(find_label_relocations(twin, relocs));
+        // The binary is prefixed by its size when packed.
+        (*size) += sizeof(size_t) + getSize() + sizeof(size_t)
+                + relocs.size() * 2 * sizeof(size_t);
+        return status::success;
+    }
+
+    status_t get_cache_blob(
+            cache_blob_t &cache_blob, const jit_generator &twin) const {
+        std::vector<std::pair<size_t, size_t>> relocs;
+        CHECK(find_label_relocations(twin, relocs));
+        CHECK(cache_blob.add_binary(jit_ker_, getSize()));
+        const size_t n_relocs = relocs.size();
+        CHECK(cache_blob.add_value(
+                (const uint8_t *)&n_relocs, sizeof(n_relocs)));
+        for (const auto &r : relocs) {
+            CHECK(cache_blob.add_value(
+                    (const uint8_t *)&r.first, sizeof(r.first)));
+            CHECK(cache_blob.add_value(
+                    (const uint8_t *)&r.second, sizeof(r.second)));
+        }
+        return status::success;
+    }
+
 private:
     const cpu_isa_t max_cpu_isa_;
+    std::vector<jit_utils::code_region_t> code_regions_;
     const Xbyak::uint8 *getCode() {
         this->ready();
         if (!is_initialized()) return nullptr;
@@ -2856,6 +2934,44 @@ private:
         return Xbyak::GetError() == Xbyak::ERR_NONE;
     }
 
+    // Returns {code offset, label offset} pairs for every absolute label
+    // address in the code.
+    status_t find_label_relocations(const jit_generator &twin,
+            std::vector<std::pair<size_t, size_t>> &relocs) const {
+        const size_t size = getSize();
+        if (!jit_ker_ || !twin.jit_ker_ || twin.getSize() != size)
+            return status::runtime_error;
+
+        const size_t top = reinterpret_cast<size_t>(jit_ker_);
+        const size_t twin_top = reinterpret_cast<size_t>(twin.jit_ker_);
+        const size_t addr_len = sizeof(size_t);
+        size_t i = 0;
+        while (i < size) {
+            if (jit_ker_[i] == twin.jit_ker_[i]) {
+                i++;
+                continue;
+            }
+            bool found = false;
+            const size_t start = i >= addr_len - 1 ? i - (addr_len - 1) : 0;
+            for (size_t off = start; off <= i && off + addr_len <= size;
+                    off++) {
+                size_t addr = 0, twin_addr = 0;
+                std::memcpy(&addr, jit_ker_ + off, addr_len);
+                std::memcpy(&twin_addr, twin.jit_ker_ + off, addr_len);
+                const bool is_label_addr = addr >= top && addr <= top + size
+                        && twin_addr - twin_top == addr - top;
+                if (!is_label_addr) continue;
+                relocs.emplace_back(off, addr - top);
+                i = off + addr_len;
+                found = true;
+                break;
+            }
+            // The code depends on something other than its own address.
+            if (!found) return status::unimplemented;
+        }
+        return status::success;
+    }
+
 protected:
     virtual void generate() = 0;
     const Xbyak::uint8 *jit_ker_ = nullptr;
@@ -564,6 +564,9 @@ struct jit_pool_conf_t {
     bool with_binary;
     bool with_depthwise;
     bool with_quantization;
+    bool with_dst_scale;
+    // channel blocks are distributed among threads at runtime
+    bool split_c;
     int nthr;
     memory_desc_t tmp_md;
 };
@@ -916,6 +919,8 @@ struct jit_binary_conf_t {
     bool is_i8 = false;
     bool is_bf16 = false;
     bool is_f16 = false;
+    // f16 values are computed without conversion to f32
+    bool use_native_f16 = false;
     bool is_src_different_layouts = false;
     dim_t outer_dims = 1;
     int src1_stride = 1;
@@ -951,6 +956,13 @@ struct jit_reduction_conf_t {
 
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
+    // Number of elements the mean is computed over. It differs from
+    // reduce_size for the kernel combining partial results.
+    dim_t mean_size = 0;
+    // The reduced dimension is split into nchunks parts of chunk_size
+    // elements when idle_size alone does not occupy all the threads.
+    dim_t nchunks = 1;
+    dim_t chunk_size = 0;
 
     bool is_saturation_needed = false;
 
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <math.h>
 #include <functional>
 
 #include "common/c_types_map.hpp"
@@ -362,6 +363,11 @@ struct jit_bnorm_t : public jit_generator {
         return is_bf16_ && isa == avx512_core && !mayiuse(avx512_core_bf16);
     }
 
+    // With global stats the driver folds mean, variance, scale and shift into
+    // a per-channel multiplier and bias passed via `scale` and `shift`, so the
+    // kernel computes dst = src * alpha + beta.
+    bool use_folded_stats() { return pd_->is_fwd() && pd_->stats_is_src(); }
+
     bool stream_store_supported() {
         // keep original behavior for f32
         if (!is_xf16()) return true;
@@ -964,7 +970,11 @@ struct jit_bnorm_t : public jit_generator {
 
             // pre-compute scale for each channel to avoid costly div and sqrt
             // merge variances in interleaved to plain layout if needed
-            for (int idx = 0; idx < num_ch_blks; idx += 2) {
+            for (int idx = 0; use_folded_stats() && idx < num_ch_blks; ++idx)
+                uni_vmovups_maybe_tail(
+                        Vmm(idx + num_ch_blks), gamma_ptr(idx * vlen));
+            for (int idx = 0; !use_folded_stats() && idx < num_ch_blks;
+                    idx += 2) {
                 const int coff_base = idx * vlen;
                 const bool is_ch_blks_tail = num_ch_blks - idx < 2;
                 const Vmm vvar_even = Vmm(idx);
@@ -1033,19 +1043,24 @@ struct jit_bnorm_t : public jit_generator {
                     const int offt = idx * vlen_spat_data_;
                     const Vmm vdata = Vmm(idx);
                     const Vmm vscale = Vmm(idx + num_ch_blks);
-                    uni_vmovups_maybe_tail(vmean, mean_ptr(coff));
+                    const bool with_shift
+                            = pd_->use_shift() || use_folded_stats();
+                    if (!use_folded_stats())
+                        uni_vmovups_maybe_tail(vmean, mean_ptr(coff));
 
-                    if (pd_->use_shift()) {
+                    if (with_shift) {
                         uni_vmovups_maybe_tail(vbeta, beta_ptr(coff));
                     }
 
                     if (!is_avx2_ne_xf16_)
                         uni_vmovups_spat_data(
                                 vdata, vmmword[reg_src + reg_soff_nspc + offt]);
-                    if (IMPLICATION(is_avx2_ne_xf16_, pd_->stats_is_src()))
+                    if (!use_folded_stats()
+                            && IMPLICATION(
+                                    is_avx2_ne_xf16_, pd_->stats_is_src()))
                         uni_vsubps(vdata, vdata, vmean);
 
-                    if (pd_->use_shift()) {
+                    if (with_shift) {
                         // --flags=S,CH,H
                         uni_vfmadd213ps(vdata, vscale, vbeta);
                     } else {
@@ -1325,25 +1340,32 @@ struct jit_bnorm_t : public jit_generator {
         Label ch_label;
         L(ch_label);
         {
-            uni_vmovups_maybe_tail(vmean, mean_ptr());
-            uni_vmovups_maybe_tail(vsqrtvar, var_ptr());
-            uni_vaddps(vsqrtvar, vsqrtvar, veps);
-            uni_vsqrtps(vsqrtvar, vsqrtvar);
-
-            if (pd_->use_scale()) {
+            if (use_folded_stats()) {
                 uni_vmovups_maybe_tail(vgamma, gamma_ptr());
-            }
-            if (pd_->use_shift()) { uni_vmovups_maybe_tail(vbeta, beta_ptr()); }
+                uni_vmovups_maybe_tail(vbeta, beta_ptr());
+            } else {
+                uni_vmovups_maybe_tail(vmean, mean_ptr());
+                uni_vmovups_maybe_tail(vsqrtvar, var_ptr());
+                uni_vaddps(vsqrtvar, vsqrtvar, veps);
+                uni_vsqrtps(vsqrtvar, vsqrtvar);
 
-            Vmm vscale = (pd_->use_scale()) ? vgamma : vone;
-            Vmm vdiv = (pd_->use_scale()) ? vgamma : vsqrtvar;
+                if (pd_->use_scale()) {
+                    uni_vmovups_maybe_tail(vgamma, gamma_ptr());
+                }
+                if (pd_->use_shift()) {
+                    uni_vmovups_maybe_tail(vbeta, beta_ptr());
+                }
 
-            if (isa == sse41) {
-                movups(vtmp, vscale);
-                divps(vtmp, vsqrtvar);
-                movups(vdiv, vtmp);
-            } else {
-                vdivps(vdiv, vscale, vsqrtvar);
+                Vmm vscale = (pd_->use_scale()) ? vgamma : vone;
+                Vmm vdiv = (pd_->use_scale()) ? vgamma : vsqrtvar;
+
+                if (isa == sse41) {
+                    movups(vtmp, vscale);
+                    divps(vtmp, vsqrtvar);
+                    movups(vdiv, vtmp);
+                } else {
+                    vdivps(vdiv, vscale, vsqrtvar);
+                }
             }
 
             const auto spat_loop_init_fin
@@ -1354,9 +1376,10 @@ struct jit_bnorm_t : public jit_generator {
                 const Vmm v = Vmm(base_reg);
                 const size_t offt = i * vlen_spat_data_;
                 uni_vmovups_spat_data(v, vmmword[reg_src + reg_soff + offt]);
-                uni_vsubps(v, v, vmean);
-                if ((pd_->use_scale() && pd_->use_shift())) {
-                    // --flags=CH
+                if (!use_folded_stats()) uni_vsubps(v, v, vmean);
+                if (use_folded_stats()
+                        || (pd_->use_scale() && pd_->use_shift())) {
+                    // --flags=CH or folded global stats
                     uni_vfmadd213ps(v, vgamma, vbeta);
                 } else if (pd_->use_scale()) {
                     // --flags=C
@@ -2140,7 +2163,8 @@ struct driver_t : public c_compatible {
             const batch_normalization_pd_t *pd, int nthr) {
         dim_t C_PADDED = get_c_padded(pd);
 
-        auto sbuf_sz = use_tmp_stats(pd) * 2 * C_PADDED;
+        auto sbuf_sz
+                = (use_tmp_stats(pd) || use_folded_stats(pd)) * 2 * C_PADDED;
         auto pbuf_sz
                 = (use_tmp_diff_scale(pd) + use_tmp_diff_shift(pd)) * C_PADDED;
         auto rbuf_sz = (pd->is_fwd() ? 1 : 2) * C_PADDED * nthr;
@@ -2255,8 +2279,13 @@ struct driver_t : public c_compatible {
             if (tmp_mean != nullptr) p.mean = tmp_mean + coff_base;
             const auto tmp_var = use_tmp_stats(pd_) ? sbuf + C_PADDED : var;
             if (tmp_var != nullptr) p.var = tmp_var + coff_base;
-            if (scale != nullptr) p.scale = scale + coff_base;
-            if (shift != nullptr) p.shift = shift + coff_base;
+            if (use_folded_stats(pd_)) {
+                p.scale = sbuf + coff_base;
+                p.shift = sbuf + C_PADDED + coff_base;
+            } else {
+                if (scale != nullptr) p.scale = scale + coff_base;
+                if (shift != nullptr) p.shift = shift + coff_base;
+            }
             const auto tmp_diff_scale
                     = use_tmp_diff_scale(pd_) ? pbuf : diff_scale;
             if (tmp_diff_scale != nullptr)
@@ -2300,6 +2329,32 @@ struct driver_t : public c_compatible {
         }
     }
 
+    // Folds global mean and variance together with scale and shift into
+    // a per-channel multiplier and bias consumed by the kernel. Padded
+    // channels are zeroed so that full-vector loads stay well-defined.
+    void fold_stats(const acc_data_t *scale, const acc_data_t *shift,
+            const acc_data_t *mean, const acc_data_t *var,
+            const memory_tracking::grantor_t &scratchpad) const {
+        if (!use_folded_stats(pd_)) return;
+
+        auto sbuf = scratchpad.get<acc_data_t>(key_bnorm_tmp_stats);
+        const dim_t C = pd_->C();
+        const dim_t C_PADDED = get_c_padded(pd_);
+        const float eps = pd_->desc()->batch_norm_epsilon;
+        acc_data_t *alpha = sbuf;
+        acc_data_t *beta = sbuf + C_PADDED;
+
+        parallel_nd(C_PADDED, [&](dim_t c) {
+            if (c >= C) {
+                alpha[c] = beta[c] = 0.f;
+                return;
+            }
+            const float sm = (scale ? scale[c] : 1.f) / sqrtf(var[c] + eps);
+            alpha[c] = sm;
+            beta[c] = (shift ? shift[c] : 0.f) - mean[c] * sm;
+        });
+    }
+
     void init_barriers(const memory_tracking::grantor_t &scratchpad) {
         auto barriers = scratchpad.get<barrier::ctx_64_t>(key_barrier);
         if (barriers) {
@@ -2323,6 +2378,10 @@ private:
                 && pd->desc()->prop_kind == prop_kind::forward_inference;
     }
 
+    static bool use_folded_stats(const batch_normalization_pd_t *pd) {
+        return pd->is_fwd() && pd->stats_is_src();
+    }
+
     static bool use_tmp_diff_scale(const batch_normalization_pd_t *pd) {
         return (!pd->is_fwd() && !pd->use_scale())
                 || pd->desc()->prop_kind == prop_kind::backward_data;
@@ -2467,6 +2526,7 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     bnorm_driver_->init_barriers(scratchpad);
+    bnorm_driver_->fold_stats(scale, shift, mean, var, scratchpad);
     const int nthr = pd()->nthr_;
 
     parallel(nthr, [&](const int ithr, const int nthr) {
@@ -123,6 +123,18 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
     conf_.is_i8 = utils::one_of(conf_.dst_type, s8, u8);
 
     conf_.isa = get_supported_isa();
+    // Binary is memory-bound, use Ymm registers if they are preferred and
+    // support the problem.
+    if (is_superset(conf_.isa, avx512_core)
+            && prefer_ymm(attr()->cpu_isa_hints_,
+                    /* is_memory_bound = */ true)) {
+        const cpu_isa_t ymm_isa = mayiuse(avx2_vnni_2) ? avx2_vnni_2 : avx2;
+        if (mayiuse(ymm_isa) && data_type_supported(conf_.dst_type, ymm_isa)
+                && data_type_supported(conf_.src0_type, ymm_isa)
+                && data_type_supported(conf_.src1_type, ymm_isa)
+                && data_format_supported(src0_md_, ymm_isa))
+            conf_.isa = ymm_isa;
+    }
 
     VDISPATCH_BINARY(data_type_supported(conf_.dst_type, conf_.isa),
             VERBOSE_ISA_DT_MISMATCH);
@@ -200,6 +212,21 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
                             && conf_.bcast_type == bcast_t::per_w));
     conf_.use_stride_rhs_postops = conf_.postops_per_oc_broadcast_exists
             && conf_.op_type == op_t::n_spatial_c;
+    // Plain f16 problems without scales and post-ops are computed on packed
+    // halves. Each of the algorithms below is correctly rounded in f16, so the
+    // result is the same as the one of the f32 computation rounded to f16.
+    conf_.use_native_f16 = is_superset(conf_.isa, avx512_core_fp16)
+            && utils::everyone_is(
+                    f16, conf_.src0_type, conf_.src1_type, conf_.dst_type)
+            && !conf_.with_postops && !conf_.do_scale_src0
+            && !conf_.do_scale_src1 && conf_.op_type != op_t::c_blocked
+            && !conf_.is_src_different_layouts
+            && utils::one_of(
+                    conf_.bcast_type, bcast_t::none, bcast_t::per_batch)
+            && utils::one_of(desc()->alg_kind, alg_kind::binary_add,
+                    alg_kind::binary_sub, alg_kind::binary_mul,
+                    alg_kind::binary_div, alg_kind::binary_max,
+                    alg_kind::binary_min);
 
     const auto ndims = src0_md_.ndims();
     if (conf_.is_src_different_layouts) {
@@ -788,10 +815,17 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
 
         const bool point_broadcast = bcast_type == bcast_t::scalar;
 
+        parallel_cost_t cost;
+        cost.bytes = nelems0
+                * (src0_type_size + dst_type_size
+                        + (point_broadcast ? 0 : src1_type_size));
+        cost.ops = nelems0;
+        const int nthr = adjust_num_threads(0, nelems0_simd + has_tail, cost);
+
         // Compute strategy:
         // Compute number of vectors, divide it equally between all threads.
         // Last one will also handle a tail if present.
-        parallel(0, [&](const int ithr, const int nthr) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
             dim_t start = 0, end = 0;
             balance211(nelems0_simd + has_tail, nthr, ithr, start, end);
             if (start >= end) return;
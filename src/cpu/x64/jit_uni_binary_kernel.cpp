@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_uni_binary_kernel.hpp"
@@ -43,7 +44,8 @@ binary_kernel_t::binary_kernel_t(const size_t vlen, const binary_pd_t *pd,
         const jit_binary_conf_t conf, const char *name, bool tail_kernel)
     : jit_generator(name)
     , vlen_(vlen)
-    , simd_w_(vlen / sizeof(float))
+    , simd_w_(vlen
+              / (conf.use_native_f16 ? sizeof(float16_t) : sizeof(float)))
     , pd_(pd)
     , conf_(conf)
     , is_tail_kernel_(tail_kernel)
@@ -324,10 +326,36 @@ void jit_uni_binary_kernel_t<isa, Vmm>::perform_op(
         assert(!"not supported operation!");
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_kernel_t<isa, Vmm>::perform_native_f16_op(
+        const Vmm &v0, const Vmm &v1) {
+    using namespace alg_kind;
+    const auto alg = pd_->desc()->alg_kind;
+    if (alg == binary_add)
+        vaddph(v0, v0, v1);
+    else if (alg == binary_mul)
+        vmulph(v0, v0, v1);
+    else if (alg == binary_max)
+        vmaxph(v0, v0, v1);
+    else if (alg == binary_min)
+        vminph(v0, v0, v1);
+    else if (alg == binary_div)
+        vdivph(v0, v0, v1);
+    else if (alg == binary_sub)
+        vsubph(v0, v0, v1);
+    else
+        assert(!"not supported operation!");
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_kernel_t<isa, Vmm>::prepare_isa_kernel() {
     if (conf_.is_bf16) io_.init_bf16();
-    if (tail_size_ > 0) io_.prepare_tail_mask();
+    if (conf_.use_native_f16 && tail_size_ > 0) {
+        // io_ helper sets 16 mask bits at most, f16 vectors hold up to 32
+        mov(reg_tmp_.cvt32(), (1u << tail_size_) - 1);
+        kmovd(tail_opmask_, reg_tmp_.cvt32());
+    } else if (tail_size_ > 0)
+        io_.prepare_tail_mask();
     if (conf_.is_src_different_layouts && is_superset(isa, avx2)) {
         io_.init_full_mask();
         io_.prepare_full_mask();
@@ -383,6 +411,18 @@ void jit_uni_binary_kernel_t<isa, Vmm>::load_src1(
 
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_kernel_t<isa, Vmm>::store(int unroll, bool tail) {
+    if (conf_.use_native_f16) {
+        for (int i = 0; i < unroll; i++) {
+            const Vmm vreg_tmp_src0 = Vmm(i + vmm_start_idx_);
+            const auto addr = dst_ptr(simd_w_ * i * sizeof(float16_t));
+            if (tail)
+                vmovdqu16(addr | tail_opmask_, vreg_tmp_src0);
+            else
+                vmovdqu16(addr, vreg_tmp_src0);
+        }
+        return;
+    }
+
     for (int i = 0; i < unroll; i++) {
         const Vmm vreg_tmp_src0 = Vmm(i + vmm_start_idx_);
         const int offt = simd_w_ * i;
@@ -500,6 +540,24 @@ void jit_uni_binary_kernel_t<isa, Vmm>::compute_ne_xf16_dst_body(
     }
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_kernel_t<isa, Vmm>::compute_native_f16_dst_body(
+        int unroll, bool tail) {
+    for (int i = 0; i < unroll; i++) {
+        const Vmm vreg_tmp_src0 = Vmm(i + vmm_start_idx_);
+        const Vmm vreg_tmp_src1 = Vmm(unroll + i + vmm_start_idx_);
+        const int offt = simd_w_ * i * sizeof(float16_t);
+        if (tail) {
+            vmovdqu16(vreg_tmp_src0 | tail_opmask_ | T_z, src0_ptr(offt));
+            vmovdqu16(vreg_tmp_src1 | tail_opmask_ | T_z, src1_ptr(offt));
+        } else {
+            vmovdqu16(vreg_tmp_src0, src0_ptr(offt));
+            vmovdqu16(vreg_tmp_src1, src1_ptr(offt));
+        }
+        perform_native_f16_op(vreg_tmp_src0, vreg_tmp_src1);
+    }
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_kernel_t<isa, Vmm>::compute_dst_body(
         int unroll, bool tail) {
@@ -526,6 +584,12 @@ void jit_uni_binary_kernel_t<isa, Vmm>::compute_dst_body(
 
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_kernel_t<isa, Vmm>::compute_dst(int unroll, bool tail) {
+    if (conf_.use_native_f16) {
+        compute_native_f16_dst_body(unroll, tail);
+        store(unroll, tail);
+        return;
+    }
+
     // When src1 supports but src0 does not support ne convert instructions
     // we only call compute_ne_xf16_dst_body() when loading src1 is needed
     if (!tail
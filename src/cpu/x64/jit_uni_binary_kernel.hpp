@@ -138,11 +138,13 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     unsigned int cmp_predicate(alg_kind_t alg);
     void perform_op(
             const Vmm &v0, const Vmm &v1, const Vmm &s_src0, const Vmm &s_src1);
+    void perform_native_f16_op(const Vmm &v0, const Vmm &v1);
     void prepare_isa_kernel();
     void compute_bcast(bool tail);
     void load_src1(const Vmm &vreg_src1, const int offt, bool tail);
     void store(int unroll, bool tail);
     void compute_ne_xf16_dst_body(int unroll, bool tail);
+    void compute_native_f16_dst_body(int unroll, bool tail);
     void compute_dst_body(int unroll, bool tail);
     void compute_dst(int unroll, bool tail);
     void forward();
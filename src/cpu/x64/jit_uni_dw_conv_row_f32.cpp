@@ -94,7 +94,7 @@ void jit_uni_dw_conv_row_f32<isa>::apply_filter(int ur_w, int kw_size) {
             load_ker(vmm_ker, ptr[aux_reg_kernel + ker_off * jcp.typesize_in]);
 
             for (int ow = 0; ow < ur_w; ow++) {
-                int inp_off = ow * stride_w * ch_blk + kw * ch_blk + i*(jcp.ch_block / 2);
+                int inp_off = ow * stride_w * iw_stride_ + kw * iw_stride_ + i*(jcp.ch_block / 2);
 
                 Vmm vmm_src = get_src_reg(0);
                 load_src(vmm_src, ptr[aux_reg_input0 + inp_off * jcp.typesize_in]);
@@ -116,7 +116,7 @@ void jit_uni_dw_conv_row_f32<isa>::apply_filter(int ur_w, int kw_size) {
             load_ker(vmm_ker, ptr[aux_reg_kernel + ker_off * jcp.typesize_in]);
 
             for (int ow = 0; ow < ur_w; ow++) {
-                int inp_off = ow * stride_w * ch_blk + kw * ch_blk + i*(jcp.ch_block / 2);
+                int inp_off = ow * stride_w * iw_stride_ + kw * iw_stride_ + i*(jcp.ch_block / 2);
 
                 Vmm vmm_src = get_src_reg(0);
                 load_src(vmm_src, ptr[aux_reg_input1 + inp_off * jcp.typesize_in]);
@@ -138,7 +138,7 @@ void jit_uni_dw_conv_row_f32<isa>::apply_filter(int ur_w, int kw_size) {
             load_ker(vmm_ker, ptr[aux_reg_kernel + ker_off * jcp.typesize_in]);
 
             for (int ow = 0; ow < ur_w; ow++) {
-                int inp_off = ow * stride_w * ch_blk + kw * ch_blk + i*(jcp.ch_block / 2);
+                int inp_off = ow * stride_w * iw_stride_ + kw * iw_stride_ + i*(jcp.ch_block / 2);
 
                 Vmm vmm_src = get_src_reg(0);
                 load_src(vmm_src, ptr[aux_reg_input2 + inp_off * jcp.typesize_in]);
@@ -449,9 +449,9 @@ void jit_uni_dw_conv_row_f32<isa>::loop_body(int oc_step) {
         apply_postprocessing(ur_w, oc_step);
         store_dst(ur_w, oc_step);
 
-        add(reg_input0, jcp.typesize_in * ur_w * jcp.ch_block * (jcp.stride_w-1));
-        add(reg_input1, jcp.typesize_in * ur_w * jcp.ch_block * (jcp.stride_w-1));
-        add(reg_input2, jcp.typesize_in * ur_w * jcp.ch_block * (jcp.stride_w-1));
+        add(reg_input0, jcp.typesize_in * ur_w * iw_stride_ * (jcp.stride_w-1));
+        add(reg_input1, jcp.typesize_in * ur_w * iw_stride_ * (jcp.stride_w-1));
+        add(reg_input2, jcp.typesize_in * ur_w * iw_stride_ * (jcp.stride_w-1));
         add(reg_output, jcp.typesize_out * ur_w * output_step);
 
         sub(reg_ur_w, ur_w);
@@ -474,9 +474,9 @@ void jit_uni_dw_conv_row_f32<isa>::loop_body(int oc_step) {
         apply_postprocessing(ur_w, oc_step);
         store_dst(ur_w, oc_step);
 
-        add(reg_input0, jcp.typesize_in * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_input1, jcp.typesize_in * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_input2, jcp.typesize_in * ur_w * jcp.ch_block * jcp.stride_w);
+        add(reg_input0, jcp.typesize_in * ur_w * iw_stride_ * jcp.stride_w);
+        add(reg_input1, jcp.typesize_in * ur_w * iw_stride_ * jcp.stride_w);
+        add(reg_input2, jcp.typesize_in * ur_w * iw_stride_ * jcp.stride_w);
         add(reg_output, jcp.typesize_out * ur_w * output_step);
 
         sub(reg_ur_w, ur_w);
@@ -503,9 +503,9 @@ void jit_uni_dw_conv_row_f32<isa>::loop_body(int oc_step) {
         apply_postprocessing(ur_w, oc_step);
         store_dst(ur_w, oc_step);
 
-        add(reg_input0, jcp.typesize_in * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_input1, jcp.typesize_in * ur_w * jcp.ch_block * jcp.stride_w);
-        add(reg_input2, jcp.typesize_in * ur_w * jcp.ch_block * jcp.stride_w);
+        add(reg_input0, jcp.typesize_in * ur_w * iw_stride_ * jcp.stride_w);
+        add(reg_input1, jcp.typesize_in * ur_w * iw_stride_ * jcp.stride_w);
+        add(reg_input2, jcp.typesize_in * ur_w * iw_stride_ * jcp.stride_w);
         add(reg_output, jcp.typesize_out * ur_w * output_step);
 
         sub(reg_ur_w, ur_w);
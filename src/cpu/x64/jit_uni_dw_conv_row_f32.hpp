@@ -46,8 +46,11 @@ template <cpu_isa_t isa>
 struct jit_uni_dw_conv_row_f32: public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_dw_conv_row_f32)
 
-    jit_uni_dw_conv_row_f32(jit_conv_conf_t ajcp, const primitive_attr_t &attr, int ow_stride)
-            : jit_generator(jit_name()), jcp(ajcp), attr_(attr), ow_stride_(ow_stride) {}
+    // iw_stride is the distance between two input pixels in the row
+    // buffers, defaults to ch_block (blocked row buffers).
+    jit_uni_dw_conv_row_f32(jit_conv_conf_t ajcp, const primitive_attr_t &attr, int ow_stride, int iw_stride = 0)
+            : jit_generator(jit_name()), jcp(ajcp), attr_(attr), ow_stride_(ow_stride)
+            , iw_stride_(iw_stride > 0 ? iw_stride : ajcp.ch_block) {}
 
     ~jit_uni_dw_conv_row_f32() {
         for (auto inj : eltwise_injectors)
@@ -70,6 +73,7 @@ struct jit_uni_dw_conv_row_f32: public jit_generator {
     jit_conv_conf_t jcp;
     const primitive_attr_t &attr_;
     int ow_stride_;
+    int iw_stride_;
 
 private:
     using Vmm = typename utils::conditional3<isa == sse41, Xbyak::Xmm,
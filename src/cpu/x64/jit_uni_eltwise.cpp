@@ -17,6 +17,7 @@
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
@@ -66,6 +67,39 @@ protected:
                 ? avx512_core_bf16
                 : isa;
     }
+
+    // Forward f16 algorithms which can be computed directly on packed halves
+    // with avx512_core_fp16 arithmetic instead of going through f32. Max/min,
+    // abs and squaring produce the same values as the f32 path rounded back
+    // to f16, and so does scaling by an alpha which is exact in f16. Other
+    // constants get rounded to f16, which is only allowed by a fpmath mode
+    // permitting f16 down-conversion.
+    bool use_native_f16(cpu_isa_t isa) const {
+        using namespace alg_kind;
+        if (!(is_superset(isa, avx512_core_fp16) && is_f16() && pd_->is_fwd()))
+            return false;
+
+        const auto &desc = *pd_->desc();
+        const auto is_f16_exact = [](float v) {
+            return static_cast<float>(float16_t(v)) == v;
+        };
+        const auto mode = pd_->attr()->fpmath_.mode_;
+        const bool f16_allowed
+                = utils::one_of(mode, fpmath_mode::f16, fpmath_mode::any);
+        switch (desc.alg_kind) {
+            case eltwise_relu:
+            case eltwise_relu_use_dst_for_bwd:
+                return desc.alpha == 0.f || is_f16_exact(desc.alpha)
+                        || f16_allowed;
+            case eltwise_abs:
+            case eltwise_square:
+            case eltwise_clip:
+            case eltwise_clip_v2:
+            case eltwise_clip_v2_use_dst_for_bwd: return true;
+            case eltwise_linear: return f16_allowed;
+            default: return false;
+        }
+    }
 };
 
 // jit kernels
@@ -76,19 +110,28 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
 
     jit_uni_kernel_t(const eltwise_pd_t *pd)
         : jit_uni_eltwise_kernel(pd, jit_name())
-        , vlen_(is_bf16() || is_f16() ? cpu_isa_traits<isa>::vlen / 2
-                                      : cpu_isa_traits<isa>::vlen)
+        , use_native_f16_(use_native_f16(isa))
+        , vlen_((is_bf16() || is_f16()) && !use_native_f16_
+                          ? cpu_isa_traits<isa>::vlen / 2
+                          : cpu_isa_traits<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , use_nt_stores_(is_fwd_
+                  && io::use_nt_stores(
+                          memory_desc_wrapper(pd_->dst_md()).size())) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
         // using the first 7 vregs can be considered volatile during the call
         // to eltwise injector
         const bool save_state = is_fwd_ ? false : true;
+        const bool fast_approx = eltwise_injector::is_fast_approx_allowed(
+                pd_->attr()->fpmath_.mode_);
         eltwise_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
                 desc.alg_kind, desc.alpha, desc.beta, 1.f, save_state,
-                reg_injector_table, injector_mask, is_fwd_, pd_->use_dst()));
+                reg_injector_table, injector_mask, is_fwd_, pd_->use_dst(),
+                /* preserve_vmm = */ true, /* preserve_p_table = */ true,
+                fast_approx));
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, tail_size_, tail_opmask_idx_,
                 vmm_tail_mask.getIdx(), reg_tmp);
@@ -97,16 +140,125 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
                 bf16_emu_zmm_4_idx_);
         io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, get_io_isa(isa),
                 {data_type()}, io_conf, io_tail_conf, io_bf16_conf);
+        // Non-temporal stores can't process tails, full vectors only
+        if (use_nt_stores_)
+            io_nt_ = io::jit_io_multi_dt_helper_t<Vmm>(this, get_io_isa(isa),
+                    {data_type()}, io::io_conf_t(true), io_tail_conf,
+                    io_bf16_conf);
+    }
+
+    void store_dst(const typename cpu_isa_traits<isa>::Vmm &vmm,
+            const Address &addr, const bool tail) {
+        const auto &io = use_nt_stores_ && !tail ? io_nt_ : io_;
+        io[data_type()]->store(vmm, addr, tail);
+    }
+
+    void prepare_native_f16_consts() {
+        using namespace alg_kind;
+        const auto &desc = *pd_->desc();
+        const auto broadcast_f16 = [&](const Xmm &vmm, float v) {
+            mov(reg_tmp.cvt16(), float16_t(v).raw);
+            vpbroadcastw(vmm, reg_tmp.cvt16());
+        };
+
+        switch (desc.alg_kind) {
+            case eltwise_relu:
+            case eltwise_relu_use_dst_for_bwd:
+                uni_vpxor(vmm_f16_zero, vmm_f16_zero, vmm_f16_zero);
+                if (desc.alpha != 0.f) broadcast_f16(vmm_f16_alpha, desc.alpha);
+                break;
+            case eltwise_abs:
+                mov(reg_tmp.cvt16(), 0x7fff);
+                vpbroadcastw(vmm_f16_alpha, reg_tmp.cvt16());
+                break;
+            case eltwise_clip:
+            case eltwise_clip_v2:
+            case eltwise_clip_v2_use_dst_for_bwd:
+            case eltwise_linear:
+                broadcast_f16(vmm_f16_alpha, desc.alpha);
+                broadcast_f16(vmm_f16_beta, desc.beta);
+                break;
+            default: break;
+        }
+    }
+
+    void compute_native_f16(const typename cpu_isa_traits<isa>::Vmm &vmm) {
+        using namespace alg_kind;
+        const auto &desc = *pd_->desc();
+        switch (desc.alg_kind) {
+            case eltwise_relu:
+            case eltwise_relu_use_dst_for_bwd:
+                if (desc.alpha == 0.f)
+                    vmaxph(vmm, vmm, vmm_f16_zero);
+                else {
+                    // -0 is scaled as well to keep the sign of alpha * -0
+                    vcmpph(native_f16_mask, vmm, vmm_f16_zero, _cmp_le_os);
+                    vmulph(vmm | native_f16_mask, vmm, vmm_f16_alpha);
+                }
+                break;
+            case eltwise_abs: vpandd(vmm, vmm, vmm_f16_alpha); break;
+            case eltwise_square: vmulph(vmm, vmm, vmm); break;
+            case eltwise_clip:
+            case eltwise_clip_v2:
+            case eltwise_clip_v2_use_dst_for_bwd:
+                vmaxph(vmm, vmm, vmm_f16_alpha);
+                vminph(vmm, vmm, vmm_f16_beta);
+                break;
+            case eltwise_linear:
+                vfmadd213ph(vmm, vmm_f16_alpha, vmm_f16_beta);
+                break;
+            default: assert(!"unsupported native f16 algorithm");
+        }
+    }
+
+    void compute_native_f16_dst(const bool tail) {
+        const auto vmm_src_masked = tail
+                ? vmm_src | Opmask(tail_opmask_idx_) | T_z
+                : vmm_src;
+        vmovdqu16(vmm_src_masked, ptr[reg_src]);
+        compute_native_f16(vmm_src);
+        if (tail)
+            vmovdqu16(ptr[reg_dst] | Opmask(tail_opmask_idx_), vmm_src);
+        else if (use_nt_stores_)
+            vmovntdq(ptr[reg_dst], vmm_src);
+        else
+            vmovdqu16(ptr[reg_dst], vmm_src);
     }
 
     void compute_dst(const bool tail) {
+        if (use_native_f16_) {
+            compute_native_f16_dst(tail);
+            return;
+        }
         io_[data_type()]->load(ptr[reg_src], vmm_src, tail);
         eltwise_injector_->compute_vector(vmm_src.getIdx());
         if (!is_fwd_) {
             io_[data_type()]->load(ptr[reg_diff_dst], vmm_diff_dst, tail);
             uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
         }
-        io_[data_type()]->store(vmm_src, ptr[reg_dst], tail);
+        store_dst(vmm_src, ptr[reg_dst], tail);
+    }
+
+    // Non-temporal stores require the destination to be aligned on the vector
+    // width, so elements are processed one by one until it is.
+    void align_dst() {
+        Label align_loop, aligned;
+
+        L(align_loop);
+        {
+            test(reg_dst, vlen_ - 1);
+            jz(aligned, T_NEAR);
+            cmp(reg_work_amount, 0);
+            jle(aligned, T_NEAR);
+
+            compute_dst(true);
+            add(reg_src, dtype_size());
+            add(reg_dst, dtype_size());
+
+            dec(reg_work_amount);
+            jmp(align_loop, T_NEAR);
+        }
+        L(aligned);
     }
 
     void compute_two_simdw_xf16_dst(const bool tail) {
@@ -126,7 +278,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
                     = i == 0 ? vmm_diff_dst_even : vmm_diff_dst_odd;
             eltwise_injector_->compute_vector(vsrc.getIdx());
             if (!is_fwd_) uni_vmulps(vsrc, vsrc, vdiff_dst);
-            io_[data_type()]->store(vsrc, ptr[reg_dst + i * vlen_], tail);
+            store_dst(vsrc, ptr[reg_dst + i * vlen_], tail);
         }
     }
 
@@ -151,6 +303,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
     }
 
     void compute() {
+        if (use_nt_stores_) align_dst();
+
         // Compute two simdw at once in vectorized loop first
         // when ne_convert instructions is available for xf16
         if (isa == avx2_vnni_2 && (is_bf16() || is_f16()))
@@ -194,6 +348,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
 
         io_.prepare_tail_mask();
         if (is_bf16()) io_.init_bf16();
+        if (use_native_f16_) prepare_native_f16_consts();
 
         Reg64 param = abi_param1;
         mov(reg_src, ptr[param + GET_OFF(src)]);
@@ -214,6 +369,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // perspective and will complicate the compute logic significantly.
         compute();
 
+        // Make non-temporal stores visible to other threads
+        if (use_nt_stores_) sfence();
+
         postamble();
 
         eltwise_injector_->prepare_table();
@@ -222,9 +380,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
 private:
     using Vmm = typename cpu_isa_traits<isa>::Vmm;
 
+    const bool use_native_f16_;
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    const bool use_nt_stores_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
@@ -248,8 +408,14 @@ private:
     Vmm vmm_src_odd = Vmm(8);
     Vmm vmm_diff_dst_even = vmm_diff_dst;
     Vmm vmm_diff_dst_odd = Vmm(9);
+    // constants for the native f16 path, it does not call the injector
+    Vmm vmm_f16_zero = Vmm(4);
+    Vmm vmm_f16_alpha = Vmm(5);
+    Vmm vmm_f16_beta = Vmm(6);
+    Opmask native_f16_mask = Opmask(2);
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
     io::jit_io_multi_dt_helper_t<Vmm> io_;
+    io::jit_io_multi_dt_helper_t<Vmm> io_nt_;
 
     /* bf16 support */
     const int bf16_emu_zmm_1_idx_ = 26;
@@ -285,6 +451,16 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     VDISPATCH_ELTWISE(src_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
     VDISPATCH_ELTWISE(eltwise_injector::is_supported(isa, desc_.alg_kind),
             VERBOSE_BAD_ALGORITHM);
+    // Eltwise is memory-bound, leave it to an implementation using Ymm
+    // registers if they are preferred and it is available.
+    const cpu_isa_t ymm_isa = d_type == data_type::f32 ? avx2 : avx2_vnni_2;
+    VDISPATCH_ELTWISE(IMPLICATION(is_superset(isa, avx512_core)
+                                      && prefer_ymm(attr()->cpu_isa_hints_,
+                                              /* is_memory_bound = */ true),
+                              !mayiuse(ymm_isa)
+                                      || !eltwise_injector::is_supported(
+                                              ymm_isa, desc_.alg_kind)),
+            VERBOSE_ISA_NOT_PREFERRED);
     // refer to a comment in jit_uni_kernel why this is needed
     VDISPATCH_ELTWISE(IMPLICATION(!src_d.is_dense(), is_zero_preserved()),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -306,9 +482,37 @@ jit_uni_eltwise_fwd_t<isa, d_type>::~jit_uni_eltwise_fwd_t() = default;
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_fwd_t<isa, d_type>::init(engine_t *engine) {
     CHECK(safe_ptr_assign(kernel_, new jit_uni_kernel_t<isa>(pd())));
+    if (cache_blob() && is_kernel_relocatable())
+        return kernel_->create_kernel_from_cache_blob(cache_blob());
     return kernel_->create_kernel();
 }
 
+template <cpu_isa_t isa, data_type_t d_type>
+bool jit_uni_eltwise_fwd_t<isa, d_type>::is_kernel_relocatable() const {
+    // `eltwise_pow` calls `powf` by its address. Tail processing on ISAs
+    // without opmask support loads the mask from a static table.
+    return pd()->desc()->alg_kind != alg_kind::eltwise_pow
+            && is_superset(isa, avx512_core);
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    if (!is_kernel_relocatable()) return status::unimplemented;
+    jit_uni_kernel_t<isa> twin(pd());
+    CHECK(twin.create_kernel());
+    return kernel_->get_cache_blob_size(size, twin);
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    if (!is_kernel_relocatable()) return status::unimplemented;
+    jit_uni_kernel_t<isa> twin(pd());
+    CHECK(twin.create_kernel());
+    return kernel_->get_cache_blob(cache_blob, twin);
+}
+
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         const exec_ctx_t &ctx) const {
@@ -322,7 +526,13 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
-    parallel(0, [&](const int ithr, const int nthr) {
+    parallel_cost_t cost;
+    cost.bytes = 2 * nelems * data_d.data_type_size();
+    cost.ops = nelems;
+    const int nthr
+            = adjust_num_threads(0, utils::div_up(nelems, simd_w), cost);
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
         balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
@@ -366,6 +576,12 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     VDISPATCH_ELTWISE(data_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
     VDISPATCH_ELTWISE(
             eltwise_injector::is_isa_supported(isa), VERBOSE_UNSUPPORTED_ISA);
+    // Only the f32 backward has an implementation using Ymm registers.
+    VDISPATCH_ELTWISE(IMPLICATION(is_superset(isa, avx512_core)
+                                      && prefer_ymm(attr()->cpu_isa_hints_,
+                                              /* is_memory_bound = */ true),
+                              d_type != data_type::f32 || !mayiuse(avx2)),
+            VERBOSE_ISA_NOT_PREFERRED);
     VDISPATCH_ELTWISE(eltwise_injector::is_alg_supported(desc_.alg_kind),
             VERBOSE_BAD_ALGORITHM);
     // refer to a comment in jit_uni_kernel why this is needed
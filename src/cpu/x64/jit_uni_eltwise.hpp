@@ -60,8 +60,17 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    status_t get_cache_blob_size(
+            engine_t *engine, size_t *size) const override;
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override;
+
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    // The generated code may be stored in a cache blob only when it doesn't
+    // embed host addresses which are not preserved between processes.
+    bool is_kernel_relocatable() const;
+
     std::unique_ptr<jit_uni_eltwise_kernel> kernel_;
 };
 
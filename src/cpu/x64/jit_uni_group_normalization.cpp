@@ -17,7 +17,11 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
 
@@ -60,6 +64,7 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
         , axis_simd_tail_(C_ % simd_w_)
         , use_scale_(pd->use_scale())
         , use_shift_(pd->use_shift())
+        , with_postops_(pd->attr()->post_ops_.len() != 0)
         , eps_(pd->desc()->group_norm_epsilon) {
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -76,6 +81,13 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
                 {src_d_.data_type(), dst_d_.data_type(), f32 /* stats */},
                 io_conf, io_tail_conf, io_bf16_conf,
                 {{dst_d_.data_type(), io_saturation_conf}});
+
+        // Only eltwise post-ops are accepted, see `pd_t::post_ops_ok()`.
+        for (const auto &e : pd->attr()->post_ops_.entry_)
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise,
+                            true /*save_state*/, reg_po_injector_helper,
+                            elt_inj_opmask));
     }
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -124,9 +136,14 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
             // precompute and broadcast scales
             uni_vmovss(xmm_tmp, dword[reg_src_scales]);
             uni_vbroadcastss(vmm_combined_scales, xmm_tmp);
+            // post-ops are applied in between src and dst scales
             uni_vmovss(xmm_tmp, dword[reg_dst_scales]);
-            uni_vbroadcastss(vmm_tmp, xmm_tmp);
-            uni_vmulps(vmm_combined_scales, vmm_combined_scales, vmm_tmp);
+            if (with_postops_) {
+                uni_vbroadcastss(vmm_dst_scales, xmm_tmp);
+            } else {
+                uni_vbroadcastss(vmm_tmp, xmm_tmp);
+                uni_vmulps(vmm_combined_scales, vmm_combined_scales, vmm_tmp);
+            }
             io_.init_saturate_f32({dst_d_.data_type()});
 
             // calculate dst
@@ -140,6 +157,9 @@ struct kernel_t : public jit_uni_group_normalization_fwd_t::kernel_base_t,
         L(end);
 
         postamble();
+
+        for (auto &inj : eltwise_injectors_)
+            inj->prepare_table();
     }
 
     void operator()(const void *src, void *dst, const float *scale,
@@ -191,7 +211,10 @@ protected:
     const dim_t axis_simd_tail_;
     const bool use_scale_ = false;
     const bool use_shift_ = false;
+    const bool with_postops_ = false;
     const float eps_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
 
     void compute_dst_body(size_t offt_elems, bool tail = false) {
         if (use_scale_) {
@@ -228,6 +251,11 @@ protected:
             if (use_shift_) uni_vaddps(vmm_dst, vmm_dst, vmm_shift);
         }
         uni_vmulps(vmm_dst, vmm_dst, vmm_combined_scales);
+        if (with_postops_) {
+            for (auto &inj : eltwise_injectors_)
+                inj->compute_vector(vmm_dst.getIdx());
+            uni_vmulps(vmm_dst, vmm_dst, vmm_dst_scales);
+        }
         io_[dst_d_.data_type()]->store(vmm_dst, dst_ptr(offt_elems), tail);
     }
 
@@ -273,8 +301,10 @@ protected:
     const Xbyak::Reg64 reg_var = r13;
     const Xbyak::Reg64 reg_src_scales = r14;
     const Xbyak::Reg64 reg_dst_scales = r15;
+    const Xbyak::Reg64 reg_po_injector_helper = rbp;
 
     const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_dst_scales = Vmm(4);
     const Vmm vmm_zero = Vmm(5); // In unroll range, safe for dst compute.
     const Vmm vmm_saturation_ubound
             = Vmm(6); // In unroll range, safe for dst compute.
@@ -294,6 +324,7 @@ protected:
     const int bf16_emu_zmm_3_idx = 30;
     const int bf16_emu_zmm_4_idx = 31;
     const int tail_opmask_idx = 1;
+    const Xbyak::Opmask elt_inj_opmask = Xbyak::Opmask(2);
 };
 
 template struct kernel_t<avx2>;
@@ -306,16 +337,12 @@ struct kernel_stat_t
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_group_normalization_fwd_t::kernel_stat_t);
 
-    kernel_stat_t(const group_normalization_pd_t *pd, bool compute_var = false)
+    kernel_stat_t(const group_normalization_pd_t *pd)
         : jit_generator(jit_name())
         , src_d_(pd->src_md())
-        , compute_var_(compute_var)
         , C_(pd->src_md()->dims[1])
-        , C_PER_G_(C_ / pd->G())
         , simd_w_(vlen / sizeof(float))
         , axis_simd_tail_(C_ % simd_w_)
-        , vmm_per_g_(nstl::max(dim_t(1), dim_t(C_PER_G_ / simd_w_)))
-        , unroll_c_(utils::rnd_dn(compute_var_ ? 6 : 12, vmm_per_g_))
         , c_block_(unroll_c_ * simd_w_)
         , nc_blocks_(C_ / c_block_)
         , c_block_tail_((C_ % c_block_) - axis_simd_tail_)
@@ -342,8 +369,9 @@ struct kernel_stat_t
         if (axis_simd_tail_) io_.prepare_tail_mask();
 
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
-        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
-        if (compute_var_) mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
+        mov(reg_pivot, ptr[reg_param + PARAM_OFF(pivot)]);
+        mov(reg_sum, ptr[reg_param + PARAM_OFF(sum)]);
+        mov(reg_sum_sq, ptr[reg_param + PARAM_OFF(sum_sq)]);
         mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
 #undef PARAM_OFF
 
@@ -356,13 +384,8 @@ struct kernel_stat_t
                 cmp(reg_nc_block, nc_blocks_);
                 je(c_blk_loop_end, T_NEAR);
 
-                // calculate mean
                 compute_stat_block(unroll_c_);
-
-                add(reg_src_start,
-                        c_block_ * types::data_type_size(src_d_.data_type()));
-                add_mean(c_block_);
-                if (compute_var_) add(reg_var, c_block_ * sizeof(float));
+                advance_ptrs(c_block_);
                 add(reg_nc_block, 1);
 
                 jmp(c_blk_loop);
@@ -372,10 +395,7 @@ struct kernel_stat_t
 
         if (unroll_c_tail_) {
             compute_stat_block(unroll_c_tail_);
-            add(reg_src_start,
-                    c_block_tail_ * types::data_type_size(src_d_.data_type()));
-            add_mean(c_block_tail_);
-            if (compute_var_) add(reg_var, c_block_tail_ * sizeof(float));
+            advance_ptrs(c_block_tail_);
         }
 
         if (axis_simd_tail_) compute_stat_block(1, true);
@@ -383,23 +403,13 @@ struct kernel_stat_t
         postamble();
     }
 
-    void operator()(
-            const void *src, float *mean, size_t block_size) const override {
-        ker_args_t args;
-        args.src = src;
-        args.mean = mean;
-        args.block_size
-                = block_size * C_ * types::data_type_size(src_d_.data_type());
-
-        jit_generator::operator()(&args);
-    }
-
-    void operator()(const void *src, const float *mean, float *var,
-            size_t block_size) const override {
+    void operator()(const void *src, const float *pivot, float *sum,
+            float *sum_sq, size_t block_size) const override {
         ker_args_t args;
         args.src = src;
-        args.mean = mean;
-        args.var = var;
+        args.pivot = pivot;
+        args.sum = sum;
+        args.sum_sq = sum_sq;
         args.block_size
                 = block_size * C_ * types::data_type_size(src_d_.data_type());
 
@@ -415,33 +425,36 @@ protected:
 
     struct ker_args_t {
         const void *src;
-        const float *mean;
-        const float *var;
+        const float *pivot;
+        float *sum;
+        float *sum_sq;
         size_t block_size;
     };
 
+    static constexpr dim_t unroll_c_ = 6;
+
     io::jit_io_multi_dt_helper_t<Vmm> io_;
     const memory_desc_wrapper src_d_;
-    bool compute_var_;
     const dim_t C_;
-    const dim_t C_PER_G_;
     const size_t simd_w_;
     const dim_t axis_simd_tail_;
-    const dim_t vmm_per_g_;
-    const dim_t unroll_c_;
     const dim_t c_block_;
     const dim_t nc_blocks_;
     const dim_t c_block_tail_;
     const dim_t unroll_c_tail_;
 
-    void compute_mean_block(size_t unroll, bool tail = false) {
+    // Accumulates shifted data so that the variance can be recovered as
+    // `sum_sq - sum^2 / n` without catastrophic cancellation. The pivot buffer
+    // is padded and zeroed past C, so a full-width access is safe for tails.
+    void compute_stat_block(size_t unroll, bool tail = false) {
         const size_t c_src_size
                 = C_ * types::data_type_size(src_d_.data_type());
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
 #undef PARAM_OFF
         for (size_t ur = 0; ur < unroll; ur++) {
-            uni_vpxor(Vmm_mean(ur), Vmm_mean(ur), Vmm_mean(ur));
+            uni_vpxor(Vmm_sum(ur), Vmm_sum(ur), Vmm_sum(ur));
+            uni_vpxor(Vmm_sum_sq(ur), Vmm_sum_sq(ur), Vmm_sum_sq(ur));
         }
 
         mov(reg_src, reg_src_start);
@@ -457,7 +470,9 @@ protected:
             for (size_t ur = 0; ur < unroll; ur++) {
                 io_[src_d_.data_type()]->load(
                         src_ptr(ur * simd_w_), vmm_src, tail);
-                uni_vaddps(Vmm_mean(ur), Vmm_mean(ur), vmm_src);
+                uni_vsubps(vmm_src, vmm_src, pivot_ptr(ur * simd_w_));
+                uni_vaddps(Vmm_sum(ur), Vmm_sum(ur), vmm_src);
+                uni_vfmadd231ps(Vmm_sum_sq(ur), vmm_src, vmm_src);
             }
 
             add(reg_src, c_src_size);
@@ -467,96 +482,50 @@ protected:
 
         for (size_t ur = 0; ur < unroll; ur++) {
             io_[data_type::f32]->store(
-                    Vmm_mean(ur), mean_ptr(ur * simd_w_), tail);
-        }
-    }
-
-    void compute_var_block(size_t unroll, bool tail = false) {
-        const size_t c_src_size
-                = C_ * types::data_type_size(src_d_.data_type());
-#define PARAM_OFF(x) offsetof(ker_args_t, x)
-        mov(reg_sp_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
-#undef PARAM_OFF
-        for (size_t ur = 0; ur < unroll; ur++) {
-            uni_vpxor(Vmm_var(ur), Vmm_var(ur), Vmm_var(ur));
-            if (C_PER_G_ == 1) {
-                io_[data_type::f32]->load(
-                        mean_ptr(ur * simd_w_), Vmm_mean(ur), tail);
-            } else {
-                io_[data_type::f32]->broadcast(
-                        mean_ptr(ur * simd_w_ / C_PER_G_), Vmm_mean(ur));
-            }
-        }
-
-        mov(reg_src, reg_src_start);
-        // add block_start to block_size to define block_end
-        add(reg_sp_block_end, reg_src);
-
-        Xbyak::Label sp_blk_loop, sp_blk_loop_end;
-        L(sp_blk_loop);
-        {
-            cmp(reg_sp_block_end, reg_src);
-            jle(sp_blk_loop_end, T_NEAR);
-
-            for (size_t ur = 0; ur < unroll; ur++) {
-                io_[src_d_.data_type()]->load(
-                        src_ptr(ur * simd_w_), vmm_src, tail);
-                uni_vsubps(vmm_src, vmm_src, Vmm_mean(ur));
-                uni_vfmadd231ps(Vmm_var(ur), vmm_src, vmm_src);
-            }
-
-            add(reg_src, c_src_size);
-            jmp(sp_blk_loop);
-        }
-        L(sp_blk_loop_end);
-
-        for (size_t ur = 0; ur < unroll; ur++) {
+                    Vmm_sum(ur), sum_ptr(ur * simd_w_), tail);
             io_[data_type::f32]->store(
-                    Vmm_var(ur), var_ptr(ur * simd_w_), tail);
+                    Vmm_sum_sq(ur), sum_sq_ptr(ur * simd_w_), tail);
         }
     }
-    void compute_stat_block(size_t unroll, bool tail = false) {
-        if (compute_var_)
-            compute_var_block(unroll, tail);
-        else
-            compute_mean_block(unroll, tail);
-    }
-    void add_mean(int c_block) {
-        // If the kernel is configured to compute variance,
-        // mean is already reduced from [MB, C] into [MB, G]
-        if (compute_var_) c_block /= C_PER_G_;
-        add(reg_mean, c_block * sizeof(float));
+
+    void advance_ptrs(dim_t c_block) {
+        add(reg_src_start, c_block * types::data_type_size(src_d_.data_type()));
+        add(reg_pivot, c_block * sizeof(float));
+        add(reg_sum, c_block * sizeof(float));
+        add(reg_sum_sq, c_block * sizeof(float));
     }
 
-    Vmm Vmm_mean(size_t ur = 0) { return Vmm(3 + ur); }
-    Vmm Vmm_var(size_t ur = 0) { return Vmm(9 + ur); }
+    Vmm Vmm_sum(size_t ur = 0) { return Vmm(3 + ur); }
+    Vmm Vmm_sum_sq(size_t ur = 0) { return Vmm(9 + ur); }
 
     Xbyak::Address src_ptr(size_t offt = 0) {
         return vmmword[reg_src + offt * src_d_.data_type_size()];
     }
 
-    Xbyak::Address mean_ptr(size_t offt = 0) {
-        return vmmword[reg_mean + offt * sizeof(float)];
+    Xbyak::Address pivot_ptr(size_t offt = 0) {
+        return vmmword[reg_pivot + offt * sizeof(float)];
     }
 
-    Xbyak::Address var_ptr(size_t offt = 0) {
-        return vmmword[reg_var + offt * sizeof(float)];
+    Xbyak::Address sum_ptr(size_t offt = 0) {
+        return vmmword[reg_sum + offt * sizeof(float)];
+    }
+
+    Xbyak::Address sum_sq_ptr(size_t offt = 0) {
+        return vmmword[reg_sum_sq + offt * sizeof(float)];
     }
 
     const Xbyak::Reg64 reg_param = abi_param1;
     const Xbyak::Reg64 reg_src = rdx;
     const Xbyak::Reg64 reg_src_start = rax;
-    const Xbyak::Reg64 reg_mean = rbx;
+    const Xbyak::Reg64 reg_sum = rbx;
+    const Xbyak::Reg64 reg_pivot = r8;
     const Xbyak::Reg64 reg_sp_block_end = r9;
     const Xbyak::Reg64 reg_nc_block = r10;
     const Xbyak::Reg64 reg_tmp = r11;
-    const Xbyak::Reg64 reg_var = r12;
+    const Xbyak::Reg64 reg_sum_sq = r12;
 
     const Vmm vmm_tail_mask = Vmm(0);
-    const Vmm vmm_zero = Vmm(1);
     const Vmm vmm_src = Vmm(2);
-    const Vmm vmm_tmp = Vmm(15);
-    const Xbyak::Xmm xmm_tmp = Xbyak::Xmm(15);
 
     const int bf16_emu_zmm_1_idx = 28;
     const int bf16_emu_zmm_2_idx = 29;
@@ -585,17 +554,27 @@ jit_uni_group_normalization_fwd_t::kernel_base_t::create(
 
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
 jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(
-        const group_normalization_pd_t *apd, bool compute_var) {
+        const group_normalization_pd_t *apd) {
     if (mayiuse(avx512_core)) {
-        return new kernel_stat_t<avx512_core>(apd, compute_var);
+        return new kernel_stat_t<avx512_core>(apd);
     } else if (mayiuse(avx2)) {
-        return new kernel_stat_t<avx2>(apd, compute_var);
+        return new kernel_stat_t<avx2>(apd);
     } else {
         assert(!"kernel is empty.");
         return nullptr;
     }
 }
 
+bool jit_uni_group_normalization_fwd_t::pd_t::post_ops_ok() const {
+    const std::vector<injector::post_op_type> accepted_post_ops
+            = {injector::eltwise};
+    const memory_desc_wrapper dst_d(dst_md());
+    const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    injector::post_ops_ok_args_t post_ops_args(
+            isa, accepted_post_ops, attr()->post_ops_, &dst_d, true, true);
+    return injector::post_ops_ok(post_ops_args);
+}
+
 status_t jit_uni_group_normalization_fwd_t::execute_forward(
         const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
@@ -608,6 +587,7 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
 
     auto scratchpad = ctx.get_scratchpad_grantor();
     auto stat_reduction = scratchpad.template get<float>(key_gnorm_reduction);
+    auto pivot_buf = scratchpad.template get<float>(key_gnorm_pivot);
     auto tmp_mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
     auto tmp_var = scratchpad.template get<float>(key_gnorm_tmp_var);
 
@@ -641,78 +621,100 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     const int nthr = pd()->nthr_;
 
     if (calculate_stats) {
-        auto reduce = [&](float *stat, const float *tmp_stat) {
-            for (dim_t n = 0; n < N; ++n) {
-                const float *loc_stat = tmp_stat + n * nthr * C;
-                for (dim_t g = 0; g < G; ++g)
-                    stat[g] = 0.f;
-
-                for (int ithr_sp = 0; ithr_sp < nthr; ++ithr_sp) {
-                    for (dim_t g = 0; g < G; ++g) {
-                        float s = stat[g];
-                        const dim_t c_start = g * C_PER_G;
-                        for (dim_t c = 0; c < C_PER_G; ++c)
-                            s += loc_stat[c_start + c];
-                        stat[g] = s;
-                    }
-                    // Increase loc_stat to reduce the chunk for the next ithr_sp
-                    loc_stat += C;
-                }
+        const dim_t simd_w = isa_max_vlen(get_max_cpu_isa()) / sizeof(float);
+        const dim_t C_rnd = utils::rnd_up(C, simd_w);
 
-                for (dim_t g = 0; g < G; ++g)
-                    stat[g] /= C_PER_G * SP;
-                stat += G;
-            }
-        };
-        // compute mean
-        parallel(nthr, [&](const int ithr, const int nthr) {
-            dim_t SP_start = 0, SP_end = 0;
-            balance211(SP, nthr, ithr, SP_start, SP_end);
-            const int block_size = SP_end - SP_start;
-            for (int n = 0; n < N; ++n) {
-                float *local_mean = stat_reduction + n * nthr * C + ithr * C;
-                const size_t s_off
-                        = (size_t)n * SP * C_padded + SP_start * C_padded;
-                const char *__restrict local_src
-                        = static_cast<const char *>(src)
-                        + s_off * src_d.data_type_size();
-                (*kernel_mean_)(local_src, local_mean, block_size);
-            }
-        });
-        reduce(mean, stat_reduction);
-        // compute variance
+        // Every thread reads its spatial chunk of the source once and stores
+        // the partial mean and M2 (sum of squared deviations) per channel.
         parallel(nthr, [&](const int ithr, const int nthr) {
             dim_t SP_start = 0, SP_end = 0;
             balance211(SP, nthr, ithr, SP_start, SP_end);
             const dim_t block_size = SP_end - SP_start;
+            if (block_size == 0) return;
+
+            float *pivot = pivot_buf + ithr * C_rnd;
+            for (dim_t c = C; c < C_rnd; ++c)
+                pivot[c] = 0.f;
+
             for (dim_t n = 0; n < N; ++n) {
-                float *local_mean = mean + n * G;
-                float *local_var = stat_reduction + n * nthr * C + ithr * C;
+                float *loc_mean = stat_reduction + (n * nthr + ithr) * 2 * C;
+                float *loc_m2 = loc_mean + C;
                 const size_t s_off
                         = (size_t)n * SP * C_padded + SP_start * C_padded;
                 const char *__restrict local_src
                         = static_cast<const char *>(src)
                         + s_off * src_d.data_type_size();
-                (*kernel_var_)(local_src, local_mean, local_var, block_size);
+                // The first point of the chunk serves as a shift value
+                for (dim_t c = 0; c < C; ++c)
+                    pivot[c] = cpu::io::load_float_value(
+                            src_d.data_type(), local_src, c);
+
+                (*kernel_stat_)(
+                        local_src, pivot, loc_mean, loc_m2, block_size);
+
+                for (dim_t c = 0; c < C; ++c) {
+                    const float s = loc_mean[c];
+                    loc_mean[c] = pivot[c] + s / block_size;
+                    loc_m2[c] = nstl::max(0.f, loc_m2[c] - s * s / block_size);
+                }
             }
         });
-        reduce(variance, stat_reduction);
+
+        // Merge partial statistics with the parallel Welford update (Chan et
+        // al.), which stays accurate when partial means differ much.
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            double cnt = 0, m = 0, m2 = 0;
+            for (int ithr = 0; ithr < nthr; ++ithr) {
+                dim_t SP_start = 0, SP_end = 0;
+                balance211(SP, nthr, ithr, SP_start, SP_end);
+                const double loc_cnt = SP_end - SP_start;
+                if (loc_cnt == 0) continue;
+
+                const float *loc_mean
+                        = stat_reduction + (n * nthr + ithr) * 2 * C;
+                const float *loc_m2 = loc_mean + C;
+                for (dim_t c = g * C_PER_G; c < (g + 1) * C_PER_G; ++c) {
+                    const double new_cnt = cnt + loc_cnt;
+                    const double delta = loc_mean[c] - m;
+                    m += delta * loc_cnt / new_cnt;
+                    m2 += loc_m2[c] + delta * delta * cnt * loc_cnt / new_cnt;
+                    cnt = new_cnt;
+                }
+            }
+            mean[n * G + g] = static_cast<float>(m);
+            variance[n * G + g] = static_cast<float>(m2 / cnt);
+        });
     }
 
+    // Normalization re-reads the source. Spatial tiles are traversed in the
+    // reverse order of the statistics pass, so the most recently read tiles
+    // are consumed while they are still in the L2 cache.
+    const size_t row_bytes = C_padded
+            * nstl::max(src_d.data_type_size(), dst_d.data_type_size());
+    const dim_t sp_tile = nstl::max(dim_t(1),
+            (dim_t)(platform::get_per_core_cache_size(2) / 2 / row_bytes));
+
     parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t SP_start = 0, SP_end = 0;
         balance211(SP, nthr, ithr, SP_start, SP_end);
-        for (dim_t n = 0; n < N; ++n) {
-            const size_t data_off = n * SP * C_padded + SP_start * C_padded;
-            const char *const __restrict src_ptr
-                    = reinterpret_cast<const char *>(src)
-                    + data_off * src_d.data_type_size();
-            char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
-                    + data_off * dst_d.data_type_size();
-            const dim_t block_size = SP_end - SP_start;
-
-            (*kernel_)(src_ptr, dst_ptr, scale, shift, &mean[n * G],
-                    &variance[n * G], src_scales, dst_scales, block_size);
+        if (SP_end == SP_start) return;
+        const dim_t n_tiles = utils::div_up(SP_end - SP_start, sp_tile);
+        for (dim_t n = N - 1; n >= 0; --n) {
+            for (dim_t t = n_tiles - 1; t >= 0; --t) {
+                const dim_t tile_start = SP_start + t * sp_tile;
+                const dim_t tile_end = nstl::min(SP_end, tile_start + sp_tile);
+                const size_t data_off
+                        = n * SP * C_padded + tile_start * C_padded;
+                const char *const __restrict src_ptr
+                        = reinterpret_cast<const char *>(src)
+                        + data_off * src_d.data_type_size();
+                char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
+                        + data_off * dst_d.data_type_size();
+                const dim_t block_size = tile_end - tile_start;
+
+                (*kernel_)(src_ptr, dst_ptr, scale, shift, &mean[n * G],
+                        &variance[n * G], src_scales, dst_scales, block_size);
+            }
         }
     });
 
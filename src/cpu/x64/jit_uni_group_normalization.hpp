@@ -60,9 +60,11 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
                                     mayiuse(avx512_core)),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_GNORM(
-                    attr()->has_default_values(skip_mask_t::scales_runtime)
+                    attr()->has_default_values(skip_mask_t::scales_runtime
+                            | skip_mask_t::post_ops)
                             && attr_scales_ok(),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_GNORM(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
             VDISPATCH_GNORM(memory_desc_matches_one_of_tag(
                                     *src_md(), ndhwc, nhwc, nwc, nc),
                     VERBOSE_UNSUPPORTED_TAG_S, "src");
@@ -79,17 +81,19 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
             VDISPATCH_GNORM(IMPLICATION(C_PER_G != 1, C_PER_G % simd_w == 0),
                     VERBOSE_INCONSISTENT_DIM, "C", (int)C(), "groups",
                     (int)desc()->groups);
-            // C_PER_G should be less than simd_w * unroll_c (which is 6 for var)
-            VDISPATCH_GNORM(C_PER_G / simd_w <= 6, VERBOSE_SHAPE_RESTRICTION);
 
             nthr_ = dnnl_get_max_threads();
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
                 using namespace memory_tracking::names;
                 const size_t stats_size = MB() * C();
-                const size_t stats_reduction_buf_sz = stats_size * nthr_;
+                // Per-thread partial mean and M2 of every channel.
+                const size_t stats_reduction_buf_sz = 2 * stats_size * nthr_;
                 scratchpad.template book<float>(
                         key_gnorm_reduction, stats_reduction_buf_sz);
+                // Per-thread shift values, padded for full-vector access.
+                scratchpad.template book<float>(key_gnorm_pivot,
+                        nthr_ * utils::rnd_up(C(), simd_w));
                 if (!is_training()) {
                     scratchpad.template book<float>(
                             key_gnorm_tmp_mean, stats_size);
@@ -101,17 +105,16 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
             return status::success;
         }
 
+        bool post_ops_ok() const;
+
         int nthr_; // To not exceed the limit in execute used for set up.
     };
 
     status_t init(engine_t *engine) override {
         CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
-        CHECK(safe_ptr_assign(kernel_mean_, kernel_stat_base_t::create(pd())));
-        CHECK(safe_ptr_assign(
-                kernel_var_, kernel_stat_base_t::create(pd(), true)));
+        CHECK(safe_ptr_assign(kernel_stat_, kernel_stat_base_t::create(pd())));
         if (kernel_) CHECK(kernel_->create_kernel());
-        if (kernel_mean_) CHECK(kernel_mean_->create_kernel());
-        if (kernel_var_) CHECK(kernel_var_->create_kernel());
+        if (kernel_stat_) CHECK(kernel_stat_->create_kernel());
         return status::success;
     }
 
@@ -129,13 +132,12 @@ struct jit_uni_group_normalization_fwd_t : public primitive_t {
         virtual ~kernel_base_t() = default;
     };
 
+    // Computes per-channel sums of `src - pivot` and of its squares over
+    // `block_size` spatial points in a single read of the source.
     struct kernel_stat_base_t {
-        virtual void operator()(
-                const void *src, float *mean, size_t block_size) const = 0;
-        virtual void operator()(const void *src, const float *mean, float *var,
-                size_t block_size) const = 0;
-        static kernel_stat_base_t *create(
-                const group_normalization_pd_t *pd, bool compute_var = false);
+        virtual void operator()(const void *src, const float *pivot,
+                float *sum, float *sum_sq, size_t block_size) const = 0;
+        static kernel_stat_base_t *create(const group_normalization_pd_t *pd);
         virtual status_t create_kernel() = 0;
         virtual ~kernel_stat_base_t() = default;
     };
@@ -145,8 +147,7 @@ protected:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<kernel_base_t> kernel_;
-    std::unique_ptr<kernel_stat_base_t> kernel_mean_;
-    std::unique_ptr<kernel_stat_base_t> kernel_var_;
+    std::unique_ptr<kernel_stat_base_t> kernel_stat_;
 };
 
 } // namespace x64
@@ -19,6 +19,8 @@
 #include "common/dnnl_thread.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -62,6 +64,11 @@ struct jit_uni_i8i8_pool_call_params_t {
     float idivider;
     const char *src_safe_access;
     const char *dst_safe_access;
+    const float *dst_scales;
+    // channel range, used only with split_c
+    size_t c_steps;
+    size_t oc_off;
+    size_t process_c_tail;
 };
 
 template <cpu_isa_t isa>
@@ -1052,6 +1059,12 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_avg_step(
                             vmm_idxs, rhs_arg_params, ddp, qdp);
                 }
 
+                if (jpp.with_dst_scale) {
+                    // aux_reg_src_h is free after accumulation and post-ops
+                    mov(aux_reg_src_h, ptr[reg_param + GET_OFF(dst_scales)]);
+                    uni_vmulps(reg_dst_f32, reg_dst_f32, ptr[aux_reg_src_h]);
+                }
+
                 if (jpp.dst_dt != f32) {
                     uni_vcvtps2dq(reg_dst_s32, reg_dst_f32);
                 }
@@ -1089,10 +1102,19 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_c_block() {
     int c_tail = jpp.c_tail;
 
     xor_(c_iter, c_iter);
-    if (jpp.with_quantization)
-        xor_(reg_oc_off, reg_oc_off);
+    if (jpp.with_quantization) {
+        if (jpp.split_c)
+            mov(reg_oc_off, ptr[reg_param + GET_OFF(oc_off)]);
+        else
+            xor_(reg_oc_off, reg_oc_off);
+    }
 
     if (c_steps > 0) {
+        Label l_main_loop_end;
+        if (jpp.split_c) {
+            cmp(ptr[reg_param + GET_OFF(c_steps)], c_iter);
+            je(l_main_loop_end, T_NEAR);
+        }
         L(l_main_loop);
         {
             compute_step(ur_c, 0);
@@ -1101,12 +1123,25 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_c_block() {
             if (jpp.with_quantization)
                 add(reg_oc_off, ur_c*c_block*sizeof(float));
             inc(c_iter);
-            cmp(c_iter, c_steps);
+            if (jpp.split_c)
+                cmp(c_iter, ptr[reg_param + GET_OFF(c_steps)]);
+            else
+                cmp(c_iter, c_steps);
             jl(l_main_loop, T_NEAR);
         }
+        L(l_main_loop_end);
     }
 
-    if (ur_c_tail != 0) { compute_step(ur_c_tail, c_tail); }
+    if (ur_c_tail != 0) {
+        Label l_skip_tail;
+        if (jpp.split_c) {
+            mov(c_iter, ptr[reg_param + GET_OFF(process_c_tail)]);
+            test(c_iter, c_iter);
+            jz(l_skip_tail, T_NEAR);
+        }
+        compute_step(ur_c_tail, c_tail);
+        L(l_skip_tail);
+    }
 }
 
 template <>
@@ -1430,6 +1465,18 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
     VDISPATCH_POOLING_IC(
             post_ops_ok(jpp, *ppd->attr(), dst_d), VERBOSE_UNSUPPORTED_POSTOP);
 
+    // Without post-ops the dst scale is folded into the averaging divider,
+    // otherwise it has to be applied after the post-op chain.
+    jpp.with_dst_scale = jpp.with_postops
+            && !ppd->attr()->scales_.get(DNNL_ARG_DST).has_default_values();
+
+    // Global pooling of a single image leaves too few output points to
+    // occupy all threads, so channel blocks are distributed as well.
+    jpp.nthr = dnnl_get_max_threads();
+    const dim_t work_amount = (dim_t)jpp.mb * jpp.od * jpp.oh * jpp.ow;
+    jpp.split_c = work_amount < jpp.nthr && jpp.nb_c / jpp.ur_c >= 2
+            && !jpp.with_depthwise;
+
     return status::success;
 }
 
@@ -1508,6 +1555,19 @@ status_t jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
     const auto &jpp = pd()->jpp_;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(jpp.post_ops, ctx);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    const float io_scale
+            = src_scales[0] * (jpp.with_dst_scale ? 1.f : dst_scales[0]);
+
+    const dim_t c_steps = jpp.nb_c / jpp.ur_c;
+    const dim_t work_amount = (dim_t)jpp.mb * jpp.od * jpp.oh * jpp.ow;
+    const dim_t nb_chunks = jpp.split_c
+            ? nstl::min(c_steps, utils::div_up((dim_t)jpp.nthr, work_amount))
+            : 1;
+    const dim_t c_step_size = (dim_t)jpp.ur_c * jpp.c_block;
+
     /* Calculate when the memory-access will happen outisde of the memory
      * boundary, if so, compute a safe memory access. */
     const auto src_safe_access = reinterpret_cast<char *>(
@@ -1518,8 +1578,8 @@ status_t jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
             reinterpret_cast<ptrdiff_t>(dst_i8 + dst_d.size() - 1)
             - (cpu_isa_traits<isa>::vlen - 1));
 
-    parallel_nd(jpp.mb, jpp.od, jpp.oh, jpp.ow,
-            [&](dim_t n, dim_t od, dim_t oh, dim_t ow) {
+    parallel_nd(jpp.mb, jpp.od, jpp.oh, jpp.ow, nb_chunks,
+            [&](dim_t n, dim_t od, dim_t oh, dim_t ow, dim_t chunk) {
                 dim_t id = nstl::max(od * jpp.stride_d - jpp.f_pad, dim_t(0));
                 dim_t ih = nstl::max(oh * jpp.stride_h - jpp.t_pad, dim_t(0));
                 dim_t iw = nstl::max(ow * jpp.stride_w - jpp.l_pad, dim_t(0));
@@ -1546,7 +1606,7 @@ status_t jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
                 p.kd_range = kd_end - kd_start;
                 p.kh_range = kh_end - kh_start;
                 p.kw_range = kw_end - kw_start;
-                p.idivider = 1.0f
+                p.idivider = io_scale
                         / ((jpp.alg == pooling_avg_exclude_padding)
                                         ? p.kd_range * p.kh_range * p.kw_range
                                         : jpp.kd * jpp.kh * jpp.kw);
@@ -1554,6 +1614,17 @@ status_t jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
                 p.dst_safe_access = dst_safe_access;
                 p.post_ops_binary_rhs_arg_vec
                         = post_ops_binary_rhs_arg_vec.data();
+                p.dst_scales = dst_scales;
+
+                dim_t step_start = 0, step_end = c_steps;
+                if (jpp.split_c)
+                    balance211(c_steps, nb_chunks, chunk, step_start, step_end);
+                const dim_t c_off = step_start * c_step_size;
+                p.src_i8 += c_off * src_d.data_type_size();
+                p.dst_i8 += c_off * dst_d.data_type_size();
+                p.c_steps = step_end - step_start;
+                p.oc_off = c_off * sizeof(float);
+                p.process_c_tail = chunk == nb_chunks - 1;
                 (*ker_)(&p);
             });
     return status::success;
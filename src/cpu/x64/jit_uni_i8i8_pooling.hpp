@@ -61,9 +61,17 @@ struct jit_uni_i8i8_pooling_fwd_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_POOLING(!is_dilated(), VERBOSE_UNSUPPORTED_FEATURE,
                     "does not support dilations");
-            VDISPATCH_POOLING(attr()->has_default_values(
-                                      primitive_attr_t::skip_mask_t::post_ops),
+            VDISPATCH_POOLING(
+                    attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops
+                            | primitive_attr_t::skip_mask_t::scales_runtime)
+                            && attr_scales_ok(),
                     VERBOSE_UNSUPPORTED_ATTR);
+            // Max pooling keeps data in the source data type.
+            VDISPATCH_POOLING(
+                    IMPLICATION(desc()->alg_kind == alg_kind::pooling_max,
+                            attr()->scales_.has_default_values()),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_POOLING(set_default_params() == status::success,
                     VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_POOLING(
@@ -150,16 +150,90 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
                     reduction_norm_lp_power_p_sum)),
             VERBOSE_BAD_ALGORITHM);
 
+    conf_.mean_size = conf_.reduce_size;
+    init_reduce_split();
+    init_scratchpad();
+
     return status::success;
 }
 
+void jit_uni_reduction_t::pd_t::init_reduce_split() {
+    // Global pooling like shapes have few outputs with a long reduction each.
+    // Split the reduced dimension then, so that every thread reduces its
+    // chunk into a partial result, and combine them with the final kernel.
+    static constexpr dim_t min_chunk_size = 4096;
+    // Multiple of the vector length of every supported isa.
+    static constexpr dim_t chunk_alignment = 16;
+
+    const dim_t nthr = dnnl_get_max_threads();
+    conf_.nchunks = 1;
+    conf_.chunk_size = conf_.reduce_size;
+    // Nothing to split for an empty destination.
+    if (conf_.idle_size == 0 || conf_.idle_size >= nthr) return;
+
+    const dim_t max_nchunks = utils::div_up(nthr, conf_.idle_size);
+    const dim_t nchunks = nstl::min(
+            max_nchunks, conf_.reduce_size / min_chunk_size);
+    if (nchunks <= 1) return;
+
+    conf_.chunk_size = utils::rnd_up(
+            utils::div_up(conf_.reduce_size, nchunks), chunk_alignment);
+    conf_.nchunks = utils::div_up(conf_.reduce_size, conf_.chunk_size);
+}
+
+void jit_uni_reduction_t::pd_t::init_scratchpad() {
+    if (conf_.nchunks <= 1) return;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(memory_tracking::names::key_reduction,
+            conf_.idle_size * conf_.nchunks);
+}
+
 status_t jit_uni_reduction_t::init(engine_t *engine) {
     using namespace format_tag;
 
     const memory_desc_t *dst_md = pd()->dst_md();
     const jit_reduction_conf_t &conf = pd()->get_conf();
 
-    CHECK(get_proper_kernel(dst_md, conf));
+    if (conf.nchunks <= 1) {
+        CHECK(get_proper_kernel(kernel_, dst_md, conf));
+        return kernel_->create_kernel();
+    }
+
+    // Chunks are reduced to partial f32 sums (or minimums, maximums and
+    // products) without any post-processing, while kernel_ combines the
+    // partial results and finalizes them as for the unsplit case.
+    auto init_partial_conf = [&](jit_reduction_conf_t &pconf, dim_t size) {
+        pconf = conf;
+        pconf.dst_type = data_type::f32;
+        pconf.dst_dt_size = sizeof(float);
+        if (pconf.alg == alg_kind::reduction_mean)
+            pconf.alg = alg_kind::reduction_sum;
+        pconf.reduce_size = size;
+        pconf.is_saturation_needed = false;
+        pconf.post_ops = post_ops_t();
+        pconf.with_postops = pconf.with_eltwise = pconf.with_binary
+                = pconf.with_sum = false;
+        pconf.sum_scales = std::queue<float>();
+    };
+
+    const dim_t tail_chunk_size
+            = conf.reduce_size - (conf.nchunks - 1) * conf.chunk_size;
+    init_partial_conf(partial_conf_, conf.chunk_size);
+    CHECK(get_proper_kernel(partial_kernel_, dst_md, partial_conf_));
+    CHECK(partial_kernel_->create_kernel());
+    if (tail_chunk_size != conf.chunk_size) {
+        init_partial_conf(partial_tail_conf_, tail_chunk_size);
+        CHECK(get_proper_kernel(
+                partial_tail_kernel_, dst_md, partial_tail_conf_));
+        CHECK(partial_tail_kernel_->create_kernel());
+    }
+
+    combine_conf_ = conf;
+    combine_conf_.src_type = data_type::f32;
+    combine_conf_.src_dt_size = sizeof(float);
+    combine_conf_.reduce_size = conf.nchunks;
+    CHECK(get_proper_kernel(kernel_, dst_md, combine_conf_));
     CHECK(kernel_->create_kernel());
 
     return status::success;
@@ -177,6 +251,9 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     const auto &post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(post_ops, ctx);
 
+    if (pd()->get_conf().nchunks > 1)
+        return execute_split(ctx, post_ops_binary_rhs_arg_vec.data());
+
     parallel_nd(idle_size, [&](dim_t i) {
         const dim_t src_off = i * reduce_size * src_dt_size;
         const dim_t dst_off = i * dst_dt_size;
@@ -193,48 +270,93 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+status_t jit_uni_reduction_t::execute_split(
+        const exec_ctx_t &ctx, const void *post_ops_binary_rhs_arg_vec) const {
+    const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+    auto partials = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reduction);
+
+    const auto &conf = pd()->get_conf();
+    const dim_t idle_size = conf.idle_size;
+    const dim_t reduce_size = conf.reduce_size;
+    const dim_t nchunks = conf.nchunks;
+    const dim_t chunk_size = conf.chunk_size;
+
+    parallel_nd(idle_size, nchunks, [&](dim_t i, dim_t c) {
+        const dim_t src_off
+                = (i * reduce_size + c * chunk_size) * conf.src_dt_size;
+        const bool is_tail = c == nchunks - 1 && partial_tail_kernel_;
+
+        jit_reduction_call_s args = jit_reduction_call_s();
+        args.src = src + src_off;
+        args.dst = partials + i * nchunks + c;
+        args.dst_orig = partials;
+
+        if (is_tail)
+            (*partial_tail_kernel_)(&args);
+        else
+            (*partial_kernel_)(&args);
+    });
+
+    // The partial results are combined in a fixed order, so the result does
+    // not depend on the threads which computed them.
+    parallel_nd(idle_size, [&](dim_t i) {
+        jit_reduction_call_s args = jit_reduction_call_s();
+        args.src = partials + i * nchunks;
+        args.dst = dst + i * conf.dst_dt_size;
+        args.dst_orig = dst;
+        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
 status_t jit_uni_reduction_t::get_proper_kernel(
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
         const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2_vnni_2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2>(
                                 conf, dst_md));
         } else if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
         }
     } else if (conf.isa == sse41)
         return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+                kernel, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
     else
         return status::runtime_error;
 }
@@ -44,6 +44,8 @@ struct jit_uni_reduction_t : public primitive_t {
 
     private:
         bool fill_post_ops_conf();
+        void init_reduce_split();
+        void init_scratchpad();
 
         jit_reduction_conf_t conf_;
     };
@@ -56,11 +58,21 @@ struct jit_uni_reduction_t : public primitive_t {
 
 private:
     status_t get_proper_kernel(
+            std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
             const memory_desc_t *dst_md, const jit_reduction_conf_t &conf);
+    status_t execute_split(const exec_ctx_t &ctx,
+            const void *post_ops_binary_rhs_arg_vec) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
+    // Kernels hold references to their configurations.
+    jit_reduction_conf_t partial_conf_;
+    jit_reduction_conf_t partial_tail_conf_;
+    jit_reduction_conf_t combine_conf_;
+
     std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> partial_kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> partial_tail_kernel_;
 };
 
 } // namespace x64
@@ -77,7 +77,7 @@ static bool is_direct_copy(const prb_t &prb) {
             false, prb.req_s8s8_comp, prb.req_asymmetric_comp);
     return prb.ndims == 1 && prb.nodes[0].is == 1 && prb.nodes[0].os == 1
             && !is_s32 && !prb.is_tail_present && no_scale && no_zp && no_comp
-            && prb.beta == 0.f;
+            && prb.beta == 0.f && prb.eltwise_post_ops.empty();
 }
 
 static bool prb_has_small_strides(const prb_t &prb) {
@@ -562,34 +562,38 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     bool can_do_tr8x8() {
         using namespace data_type;
 
-        static constexpr size_t desirable_node_size = 8;
         static constexpr ptrdiff_t desirable_stride = 1;
 
         // This processing is relied on swaping two innermost dimension.
         // Therefore, input stride in second node and output stride in first node
-        // have to be equal to 1.
+        // have to be equal to 1. 16x16 tiles are processed as four 8x8 ones.
 
         return mayiuse(avx2) && prb_.ndims >= 2
                 && ((utils::one_of(prb_.itype, u8, s8, f8_e5m2, f8_e4m3, s32,
                              f32, bf16, f16)
                         && utils::one_of(prb_.otype, u8, s8, f8_e5m2, f8_e4m3,
                                 s32, f32, bf16, f16)))
-                && utils::everyone_is(desirable_node_size, prb_.n(0), prb_.n(1))
+                && prb_.n(0) == prb_.n(1) && utils::one_of(prb_.n(0), 8u, 16u)
                 && utils::everyone_is(desirable_stride, prb_.os(0), prb_.is(1))
                 && !prb_.is_tail_present
                 && prb_.src_scale_type == scale_type_t::NONE
                 && prb_.dst_scale_type == scale_type_t::NONE
-                && prb_.beta == 0.f;
+                && prb_.beta == 0.f && prb_.eltwise_post_ops.empty();
     }
 
     bool process_unroll_tr8x8(const int ndims, const int len) {
         if (!can_do_tr8x8()) return false;
 
-        const int step_size = prb_.n(0) * prb_.n(1);
+        static constexpr int sub_tile = 8;
+        const int tile = static_cast<int>(prb_.n(0));
+        const int step_size = tile * tile;
         int i_off = 0, o_off = 0;
         for (int off = 0; off < len; off += step_size) {
             step(off, i_off, o_off, i_off, o_off, step_size);
-            tr8x8_avx2(i_off, o_off);
+            for_(int r = 0; r < tile; r += sub_tile)
+            for (int c = 0; c < tile; c += sub_tile)
+                tr8x8_avx2(i_off + r * static_cast<int>(prb_.is(0)) + c,
+                        o_off + r + c * static_cast<int>(prb_.os(1)));
         }
 
         return true;
@@ -972,7 +976,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             // transposition on the fly
             const bool fast_return = prb_.src_scale_type != scale_type_t::MANY
                     && prb_.dst_scale_type != scale_type_t::MANY
-                    && prb_.beta == 0.f && !prb_.req_src_zp && !prb_.req_dst_zp;
+                    && prb_.beta == 0.f && prb_.eltwise_post_ops.empty()
+                    && !prb_.req_src_zp && !prb_.req_dst_zp;
             if (fast_return) {
                 if (prb_.src_scale_type == scale_type_t::COMMON)
                     for (int ur = 0; ur < reg_unroll; ur += load_step)
@@ -1122,6 +1127,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 }
             }
 
+            /* xmm[:] <-- post_ops(xmm[:]) */
+            apply_eltwise_post_ops(reg_unroll, ur_step);
+
             /* dst <-- dst_scales * xmm[:] */
             apply_scales(
                     xmm_dst_scales_, scale_arg_t::DST, prb_.dst_scale_type);
@@ -1171,6 +1179,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 }
             }
 
+            /* xmm[0] <-- post_ops(xmm[0]) */
+            apply_eltwise_post_ops(reg_unroll, ur_step);
+
             /* dst <-- dst_scales * xmm[0] */
             apply_scales(
                     xmm_dst_scales_, scale_arg_t::DST, prb_.dst_scale_type);
@@ -1322,12 +1333,48 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         }
     }
 
+    // Packed operations are used for both the vector and the scalar paths:
+    // the lanes that are not stored are ignored.
+    void apply_eltwise_post_ops(int reg_unroll, int ur_step) {
+        using namespace alg_kind;
+        for (const auto &e : prb_.eltwise_post_ops) {
+            switch (e.alg) {
+                case eltwise_relu:
+                    assert(e.alpha == 0.f);
+                    uni_vxorps(xmm_tmp_, xmm_tmp_, xmm_tmp_);
+                    for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                        uni_vmaxps(Xmm(ur), Xmm(ur), xmm_tmp_);
+                    break;
+                case eltwise_linear:
+                    init_vmm(xmm_tmp_, reg_tmp_, e.alpha);
+                    for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                        uni_vmulps(Xmm(ur), Xmm(ur), xmm_tmp_);
+                    if (e.beta == 0.f) break;
+                    init_vmm(xmm_tmp_, reg_tmp_, e.beta);
+                    for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                        uni_vaddps(Xmm(ur), Xmm(ur), xmm_tmp_);
+                    break;
+                case eltwise_clip:
+                case eltwise_clip_v2:
+                    init_vmm(xmm_tmp_, reg_tmp_, e.alpha);
+                    for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                        uni_vmaxps(Xmm(ur), Xmm(ur), xmm_tmp_);
+                    init_vmm(xmm_tmp_, reg_tmp_, e.beta);
+                    for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                        uni_vminps(Xmm(ur), Xmm(ur), xmm_tmp_);
+                    break;
+                default: assert(!"unsupported eltwise post-op");
+            }
+        }
+    }
+
     bool interim_f32_needed() {
         using namespace data_type;
 
         return utils::one_of(f32, prb_.itype, prb_.otype)
                 || prb_.src_scale_type != scale_type_t::NONE
                 || prb_.dst_scale_type != scale_type_t::NONE || prb_.beta != 0.f
+                || !prb_.eltwise_post_ops.empty()
                 || ((prb_.req_src_zp || prb_.req_dst_zp)
                                 ? !(prb_.itype == s32 && prb_.otype == s32)
                                 : false)
@@ -1958,6 +2005,7 @@ struct jit_single_blk_kernel_t : public jit_generator {
                 && p.dst_scale_type == scale_type_t::NONE
                 && utils::one_of(p.itype, f32) && utils::one_of(p.otype, f32)
                 && utils::everyone_is(0, p.ioff, p.ooff) && p.beta == 0.f
+                && p.eltwise_post_ops.empty()
                 && prb_has_small_strides(p);
         if (!ok) return false;
 
@@ -2321,6 +2369,59 @@ kernel_t *kernel_t::create(const kernel_t::desc_t &desc) {
 
 } // namespace tr
 
+/* Blocks a permutation-only problem into square tiles swapping the unit
+ * output stride node and the unit input stride node, so the kernel can
+ * transpose them in registers:
+ * [n0:is0:1]..[nk:1:osk] --> [t:is0:1][t:1:osk][nk/t:t:osk*t][n0/t:is0*t:t]..
+ * The outer part of the unit input stride node goes next to keep reads
+ * sequential across consecutive tiles. Returns false if not applicable. */
+static bool prb_block_for_transpose(tr::prb_t &prb) {
+    using namespace data_type;
+
+    const bool ok = mayiuse(avx2) && prb.ndims >= 2
+            && prb.ndims + 2 < tr::max_ndims
+            && utils::one_of(
+                    prb.itype, u8, s8, f8_e5m2, f8_e4m3, s32, f32, bf16, f16)
+            && utils::one_of(
+                    prb.otype, u8, s8, f8_e5m2, f8_e4m3, s32, f32, bf16, f16)
+            && prb.src_scale_type == tr::scale_type_t::NONE
+            && prb.dst_scale_type == tr::scale_type_t::NONE
+            && !prb.req_src_zp && !prb.req_dst_zp && !prb.req_s8s8_comp
+            && !prb.req_asymmetric_comp && !prb.is_tail_present
+            && prb.beta == 0.f && prb.eltwise_post_ops.empty();
+    if (!ok) return false;
+
+    int unit_os_idx = -1, unit_is_idx = -1;
+    for (int d = 0; d < prb.ndims; ++d) {
+        if (prb.nodes[d].os == 1 && prb.nodes[d].is != 1) unit_os_idx = d;
+        if (prb.nodes[d].is == 1 && prb.nodes[d].os != 1) unit_is_idx = d;
+    }
+    if (unit_os_idx == -1 || unit_is_idx == -1) return false;
+
+    // Small tiles don't justify moving away from the cache blocking below.
+    static constexpr size_t min_transpose_sz = 64;
+    const size_t n_os = prb.nodes[unit_os_idx].n;
+    const size_t n_is = prb.nodes[unit_is_idx].n;
+    if (n_os < min_transpose_sz || n_is < min_transpose_sz) return false;
+
+    const size_t tile = (n_os % 16 == 0 && n_is % 16 == 0) ? 16
+            : (n_os % 8 == 0 && n_is % 8 == 0)             ? 8
+                                                           : 0;
+    if (tile == 0) return false;
+
+    // Put the unit output stride node first and the unit input stride node
+    // second, then split off their tiles and move the outer part of the
+    // unit output stride node behind the one of the unit input stride node.
+    prb_node_move(prb, unit_os_idx, 0);
+    if (unit_is_idx < unit_os_idx) ++unit_is_idx;
+    prb_node_move(prb, unit_is_idx, 1);
+    prb_node_split(prb, 1, tile);
+    prb_node_split(prb, 0, tile);
+    prb_node_move(prb, 1, 3);
+
+    return true;
+}
+
 static void prb_block_for_cache(tr::prb_t &prb) {
     /* If strides for 0th and 1st nodes are cache friendly
      * then one can altogether do away with blocking ! */
@@ -2515,7 +2616,8 @@ static void prb_thread_kernel_balance(
 
 status_t jit_uni_reorder_t::pd_t::init(
         engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
-    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine,
+            /* allow_eltwise_post_ops = */ true));
 
     CHECK(init_scratchpad());
 
@@ -2528,12 +2630,9 @@ status_t jit_uni_reorder_t::pd_t::init_scratchpad() {
     const bool compensation_needed
             = prb_.req_s8s8_comp || prb_.req_asymmetric_comp;
     if (compensation_needed) {
-        const memory_desc_wrapper od(dst_md());
-        const auto G = with_groups_ ? od.padded_dims()[0] : 1;
-        const auto N = od.padded_dims()[with_groups_ ? 1 : 0];
         static constexpr int cache_line_size = 16;
         const auto wspace_per_thr_size
-                = utils::rnd_up(G * N, cache_line_size) * sizeof(int32_t);
+                = utils::rnd_up(comp_size_, cache_line_size) * sizeof(int32_t);
 
         const auto compensation_reduce_size = wspace_per_thr_size * nthr_;
 
@@ -2571,7 +2670,7 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
     status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
     if (prb_init_status != status::success) return prb_init_status;
 
-    prb_block_for_cache(prb);
+    if (!prb_block_for_transpose(prb)) prb_block_for_cache(prb);
     DEBUG({
         printf("cache: ");
         prb_dump(prb);
@@ -2603,8 +2702,13 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     _pd->nthr_ = nthr;
     _pd->prb_ = prb;
-    _pd->with_groups_
-            = prb.compensation_mask == tr::prb_t::comp_mask_with_groups;
+    if (prb.req_s8s8_comp || prb.req_asymmetric_comp) {
+        const memory_desc_wrapper od(*dst_md);
+        _pd->comp_size_ = 1;
+        for (int d = 0; d < od.ndims(); ++d)
+            if (prb.compensation_mask & (1 << d))
+                _pd->comp_size_ *= od.padded_dims()[d];
+    }
     CHECK(_pd->init(engine, src_engine, dst_engine));
     _pd->ker_desc_ = ker_desc;
     CHECK(_pd->init_scratchpad_md());
@@ -2821,11 +2925,9 @@ void jit_uni_reorder_t::omp_driver(const char *in, char *out,
     int32_t *compensation_reduce_scratch = scratchpad.template get<int32_t>(
             memory_tracking::names::key_reorder_space);
 
-    const memory_desc_wrapper od(pd()->dst_md());
-    const auto G = pd()->with_groups_ ? od.padded_dims()[0] : 1;
-    const auto N = od.padded_dims()[pd()->with_groups_ ? 1 : 0];
     static constexpr int cache_line_size = 16;
-    const auto wspace_per_thr_size = utils::rnd_up(G * N, cache_line_size);
+    const auto wspace_per_thr_size
+            = utils::rnd_up(pd()->comp_size_, cache_line_size);
     const auto wspace_per_thr_bytes = wspace_per_thr_size * sizeof(int32_t);
 
     if (ndims - ndims_ker == 0) {
@@ -2885,9 +2987,7 @@ void jit_uni_reorder_t::reduce_compensation(char *out,
 
     // Note: We do not need to explicitly zero-out compensation buffer, as the
     // per_thread buffers are already zeroed out in the padded area.
-    const auto G = pd()->with_groups_ ? od.padded_dims()[0] : 1;
-    const auto N = od.padded_dims()[pd()->with_groups_ ? 1 : 0];
-    const auto GN = G * N;
+    const auto GN = pd()->comp_size_;
     const bool req_s8s8_comp = pd()->prb_.req_s8s8_comp;
     const bool req_asymmetric_comp = pd()->prb_.req_asymmetric_comp;
     const size_t zp_offset
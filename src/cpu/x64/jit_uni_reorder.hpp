@@ -18,8 +18,10 @@
 #define CPU_X64_JIT_UNI_REORDER_HPP
 
 #include <assert.h>
+#include <vector>
 
 #include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/reorder/cpu_reorder_pd.hpp"
@@ -57,7 +59,9 @@ struct prb_t {
      * Possible values for reorder:
      *     1) standard compensation = 1 = 0b01
      *     2) asymmetric compensation = 2 = 0b10
-     *     3) compensation if tensor contains group = 3 = 0b11 */
+     *     3) compensation if tensor contains group = 3 = 0b11
+     * Matmul weights use all dimensions except K, e.g. 0b10 for 2D and 0b101
+     * for 3D tensors. */
     static constexpr int invalid_comp_mask = 0;
     static constexpr int standard_comp_mask = 0b1;
     static constexpr int asymmetric_comp_mask = 0b10;
@@ -113,6 +117,8 @@ struct prb_t {
     scale_type_t src_scale_type;
     scale_type_t dst_scale_type;
     float beta;
+    // Eltwise post-ops applied after the sum, before destination scales.
+    std::vector<post_ops_t::entry_t::eltwise_t> eltwise_post_ops;
     int full_ndims;
     bool is_tail_present = false;
     float scale_adjust = 1.f;
@@ -220,7 +226,9 @@ struct jit_uni_reorder_t : public primitive_t {
         tr::prb_t prb_;
         tr::kernel_t::desc_t ker_desc_;
         int nthr_;
-        bool with_groups_ = false;
+        // Number of compensation values, product of the padded dimensions
+        // covered by the compensation mask.
+        dim_t comp_size_ = 0;
         dim_t D_mask_ = 0;
 
         status_t init(
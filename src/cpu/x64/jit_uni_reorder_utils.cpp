@@ -194,9 +194,27 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
     auto im_d = memory_desc_wrapper(imd);
     auto om_d = memory_desc_wrapper(omd);
 
-    auto check_post_ops = [](const primitive_attr_t *attr) {
+    // An optional sum may be followed by eltwise post-ops the kernel computes
+    // with plain arithmetic. They are not combined with compensations or zero
+    // points.
+    auto check_post_ops = [&](const primitive_attr_t *attr) {
+        using namespace alg_kind;
         const auto &po = attr->post_ops_;
-        return po.len() == 0 || (po.len() == 1 && po.entry_[0].is_sum(false));
+        for (int i = 0; i < po.len(); i++) {
+            const auto &e = po.entry_[i];
+            if (e.is_sum(false) && i == 0) continue;
+            if (!e.is_eltwise()) return false;
+            const auto &elt = e.eltwise;
+            const bool alg_ok
+                    = (elt.alg == eltwise_relu && elt.alpha == 0.f)
+                    || utils::one_of(elt.alg, eltwise_linear, eltwise_clip,
+                            eltwise_clip_v2);
+            if (!alg_ok) return false;
+            if (om_d.extra().flags != memory_extra_flags::none
+                    || !attr->zero_points_.has_default_values())
+                return false;
+        }
+        return true;
     };
 
     bool ok = im_d.is_blocking_desc() && om_d.is_blocking_desc()
@@ -302,8 +320,14 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
 
     const bool with_groups = is_with_groups(omd);
 
+    // Matmul weights keep compensation for all dimensions except K.
+    const int md_ndims = om_d.ndims();
+    const int matmul_comp_mask = md_ndims >= 2
+            ? (1 << md_ndims) - 1 - (1 << (md_ndims - 2))
+            : -1;
     auto mask_ok = [&](bool check, int mask) {
-        return IMPLICATION(check, mask == (with_groups ? 0x3 : 0x1));
+        return IMPLICATION(check,
+                mask == (with_groups ? 0x3 : 0x1) || mask == matmul_comp_mask);
     };
 
     if (!mask_ok(p.req_s8s8_comp, om_d.extra().compensation_mask)
@@ -311,6 +335,12 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
                     om_d.extra().asymm_compensation_mask))
         return status::unimplemented;
 
+    // A single set of compensation strides serves both buffers.
+    if (p.req_s8s8_comp && p.req_asymmetric_comp
+            && om_d.extra().compensation_mask
+                    != om_d.extra().asymm_compensation_mask)
+        return status::unimplemented;
+
     ptrdiff_t ss[max_ndims] = {0}; // scales strides
     if (p.src_scale_type == scale_type_t::MANY
             || p.dst_scale_type == scale_type_t::MANY) {
@@ -339,11 +369,9 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
                 : (p.req_asymmetric_comp ? om_d.extra().asymm_compensation_mask
                                          : tr::prb_t::invalid_comp_mask);
 
-        if (p.compensation_mask == tr::prb_t::asymmetric_comp_mask)
-            return unimplemented;
-
         assert(p.compensation_mask == tr::prb_t::standard_comp_mask
-                || p.compensation_mask == tr::prb_t::comp_mask_with_groups);
+                || p.compensation_mask == tr::prb_t::comp_mask_with_groups
+                || p.compensation_mask == matmul_comp_mask);
     }
 
     int ndims = 0;
@@ -426,6 +454,8 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
 
     const int sum_idx = attr->post_ops_.find(primitive_kind::sum);
     p.beta = sum_idx == -1 ? 0.f : attr->post_ops_.entry_[sum_idx].sum.scale;
+    for (const auto &e : attr->post_ops_.entry_)
+        if (e.is_eltwise()) p.eltwise_post_ops.push_back(e.eltwise);
 
     DEBUG({
         printf("init : ");
@@ -514,17 +514,33 @@ status_t jit_uni_resampling_fwd_t::interpolate_linear(const uint8_t *src,
     const dim_t IW = pd()->IW();
 
     if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::ncsp) {
-        parallel_nd(MB, C, [&](dim_t mb, dim_t c) {
+        // Large upsampling of few channels does not occupy all the threads,
+        // so the output plane is split into vector aligned batches of points.
+        const dim_t sp = OD * OH * OW;
+        const dim_t simd_w = kernel_->get_simd_w();
+        const dim_t nthr = dnnl_get_max_threads();
+        const dim_t max_sp_chunks = MB * C < nthr
+                ? nstl::min(utils::div_up(nthr, MB * C),
+                        utils::div_up(sp, simd_w))
+                : 1;
+        const dim_t sp_chunk
+                = utils::rnd_up(utils::div_up(sp, max_sp_chunks), simd_w);
+        const dim_t sp_chunks = utils::div_up(sp, sp_chunk);
+
+        parallel_nd(MB, C, sp_chunks, [&](dim_t mb, dim_t c, dim_t spc) {
+            const dim_t sp_start = spc * sp_chunk;
+            const dim_t sp_work = nstl::min(sp_chunk, sp - sp_start);
             const dim_t src_off = (mb * C + c) * ID * IH * IW * src_dt_size;
-            const dim_t dst_off = (mb * C + c) * OD * OH * OW * dst_dt_size;
+            const dim_t dst_off
+                    = ((mb * C + c) * sp + sp_start) * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
-            args.batch_of_sp_points_to_process = OW * OH * OD;
+            args.batch_of_sp_points_to_process = sp_work;
             args.src = src + src_off;
             args.dst = dst + dst_off;
             args.dst_orig = dst;
-            args.indices = &indices_[0];
-            args.weights = &weights_[0];
+            args.indices = &indices_[sp_start];
+            args.weights = &weights_[sp_start];
             args.post_ops_binary_rhs_arg_vec = post_ops_args.data();
             args.c_offset = static_cast<size_t>(c);
 
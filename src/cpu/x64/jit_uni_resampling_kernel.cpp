@@ -603,7 +603,15 @@ void jit_uni_resampling_kernel_t<isa, Vmm>::linear_ncsp_format() {
     }
     L(loop_end);
 
-    if (tail_size_ > 0) linear_interpolation(true);
+    // The tail belongs to the last batch of spatial points only when the
+    // spatial dimensions are split between several calls.
+    if (tail_size_ > 0) {
+        Label tail_end;
+        cmp(reg_work_, 0);
+        jle(tail_end, T_NEAR);
+        linear_interpolation(true);
+        L(tail_end);
+    }
 }
 
 template <cpu_isa_t isa, typename Vmm>
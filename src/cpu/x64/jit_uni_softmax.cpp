@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <cstring>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -102,6 +103,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     Vmm vsbr = vsum; // must be not equal to vmax
     Vmm vzero = Vmm(is_superset(isa, avx512_core) ? 21 : 11);
     Vmm vcvt_vmm = Vmm(is_superset(isa, avx512_core) ? 22 : 10);
+    Vmm vsoftmax_scale = Vmm(is_superset(isa, avx512_core) ? 27 : 9);
     Vmm vsaturation_ubound = vneg_flt_max;
 
     bool is_bf16_ = false;
@@ -110,12 +112,15 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
     bool axis_has_padding_;
+    bool use_online_softmax_;
     bool need_scratchpad_;
     bool with_postops_ = false;
     bool with_binary_ = false;
     bool with_eltwise_ = false;
     bool with_src_scales_ = false;
     bool with_dst_scales_ = false;
+    bool with_softmax_scale_ = false;
+    bool with_causal_mask_ = false;
     bool use_ext_aux_vmms_ = false;
 
     size_t unroll_regs_ = 4;
@@ -151,6 +156,9 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     void compute_predefined_variables() {
         n_loops_ = axis_simd_full_ / unroll_regs_;
         loop_tail_ = axis_simd_full_ - n_loops_ * unroll_regs_;
+        // With causal mask the row length is known at runtime only, thus, the
+        // rest of full vregs is processed one by one.
+        if (with_causal_mask_) loop_tail_ = axis_simd_full_ ? 1 : 0;
         process_n_elems_ = compute_process_n_elems(dst_d_);
         src_next_vreg_stride_ = compute_next_vreg_stride(src_d_);
         interim_next_vreg_stride_ = simd_w_ * sizeof(float);
@@ -182,6 +190,12 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         mov(reg_tmp, float2int(-FLT_MAX));
         uni_vmovq(xneg_flt_max, reg_tmp);
         uni_vbroadcastss(vneg_flt_max, xneg_flt_max);
+        if (with_softmax_scale_) {
+            const Xmm xsoftmax_scale = Xmm(vsoftmax_scale.getIdx());
+            mov(reg_tmp, float2int(pd_->attr()->softmax_params_.scale_));
+            uni_vmovq(xsoftmax_scale, reg_tmp);
+            uni_vbroadcastss(vsoftmax_scale, xsoftmax_scale);
+        }
 
 #define PARAM_OFF(x) offsetof(call_params_t, x)
         mov(reg_process_n_elems, ptr[reg_param + PARAM_OFF(process_n_elems)]);
@@ -199,6 +213,25 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
     }
 
+    // With causal mask the number of elements to process varies from row to
+    // row, thus, the tail opmask is built from `process_n_elems` at runtime.
+    void prepare_runtime_tail_opmask() {
+        assert(is_superset(isa, avx512_core));
+        Reg64 reg_tail = reg_reverse_n_elems; // reset in `axis_loop`
+        mov(reg_tail, reg_process_n_elems);
+        and_(reg_tail, simd_w_ - 1);
+        mov(reg_tmp, 1);
+        shlx(reg_tmp, reg_tmp, reg_tail);
+        sub(reg_tmp, 1);
+        kmovw(tail_opmask, reg_tmp.cvt32());
+    }
+
+    // The softmax scale is applied to a difference with the maximum which is
+    // searched over unscaled values. It is valid for positive scales only.
+    void apply_softmax_scale(const Vmm &vmm) {
+        if (with_softmax_scale_) uni_vmulps(vmm, vmm, vsoftmax_scale);
+    }
+
     Address diff_src_ptr(size_t offt = 0) {
         return vmmword[reg_diff_src + reg_src_spat_offt + offt];
     }
@@ -312,12 +345,13 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                 if (!pd_->is_fwd())
                     add(reg_diff_dst_spat_offt,
                             loop_tail_ * diff_dst_next_vreg_stride_);
+                if (with_causal_mask_) jmp(body_unroll_tail_loop);
             }
         }
 
         L(tail_axis);
         {
-            if (axis_simd_tail_) {
+            if (axis_simd_tail_ || with_causal_mask_) {
                 cmp(reg_reverse_n_elems, 1);
                 jl(loop_end, T_NEAR);
 
@@ -394,6 +428,24 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         return Vmm(vmm.getIdx() + unroll);
     }
 
+    // Applies exp to `vmm_idxs`. When the injector doesn't preserve its state,
+    // aux vmms are taken consecutively starting from `aux_start_idx`.
+    void compute_exp(const injector_utils::vmm_index_set_t &vmm_idxs,
+            size_t aux_start_idx) {
+        if (!use_ext_aux_vmms_) {
+            exp_injector_->compute_vector_range(vmm_idxs);
+            return;
+        }
+
+        injector_utils::vmm_index_set_t exp_aux_indices;
+        const auto exp_vmm_aux_count
+                = jit_uni_eltwise_injector_f32<isa>::aux_vecs_count(
+                        alg_kind::eltwise_exp, pd_->is_fwd(), 0.f);
+        for (size_t j = 0; j < exp_vmm_aux_count; j++)
+            exp_aux_indices.insert(aux_start_idx + j);
+        exp_injector_->compute_vector_range(vmm_idxs, exp_aux_indices);
+    }
+
     // TODO: introduce independent vmax split code for SRF.
     // Use ne_convert instruction to load xf16 even/odd elements from memory
     void accumulate_avx2_ne_xf16_vmax() {
@@ -533,6 +585,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                     const auto vreg_tmp_src
                             = i_odd ? vreg_tmp_src_odd : vreg_tmp_src_even;
                     uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                    apply_softmax_scale(vreg_tmp_src);
                     if (is_logsoftmax_) { // store before applying exp
                         if (need_scratchpad_)
                             store(interim_ptr(interim_next_vreg_stride_
@@ -593,6 +646,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                 io_[src_d_.data_type()]->load(
                         src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src, tail);
                 uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                apply_softmax_scale(vreg_tmp_src);
                 if (is_logsoftmax_) { // store before applying exp
                     if (need_scratchpad_)
                         store(interim_ptr(interim_next_vreg_stride_ * i),
@@ -677,6 +731,70 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
 
+    // Computes the maximum and the sum of exponents in a single pass. Each lane
+    // keeps its own running maximum and its partial sum is rescaled by
+    // `exp(old_max - new_max)` every time the maximum grows. Lanes are
+    // synchronized once after the loop, and `compute_dst` recomputes exponents
+    // from `src` instead of reading them back from `dst` or an interim buffer.
+    void accumulate_vmax_vsum_online() {
+        uni_vmovups(vmax, vneg_flt_max);
+        uni_vpxor(vsum, vsum, vsum);
+
+        const auto pre_body = [](int max_unroll) {};
+
+        const auto body = [&](int unroll, int max_unroll, bool tail = false) {
+            Vmm vreg_tmp_max = Vmm(max_unroll + 1);
+            Vmm vreg_tmp_rescale = Vmm(max_unroll + 2);
+            injector_utils::vmm_index_set_t exp_idxs;
+
+            uni_vmovups(vreg_tmp_max, vmax);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                io_[src_d_.data_type()]->load(
+                        src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src, tail);
+                uni_vmaxps_maybe_tail(vreg_tmp_max, vreg_tmp_src,
+                        vtmp = vreg_tmp_rescale, tail);
+                exp_idxs.insert(vreg_tmp_src.getIdx());
+            }
+            uni_vsubps(vreg_tmp_rescale, vmax, vreg_tmp_max);
+            apply_softmax_scale(vreg_tmp_rescale);
+            uni_vmovups(vmax, vreg_tmp_max);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                apply_softmax_scale(vreg_tmp_src);
+            }
+            exp_idxs.insert(vreg_tmp_rescale.getIdx());
+            compute_exp(exp_idxs, max_unroll + 3);
+
+            uni_vmulps(vsum, vsum, vreg_tmp_rescale);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                uni_vaddps_maybe_tail(
+                        vsum, vreg_tmp_src, vtmp = vreg_tmp_max, tail);
+            }
+        };
+
+        const auto post_body = [](int max_unroll) {};
+
+        axis_loop(pre_body, body, post_body);
+
+        // Bring partial sums of all lanes to a common maximum.
+        Vmm vreg_tmp_lane_max = Vmm(1);
+        Vmm vreg_tmp = Vmm(2);
+        uni_vmovups(vreg_tmp_lane_max, vmax);
+        get_horizontal_op(vmax, vtmp = vreg_tmp, op_t::max);
+        uni_vsubps(vreg_tmp_lane_max, vreg_tmp_lane_max, vmax);
+        apply_softmax_scale(vreg_tmp_lane_max);
+        compute_exp({static_cast<size_t>(vreg_tmp_lane_max.getIdx())}, 3);
+        uni_vmulps(vsum, vsum, vreg_tmp_lane_max);
+        get_horizontal_op(vsum, vtmp = vreg_tmp, op_t::sum);
+        uni_vdivps(vsum, vone, vsum, vtmp = vreg_tmp);
+
+        // `vneg_flt_max` is no longer needed and can be used for saturation.
+        io_.init_saturate_f32({dst_d_.data_type()});
+    }
+
     // Use ne_convert instruction to load xf16 even/odd elements from memory
     void compute_avx2_ne_xf16_dst() {
         const auto pre_body = [](int max_unroll) {};
@@ -763,7 +881,11 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         const auto body = [&](int unroll, int max_unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (need_scratchpad_)
+                if (use_online_softmax_)
+                    io_[src_d_.data_type()]->load(
+                            src_ptr(src_next_vreg_stride_ * i), vreg_tmp_src,
+                            tail);
+                else if (need_scratchpad_)
                     io_[f32]->load(interim_ptr(interim_next_vreg_stride_ * i),
                             vreg_tmp_src, tail);
                 else
@@ -771,6 +893,16 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                             dst_ptr(dst_next_vreg_stride_ * i), vreg_tmp_src,
                             tail);
             }
+            if (use_online_softmax_) {
+                injector_utils::vmm_index_set_t exp_idxs;
+                for (int i = 0; i < unroll; i++) {
+                    Vmm vreg_tmp_src = Vmm(i + 1);
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                    apply_softmax_scale(vreg_tmp_src);
+                    exp_idxs.insert(vreg_tmp_src.getIdx());
+                }
+                compute_exp(exp_idxs, max_unroll + 1);
+            }
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
                 Vmm vreg_tmp_scale = get_aux_vmm(vreg_tmp_src, 1 * max_unroll);
@@ -877,8 +1009,12 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     }
 
     void forward() {
-        accumulate_vmax();
-        accumulate_vsum();
+        if (use_online_softmax_) {
+            accumulate_vmax_vsum_online();
+        } else {
+            accumulate_vmax();
+            accumulate_vsum();
+        }
         compute_dst();
     }
 
@@ -929,6 +1065,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         if (log_injector_) log_injector_->load_table_addr();
         if (axis_simd_tail_) io_.prepare_tail_mask();
         load_common_params();
+        if (with_causal_mask_) prepare_runtime_tail_opmask();
         if (pd_->is_fwd())
             forward();
         else
@@ -940,7 +1077,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
             postops_injector_->prepare_table(/* generate = */ true);
     }
 
-    jit_softmax_dense_kernel_t(const softmax_pd_t *pd)
+    jit_softmax_dense_kernel_t(const softmax_pd_t *pd, bool use_online_softmax)
         : jit_softmax_kernel_base_t(pd)
         , jit_generator(jit_name(), isa)
         , src_d_(pd_->invariant_src_md())
@@ -950,8 +1087,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         , is_f16_(utils::one_of(f16, src_d_.data_type(), dst_d_.data_type()))
         , is_avx2_ne_xf16_(mayiuse(avx2_vnni_2) && !mayiuse(avx512_core)
                   && (is_bf16_ || is_f16_))
+        , use_online_softmax_(use_online_softmax)
         // Note: must be aligned with pd_t::init()->init_scratchpad();
-        , need_scratchpad_(pd_->is_fwd() && dst_d_.data_type() != f32)
+        , need_scratchpad_(pd_->is_fwd() && dst_d_.data_type() != f32
+                  && !use_online_softmax_)
         , use_ext_aux_vmms_(!is_logsoftmax_ && n_vregs > 16)
         , axis_simd_full_(pd_->axis_size() / simd_w_)
         , axis_simd_tail_(pd_->axis_size() % simd_w_) {
@@ -967,6 +1106,10 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         with_dst_scales_ = is_superset(isa, avx2)
                 && !attr_scales.get(DNNL_ARG_DST).has_default_values();
 
+        const auto &softmax_params = pd_->attr()->softmax_params_;
+        with_softmax_scale_ = softmax_params.scale_ != 1.f;
+        with_causal_mask_ = softmax_params.mask_ == softmax_mask::causal;
+
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
                 tail_opmask_idx_, tail_vmask.getIdx(), reg_tmp);
@@ -1542,14 +1685,15 @@ struct jit_softmax_strided_kernel_t : jit_softmax_kernel_base_t,
 // class is easier though certain pieces are same.
 jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create(
         const softmax_pd_t *pd, const cpu_isa_t isa,
-        bool axis_is_plain_and_strided) {
+        bool axis_is_plain_and_strided, bool use_online_softmax) {
 
 #define HANDLE_ISA(isa_) \
     if ((isa_) == isa) { \
         if (axis_is_plain_and_strided) \
             return new jit_softmax_strided_kernel_t<isa_>(pd); \
         else \
-            return new jit_softmax_dense_kernel_t<isa_>(pd); \
+            return new jit_softmax_dense_kernel_t<isa_>( \
+                    pd, use_online_softmax); \
     }
     REG_AVX512_ISA(HANDLE_ISA(avx512_core_fp16));
     REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
@@ -1585,7 +1729,8 @@ jit_uni_softmax_fwd_t::jit_uni_softmax_fwd_t(const pd_t *apd)
 status_t jit_uni_softmax_fwd_t::init(engine_t *engine) {
     CHECK(safe_ptr_assign(ker_,
             softmax_impl::jit_softmax_kernel_base_t::create(
-                    pd(), pd()->isa_, pd()->axis_is_plain_and_strided_)));
+                    pd(), pd()->isa_, pd()->axis_is_plain_and_strided_,
+                    pd()->use_online_softmax_)));
     if (ker_) CHECK(ker_->create_kernel());
     return status::success;
 }
@@ -1651,6 +1796,13 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     const int nthr = pd()->nthr_;
     const char *dst_orig_ptr = dst;
 
+    const bool with_causal_mask
+            = pd()->attr()->softmax_params_.mask_ == softmax_mask::causal;
+    // Causal mask implies a plain layout with the last axis, thus, `ou` walks
+    // over rows of the last two dimensions.
+    const dim_t n_queries
+            = with_causal_mask ? src_d.dims()[src_d.ndims() - 2] : 1;
+
     VDEBUGINFO(1, primitive, softmax,
             "%s,src=%p dst=%p outer_size=%" PRId64 " outer_stride=%" PRId64
             " inner_size=%" PRId64 " inner_stride=%" PRId64
@@ -1677,6 +1829,19 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
                 } else {
                     p.process_n_elems = process_n_elems;
                 }
+                if (with_causal_mask) {
+                    // Masked elements are skipped by the kernel entirely and
+                    // their dst values are zeroed here.
+                    const dim_t axis_size = pd()->axis_size();
+                    const dim_t n_valid = nstl::max(dim_t(0),
+                            nstl::min(axis_size,
+                                    ou % n_queries + 1 + axis_size
+                                            - n_queries));
+                    std::memset(dst_ptr + n_valid * dst_data_type_size, 0,
+                            (axis_size - n_valid) * dst_data_type_size);
+                    if (n_valid == 0) return;
+                    p.process_n_elems = n_valid;
+                }
                 p.src = src_ptr;
                 p.dst = dst_ptr;
                 p.interim = interim_ptr;
@@ -1698,7 +1863,7 @@ jit_uni_softmax_bwd_t::jit_uni_softmax_bwd_t(const pd_t *apd)
 status_t jit_uni_softmax_bwd_t::init(engine_t *engine) {
     CHECK(safe_ptr_assign(ker_,
             softmax_impl::jit_softmax_kernel_base_t::create(
-                    pd(), pd()->isa_, false)));
+                    pd(), pd()->isa_, false, false)));
     if (ker_) CHECK(ker_->create_kernel());
     return status::success;
 }
@@ -26,6 +26,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_softmax_pd.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
@@ -41,7 +42,8 @@ namespace softmax_impl {
 // the kernel.
 struct jit_softmax_kernel_base_t {
     static jit_softmax_kernel_base_t *create(const softmax_pd_t *pd,
-            const cpu_isa_t isa, bool axis_is_plain_and_strided);
+            const cpu_isa_t isa, bool axis_is_plain_and_strided,
+            bool use_online_softmax);
 
     virtual ~jit_softmax_kernel_base_t() = default;
 
@@ -132,7 +134,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
             VDISPATCH_SOFTMAX(
                     attr()->has_default_values(skip_mask_t::scales_runtime
-                            | skip_mask_t::post_ops),
+                            | skip_mask_t::post_ops
+                            | skip_mask_t::softmax_params),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_SOFTMAX(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
 
@@ -158,6 +161,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
             const memory_desc_wrapper dst_d(dst_md());
             axis_is_plain_and_strided_ = dst_d.is_plain() && axis_stride() > 1;
+            VDISPATCH_SOFTMAX(softmax_params_ok(), VERBOSE_UNSUPPORTED_ATTR);
+            use_online_softmax_ = online_softmax_ok();
             nthr_ = dnnl_get_max_threads();
             init_scratchpad();
 
@@ -168,10 +173,57 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         size_t scratch_size_per_thr_ = 0;
         cpu_isa_t isa_ = isa_undef;
         bool axis_is_plain_and_strided_ = false;
+        bool use_online_softmax_ = false;
 
     private:
+        bool softmax_params_ok() const {
+            using namespace format_tag;
+            const auto &softmax_params = attr()->softmax_params_;
+            if (softmax_params.has_default_values()) return true;
+
+            // The dense kernel finds the maximum over unscaled values.
+            if (softmax_params.scale_ <= 0.f || axis_is_plain_and_strided_)
+                return false;
+            if (softmax_params.mask_ == softmax_mask::none) return true;
+
+            // Causal mask makes row lengths runtime values which relies on
+            // opmask-based tails. Masked elements are zeroed outside of the
+            // kernel, thus, no post-ops can be applied to them.
+            return is_superset(isa_, avx512_core)
+                    && attr()->post_ops_.has_default_values() && ndims() <= 6
+                    && memory_desc_matches_tag(*src_md(),
+                            utils::pick(ndims() - 2, ab, abc, abcd, abcde,
+                                    abcdef));
+        }
+
+        // Online softmax computes the maximum and the sum of exponents in a
+        // single pass over `src` and doesn't keep an interim buffer. It
+        // trades an extra exponent per element for less memory traffic, thus,
+        // it's used only when a row doesn't fit in L2 cache.
+        bool online_softmax_ok() const {
+            using namespace data_type;
+            const memory_desc_wrapper src_d(src_md());
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            // Keep aligned with `is_avx2_ne_xf16_` in the kernel.
+            const bool is_avx2_ne_xf16 = mayiuse(avx2_vnni_2)
+                    && !mayiuse(avx512_core)
+                    && (utils::one_of(bf16, src_dt, dst_dt)
+                            || utils::one_of(f16, src_dt, dst_dt));
+            if (!is_softmax() || !is_superset(isa_, avx2) || is_avx2_ne_xf16
+                    || !src_d.is_plain() || axis_is_plain_and_strided_)
+                return false;
+
+            // The regular kernel goes over `src` and over f32 `dst` (or an f32
+            // interim buffer) twice per row.
+            const size_t row_size = axis_size()
+                    * (types::data_type_size(src_dt) + sizeof(float));
+            return row_size > platform::get_per_core_cache_size(2);
+        }
+
         void init_scratchpad() {
-            if (dst_md()->data_type != data_type::f32) {
+            if (dst_md()->data_type != data_type::f32
+                    && !use_online_softmax_) {
                 auto scratchpad = scratchpad_registry().registrar();
                 // When stride != 1, then each thread operates over simd at a
                 // time, thus, increased scratchpad size.
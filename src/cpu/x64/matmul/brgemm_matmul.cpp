@@ -57,7 +57,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
     const bool is_f16
             = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
-    const bool is_bf16_with_int_wei = src_dt == bf16 && one_of(wei_dt, s8, u8)
+    const bool is_f8_wei = one_of(wei_dt, f8_e5m2, f8_e4m3);
+    const bool is_bf16_with_int_wei = src_dt == bf16
+            && (one_of(wei_dt, s8, u8) || is_f8_wei)
             && one_of(dst_dt, bf16, f32);
 
     auto check_bias = [&]() -> bool {
@@ -84,8 +86,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         return ok;
     };
 
-    auto check_attr_zero_points
-            = [&]() -> bool { return attr()->zero_points_.common(); };
+    auto check_attr_zero_points = [&]() -> bool {
+        return attr()->zero_points_.common()
+                && IMPLICATION(is_f8_wei,
+                        attr()->zero_points_.has_default_values(
+                                DNNL_ARG_WEIGHTS));
+    };
     const bool problem_dt_correct = one_of(
             true, is_int8, is_bf16, is_f32, is_f16, is_bf16_with_int_wei);
 
@@ -204,6 +210,15 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             : N();
     book_precomputed_scales(scratchpad, attr()->scales_, wei_scale_count);
 
+    VINFO(primitive, create, explain, matmul,
+            "%s,M_blk:%" PRId64 " N_blk:%" PRId64 " K_blk:%" PRId64
+            " batch:%d M_chunk:%d N_chunk:%d nthr:%d nthr_k:%d"
+            " buffer_a:%d buffer_b:%d buffer_c:%d",
+            info(engine), bgmmc_.M_blk, bgmmc_.N_blk, bgmmc_.K_blk,
+            bgmmc_.brgemm_batch_size, bgmmc_.M_chunk_size,
+            bgmmc_.N_chunk_size, bgmmc_.nthr, bgmmc_.nthr_k,
+            bgmmc_.use_buffer_a, bgmmc_.use_buffer_b, bgmmc_.use_buffer_c);
+
     return status::success;
 }
 
@@ -222,9 +237,12 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        // Kernels for the tails of runtime dimensions are generated on first
+        // use as only a few of them are executed for a given shape.
+        const bool is_runtime_tail = (bgmmc.is_runtime_M && i_M > 0)
+                || (bgmmc.is_runtime_N && i_N > 0);
+        if (!is_runtime_tail)
+            CHECK(brg_kernels_.insert(idx, &pd()->get_brg_desc(idx)));
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
     }
@@ -373,7 +391,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
 
-    return status::success;
+    return brg_kernels_.status();
 }
 
 template <cpu_isa_t isa>
@@ -431,13 +449,18 @@ void brgemm_matmul_t<isa>::compute_kernel(
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
         const bool is_amx = is_superset(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
-        assert(brg_kernel != nullptr);
+        const auto brg_kernel = brg_kernels_.get(
+                brg_ker_idx, &pd()->get_brg_desc(brg_ker_idx));
+        // The failure of a kernel generated on first use is reported by
+        // `execute_body`.
+        if (brg_kernel == nullptr) return;
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brg_ker_idx);
 
         brgmm_ctx.init_brgemm_batch_elements_values(
                 ithr, 0, gemm_batch, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
+        const int bs = brgmm_ctx.maybe_skip_zero_B_blks(
+                ithr, addr_batch, gemm_batch);
 
         if (post_ops_applicable && is_last_K_chunk && !is_K_tail) {
             void *scratch = is_amx
@@ -464,11 +487,11 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
                     false, brgmm_ctx.get_dst_scales_ptr()};
-            brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
+            brgemm_kernel_execute_postops(brg_kernel, bs, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
                     &leading_dimensions);
         } else {
-            brgemm_kernel_execute(brg_kernel, gemm_batch, addr_batch,
+            brgemm_kernel_execute(brg_kernel, bs, addr_batch,
                     (void *)ptr_C, is_amx ? (void *)wsp_tile : nullptr,
                     &leading_dimensions);
         }
@@ -488,7 +511,9 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brg_ker_idx);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel_k_tail = brg_kernels_.get(
+                brg_ker_idx, &pd()->get_brg_desc(brg_ker_idx));
+        if (brg_kernel_k_tail == nullptr) return;
 
         if (post_ops_applicable) {
             void *scratch = is_amx
@@ -614,7 +639,9 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 avx512_core_amx);
                         brgemm_palettes_.maybe_tile_configure(
                                 is_amx, prev_ker_idx, brg_ker_idx);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        const auto brg_kernel = brg_kernels_.get(brg_ker_idx,
+                                &pd()->get_brg_desc(brg_ker_idx));
+                        if (brg_kernel == nullptr) return;
                         const int m = brgmm_ctx.get_M_idx(mb);
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -732,8 +759,17 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
     const dim_t n = brgmm_ctx.get_N_idx(n_blk_idx, true);
 
     if (brgmm_ctx.packed_sparse_weights()) {
+        char *zero_blks = brgmm_ctx.get_B_zero_blks_ptr(ithr);
         for (int gb = 0; gb < gemm_batch + is_K_tail; gb++) {
             const int k = k_start + gb * bgmmc.K_blk;
+            // All-zero blocks are excluded from the brgemm batch, so there is
+            // no need to decompress them. The first block and the K tail are
+            // always decompressed as a batch may not be empty.
+            const bool is_zero = gb < gemm_batch
+                    && brgmm_ctx.is_zero_B_blk(b_idx, k, n);
+            zero_blks[gb] = is_zero;
+            if (is_zero && gb > 0) continue;
+
             auto p = jit_avx512_sparse_decompress_kernel_t::call_params_t();
             p.src_ptr = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
             p.bitmask_ptr
@@ -818,6 +854,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                     = CTX_IN_MEM(const int64_t *, DNNL_ARG_WEIGHTS, 1);
             data_B_bitmask_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 2);
             B_packed_sparse_block_size_ = weights_d.blk_size();
+            B_zero_blks_.reset(new char[static_cast<size_t>(bgmmc_.nthr)
+                    * (bgmmc_.brgemm_batch_size + 1)]);
         }
 
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
@@ -1135,6 +1173,41 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return data_B_bitmask_ptr_ + bitmask_off;
     }
 
+    // Whether the K_blk x wei_n_blk block of packed sparse weights starting
+    // at (k, n) has no non-zero elements, i.e. its bitmask is all zeros.
+    bool is_zero_B_blk(int b, int k, int n) const {
+        const auto *bitmask = reinterpret_cast<const uint64_t *>(
+                get_data_B_bitmask_ptr(b, k, n));
+        const dim_t nwords = (dim_t)bgmmc_.K_blk * bgmmc_.wei_n_blk / 64;
+        for (dim_t i = 0; i < nwords; i++)
+            if (bitmask[i] != 0) return false;
+        return true;
+    }
+
+    // Per-thread flags of the all-zero blocks of packed sparse weights for
+    // the current K chunk, filled by `copy_b_chunk_in_buffer`.
+    char *get_B_zero_blks_ptr(int ithr) const {
+        assert(bgmmc_.packed_sparse_weights);
+        return B_zero_blks_.get() + ithr * (bgmmc_.brgemm_batch_size + 1);
+    }
+
+    // Removes the all-zero blocks of packed sparse weights from the batch
+    // and returns the new batch size. The first element is kept if all of
+    // them are zeros, its weights are decompressed to zeros.
+    int maybe_skip_zero_B_blks(int ithr, brgemm_batch_element_t *addr_batch,
+            int gemm_batch) const {
+        if (!bgmmc_.packed_sparse_weights) return gemm_batch;
+
+        const char *zero_blks = get_B_zero_blks_ptr(ithr);
+        int bs = 0;
+        for (int gb = 0; gb < gemm_batch; gb++) {
+            if (zero_blks[gb]) continue;
+            if (bs != gb) addr_batch[bs] = addr_batch[gb];
+            bs++;
+        }
+        return nstl::max(bs, 1);
+    }
+
     char *get_data_C_ptr(int b, int m, int n) const {
         return data_C_ptr_ + get_data_C_off(b, m, n);
     }
@@ -1666,6 +1739,7 @@ private:
     // The size of a packed saprse block. E.g. the block
     // for a tag 'BA16a64b4a' is 4096.
     int B_packed_sparse_block_size_;
+    std::unique_ptr<char[]> B_zero_blks_;
 
     char *data_C_ptr_;
     brgemm_batch_element_t *batch_element_ptr_;
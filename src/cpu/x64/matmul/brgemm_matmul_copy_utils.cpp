@@ -18,6 +18,7 @@
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
+#include "cpu/x64/jit_avx512_core_fp8cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
@@ -2835,7 +2836,21 @@ struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
         , is_dynamic_N(conf->is_runtime_N)
         , req_cvtps2bf16(conf->is_bf32 || conf->is_bf16_with_int_wei)
         , req_zp_b_shift(conf->has_zero_point_b && conf->with_wei_decompression)
-        , req_apply_scales(conf->apply_scales_in_buffer_b) {}
+        , req_apply_scales(conf->apply_scales_in_buffer_b)
+        , is_f8_wei(conf->is_bf16_with_int_wei
+                  && utils::one_of(conf->orig_wei_dt, data_type::f8_e5m2,
+                          data_type::f8_e4m3)) {
+        if (!is_f8_wei) return;
+        assert(is_superset(conf->isa, avx512_core_fp16));
+        if (conf->orig_wei_dt == data_type::f8_e5m2)
+            f8_emulator_ = utils::make_unique<fp8_emulation_e5m2_t>(this,
+                    xmm_fp8_emu_aux1, xmm_fp8_emu_aux2, xmm_fp8_emu_aux3,
+                    kmask_fp8_aux, reg64_fp8_aux);
+        else
+            f8_emulator_ = utils::make_unique<fp8_emulation_e4m3_t>(this,
+                    xmm_fp8_emu_aux1, xmm_fp8_emu_aux2, xmm_fp8_emu_aux3,
+                    xmm_fp8_emu_aux4, xmm_fp8_emu_aux5, reg64_fp8_aux);
+    }
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -2855,6 +2870,9 @@ private:
     const bool req_cvtps2bf16;
     const bool req_zp_b_shift;
     const bool req_apply_scales;
+    // fp8 weights are up-converted to f32 in registers, scaled and then
+    // down-converted to bf16 together with the integer weights.
+    const bool is_f8_wei;
 
     constexpr static int reg_src_offs = 0;
 
@@ -2863,6 +2881,7 @@ private:
 
     opmask_t kTail = k7;
     opmask_t kFFFF = k6;
+    opmask_t kmask_fp8_aux = k1;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -2881,12 +2900,24 @@ private:
 
     reg64_t reg_dynamic_tail = rcx;
     Xbyak::Reg8 reg8_mask_shift = reg_dynamic_tail.cvt8();
+    reg64_t reg64_fp8_aux = rbp;
 
     Vmm vmm_zero = Vmm(0);
     Vmm vmm_permw = Vmm(1);
     Vmm vmm_tmp = Vmm(1); // used only for avx2_vnni_2
     Vmm vmm_zp_b_shift = Vmm(2);
 
+    // Zero points are not supported with fp8 weights, so the emulation
+    // registers may start right after vmm_permw.
+    const Xbyak::Zmm xmm_fp8_emu_aux1 = Xbyak::Zmm(2);
+    const Xbyak::Zmm xmm_fp8_emu_aux2 = Xbyak::Zmm(3);
+    const Xbyak::Zmm xmm_fp8_emu_aux3 = Xbyak::Zmm(4);
+    const Xbyak::Zmm xmm_fp8_emu_aux4 = Xbyak::Zmm(5);
+    const Xbyak::Zmm xmm_fp8_emu_aux5 = Xbyak::Zmm(6);
+    constexpr static int fp8_emu_regs = 5;
+
+    std::unique_ptr<fp8_emulation_base_t> f8_emulator_;
+
     void kmovx(Opmask k, unsigned w) {
         if (!isa_has_masks(conf_->isa)) return;
         const auto regw_tmp = reg_tmp.cvt32();
@@ -2924,7 +2955,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(int nrows, int ncolumns) {
     }
 
     static constexpr int blk_sz = k_blk_step;
-    const int reserved_regs = req_zp_b_shift ? 3 : 2;
+    const int reserved_regs
+            = is_f8_wei ? 2 + fp8_emu_regs : req_zp_b_shift ? 3 : 2;
     const int max_isa_regs = isa_num_vregs(conf_->isa);
     const int max_regs_available = max_isa_regs - reserved_regs;
     const int max_unroll = max_regs_available / blk_sz;
@@ -2955,13 +2987,19 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(int nrows, int ncolumns) {
             if (conf_->is_bf32)
                 uni_vmovups(src_load, load_addr);
             else if (conf_->is_bf16_with_int_wei) {
-                if (conf_->orig_wei_dt == data_type::s8)
-                    uni_vpmovsxbd(src_load, load_addr);
-                else
-                    uni_vpmovzxbd(src_load, load_addr);
-                if (req_zp_b_shift)
-                    uni_vpsubd(src_load, src_load, vmm_zp_b_shift);
-                uni_vcvtdq2ps(src_load, src_load);
+                if (is_f8_wei) {
+                    // The emulation merges into the masked out lanes.
+                    if (is_tail) uni_vxorps(src_reg, src_reg, src_reg);
+                    f8_emulator_->vcvt_f8_to_f32(src_load, load_addr);
+                } else {
+                    if (conf_->orig_wei_dt == data_type::s8)
+                        uni_vpmovsxbd(src_load, load_addr);
+                    else
+                        uni_vpmovzxbd(src_load, load_addr);
+                    if (req_zp_b_shift)
+                        uni_vpsubd(src_load, src_load, vmm_zp_b_shift);
+                    uni_vcvtdq2ps(src_load, src_load);
+                }
                 if (req_apply_scales) {
                     const auto scales_offset
                             = (is_dynamic_stride ? 0 : k * scales_N_stride)
@@ -3203,6 +3241,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::generate() {
 
     add(rsp, stack_space_needed);
     postamble();
+
+    if (f8_emulator_) f8_emulator_->prepare_table();
 }
 
 template struct jit_brgemm_matmul_copy_b_bf16_t<Zmm>;
@@ -125,6 +125,7 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
             broadcasting_strategy_t::per_mb_spatial,
             broadcasting_strategy_t::per_mb_w, broadcasting_strategy_t::per_w,
             broadcasting_strategy_t::batch,
+            broadcasting_strategy_t::shared_axes,
             broadcasting_strategy_t::no_broadcast};
     const bcast_set_t limited_bcast_set = {broadcasting_strategy_t::scalar,
             broadcasting_strategy_t::no_broadcast};
@@ -164,7 +165,9 @@ status_t check_isa_with_datatype(
             && IMPLICATION(bm_conf_utils.is_int8_with_bf16_dst(),
                     is_superset(isa, avx512_core) || isa == avx2_vnni_2)
             && IMPLICATION(bm_conf_utils.is_bf16_with_int_wei(),
-                    is_superset(isa, avx512_core_bf16));
+                    is_superset(isa, avx512_core_bf16))
+            && IMPLICATION(bm_conf_utils.is_bf16_with_f8_wei(),
+                    is_superset(isa, avx512_core_fp16));
     return ok ? status::success : status::unimplemented;
 }
 
@@ -194,11 +197,15 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
               && one_of(attr.fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::any)
               && isa == avx512_core_amx)
     , bf16_with_int_wei_dt(bgmmc.src_dt == bf16
-              && utils::one_of(bgmmc.wei_dt, u8, s8)
+              && utils::one_of(bgmmc.wei_dt, u8, s8, f8_e5m2, f8_e4m3)
               && one_of(bgmmc.dst_dt, bf16, f32))
-    , weights_decompression_support(one_of(bgmmc.wei_dt, u8, s8)
-              && one_of(attr.fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::any)
-              && attr.fpmath_.apply_to_int_)
+    // fp8 values are exactly representable in bf16, so no fpmath mode is
+    // required to up-convert them.
+    , weights_decompression_support(one_of(bgmmc.wei_dt, f8_e5m2, f8_e4m3)
+              || (one_of(bgmmc.wei_dt, u8, s8)
+                      && one_of(attr.fpmath_.mode_, fpmath_mode::bf16,
+                              fpmath_mode::any)
+                      && attr.fpmath_.apply_to_int_))
     , A_any_layout(A_any_layout)
     , B_any_layout(B_any_layout)
     , C_any_layout(C_any_layout)
@@ -215,14 +222,15 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
     , blocked_24n_B_layout_tag(pick_blocked_B_layout(24))
     , blocked_16n_B_layout_tag(pick_blocked_B_layout(16))
     , blocked_8n_B_layout_tag(pick_blocked_B_layout(8))
-    , blocked_B_layouts_allowed(IMPLICATION(is_f32(),
-                                        !utils::one_of(format_tag::undef,
-                                                blocked_64n_B_layout_tag,
-                                                blocked_48n_B_layout_tag,
-                                                blocked_32n_B_layout_tag,
-                                                blocked_24n_B_layout_tag,
-                                                blocked_16n_B_layout_tag,
-                                                blocked_8n_B_layout_tag))
+    , blocked_B_layouts_allowed(!is_bf16_with_f8_wei()
+              && IMPLICATION(is_f32(),
+                      !utils::one_of(format_tag::undef,
+                              blocked_64n_B_layout_tag,
+                              blocked_48n_B_layout_tag,
+                              blocked_32n_B_layout_tag,
+                              blocked_24n_B_layout_tag,
+                              blocked_16n_B_layout_tag,
+                              blocked_8n_B_layout_tag))
               && IMPLICATION(!is_f32(),
                       !utils::one_of(format_tag::undef,
                               blocked_64n_B_layout_tag,
@@ -767,6 +775,14 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
     int start_nthr_k = 1;
     int last_nthr_k = 1;
 
+    // Parallel reduction supports neither runtime dimensions, batched
+    // problems nor compensations computed in copy routines.
+    const bool k_reduction_ok = !bgmmc.is_runtime_M && !bgmmc.is_runtime_N
+            && matmul.batch == 1
+            && bgmmc.src_zp_type == brgemm_broadcast_t::none
+            && bgmmc.wei_zp_type == brgemm_broadcast_t::none
+            && !bgmmc.s8s8_compensation_required;
+
     // for cases with low parallel work, reduce 'min_m_blk' to
     // increase potential parallelization balance.
     const dim_t max_parallel = static_cast<dim_t>(matmul.batch) * n_chunks;
@@ -798,7 +814,7 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         }
 
         // Parallelize across K for shapes with big 'K' dimension
-        bool bwd_w_par_k_blk = bgmmc.batch == 1
+        bool bwd_w_par_k_blk = k_reduction_ok
                 && bm_conf_utils.check_is_transposed(bgmmc.src_tag)
                 && IMPLICATION(bm_conf_utils.is_bf16(), math::is_pow2(matmul.K))
                 && matmul.K >= 2048;
@@ -810,11 +826,25 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         // Enable k-partitioning for huge k and small m/n dimensions.
         bool is_huge_k = matmul.K >= 20000;
         bool is_small_mn = matmul.M <= 512 && matmul.N <= 512;
-        bool use_k_partitioning = is_huge_k && is_small_mn;
+        bool use_k_partitioning = is_huge_k && is_small_mn && k_reduction_ok;
 
         // TODO: expand to other data types.
         use_k_partitioning = use_k_partitioning && bm_conf_utils.is_f32();
 
+        // Enable k-partitioning for tall k when M/N blocks alone cannot
+        // occupy all threads (e.g. M = 32, N = 4096, K = 11008). Partial
+        // results are accumulated in f32 and combined by the reduction
+        // stage, so integer accumulation is not covered yet.
+        const bool is_tall_k = matmul.K >= 4096 && max_bmn_parallel < nthr;
+        const bool use_tall_k_partitioning = is_tall_k && k_reduction_ok
+                && start_nthr_k == 1 && bgmmc.acc_dt == f32
+                && !bm_conf_utils.check_is_transposed(bgmmc.src_tag);
+        if (use_tall_k_partitioning) {
+            // Prefer more K chunks over the extended K block here.
+            k_blk = nstl::min(matmul.K, 512);
+            use_k_partitioning = true;
+        }
+
         if (use_k_partitioning) {
             auto least_prime_factor = [](int n) {
                 assert(n > 0);
@@ -845,6 +875,26 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
             start_nthr_k = nthr_k;
             last_nthr_k = nthr_k;
         }
+
+        // GEMV-like shapes (e.g. batch-1 decode): with M <= 4 every thread
+        // streams its own slice of B exactly once, so threads that cannot
+        // be given an N chunk are put on K instead, and partial results are
+        // reduced by the common nthr_k > 1 path.
+        const bool is_small_m_gemv = matmul.M <= 4 && k_reduction_ok
+                && !bgmmc.use_buffer_a && start_nthr_k == 1;
+        if (is_small_m_gemv) {
+            // Keep enough K per thread for the reduction to stay cheap
+            // compared to the weights stream.
+            const int min_k_per_thr = 256;
+            const int nthr_bmn = nstl::min(nthr, div_up(matmul.N, n_blk));
+            const int nthr_k
+                    = nstl::min(nthr / nthr_bmn, matmul.K / min_k_per_thr);
+            if (nthr_k > 1) {
+                k_blk = nstl::min(k_blk, rnd_up(div_up(matmul.K, nthr_k), 64));
+                start_nthr_k = nthr_k;
+                last_nthr_k = nthr_k;
+            }
+        }
     }
 
     // Use large m-blocking if possible.
@@ -1109,8 +1159,12 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
         // Batch_Size:
         // - unused.
 
+        // For runtime M the blocking is searched for a nominal M of one
+        // full M block: it only affects N and K blocking then.
+        const dim_t runtime_M_blk = 64;
+        const dim_t M = bgmmc.is_runtime_M ? runtime_M_blk : bgmmc.M;
         const matmul_avx512_blocking_params_t::matmul_params_t matmul(
-                bgmmc.M, bgmmc.N, bgmmc.K, bgmmc.batch);
+                M, bgmmc.N, bgmmc.K, bgmmc.batch);
 
         matmul_avx512_blocking_params_t best_blocking(matmul, bgmmc.nthr);
 
@@ -1120,6 +1174,12 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
         VCONDCHECK_BG(best_imbalance != 1.f, VERBOSE_BLOCKING_FAIL, "")
 
         best_blocking.update_configuration(bgmmc);
+        // The M tails are covered by the dynamic tail kernels, the largest
+        // of which must fit into an M block.
+        if (bgmmc.is_runtime_M) {
+            bgmmc.M_blk = runtime_M_blk;
+            bgmmc.M_chunk_size = 1;
+        }
     } else {
         VCONDCHECK_BG(is_superset(bm_conf_utils.get_isa(), avx2),
                 VERBOSE_UNSUPPORTED_ISA)
@@ -1279,10 +1339,16 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // Single runtime dimension is only supported for now
     VCONDCHECK_BG(!(bgmmc.is_runtime_M && bgmmc.is_runtime_N),
             VERBOSE_RUNTIMEDIM_UNSUPPORTED)
-    // Runtime value for M dimension is supported for 2d AMX int8/bfloat16
-    // problems only.
-    const bool runtime_M_supported = bgmmc.is_amx && bgmmc.ndims == 2
-            && one_of(true, bm_conf_utils.is_int8(), bm_conf_utils.is_bf16());
+    // Runtime value for M dimension is supported for 2d int8/bfloat16
+    // problems on AMX, and additionally for f32 ones on avx512_core.
+    const bool runtime_M_supported = bgmmc.ndims == 2
+            && ((bgmmc.is_amx
+                        && one_of(true, bm_conf_utils.is_int8(),
+                                bm_conf_utils.is_bf16()))
+                    || (!bgmmc.is_amx && is_superset(isa, avx512_core)
+                            && one_of(true, bm_conf_utils.is_int8(),
+                                    bm_conf_utils.is_bf16(),
+                                    bm_conf_utils.is_f32())));
     VCONDCHECK_BG(!(bgmmc.is_runtime_M && !runtime_M_supported),
             VERBOSE_RUNTIMEDIM_UNSUPPORTED)
 
@@ -1320,6 +1386,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.blocked_B = bm_conf_utils.get_blocked_B();
     bgmmc.transposed_B = bm_conf_utils.check_is_transposed(bgmmc.wei_tag)
             || bgmmc.wei_tag == adbc;
+    // fp8 weights are only up-converted by the plain layout copy routine.
+    VCONDCHECK_BG(IMPLICATION(bm_conf_utils.is_bf16_with_f8_wei(),
+                          !bgmmc.blocked_B && !bgmmc.transposed_B),
+            VERBOSE_UNSUPPORTED_TAG);
     bgmmc.use_buffer_b = bm_conf_utils.use_buffer_b();
     bgmmc.req_transpose_scales = bgmmc.apply_scales_in_buffer_b
             && bgmmc.is_oscale_per_k && bgmmc.is_oscale_per_n
@@ -1469,7 +1539,17 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL, "");
 
-    if (bgmmc.wei_n_blk > bgmmc.N_blk
+    // Non-AMX f32 and bf16 kernels read blocked B with a plain row stride,
+    // so a smaller N block can be computed within the default packed layout.
+    // Keeping this layout independent of M lets one reordered weights tensor
+    // serve primitives created for any M.
+    const bool keep_packed_B_layout = !bgmmc.is_amx
+            && bm_conf_utils.is_any_B_layout()
+            && !bm_conf_utils.check_is_plain(bgmmc.wei_tag)
+            && !bm_conf_utils.check_is_transposed(bgmmc.wei_tag)
+            && one_of(true, bm_conf_utils.is_f32(), bm_conf_utils.is_bf16())
+            && !bgmmc.apply_scales_in_buffer_b;
+    if (bgmmc.wei_n_blk > bgmmc.N_blk && !keep_packed_B_layout
             && IMPLICATION(
                     bgmmc.N == bgmmc.N_blk, bgmmc.N >= bgmmc.wei_n_blk)) {
         assert(!bgmmc.is_runtime_N
@@ -1546,7 +1626,7 @@ status_t init_conf(brgemm_matmul_conf_t &conf, dim_t batch, dim_t K, dim_t N,
     const bool with_wei_decompression = in_type != out_type
             && utils::one_of(in_type, data_type::s8, data_type::u8);
 
-    conf.blocked_B = !utils::one_of(in_tag, ab, abc);
+    conf.blocked_B = !utils::one_of(in_tag, ab, abc, ba, acb);
     conf.is_bf16_with_int_wei = is_bf16_with_int_wei;
     conf.with_wei_decompression = with_wei_decompression;
     conf.orig_wei_dt = in_type;
@@ -1562,8 +1642,9 @@ status_t init_conf(brgemm_matmul_conf_t &conf, dim_t batch, dim_t K, dim_t N,
     conf.a_dt_sz = conf.tr_a_dt_sz = types::data_type_size(conf.src_dt);
     conf.b_dt_sz = types::data_type_size(in_type);
     conf.tr_b_dt_sz = types::data_type_size(conf.wei_dt);
-    conf.copy_B_wei_stride = conf.N * conf.b_dt_sz;
-    conf.transposed_B = false;
+    conf.transposed_B = utils::one_of(in_tag, ba, acb);
+    conf.copy_B_wei_stride
+            = (conf.transposed_B ? conf.K : conf.N) * conf.b_dt_sz;
     conf.s8s8_comp_b_str = utils::rnd_up(conf.N, conf.wei_n_blk);
     conf.s8s8_comp_n_str = conf.wei_n_blk;
     conf.isa = is_f16 ? avx512_core_fp16 : avx512_core;
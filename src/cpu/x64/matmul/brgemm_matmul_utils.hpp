@@ -287,6 +287,13 @@ struct brgemm_matmul_conf_utils_t {
 
     inline bool is_bf16_with_int_wei() const { return bf16_with_int_wei_dt; }
 
+    // fp8 weights take the decompression path of the integer weights.
+    inline bool is_bf16_with_f8_wei() const {
+        return bf16_with_int_wei_dt
+                && utils::one_of(bgmmc.orig_wei_dt, data_type::f8_e5m2,
+                        data_type::f8_e4m3);
+    }
+
     inline bool with_weights_decompression() const {
         return !utils::one_of(bgmmc.src_dt, data_type::s8, data_type::u8)
                 && weights_decompression_support;
@@ -41,7 +41,8 @@ struct sparse_matmul_kernel_t : public jit_generator {
 
     struct call_params_t {
         const int32_t *src_indices;
-        const float *src_values, *wei, *dst;
+        const void *src_values, *wei;
+        float *dst;
         size_t block_size;
         size_t nnz;
     };
@@ -52,7 +53,9 @@ struct sparse_matmul_kernel_t : public jit_generator {
         , vlen_(vlen)
         , simd_w_(vlen_ / data_type_size())
         , tail_block_size_(N() % block_size())
-        , tail_size_(tail_block_size() % simd_w()) {}
+        , tail_size_(tail_block_size() % simd_w())
+        , src_dt_(pd->src_md()->data_type)
+        , wei_dt_(pd->weights_md()->data_type) {}
 
     ~sparse_matmul_kernel_t() override = default;
 
@@ -65,7 +68,11 @@ struct sparse_matmul_kernel_t : public jit_generator {
     size_t tail_block_size() const { return tail_block_size_; }
     size_t tail_size() const { return tail_size_; }
 
+    // Size of the accumulators and dst elements, src values and weights may
+    // be bf16 and are up-converted to f32 on load.
     int data_type_size() const { return sizeof(float); }
+    int src_dt_size() const { return types::data_type_size(src_dt_); }
+    int wei_dt_size() const { return types::data_type_size(wei_dt_); }
     int index_type_size() const { return sizeof(int32_t); }
 
     int block_size() const { return vlen(); }
@@ -80,6 +87,8 @@ protected:
     size_t simd_w_;
     size_t tail_block_size_;
     size_t tail_size_;
+    data_type_t src_dt_;
+    data_type_t wei_dt_;
 };
 
 template <cpu_isa_t isa>
@@ -128,11 +137,11 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
     Address wei_ptr(size_t offt = 0) {
         if (N() == 1)
-            return ptr[reg_wei + reg_src_col_idx * data_type_size() + offt];
+            return ptr[reg_wei + reg_src_col_idx * wei_dt_size() + offt];
 
         imul(reg_tmp, reg_src_col_idx, N());
         add(reg_tmp, reg_block_offset);
-        return ptr[reg_wei + reg_tmp * data_type_size() + offt];
+        return ptr[reg_wei + reg_tmp * wei_dt_size() + offt];
     }
 
     Address dst_ptr(size_t offt = 0) {
@@ -140,7 +149,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     }
 
     Address src_values_ptr(size_t offt = 0) {
-        return ptr[reg_src_values + reg_nnz_count * data_type_size() + offt];
+        return ptr[reg_src_values + reg_nnz_count * src_dt_size() + offt];
     }
 
     Address src_indices_ptr(size_t offt = 0) {
@@ -166,6 +175,30 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
     void prepare_tail_mask();
 
+    // bf16 is converted to f32 by shifting it to the upper half of a dword.
+    void load_wei(const Vmm &vmm, const Address &addr, bool is_tail) {
+        if (wei_dt_ == bf16) {
+            if (is_tail)
+                vpmovzxwd(vmm | tail_opmask | T_z, addr);
+            else
+                vpmovzxwd(vmm, addr);
+            vpslld(vmm, vmm, 16);
+        } else if (is_tail) {
+            load_tail(vmm, addr);
+        } else {
+            uni_vmovups(vmm, addr);
+        }
+    }
+
+    void broadcast_src_value(const Vmm &vmm, const Address &addr) {
+        if (src_dt_ == bf16) {
+            vpbroadcastw(vmm, addr);
+            vpslld(vmm, vmm, 16);
+        } else {
+            uni_vbroadcastss(vmm, addr);
+        }
+    }
+
     Vmm get_dst_reg(int index) const {
         // Vmm(0) is reserved for mask.
         return Vmm(index + 1);
@@ -187,11 +220,10 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         for (int i_load = 0; i_load < nloads; i_load++) {
             Vmm vreg_tmp_wei = get_wei_reg(i_load, is_tail_block);
             // Load a row of weights.
-            if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                load_tail(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            } else {
-                uni_vmovups(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            }
+            const bool is_tail
+                    = is_tail_block && tail_size() > 0 && i_load == nloads - 1;
+            load_wei(vreg_tmp_wei, wei_ptr(simd_w() * wei_dt_size() * i_load),
+                    is_tail);
             // Multiply the broadcasted value with the row of weights
             // and accumulate result in dst.
             Vmm vreg_tmp_dst = get_dst_reg(i_load);
@@ -209,8 +241,8 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
             for (int uf = 0; uf < unroll_factor; uf++) {
                 // Load src values to broadcast.
-                uni_vbroadcastss(
-                        vreg_src_val, src_values_ptr(uf * data_type_size()));
+                broadcast_src_value(
+                        vreg_src_val, src_values_ptr(uf * src_dt_size()));
                 // Load an index.
                 movsxd(reg_src_col_idx,
                         src_indices_ptr(uf * index_type_size()));
@@ -229,7 +261,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         jz(skip_row_tail, T_NEAR);
 
         // Load src values to broadcast.
-        uni_vbroadcastss(vreg_src_val, src_values_ptr());
+        broadcast_src_value(vreg_src_val, src_values_ptr());
         // Load an index.
         movsxd(reg_src_col_idx, src_indices_ptr());
         loop_within_block_row(vreg_src_val, reg_src_col_idx, is_tail_block);
@@ -345,9 +377,36 @@ jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
     : primitive_t(apd) {}
 jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 
+namespace {
+// Splits rows between threads so that each thread gets about the same amount
+// of work, which is the number of non-zero elements plus one per row to
+// account for the dst row initialization and the kernel call.
+void balance_rows_by_nnz(const int32_t *pointers, dim_t M, int nthr,
+        int ithr, dim_t &start, dim_t &end) {
+    const auto work = [&](dim_t m) {
+        return static_cast<dim_t>(pointers[m] - pointers[0]) + m;
+    };
+    // The first row `m` such that work(m) >= w, the work is monotonic.
+    const auto find_row = [&](dim_t w) {
+        dim_t lo = 0, hi = M;
+        while (lo < hi) {
+            const dim_t mid = lo + (hi - lo) / 2;
+            if (work(mid) < w)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+    const dim_t total = work(M);
+    start = find_row(utils::div_up(total * ithr, nthr));
+    end = find_row(utils::div_up(total * (ithr + 1), nthr));
+}
+} // namespace
+
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
-    const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
-    const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *src_values = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
     const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
     const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
@@ -360,10 +419,8 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
+    const size_t src_dt_size = src_d.data_type_size();
 
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
@@ -372,10 +429,15 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     // If not, use 0, which means all threads.
     const int nthr = data_to_process_in_kb < threshold_in_kb;
+#else
+    const int nthr = 0;
+#endif
 
+    // Rows are distributed by the number of non-zero elements rather than
+    // evenly, as the cost of a row is proportional to it.
     parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
+        balance_rows_by_nnz(src_pointers, M, nthr, ithr, start, end);
         if (start >= end) return;
 
         for (dim_t m = start; m < end; m++) {
@@ -385,7 +447,7 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
             sparse_matmul_kernel_t::call_params_t p;
             p.nnz = nnz;
-            p.src_values = src_values + row_begin;
+            p.src_values = src_values + row_begin * src_dt_size;
             p.src_indices = src_indices + row_begin;
             p.wei = weights;
             p.dst = dst + (m * N);
@@ -393,23 +455,6 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
             (*kernel_)(&p);
         }
     });
-#else
-
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
-
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
-    });
-#endif
     return status::success;
 }
 
@@ -50,8 +50,13 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
 
-            const bool problem_dt_correct
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
+            // bf16 values are up-converted to f32 in the kernel, hence
+            // avx512_core is required for the conversion instructions.
+            const bool is_f32
+                    = utils::everyone_is(f32, src_type, wei_type, dst_type);
+            const bool is_bf16 = utils::everyone_is(bf16, src_type, wei_type)
+                    && dst_type == f32 && mayiuse(avx512_core);
+            const bool problem_dt_correct = (is_f32 || is_bf16)
                     && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
                     && utils::everyone_is(s32, src_d.metadata_type(0),
                             src_d.metadata_type(1));
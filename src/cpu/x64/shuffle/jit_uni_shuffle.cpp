@@ -33,10 +33,10 @@ static bool impl_supports_datatype(cpu_isa_t isa, data_type_t data_type) {
     switch (data_type) {
         case data_type::bf16: return is_superset(isa, avx512_core);
         case data_type::f16: return is_superset(isa, avx512_core_fp16);
-        case data_type::f32:
-        case data_type::s32:
         case data_type::s8:
-        case data_type::u8: return true;
+        case data_type::u8: return is_superset(isa, avx512_core);
+        case data_type::f32:
+        case data_type::s32: return true;
         default: return false;
     }
 }
@@ -54,7 +54,7 @@ status_t jit_uni_shuffle_t<isa>::pd_t::init(engine_t *engine) {
     // disabling verbose dispatch messages for unsupported isa for better readability
     if (!mayiuse(isa)) return status::unimplemented;
 
-    VDISPATCH_SHUFFLE(utils::one_of(conf_.data_type, f32, s32, bf16),
+    VDISPATCH_SHUFFLE(utils::one_of(conf_.data_type, f32, s32, bf16, s8, u8),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_SHUFFLE(src_d.data_type() == dst_d.data_type(),
             VERBOSE_INCONSISTENT_DT, "src", "dst");
@@ -67,11 +67,28 @@ template <>
 void jit_uni_shuffle_kernel_t<avx512_core>::emu_gather_data(
         const Reg64 &reg_src_addr, const int indices_idx, const int data_idx,
         const bool is_tail) {
-    assert(conf_.data_type == data_type::bf16);
+    assert(utils::one_of(
+            conf_.data_type, data_type::bf16, data_type::s8, data_type::u8));
 
     const Xmm xmm_tmp = Xmm(vmm_full_mask_.getIdx());
     const Xmm xmm_dst = Xmm(vmm_tmp_.getIdx());
 
+    if (conf_.dt_size == 1) {
+        // A block of 16 int8 values fits a single xmm, so the values are
+        // inserted byte by byte directly into the data register.
+        constexpr unsigned xmm_size_idx = 4;
+        const unsigned number_of_values_to_load
+                = is_tail ? conf_.simd_tail : conf_.simd_w;
+        for (unsigned k = 0; k < number_of_values_to_load; k++) {
+            if (k % xmm_size_idx == 0)
+                vextracti32x4(xmm_tmp, Zmm(indices_idx), k / xmm_size_idx);
+            vpextrd(reg_tmp_.cvt32(), xmm_tmp, k % xmm_size_idx);
+            vpinsrb(Xmm(data_idx), Xmm(data_idx),
+                    ptr[reg_src_addr + reg_tmp_], k);
+        }
+        return;
+    }
+
     xor_(reg_tmp_, reg_tmp_);
     mov(reg_tmp1_, reg_src_addr);
 
@@ -235,6 +252,20 @@ void jit_uni_shuffle_kernel_t<avx512_core>::store_data(const int data_idx,
             else
                 vmovups(ptr[reg_dst_addr + offset], to_store_data);
         }
+    } else if (conf_.dt_size == 1) {
+        const Xmm to_store_data = Xmm(data_idx);
+        const Xmm xmm_tmp = Xmm(vmm_tmp_.getIdx());
+
+        if (extend_for_padding) {
+            vmovdqu8(xmm_tmp | k_tail_mask_ | T_z, to_store_data);
+            vmovups(ptr[reg_dst_addr + offset], xmm_tmp);
+        } else {
+            if (is_tail)
+                vmovdqu8(ptr[reg_dst_addr + offset] | k_tail_mask_,
+                        to_store_data);
+            else
+                vmovups(ptr[reg_dst_addr + offset], to_store_data);
+        }
     } else {
         if (extend_for_padding) {
             vmovups(vmm_tmp_ | k_tail_mask_ | T_z, Vmm(data_idx));
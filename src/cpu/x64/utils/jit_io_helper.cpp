@@ -17,6 +17,9 @@
 #include <cassert>
 #include <type_traits>
 
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_avx512_core_fp8cvt.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
@@ -30,6 +33,17 @@ namespace io {
 io_conf_t::io_conf_t(const bool nt_stores_enabled)
     : nt_stores_enabled_(nt_stores_enabled) {}
 
+bool use_nt_stores(size_t dst_size) {
+    static const size_t threshold = []() {
+        const unsigned llc_size = platform::get_cache_size(3) > 0
+                ? platform::get_cache_size(3)
+                : platform::get_cache_size(2);
+        return (size_t)nstl::max(
+                0, getenv_int_user("NT_STORES_THRESHOLD", (int)llc_size));
+    }();
+    return threshold > 0 && dst_size >= threshold;
+}
+
 io_tail_conf_t::io_tail_conf_t(const std::size_t simd_w,
         const std::size_t tail_size, const Xbyak::Opmask &tail_opmask,
         const int tail_vmm_mask_idx, const Xbyak::Reg64 &reg_tmp)
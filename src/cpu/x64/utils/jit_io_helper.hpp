@@ -47,6 +47,13 @@ public:
     bool nt_stores_enabled_ = false;
 };
 
+// Returns true if a write-once destination of `dst_size` bytes is better
+// written with non-temporal stores: it exceeds the last level cache and would
+// only evict the data of other consumers. The threshold defaults to the last
+// level cache size and can be changed with ONEDNN_NT_STORES_THRESHOLD (bytes),
+// 0 disables non-temporal stores.
+bool use_nt_stores(size_t dst_size);
+
 class io_tail_conf_t {
 public:
     io_tail_conf_t(const std::size_t simd_w, const std::size_t tail_size,
@@ -63,10 +63,18 @@ struct plan_registry_instance_t {
         registry_path = getenv_string_user(env_registry_path_name);
         if (!registry_path.empty()) {
             std::ifstream in(registry_path, std::ios::binary);
-            if (!in.good()) return;
+            if (!in.good()) {
+                ir_info() << "Plan registry file " << registry_path
+                          << " not found, using the built-in registry"
+                          << std::endl;
+                return;
+            }
             plan_registry_t file_registry;
             file_registry.deserialize(in);
             registry.merge(file_registry);
+            ir_info() << "Merged " << file_registry.size()
+                      << " plan registry entries from " << registry_path
+                      << std::endl;
         }
 #endif
     }
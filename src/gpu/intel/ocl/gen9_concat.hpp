@@ -52,6 +52,9 @@ struct gen9_concat_t : public gpu_primitive_t {
             VDISPATCH_CONCAT(n_inputs() <= 16, VERBOSE_BAD_PARAM, "n_inputs");
             VDISPATCH_CONCAT(attr()->has_default_values(sm::scales_runtime),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONCAT(
+                    attr()->scales_.get(DNNL_ARG_DST).has_default_values(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_CONCAT_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_CONCAT(!memory_desc_ndims_ok(dst_md()), VERBOSE_BAD_NDIMS,
                     "dst", dst_md()->ndims);
@@ -141,6 +141,8 @@ status_t ocl_gpu_kernel_t::parallel_for(stream_t &stream,
     kernel_wrapper_t *kernel = nullptr;
     CHECK(cache_->get(&kernel));
     CHECK(check_scalar_arguments(arg_list));
+    auto stream_ocl_ctx
+            = utils::downcast<ocl_gpu_engine_t *>(stream.engine())->context();
     for (int i = 0; i < arg_list.nargs(); ++i) {
         auto &arg = arg_list.get(i);
         if (arg.is_global()) {
@@ -153,9 +155,6 @@ status_t ocl_gpu_kernel_t::parallel_for(stream_t &stream,
 
                 // Validate that the OpenCL contexts match for execution
                 // context and memory.
-                auto stream_ocl_ctx
-                        = utils::downcast<ocl_gpu_engine_t *>(stream.engine())
-                                  ->context();
                 auto memory_storage_ocl_ctx
                         = utils::downcast<ocl_gpu_engine_t *>(
                                 ocl_mem_storage->engine())
@@ -50,6 +50,9 @@ struct ref_concat_t : public gpu_primitive_t {
 
             VDISPATCH_CONCAT(attr()->has_default_values(sm::scales_runtime),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONCAT(
+                    attr()->scales_.get(DNNL_ARG_DST).has_default_values(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
 
             if (gpu_concat_pd_t::init() != status::success) {
                 assert(dst_md_.format_kind != format_kind::undef);
@@ -47,6 +47,8 @@ struct vectorized_lnorm_fwd_t : public gpu_primitive_t {
             auto dst_data_t = dst_md()->data_type;
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!skip_mean(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "rms normalization");
             VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
             VDISPATCH_LNORM(
                     (utils::everyone_is(u8, src_data_t, dst_data_t)
@@ -129,6 +131,8 @@ struct vectorized_lnorm_bwd_t : public gpu_primitive_t {
             auto diff_src_dt = diff_src_md()->data_type;
 
             VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(!skip_mean(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "rms normalization");
             VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
             VDISPATCH_LNORM(
                     (utils::everyone_is(f32, src_dt, diff_dst_dt, diff_src_dt)
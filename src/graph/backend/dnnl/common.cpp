@@ -18,7 +18,9 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -646,6 +648,27 @@ dnnl::memory::format_tag get_format_tag(const dnnl::memory::desc &md) {
     return format_tag;
 }
 
+// The constant cache keys are hashes, the map gives the partition a key was
+// generated for so that the constant tensor cache can pin it. The entries are
+// counted by the kernels that generated the key, and erased when the last of
+// them is destroyed. The cache itself keeps the partition id of the tensors
+// it holds.
+struct constant_cache_partition_id_t {
+    size_t part_id;
+    size_t refs;
+};
+
+static std::unordered_map<size_t, constant_cache_partition_id_t> &
+constant_cache_partition_ids() {
+    static std::unordered_map<size_t, constant_cache_partition_id_t> ids;
+    return ids;
+}
+
+static std::mutex &constant_cache_partition_ids_mutex() {
+    static std::mutex m;
+    return m;
+}
+
 size_t generate_constant_cache_key(
         size_t part_id, const std::vector<dnnl::memory::desc> &const_mds) {
     size_t key = 0;
@@ -654,9 +677,29 @@ size_t generate_constant_cache_key(
         auto md_hash = impl::primitive_hashing::get_md_hash(*md.get());
         key = hash_combine(key, md_hash);
     }
+
+    std::lock_guard<std::mutex> lock(constant_cache_partition_ids_mutex());
+    auto &id = constant_cache_partition_ids()[key];
+    id.part_id = part_id;
+    id.refs++;
     return key;
 }
 
+void release_constant_cache_key(size_t key) {
+    std::lock_guard<std::mutex> lock(constant_cache_partition_ids_mutex());
+    auto it = constant_cache_partition_ids().find(key);
+    if (it == constant_cache_partition_ids().end()) return;
+    if (--it->second.refs == 0) constant_cache_partition_ids().erase(it);
+}
+
+size_t get_constant_cache_partition_id(size_t key) {
+    std::lock_guard<std::mutex> lock(constant_cache_partition_ids_mutex());
+    auto it = constant_cache_partition_ids().find(key);
+    return it != constant_cache_partition_ids().end()
+            ? it->second.part_id
+            : std::numeric_limits<size_t>::max();
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -141,9 +141,16 @@ std::string get_format_tag_str(const dnnl::memory::desc &md);
 
 dnnl::memory::format_tag get_format_tag(const dnnl::memory::desc &md);
 
+// Each call must be paired with release_constant_cache_key() when the kernel
+// the key was generated for is destroyed.
 size_t generate_constant_cache_key(
         size_t part_id, const std::vector<dnnl::memory::desc> &const_mds);
 
+void release_constant_cache_key(size_t key);
+
+// Returns the id of the partition the constant cache key was generated for.
+size_t get_constant_cache_partition_id(size_t key);
+
 #ifndef NDEBUG
 #define BACKEND_DNNL_ENFORCE(condition, message) \
     do { \
@@ -37,6 +37,65 @@ bool kernel_base_t::enabled_constant_cache() const {
     return enabled;
 }
 
+status_t kernel_base_t::prepare_constant_cache(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs, size_t constant_key,
+        const std::shared_ptr<subgraph_t> &subgraph,
+        const memory_planner_t &memory_planner,
+        const std::function<std::shared_ptr<execution_args_set_t>()>
+                &resource_ctor,
+        allocator_t *g_alloc) {
+    if (!enabled_constant_cache()) return status::success;
+
+    std::promise<constant_cache_t::cached_t> c_promise;
+    constant_cache_t::value_t cached_value
+            = dnnl_constant_cache_get_or_add(p_engine_, constant_key,
+                    memory_planner.total_internal_persistent_size(),
+                    c_promise.get_future());
+    if (cached_value.valid()) return status::success;
+
+    dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+    // each thread's own local resource, keyed by the kernel like in the
+    // execute_impl() of the kernels
+    thread_local_cache_t<execution_args_set_t> res_cache;
+    execution_args_set_t *res = res_cache.get_or_add(
+            reinterpret_cast<size_t>(this), resource_ctor);
+
+    // The constant ops only read partition inputs, so the outputs are left
+    // unbound.
+    for (const auto &mem_idx : res->get_mems_use_external_inputs()) {
+        mem_idx.first.set_data_handle(inputs[mem_idx.second].get_data_handle());
+    }
+    temporary_scratchpad_t scratchpad(
+            memory_planner.total_internal_temporary_size(), p_engine_,
+            *g_alloc);
+    grantor_t var_grantor = memory_planner.internal_temporary_grantor(
+            scratchpad.get_buffer());
+    for (auto &mem_offkey : res->get_mems_use_internal_temporary()) {
+        mem_offkey.first.set_data_handle(var_grantor.get(mem_offkey.second));
+    }
+
+    constant_cache_t::cached_t c_buffer
+            = std::make_shared<dnnl_constant_buffer_t>(
+                    memory_planner.total_internal_persistent_size(), p_engine_,
+                    g_alloc);
+    grantor_t c_grantor = memory_planner.internal_persistent_grantor(
+            c_buffer->data<char>());
+    for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
+        mem_offkey.first.set_data_handle(c_grantor.get(mem_offkey.second));
+    }
+
+    for (size_t i = 0; i < subgraph->execs_.size(); i++) {
+        if (!subgraph->is_constant_[i]) continue;
+        subgraph->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+    }
+    p_stream.wait();
+
+    c_buffer->record_creation_time();
+    c_promise.set_value(c_buffer);
+    return status::success;
+}
+
 dnnl_backend::dnnl_backend(const std::string &name, float priority)
     : backend_t(name, priority) {
     register_op_schemas();
@@ -18,6 +18,7 @@
 #define GRAPH_BACKEND_DNNL_DNNL_BACKEND_HPP
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string>
@@ -44,6 +45,9 @@ namespace graph {
 namespace dnnl_impl {
 
 class dnnl_partition_impl_t;
+class execution_args_set_t;
+class memory_planner_t;
+class subgraph_t;
 
 // gcc4.8.5 can 't support enum class as key
 struct enum_hash_t {
@@ -70,6 +74,11 @@ struct kernel_base_t {
         return execute_impl(astream, inputs, outputs);
     }
 
+    status_t prepare_constants(
+            const stream_t *astream, const std::vector<tensor_t> &inputs) {
+        return prepare_constants_impl(astream, inputs);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t execute_sycl(const stream_t *astream,
             const std::vector<tensor_t> &inputs,
@@ -114,10 +123,31 @@ struct kernel_base_t {
             const std::vector<tensor_t> &outputs)
             = 0;
 
+    // Computes the constant parts of the kernel into the constant tensor
+    // cache. Kernels without constant parts keep the default no-op.
+    virtual status_t prepare_constants_impl(
+            const stream_t *astream, const std::vector<tensor_t> &inputs) {
+        UNUSED(astream);
+        UNUSED(inputs);
+        return status::success;
+    }
+
     virtual status_t prepare_inplace_pairs_impl() { return status::success; };
 
     bool enabled_constant_cache() const;
 
+    // Executes the constant ops of `subgraph` into a new buffer of the
+    // constant tensor cache, unless the cache already holds one for
+    // `constant_key`. Implements prepare_constants_impl() for the kernels
+    // that keep a single compiled subgraph.
+    status_t prepare_constant_cache(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs, size_t constant_key,
+            const std::shared_ptr<subgraph_t> &subgraph,
+            const memory_planner_t &memory_planner,
+            const std::function<std::shared_ptr<execution_args_set_t>()>
+                    &resource_ctor,
+            allocator_t *g_alloc);
+
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
 };
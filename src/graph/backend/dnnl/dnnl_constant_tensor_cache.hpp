@@ -69,8 +69,8 @@ inline graph::constant_tensor_cache_t::value_t dnnl_constant_cache_get_or_add(
             eng.get()->kind(), eng.get()->index());
     assertm(cache,
             "no available constant cache for specified engine kind and index");
-    return cache->get_or_add(
-            dnnl_backend::get_singleton().get_id(), key, size, value);
+    return cache->get_or_add(dnnl_backend::get_singleton().get_id(), key, size,
+            value, get_constant_cache_partition_id(key));
 }
 
 inline void dnnl_constant_cache_remove_if_exist(
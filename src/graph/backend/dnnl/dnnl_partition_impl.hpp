@@ -75,6 +75,11 @@ public:
         return kernel_->execute(g_stream, inputs, outputs);
     }
 
+    status_t prepare_constants(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs) override {
+        return kernel_->prepare_constants(g_stream, inputs);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t execute_sycl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -72,6 +72,7 @@ public:
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
         res_cache.release();
+        if (constant_key_) release_constant_cache_key(constant_key_);
     }
 
     status_t compile_impl(const dnnl_partition_impl_t *part,
@@ -218,6 +219,7 @@ public:
                             p_stream, res->get_exec_args()[i]);
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -292,6 +294,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -372,6 +375,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -71,6 +71,7 @@ public:
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
         res_cache.release();
+        if (constant_key_) release_constant_cache_key(constant_key_);
     }
 
     void prepare_args_set(const execution_args_set_t *res,
@@ -151,6 +152,7 @@ public:
                             p_stream, res->get_exec_args()[i]);
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -163,6 +165,12 @@ public:
         return status::success;
     }
 
+    status_t prepare_constants_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs) override {
+        return prepare_constant_cache(g_stream, inputs, constant_key_,
+                subgraph_, memory_planner_, resource_ctor_, g_alloc_);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t sycl_execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -225,6 +233,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -305,6 +314,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -63,6 +63,7 @@ public:
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
         res_cache.release();
+        if (constant_key_) release_constant_cache_key(constant_key_);
     }
 
     status_t prepare_inplace_pairs_impl() override {
@@ -217,6 +218,7 @@ public:
                             p_stream, res->get_exec_args()[i]);
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -291,6 +293,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -371,6 +374,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
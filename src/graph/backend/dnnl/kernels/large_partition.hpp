@@ -76,6 +76,7 @@ public:
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
         res_cache.release();
+        if (constant_key_) release_constant_cache_key(constant_key_);
     }
 
     static void setup_pipeline_stage1(pass_pipeline_t &pipeline) {
@@ -295,6 +296,7 @@ public:
                             p_stream, res->get_exec_args()[i]);
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -307,6 +309,12 @@ public:
         return status::success;
     }
 
+    status_t prepare_constants_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs) override {
+        return prepare_constant_cache(g_stream, inputs, constant_key_,
+                subgraph_, memory_planner_, resource_ctor_, g_alloc_);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t sycl_execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -368,6 +376,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -445,6 +454,7 @@ public:
                     deps = {returned_event};
                 }
 
+                c_buffer->record_creation_time();
                 c_promise.set_value(c_buffer);
             }
         }
@@ -90,6 +90,12 @@ public:
     // SDP input dimension
     memory::dim batch_size, num_head, seq_len_q, size_per_head;
 
+    // Query rows handled by one per-thread work item and the number of such
+    // blocks per head. The sub-primitives are created for q_block rows, so
+    // the score tile written by mm1 and softmax is q_block x seq_len_kv
+    // instead of seq_len_q x seq_len_kv.
+    memory::dim q_block, num_q_blocks;
+
     // SDP input and output strides
     memory::dims src1_strides, wei1_strides, wei2_strides, dst_strides,
             post_add_strides;
@@ -134,7 +140,7 @@ public:
     //scratchped
     memory sub_scratchpad;
     // shared memory
-    memory sub_max_src1_src2, sub_max_dst1_wei2;
+    memory sub_max_src1_src2;
 
     bool attention_mask = false, has_select = false;
     // Used to record the ops from select
@@ -170,26 +176,54 @@ public:
         seq_len_q = src1_user_dims[2];
         size_per_head = src1_user_dims[3];
 
+        // The value of the second matmul is [.., seq_len_kv, size_per_head].
+        // The sequence length is only used to size the query blocks here, the
+        // exact value is taken from the matmul in construct_params().
+        memory::dims wei2_user_dims = ltw(inputs[graph_inport[4]]).vdims();
+        const memory::dim seq_len_kv = wei2_user_dims.size() == 4
+                ? wei2_user_dims[2]
+                : seq_len_q;
+        q_block = get_q_block(seq_len_q, seq_len_kv);
+        num_q_blocks = seq_len_q / q_block;
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
 // RATIO is an empirical value used to determine the numerical relationship
-// between batch_size, num_head and thread number to determine whether to use
-// decompose kernel. The key to the decompose kernel is that we do parallel in
-// the batch_size and num_head dimensions. Therefore, if the batch_size or
-// num_head is too small, it will cause many idle threads and affect efficiency
-// which may even worse than the original sequential kernel. Here we set this
-// ratio based on the experimental value to ensure that users do not have any
-// regression when using the decompose kernel.
-// TODO: Refine the inequation based on the relationship of cache size and sdp
-// memory footprint requirements.
+// between the amount of parallel work and thread number to determine whether
+// to use decompose kernel. The key to the decompose kernel is that we do
+// parallel in the batch_size, num_head and query block dimensions. Therefore,
+// if there are too few work items, it will cause many idle threads and affect
+// efficiency which may even worse than the original sequential kernel. Here we
+// set this ratio based on the experimental value to ensure that users do not
+// have any regression when using the decompose kernel.
 #define RATIO 2
         // Initialize nthr with current threads num
         nthr = dnnl_get_current_num_threads();
-        return batch_size * num_head > RATIO * nthr;
+        return batch_size * num_head * num_q_blocks > RATIO * nthr;
 #else
         return true;
 #endif
     }
 
+    // Returns the number of query rows per block: the largest divisor of
+    // seq_len_q whose f32 score tile fits into a core's share of L2, or
+    // seq_len_q itself if it fits or no divisor of reasonable size exists.
+    static memory::dim get_q_block(
+            memory::dim seq_len_q, memory::dim seq_len_kv) {
+        // Empirical budget for one q_block x seq_len_kv f32 score tile, and
+        // the minimal block height that still keeps the matmuls efficient.
+        constexpr size_t score_tile_budget = 256 * 1024;
+        constexpr memory::dim min_q_block = 16;
+
+        const size_t row_size = std::max<memory::dim>(seq_len_kv, 1)
+                * memory::data_type_size(memory::data_type::f32);
+        const memory::dim max_q_block = static_cast<memory::dim>(
+                std::max<size_t>(score_tile_budget / row_size, 1));
+        if (seq_len_q <= max_q_block) return seq_len_q;
+        for (memory::dim blk = max_q_block; blk >= min_q_block; --blk)
+            if (seq_len_q % blk == 0) return blk;
+        return seq_len_q;
+    }
+
     // Used to construct all params that SDP need
     template <bool quantized = false,
             memory::data_type dt = memory::data_type::f32>
@@ -238,7 +272,7 @@ public:
         sub_reorder0_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
         // per-head: reorder src1 to dense, for first matmul
-        memory::dims sub_src1_dims = {1, 1, seq_len_q, size_per_head};
+        memory::dims sub_src1_dims = {1, 1, q_block, size_per_head};
         src1_strides = ltw(inputs[graph_inport[0]]).vstrides();
         sub_src1_md = memory::desc(sub_src1_dims, dt_src_user,
                 {1, 1, src1_strides[2], src1_strides[3]});
@@ -270,9 +304,9 @@ public:
         // create first matmul primitive attr
         dnnl::primitive_attr sub_matmul1_attr
                 = make_primitive_attr(sdp_op[1], mgr);
-        memory::dims sub_mm1_src_dims = {1, 1, seq_len_q, size_per_head};
+        memory::dims sub_mm1_src_dims = {1, 1, q_block, size_per_head};
         memory::dims sub_mm1_wei_dims = {1, 1, size_per_head, seq_len_kv};
-        memory::dims sub_mm1_dst_dims = {1, 1, seq_len_q, seq_len_kv};
+        memory::dims sub_mm1_dst_dims = {1, 1, q_block, seq_len_kv};
 
         sub_mm1_src_md = memory::desc(sub_mm1_src_dims, dt_src_user, tag::abcd);
         sub_mm1_wei_md = memory::desc(sub_mm1_wei_dims, dt_wei, tag::abdc);
@@ -289,7 +323,11 @@ public:
             auto post_dt = static_cast<memory::data_type>(ori_desc.data_type);
             memory::dims post_stride_dims
                     = memory::dims(post_stride, post_stride + ori_desc.ndims);
-            auto new_sub_md = memory::desc({1, 1, post_shape[2], post_shape[3]},
+            // Inputs broadcast along the query rows stay as is, the others
+            // are sliced to one query block.
+            const memory::dim post_rows
+                    = post_shape[2] == seq_len_q ? q_block : post_shape[2];
+            auto new_sub_md = memory::desc({1, 1, post_rows, post_shape[3]},
                     post_dt, post_stride_dims);
             sub_mm1_post_md.emplace_back(new_sub_md);
             dnnl_pops.append_binary(alg, new_sub_md);
@@ -329,9 +367,9 @@ public:
         // create second matmul primitive attr
         dnnl::primitive_attr sub_matmul2_attr
                 = make_primitive_attr(sdp_op[4], mgr);
-        memory::dims sub_mm2_src_dims = {1, 1, seq_len_q, seq_len_kv};
+        memory::dims sub_mm2_src_dims = {1, 1, q_block, seq_len_kv};
         memory::dims sub_mm2_wei_dims = {1, 1, seq_len_kv, size_per_head};
-        memory::dims sub_mm2_dst_dims = {1, 1, seq_len_q, size_per_head};
+        memory::dims sub_mm2_dst_dims = {1, 1, q_block, size_per_head};
         auto sub_mm2_src_md
                 = memory::desc(sub_mm2_src_dims, dt_src_user, tag::abcd);
         sub_mm2_wei_md = memory::desc(sub_mm2_wei_dims, dt_wei, tag::abcd);
@@ -343,7 +381,7 @@ public:
         // per-head: reorder dst2 from dense to strided
         primitive_attr sub_reorder3_attr;
         sub_reorder3_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-        memory::dims sub_dst_dims = {1, 1, seq_len_q, size_per_head};
+        memory::dims sub_dst_dims = {1, 1, q_block, size_per_head};
         auto out_lt = sdp_op[4]->get_output_value(0)->get_logical_tensor();
         dst_strides = ltw(out_lt).vstrides();
         sub_dst_md = memory::desc(sub_dst_dims, dt_src_user, tag::abcd);
@@ -359,8 +397,7 @@ public:
         ////////////////////////////////////////////////////////////////////////
         /////////////// Start Constructing exec args ///////////////////////////
         ////////////////////////////////////////////////////////////////////////
-        memory::desc max_scratchpad_md, sub_max_src1_src2_md,
-                sub_max_dst1_wei2_md;
+        memory::desc max_scratchpad_md, sub_max_src1_src2_md;
         size_t max_scratchpad_size = 0;
         // all the scratchpads required by the primitives.
         const std::vector<memory::desc> scratchpads {
@@ -384,14 +421,8 @@ public:
                 ? sub_src1_d_md
                 : sub_softmax_dst_md;
 
-        auto sub_dst1_size = sub_mm1_dst_md.get_size();
-        auto sub_wei2_size = sub_mm2_wei_md.get_size();
-        sub_max_dst1_wei2_md = sub_dst1_size > sub_wei2_size ? sub_mm1_dst_md
-                                                             : sub_mm2_wei_md;
-
         // Initialize memory object with empty buffer
         sub_max_src1_src2 = memory(sub_max_src1_src2_md, p_engine, nullptr);
-        sub_max_dst1_wei2 = memory(sub_max_dst1_wei2_md, p_engine, nullptr);
         // reorder0: 2d strided -> 2d ab
         sub_src1 = memory(sub_src1_md, p_engine, nullptr);
         // reorder1: 2d strided u8 -> 2d ba s8
@@ -663,7 +694,9 @@ private:
         // Registry is used to do the memory planning for sdp decompostion
         // algorithm. We reused some internal memory to reduce the memory
         // footprint for better cache hit. And here the key in registar of each
-        // memory is planned in a specific order.
+        // memory is planned in a specific order. The reordered weights of both
+        // matmuls have their own buffers since they are reused by all query
+        // blocks of a head processed by a thread.
         registrar_t temporary_registrar = sdp_registry.registrar();
 
         // Here we initialize the map based on certain memory reuse logic. Those
@@ -671,19 +704,22 @@ private:
         // this map. So if we want to change the memory reuse logic, we need to
         // change the value of map here.
         mem_key_map = {{sub_max_src1_src2.get(), 0}, {sub_mm1_wei.get(), 1},
-                {sub_max_dst1_wei2.get(), 2}, {sub_softmax_dst.get(), 0},
-                {sub_mm2_dst.get(), 3}, {sub_scratchpad.get(), 4}};
+                {sub_mm1_dst.get(), 2}, {sub_softmax_dst.get(), 0},
+                {sub_mm2_dst.get(), 3}, {sub_scratchpad.get(), 4},
+                {sub_mm2_wei.get(), 5}};
 
         temporary_registrar.book(mem_key_map[sub_max_src1_src2.get()],
                 sub_max_src1_src2.get_desc().get_size());
         temporary_registrar.book(mem_key_map[sub_mm1_wei.get()],
                 sub_mm1_wei.get_desc().get_size());
-        temporary_registrar.book(mem_key_map[sub_max_dst1_wei2.get()],
-                sub_max_dst1_wei2.get_desc().get_size());
+        temporary_registrar.book(mem_key_map[sub_mm1_dst.get()],
+                sub_mm1_dst.get_desc().get_size());
         temporary_registrar.book(mem_key_map[sub_mm2_dst.get()],
                 sub_mm2_dst.get_desc().get_size());
         temporary_registrar.book(mem_key_map[sub_scratchpad.get()],
                 sub_scratchpad.get_desc().get_size());
+        temporary_registrar.book(mem_key_map[sub_mm2_wei.get()],
+                sub_mm2_wei.get_desc().get_size());
     }
 
     impl::status_t prepare_sdp_scales_zps(const fusion_info_mgr_t &mgr,
@@ -997,7 +1033,7 @@ public:
                 + size_offset);
         mem_map[sdp_cfg_.sub_mm1_dst.get()][id].set_data_handle(
                 var_grantor.get(
-                        sdp_cfg_.mem_key_map[sdp_cfg_.sub_max_dst1_wei2.get()])
+                        sdp_cfg_.mem_key_map[sdp_cfg_.sub_mm1_dst.get()])
                 + size_offset);
         // softmax
         mem_map[sdp_cfg_.sub_softmax_dst.get()][id].set_data_handle(
@@ -1007,7 +1043,7 @@ public:
         // mm2
         mem_map[sdp_cfg_.sub_mm2_wei.get()][id].set_data_handle(
                 var_grantor.get(
-                        sdp_cfg_.mem_key_map[sdp_cfg_.sub_max_dst1_wei2.get()])
+                        sdp_cfg_.mem_key_map[sdp_cfg_.sub_mm2_wei.get()])
                 + size_offset);
         mem_map[sdp_cfg_.sub_mm2_dst.get()][id].set_data_handle(
                 var_grantor.get(
@@ -1063,7 +1099,8 @@ public:
         sdp_args_set_t *res = res_cache.get_or_add(
                 reinterpret_cast<size_t>(this), resource_ctor_);
 
-        int MBO = sdp_cfg_.batch_size, MBI = sdp_cfg_.num_head;
+        int MBO = sdp_cfg_.batch_size, MBI = sdp_cfg_.num_head,
+            MBQ = sdp_cfg_.num_q_blocks;
 
         char *src1_user_pointer = static_cast<char *>(
                 inputs[sdp_cfg_.graph_inport[0]].get_data_handle());
@@ -1098,10 +1135,21 @@ public:
             return memory::data_type_size(m.get_desc().get_data_type());
         };
 
-        const auto loop = [&](int tid, int nthr, dim_t bo, dim_t bi) {
+        // The head whose reordered weights currently sit in each thread's
+        // buffers. Query blocks of a head are contiguous in the parallel
+        // iteration space, so the weights reorders mostly run once per head.
+        std::vector<dim_t> tid_head(sdp_cfg_.nthr, -1);
+
+        const auto loop
+                = [&](int tid, int nthr, dim_t bo, dim_t bi, dim_t bq) {
             // prepare execution args and allocate real memory
             prepare_sub_args(var_grantor, tid, block_size, res->mem_map);
 
+            const dim_t head = bo * MBI + bi;
+            const bool wei_ready = tid_head[tid] == head;
+            tid_head[tid] = head;
+            const dim_t q_start = bq * sdp_cfg_.q_block;
+
             // reorder0
             auto &sub_src1_tid = res->mem_map[sdp_cfg_.sub_src1.get()][tid];
             // reorder1:
@@ -1123,9 +1171,13 @@ public:
                 auto mask_input = inputs[sdp_cfg_.graph_inport[3]];
                 auto mask_strides
                         = ltw(mask_input.get_logical_tensor()).vstrides();
+                const dim_t mask_q_offset
+                        = sub_mm1_post_add_tid.get_desc().get_dims()[2] == 1
+                        ? 0
+                        : q_start * mask_strides[2];
                 sub_mm1_post_add_tid.set_data_handle(
                         static_cast<char *>(mask_input.get_data_handle())
-                        + bo * mask_strides[1]
+                        + (bo * mask_strides[1] + mask_q_offset)
                                 * get_mem_dt_size(sub_mm1_post_add_tid));
             }
             if (sdp_cfg_.has_select) {
@@ -1140,9 +1192,13 @@ public:
                                                            - 1]]
                                            .at(DNNL_ARG_DST);
                     auto out_strides = out_mem.get_desc().get_strides();
+                    const dim_t out_q_offset
+                            = sub_mm1_post_tid.get_desc().get_dims()[2] == 1
+                            ? 0
+                            : q_start * out_strides[2];
                     sub_mm1_post_tid.set_data_handle(
                             static_cast<char *>(out_mem.get_data_handle())
-                            + bo * out_strides[0]
+                            + (bo * out_strides[0] + out_q_offset)
                                     * get_mem_dt_size(sub_mm1_post_tid));
                 }
             }
@@ -1160,7 +1216,8 @@ public:
 
             const size_t sub_src1_offset
                     = (bo * sdp_cfg_.src1_strides[0]
-                              + bi * sdp_cfg_.src1_strides[1])
+                              + bi * sdp_cfg_.src1_strides[1]
+                              + q_start * sdp_cfg_.src1_strides[2])
                     * get_mem_dt_size(sub_src1_tid);
             const size_t sub_wei1_offset
                     = (bo * sdp_cfg_.wei1_strides[0]
@@ -1172,7 +1229,8 @@ public:
                     * get_mem_dt_size(sub_wei2_user_tid);
             const size_t sub_dst_user_offset
                     = (bo * sdp_cfg_.dst_strides[0]
-                              + bi * sdp_cfg_.dst_strides[1])
+                              + bi * sdp_cfg_.dst_strides[1]
+                              + q_start * sdp_cfg_.dst_strides[2])
                     * get_mem_dt_size(sub_dst_user_tid);
 
             sub_wei1_user_tid.set_data_handle(
@@ -1192,13 +1250,19 @@ public:
             }
 
             // in parallel region - these primitives should use single thread.
+            // An inplace reorder only rebinds the weights handle that
+            // prepare_sub_args() has just reset, so it always has to run.
             sdp_cfg_.sub_reorder0.execute(strm, res->sub_reorder0_args[tid]);
-            sdp_cfg_.sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
+            if (!wei_ready || sdp_cfg_.sub_reorder1.get_inplace())
+                sdp_cfg_.sub_reorder1.execute(
+                        strm, res->sub_reorder1_args[tid]);
             sdp_cfg_.sub_mm1_prim.execute(strm, res->sub_mm1_args[tid]);
 
             sdp_cfg_.sub_softmax_prim.execute(strm, res->sub_softmax_args[tid]);
 
-            sdp_cfg_.sub_reorder2.execute(strm, res->sub_reorder2_args[tid]);
+            if (!wei_ready || sdp_cfg_.sub_reorder2.get_inplace())
+                sdp_cfg_.sub_reorder2.execute(
+                        strm, res->sub_reorder2_args[tid]);
 
             sdp_cfg_.sub_mm2_prim.execute(strm, res->sub_mm2_args[tid]);
             sdp_cfg_.sub_reorder3.execute(strm, res->sub_reorder3_args[tid]);
@@ -1209,7 +1273,7 @@ public:
                         strm, select_res->get_exec_args()[i]);
             }
         }
-        parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, loop);
+        parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, MBQ, loop);
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         tp_stream->after_exec_hook();
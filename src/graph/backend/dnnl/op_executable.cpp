@@ -39,6 +39,17 @@ namespace dnnl_impl {
 const indices_t::type_t input = indices_t::type_t::input;
 const indices_t::type_t output = indices_t::type_t::output;
 
+// Tells whether a primitive implementation is an optimized one, as opposed to
+// a reference or a gemm-based fallback. Used as a cheap proxy of the kernel
+// efficiency when choosing between layouts.
+static bool is_optimized_impl(const std::string &impl_name) {
+    const auto starts_with = [&](const char *prefix) {
+        return impl_name.rfind(prefix, 0) == 0;
+    };
+    return !starts_with("ref") && !starts_with("gemm")
+            && impl_name.find(":ref") == std::string::npos;
+}
+
 conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -94,7 +105,8 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
     }
     auto dst = make_dnnl_memory_desc(base_conv_dst_lt);
     auto create_pd = [&](const dnnl::memory::desc &src_md,
-                             const dnnl::memory::desc &dst_md) {
+                             const dnnl::memory::desc &dst_md,
+                             bool allow_empty = false) {
         if (op->has_attr(op_attr::with_bias)
                 && op->get_attr<bool>(op_attr::with_bias)) {
             auto bias = make_dnnl_memory_desc(
@@ -102,11 +114,13 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
             bias = to_format_any(bias);
             return dnnl::convolution_forward::primitive_desc(p_engine, pkind,
                     algorithm::convolution_direct, src_md, weight, bias, dst_md,
-                    strides, dilates, pads_begin, pads_end, prm_attr);
+                    strides, dilates, pads_begin, pads_end, prm_attr,
+                    allow_empty);
         } else {
             return dnnl::convolution_forward::primitive_desc(p_engine, pkind,
                     algorithm::convolution_direct, src_md, weight, dst_md,
-                    strides, dilates, pads_begin, pads_end, prm_attr);
+                    strides, dilates, pads_begin, pads_end, prm_attr,
+                    allow_empty);
         }
     };
 
@@ -138,8 +152,28 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
             }
         }
         if (!is_format(dst, "nxc") && !permute_nxc_dst) {
-            src = to_format_any(src);
+            // The src layout has already been decided by the producer. If
+            // the optimal src layout differs, a reorder is inserted before
+            // the conv, which costs a full read and write of the src. Keep
+            // the incoming layout when the conv still gets an optimized
+            // implementation with it, as the kernel is then about as fast
+            // as in its preferred layout and the reorder is saved.
+            const auto &src_val = op->get_input_value(0);
+            const bool src_layout_fixed = src_val->has_producer()
+                    && src.get_format_kind() != memory::format_kind::any;
             dst = to_format_any(dst);
+            if (src_layout_fixed) {
+                auto any_src_pd = create_pd(to_format_any(src), dst);
+                if (any_src_pd.src_desc() != src) {
+                    auto fixed_src_pd = create_pd(src, dst, true);
+                    if (!fixed_src_pd
+                            || !is_optimized_impl(
+                                    fixed_src_pd.impl_info_str()))
+                        src = to_format_any(src);
+                }
+            } else {
+                src = to_format_any(src);
+            }
         } else {
             auto tmp_src = to_format_any(src);
             auto tmp_dst = to_format_any(dst);
@@ -15,15 +15,20 @@
  *******************************************************************************/
 
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "common/verbose.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
 #include "graph/backend/dnnl/internal_attrs.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
 
 #include "oneapi/dnnl/dnnl.hpp"
 
@@ -33,6 +38,93 @@ namespace graph {
 namespace dnnl_impl {
 using op_ptr = std::shared_ptr<op_t>;
 
+namespace {
+// Prints the execution time of the wrapped executable when
+// ONEDNN_VERBOSE=profile_exec_ops is set, so that the time of a compiled
+// partition can be attributed to the graph ops it was built from.
+struct profiled_executable_t : public op_executable_t {
+    profiled_executable_t(
+            std::shared_ptr<op_executable_t> exec, std::string info)
+        : exec_(std::move(exec)), info_(std::move(info)) {}
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        if (!is_profiling()) {
+            exec_->execute(stream, args);
+            return;
+        }
+        wait(stream);
+        const double start_ms = get_msec();
+        exec_->execute(stream, args);
+        wait(stream);
+        report(start_ms);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps = {}) const override {
+        if (!is_profiling()) return exec_->execute_sycl(stream, args, deps);
+        wait(stream);
+        const double start_ms = get_msec();
+        auto e = exec_->execute_sycl(stream, args, deps);
+        wait(stream);
+        report(start_ms);
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps = {}) const override {
+        if (!is_profiling()) return exec_->execute_ocl(stream, args, deps);
+        wait(stream);
+        const double start_ms = get_msec();
+        auto e = exec_->execute_ocl(stream, args, deps);
+        wait(stream);
+        report(start_ms);
+        return e;
+    }
+#endif
+
+private:
+    static bool is_profiling() {
+        return get_verbose(verbose_t::exec_profile_ops, component_t::graph);
+    }
+
+    static void wait(const stream &astream) {
+        // dnnl::stream::wait() is not const qualified.
+        dnnl_stream_wait(astream.get());
+    }
+
+    void report(double start_ms) const {
+        VPROF(start_ms, graph, exec, VERBOSE_profile_op, info_.c_str(),
+                get_msec() - start_ms);
+    }
+
+    std::shared_ptr<op_executable_t> exec_;
+    std::string info_;
+};
+
+// Returns `<index>,<op kind>,<graph op ids>` where the ids are separated with
+// `;` and are empty for the ops inserted by the backend, like reorders.
+std::string exec_info(const std::shared_ptr<subgraph_t> &sg, size_t index,
+        const op_t *op) {
+    std::stringstream ss;
+    ss << index << "," << kind2str(op->get_kind()) << ",";
+    auto it = sg->origin_ids_.find(op);
+    if (it != sg->origin_ids_.end()) {
+        const char *delim = "";
+        for (size_t id : it->second) {
+            ss << delim << id;
+            delim = ";";
+        }
+    }
+    return ss.str();
+}
+} // namespace
+
 /// After the lower down, infer shape, infer type and layout propagation passes,
 /// each op in the subgraph will has complete attributes and each edge will have
 /// complete shape/dtype/layout information. We can create executable for these
@@ -66,7 +158,8 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
             return status::unimplemented;
         }
 
-        sg->execs_.emplace_back(exec);
+        sg->execs_.emplace_back(std::make_shared<profiled_executable_t>(
+                exec, exec_info(sg, sg->execs_.size(), op)));
         sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
                 && op->get_attr<bool>(op_attr::is_constant));
         return status::success;
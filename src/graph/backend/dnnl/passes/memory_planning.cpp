@@ -41,18 +41,12 @@ using op_t = op_t;
 using op_ptr = std::shared_ptr<op_t>;
 using ltw = logical_tensor_wrapper_t;
 
-struct op_inplace_pair_t {
-    op_inplace_pair_t(size_t in_idx, size_t out_idx)
-        : in_idx_(in_idx), out_idx_(out_idx) {}
-    const size_t in_idx_; // the index, not id
-    const size_t out_idx_;
-};
-
 std::vector<op_inplace_pair_t> get_op_inplace_pairs(
         op_t &op, fusion_info_mgr_t &mgr) {
     // TODO(xxx) extend the set
     const static std::set<op_kind_t> ops {op_kind::dnnl_mul_scales,
-            op_kind::dnnl_add_zps, op_kind::dnnl_reorder, op_kind::dnnl_binary,
+            op_kind::dnnl_add_zps, op_kind::dnnl_sub_zps, op_kind::dnnl_reorder,
+            op_kind::dnnl_binary,
             op_kind::dnnl_eltwise, op_kind::dnnl_softmax,
             op_kind::dnnl_logsoftmax, op_kind::dnnl_softmax_bwd,
             op_kind::dnnl_logsoftmax_bwd};
@@ -60,6 +54,7 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(
 
     // Make post-sum inplace has higher priority since it affects both
     // performance and memory footprint
+    bool has_post_sum = false;
     if (op.has_attr(op_attr::fusion_info_key)
             && op.get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
         // sum post ops support inplace
@@ -92,6 +87,7 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(
         std::shared_ptr<value_t> post_sum_input;
         for (size_t i = 0; i < pops.size(); i++) {
             if (pops[i]->is_post_sum()) {
+                has_post_sum = true;
                 post_sum_input = op.get_input_value(index);
                 break; // assume only one post sum
             } else if (pops[i]->get_op()->get_kind() == op_kind::dnnl_binary) {
@@ -129,7 +125,14 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(
             }
             if (can_inplace) { pairs.emplace_back(index, 0); }
         }
-    } else if (ops.count(op.get_kind())) {
+    }
+
+    // The post-sum input is copied to the output before the computation, so
+    // the output can't share the buffer with any other input in this case.
+    // Ops fused with other post-ops can still compute in place.
+    if (has_post_sum) return pairs;
+
+    if (ops.count(op.get_kind())) {
         auto in0 = op.get_input_value(0)->get_logical_tensor();
         auto out0 = op.get_output_value(0)->get_logical_tensor();
         // always assume in0 and out0 may inplace here, please swap inputs for
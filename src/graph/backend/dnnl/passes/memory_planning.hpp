@@ -273,6 +273,19 @@ private:
     std::vector<std::unique_ptr<buffer_info_t>> data_;
 };
 
+struct op_inplace_pair_t {
+    op_inplace_pair_t(size_t in_idx, size_t out_idx)
+        : in_idx_(in_idx), out_idx_(out_idx) {}
+    const size_t in_idx_; // the index, not id
+    const size_t out_idx_;
+};
+
+// Returns the pairs of input and output values of the op that may share the
+// same buffer. Values produced by layout-only ops (reshape, transpose, etc.)
+// are handled as views by alias_analyzer_t instead.
+std::vector<op_inplace_pair_t> get_op_inplace_pairs(
+        op_t &op, fusion_info_mgr_t &mgr);
+
 // This memory_planner_t class is used to plan which buffer can be used by each
 // value in the subgraph. All the planning works are completed in compilation
 // stage for static shape cases.
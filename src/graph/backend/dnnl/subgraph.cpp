@@ -54,11 +54,29 @@ subgraph_t::subgraph_t(const std::vector<op_ptr> &ops, const dnnl::engine &eng,
     , p_engine_(&eng)
     , fusion_info_mgr_(fpm_mode, can_use_blocked_layout) {
     if (reset_layout) { set_all_layout_to_any(get_mutable_ops()); }
+    init_origin_ids();
 }
 
 subgraph_t::subgraph_t(const std::vector<op_ptr> &ops, bool reset_layout)
     : graph_t(ops), p_engine_(nullptr) {
     if (reset_layout) { set_all_layout_to_any(get_mutable_ops()); }
+    init_origin_ids();
+}
+
+void subgraph_t::init_origin_ids() {
+    for (const auto &op : get_ops()) {
+        if (op->get_id() == op_t::DEFAULT_ID) continue;
+        origin_ids_[op.get()] = {op->get_id()};
+    }
+}
+
+void subgraph_t::merge_origin_ids(const op_t *dst, const op_t *src) {
+    auto it = origin_ids_.find(src);
+    if (it == origin_ids_.end() || dst == src) return;
+    auto &dst_ids = origin_ids_[dst];
+    for (size_t id : it->second)
+        if (std::find(dst_ids.begin(), dst_ids.end(), id) == dst_ids.end())
+            dst_ids.push_back(id);
 }
 
 std::string kind2str(op_kind_t kind) {
@@ -374,6 +392,7 @@ void subgraph_rewriter_t::run() {
         auto pos = std::find_if(mutable_ops.begin(), mutable_ops.end(),
                 [op](const op_ptr &tmp) { return op.get() == tmp.get(); });
         if (pos != mutable_ops.end()) mutable_ops.erase(pos);
+        subgraph_->origin_ids_.erase(op.get());
     }
 
     for (const auto &op : to_be_inserted_ops_) {
@@ -403,6 +422,7 @@ void subgraph_rewriter_t::fuse_op_to_successor(const op_ptr &op) {
     in_val->add_consumer(successor, offset);
     successor.connect_input(offset, in_val);
 
+    subgraph_->merge_origin_ids(&successor, op.get());
     to_remove(op);
 }
 
@@ -423,6 +443,7 @@ void subgraph_rewriter_t::fuse_op_to_predecessor(const op_ptr &op, size_t i) {
         predecessor.add_input(tmp);
     }
 
+    subgraph_->merge_origin_ids(&predecessor, op.get());
     to_remove(op);
 }
 
@@ -500,6 +521,7 @@ void subgraph_rewriter_t::replace_op(
         new_op->add_output(out_val);
     }
 
+    subgraph_->merge_origin_ids(new_op.get(), org_op.get());
     to_insert(new_op);
     to_remove(org_op);
 }
@@ -90,6 +90,16 @@ public:
 
     // The executable for each op in subgraph
     std::vector<std::shared_ptr<op_executable_t>> execs_;
+
+    // The ids of the graph ops that each op in the subgraph was lowered or
+    // fused from, used to map the per-op profiling back to the user graph
+    std::unordered_map<const op_t *, std::vector<size_t>> origin_ids_;
+
+    // Appends the origin ids of the src op to the ones of the dst op
+    void merge_origin_ids(const op_t *dst, const op_t *src);
+
+private:
+    void init_origin_ids();
 };
 
 class subgraph_visualizer_t {
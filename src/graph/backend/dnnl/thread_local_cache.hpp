@@ -64,10 +64,9 @@ namespace dnnl_impl {
 //   thread local table, and release the shared_ptr.
 // - If users want to destroy the cached value for a certain key in ALL thread,
 //   they can call the @remove_if_exist() method. After that the corresponding
-//   shared ptr in global table will be released. Even though the weak ptr in
-//   thread local table won't be erased, we think this is acceptable because the
-//   underlying instance has been destroyed indeed and the expired weak ptr can
-//   be reused by other keys.
+//   shared ptr in global table will be released. The expired weak ptr in
+//   thread local table will be erased at the next cache miss of that thread,
+//   so the thread local table only holds the entries of living kernels.
 template <typename T>
 class thread_local_cache_t {
 public:
@@ -76,7 +75,8 @@ public:
     // Check if we have a cached value for the given key in current thread
     bool has_resource(const size_t &key) {
         cache_type_t &cache = get_thread_local_cache();
-        return cache.data().count(key) && !cache.data()[key].expired();
+        auto pos = cache.data().find(key);
+        return pos != cache.data().end() && !pos->second.expired();
     }
 
     // return the number of cached values in current thread
@@ -119,7 +119,7 @@ public:
                 global_cache_type_t::get_global_cache()->mutex());
         auto pos = global_cache_type_t::get_global_cache()->data().find(key);
         if (pos != global_cache_type_t::get_global_cache()->data().end()) {
-            pos->second.clear();
+            global_cache_type_t::get_global_cache()->data().erase(pos);
         }
     }
 
@@ -128,13 +128,22 @@ public:
     T *get_or_add(const size_t &key,
             const std::function<std::shared_ptr<T>()> &creator) {
         cache_type_t &cache = get_thread_local_cache();
-        if (has_resource(key)) { // cache hit
-            return cache.data()[key].lock().get();
+        auto found = cache.data().find(key);
+        // The owner in global table keeps the value alive, so the raw pointer
+        // stays valid after the temporary shared_ptr is released
+        T *value = found != cache.data().end() ? found->second.lock().get()
+                                               : nullptr;
+        if (value) { // cache hit
+            return value;
         } else { // cache miss
             // Cache miss shouldn't happen frequently, because the lock is
             // heavy. No double-check is needed here since cached values won't
             // be shared between threads
             std::shared_ptr<T> ins = creator();
+            // The resources of removed kernels have been released in global
+            // table, drop their expired entries here so that the thread local
+            // table won't keep growing with the number of created kernels
+            cache.remove_expired();
             {
                 std::lock_guard<std::mutex> lock(
                         global_cache_type_t::get_global_cache()->mutex());
@@ -229,6 +238,15 @@ private:
 
         std::unordered_map<size_t, std::weak_ptr<T>> &data() { return data_; }
 
+        void remove_expired() {
+            for (auto it = data_.begin(); it != data_.end();) {
+                if (it->second.expired())
+                    it = data_.erase(it);
+                else
+                    ++it;
+            }
+        }
+
         global_cache_type_t &global_cache_ref_;
         std::unordered_map<size_t, std::weak_ptr<T>> data_;
     };
@@ -24,6 +24,7 @@
 #include "oneapi/dnnl/dnnl_graph.h"
 
 #include "common/rw_mutex.hpp"
+#include "common/utils.hpp"
 
 #include "graph/interface/c_types_map.hpp"
 
@@ -164,6 +165,7 @@ public:
     };
 
     void *allocate(size_t size, mem_attr_t attr = {}) const {
+        dnnl::impl::exec_allocation_checker_t::on_allocation(size);
 #ifndef NDEBUG
         monitor_.lock_write();
         void *buffer = host_malloc_(size, attr.alignment_);
@@ -178,6 +180,7 @@ public:
 #ifdef DNNL_WITH_SYCL
     void *allocate(size_t size, const ::sycl::device &dev,
             const ::sycl::context &ctx, mem_attr_t attr = {}) const {
+        dnnl::impl::exec_allocation_checker_t::on_allocation(size);
 #ifndef NDEBUG
         monitor_.lock_write();
         void *buffer = sycl_malloc_(size, attr.alignment_,
@@ -197,6 +200,7 @@ public:
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     void *allocate(size_t size, const cl_device_id dev, const cl_context ctx,
             mem_attr_t attr = {}) const {
+        dnnl::impl::exec_allocation_checker_t::on_allocation(size);
 #ifndef NDEBUG
         monitor_.lock_write();
         void *buffer = ocl_malloc_(size, attr.alignment_, dev, ctx);
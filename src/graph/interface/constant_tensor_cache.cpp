@@ -43,6 +43,11 @@
 #include <windows.h>
 #endif
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace std {
 template <>
 struct hash<dnnl::impl::engine_kind_t> {
@@ -65,11 +70,26 @@ static size_t get_timestamp() {
     return std::chrono::steady_clock::now().time_since_epoch().count();
 }
 
+// Returns the NUMA node of the CPU the calling thread runs on, or 0 if it
+// cannot be queried.
+static int get_current_numa_node() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        return static_cast<int>(node);
+#endif
+    return 0;
+}
+
 constant_tensor_cache_t::constant_tensor_cache_t(
         size_t capacity_in_bytes, const std::string &name)
-    : name_(name), capacity_in_bytes_(capacity_in_bytes), counter_(1) {
-    constant_map_ = impl::utils::make_unique<
-            std::unordered_map<c_key_t, timed_entry_t>>();
+    : name_(name)
+    , capacity_in_bytes_(capacity_in_bytes)
+    , numa_replica_capacity_in_bytes_(0)
+    , eviction_policy_(eviction_policy_t::no_evict)
+    , max_node_(0)
+    , counter_(1) {
+    constant_map_ = impl::utils::make_unique<constant_map_t>();
 }
 
 constant_tensor_cache_t::~constant_tensor_cache_t() {
@@ -149,6 +169,55 @@ size_t constant_tensor_cache_t::get_capacity() {
     return capacity_in_bytes_.load();
 }
 
+status_t constant_tensor_cache_t::set_numa_replica_capacity(size_t capacity) {
+    std::vector<c_value_t> evicted;
+    lock_write();
+    numa_replica_capacity_in_bytes_ = capacity;
+    // Drop the replicas that the new capacity does not account for. The
+    // entries are kept simple by flushing all replicas.
+    for (auto it = constant_map().begin(); it != constant_map().end();) {
+        if (it->second.is_replica_) {
+            evicted.push_back(it->second.value_);
+            it = constant_map().erase(it);
+        } else {
+            ++it;
+        }
+    }
+    unlock_write();
+    notify_evict(evicted);
+    return status::success;
+}
+
+size_t constant_tensor_cache_t::get_numa_replica_capacity() const {
+    return numa_replica_capacity_in_bytes_.load();
+}
+
+void constant_tensor_cache_t::set_eviction_policy(eviction_policy_t policy) {
+    eviction_policy_ = policy;
+}
+
+constant_tensor_cache_t::eviction_policy_t
+constant_tensor_cache_t::get_eviction_policy() const {
+    return eviction_policy_.load();
+}
+
+status_t constant_tensor_cache_t::set_backend_capacity(
+        c_key_t backend_id, size_t capacity) {
+    lock_write();
+    backend_capacities_[backend_id] = capacity;
+    unlock_write();
+    return status::success;
+}
+
+static std::atomic<constant_tensor_cache_t::pin_func_t> &pin_func() {
+    static std::atomic<constant_tensor_cache_t::pin_func_t> func {nullptr};
+    return func;
+}
+
+void constant_tensor_cache_t::set_pin_func(pin_func_t func) {
+    pin_func() = func;
+}
+
 c_key_t constant_tensor_cache_t::combine_key(
         c_key_t backend_id, c_key_t backend_specific_key) {
     size_t key = (backend_specific_key << BACKEND_ID_LENGTH)
@@ -157,11 +226,17 @@ c_key_t constant_tensor_cache_t::combine_key(
 }
 
 c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
-        c_key_t backend_specific_key, size_t size, const c_value_t &value) {
+        c_key_t backend_specific_key, size_t size, const c_value_t &value,
+        size_t partition_id) {
     if (!size) { return c_value_t(); }
 
     c_key_t key = combine_key(backend_id, backend_specific_key);
 
+    // Without replication, a single copy of the tensor is kept regardless of
+    // the node that uses it.
+    const bool use_replicas = numa_replica_capacity_in_bytes_ != 0;
+    const int node = use_replicas ? get_current_numa_node() : 0;
+
     // 1. Section with shared access (read lock)
     lock_read();
     // Check if the cache is enabled.
@@ -169,8 +244,10 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
         unlock_read();
         return c_value_t();
     }
-    // Check if the requested entry is present in the cache (likely cache_hit)
-    auto e = get(key);
+    // Check if the requested entry is present in the cache (likely cache_hit).
+    // With replication, a remote copy is only used when no local replica can
+    // be added, which is decided under the write lock.
+    auto e = get(key, node, !use_replicas);
     if (e.valid()) {
         unlock_read();
         return e;
@@ -189,15 +266,32 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
         unlock_write();
         return c_value_t();
     }
+    std::vector<c_value_t> evicted;
 
     // Double check if the requested entry is present in the cache (unlikely
     // cache_hit).
-    e = get(key);
-    if (!e.valid()) {
+    e = get(key, node, !use_replicas);
+    if (!e.valid() && use_replicas) {
+        auto remote = get(key, node, true);
+        if (!remote.valid()) {
+            // The tensor is not cached by any node (cache_miss)
+            add(key, node, size, value, false, partition_id, evicted);
+        } else if (get_replica_size(node) + size
+                <= numa_replica_capacity_in_bytes_) {
+            // The tensor is cached by another node. Let the caller create a
+            // local replica, whose pages are then allocated on this node on
+            // first touch.
+            add(key, node, size, value, true, partition_id, evicted);
+        } else {
+            // No room left for replicas on this node, use the remote copy
+            e = remote;
+        }
+    } else if (!e.valid()) {
         // If the entry is missing in the cache then add it (cache_miss)
-        add(key, size, value);
+        add(key, node, size, value, false, partition_id, evicted);
     }
     unlock_write();
+    notify_evict(evicted);
     return e;
 }
 
@@ -205,19 +299,28 @@ void constant_tensor_cache_t::remove_if_exist(
         c_key_t backend_id, c_key_t backend_specific_key) {
     c_key_t key = combine_key(backend_id, backend_specific_key);
 
+    std::vector<c_value_t> evicted;
     lock_write();
-    if (constant_map().count(key) == 0) {
-        unlock_write();
-    } else {
-        // notify backend that this buffer will be evicted from the cache. If
-        // backend hold a reference to this buffer, release it and don't use it
-        // any more. Otherwise, the constant cache capacity may exceed the upper
-        // bound and cause OOM in user application.
-        auto &item = constant_map().at(key);
-        item.value_.get()->notify_evict();
-        constant_map().erase(key);
-        unlock_write();
+    // Remove the copies of all nodes.
+    for (int node = 0; node <= max_node_; node++) {
+        auto it = constant_map().find({key, node});
+        if (it == constant_map().end()) continue;
+        evicted.push_back(it->second.value_);
+        constant_map().erase(it);
     }
+    unlock_write();
+    notify_evict(evicted);
+}
+
+// Notifies the backends that the buffers have been evicted from the cache. If
+// a backend holds a reference to a buffer, it releases it and doesn't use it
+// any more. Otherwise, the constant cache capacity may exceed the upper bound
+// and cause OOM in user application. The backends may take their own locks, so
+// this is called after the cache lock is released.
+void constant_tensor_cache_t::notify_evict(
+        const std::vector<c_value_t> &evicted) {
+    for (const auto &value : evicted)
+        value.get()->notify_evict();
 }
 
 // Get the total size of all cached buffers
@@ -229,26 +332,133 @@ size_t constant_tensor_cache_t::get_size() const {
     return total_size;
 }
 
-void constant_tensor_cache_t::add(
-        const c_key_t &key, size_t size, const c_value_t &constant) {
-    size_t current_size = get_size();
+// Get the total size of the replicas cached by a node
+size_t constant_tensor_cache_t::get_replica_size(int node) const {
+    size_t total_size = 0;
+    for (const auto &pair : constant_map()) {
+        if (pair.first.node_ != node || !pair.second.is_replica_) continue;
+        total_size += pair.second.value_.get()->size();
+    }
+    return total_size;
+}
+
+static c_key_t extract_backend_id(c_key_t key) {
+    return key & (size_t)((1 << BACKEND_ID_LENGTH) - 1);
+}
+
+// Evicts cached tensors to make room for a new tensor of the given backend.
+// The tensors are evicted in the increasing order of their cost, the product
+// of their size and creation time, so that a burst of small tensors does not
+// evict a large tensor that is expensive to recompute. Nothing is evicted if
+// enough room cannot be made.
+bool constant_tensor_cache_t::evict_for(c_key_t backend_id, size_t size,
+        size_t current_size, size_t backend_size,
+        std::vector<c_value_t> &evicted) {
+    const auto pin = pin_func().load();
+    const size_t backend_capacity = backend_capacities_.count(backend_id)
+            ? backend_capacities_.at(backend_id)
+            : std::numeric_limits<size_t>::max();
+    if (size > capacity_in_bytes_ || size > backend_capacity) return false;
+
+    struct candidate_t {
+        constant_map_t::iterator it;
+        double cost;
+    };
+    std::vector<candidate_t> candidates;
+    for (auto it = constant_map().begin(); it != constant_map().end(); ++it) {
+        const auto &entry = it->second;
+        if (entry.is_replica_) continue;
+        // Tensors that are being created cannot be evicted
+        if (entry.value_.wait_for(std::chrono::seconds(0))
+                != std::future_status::ready)
+            continue;
+        if (pin && pin(entry.partition_id_)) continue;
+        const auto &buffer = entry.value_.get();
+        const double cost = static_cast<double>(buffer->size())
+                * std::max<uint64_t>(buffer->get_creation_time_ns(), 1);
+        candidates.push_back({it, cost});
+    }
+    std::sort(candidates.begin(), candidates.end(),
+            [](const candidate_t &l, const candidate_t &r) {
+                return l.cost < r.cost;
+            });
+
+    size_t need = current_size + size > capacity_in_bytes_
+            ? current_size + size - capacity_in_bytes_
+            : 0;
+    size_t backend_need = backend_size + size > backend_capacity
+            ? backend_size + size - backend_capacity
+            : 0;
+    std::vector<constant_map_t::iterator> victims;
+    for (const auto &c : candidates) {
+        if (need == 0 && backend_need == 0) break;
+        const bool same_backend
+                = extract_backend_id(c.it->first.key_) == backend_id;
+        // Only the tensors of the same backend reduce the backend size
+        if (need == 0 && !same_backend) continue;
+        const size_t sz = c.it->second.value_.get()->size();
+        need -= std::min(need, sz);
+        if (same_backend) backend_need -= std::min(backend_need, sz);
+        victims.push_back(c.it);
+    }
+    if (need != 0 || backend_need != 0) return false;
+
+    for (auto &it : victims) {
+        evicted.push_back(it->second.value_);
+        constant_map().erase(it);
+    }
+    return true;
+}
 
-    // No enough capacity to cache the new tensor, ignore the new tensor
-    // directly
-    if (current_size + size > capacity_in_bytes_) { return; }
+void constant_tensor_cache_t::add(const c_key_t &key, int node, size_t size,
+        const c_value_t &constant, bool is_replica, size_t partition_id,
+        std::vector<c_value_t> &evicted) {
+    // Replicas are accounted by the NUMA replica capacity, checked by the
+    // caller, so that they do not prevent other tensors from being cached.
+    if (!is_replica) {
+        const c_key_t backend_id = extract_backend_id(key);
+        size_t current_size = 0, backend_size = 0;
+        for (const auto &pair : constant_map()) {
+            if (pair.second.is_replica_) continue;
+            const size_t sz = pair.second.value_.get()->size();
+            current_size += sz;
+            if (extract_backend_id(pair.first.key_) == backend_id)
+                backend_size += sz;
+        }
+        const size_t backend_capacity = backend_capacities_.count(backend_id)
+                ? backend_capacities_.at(backend_id)
+                : std::numeric_limits<size_t>::max();
+
+        bool fits = current_size + size <= capacity_in_bytes_
+                && backend_size + size <= backend_capacity;
+        if (!fits && eviction_policy_ == eviction_policy_t::cost)
+            fits = evict_for(
+                    backend_id, size, current_size, backend_size, evicted);
+
+        // No enough capacity to cache the new tensor, ignore the new tensor
+        // directly
+        if (!fits) { return; }
+    }
 
     // Cache tensors
     size_t timestamp = get_timestamp();
 
     auto res = constant_map().emplace(std::piecewise_construct,
-            std::forward_as_tuple(key),
-            std::forward_as_tuple(constant, timestamp));
+            std::forward_as_tuple(entry_key_t {key, node}),
+            std::forward_as_tuple(
+                    constant, timestamp, is_replica, partition_id));
     UNUSED(res);
     assert(res.second);
+    if (node > max_node_) max_node_ = node;
 }
 
-c_value_t constant_tensor_cache_t::get(const c_key_t &key) {
-    auto it = constant_map().find(key);
+c_value_t constant_tensor_cache_t::get(
+        const c_key_t &key, int node, bool any_node) {
+    auto it = constant_map().find({key, node});
+    // Look for the copy of another node
+    for (int n = 0; any_node && it == constant_map().end() && n <= max_node_;
+            n++)
+        it = constant_map().find({key, n});
     if (it == constant_map().end()) return c_value_t();
 
     size_t timestamp = get_timestamp();
@@ -259,7 +469,7 @@ c_value_t constant_tensor_cache_t::get(const c_key_t &key) {
 
 // Evict n size of cached buffers
 void constant_tensor_cache_t::evict(size_t n) {
-    using v_t = std::unordered_map<c_key_t, timed_entry_t>::value_type;
+    using v_t = constant_map_t::value_type;
     if (n == get_size()) {
         constant_map().clear();
         return;
@@ -283,9 +493,7 @@ void constant_tensor_cache_t::evict(size_t n) {
                                     std::memory_order_relaxed);
                 });
         evicted_size += it->second.value_.get()->size();
-        auto res = constant_map().erase(it->first);
-        UNUSED(res);
-        assert(res);
+        constant_map().erase(it);
     }
 }
 
@@ -338,6 +546,7 @@ public:
     std::unordered_map<impl::engine_kind_t, size_t> &get_user_capacities() {
         return user_capacities;
     }
+    size_t &get_numa_replica_capacity() { return numa_replica_capacity; }
 
 private:
     global_cache_manager_t() {
@@ -386,6 +595,59 @@ private:
             }
         }
 
+        // The value of ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_NUMA_REPLICA_CAPACITY
+        // is the capacity of the replicas on each NUMA node in MBytes. It
+        // only applies to the CPU caches.
+        int replica_capacity = impl::getenv_int_user(
+                "GRAPH_CONSTANT_TENSOR_CACHE_NUMA_REPLICA_CAPACITY", 0);
+        if (replica_capacity > 0)
+            numa_replica_capacity = static_cast<size_t>(replica_capacity)
+                    * 1024 * 1024;
+
+        // The value of ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_EVICTION_POLICY is
+        // either no_evict (default) or cost.
+        std::string policy = impl::getenv_string_user(
+                "GRAPH_CONSTANT_TENSOR_CACHE_EVICTION_POLICY");
+        if (policy == "cost")
+            eviction_policy = constant_tensor_cache_t::eviction_policy_t::cost;
+        else if (!policy.empty() && policy != "no_evict")
+            VERROR(graph, constant_tensor_cache,
+                    "'%s': eviction policy is invalid ", policy.c_str());
+
+        // The value of ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_BACKEND_CAPACITY is
+        // in this form: backend_name:size;backend_name:size, in MBytes.
+        std::unordered_map<size_t, size_t> backend_capacities;
+        str = impl::getenv_string_user(
+                "GRAPH_CONSTANT_TENSOR_CACHE_BACKEND_CAPACITY");
+        for (const auto &config : graph::utils::split(str, ';')) {
+            auto fields = graph::utils::split(config, ':');
+            if (fields.size() != 2 || fields[0].empty() || fields[1].empty())
+                continue;
+            const backend_t *bkd = nullptr;
+            for (const auto *b : backend_registry_t::get_singleton()
+                                         .get_registered_backends()) {
+                if (b->get_name() == fields[0]) bkd = b;
+            }
+            if (!bkd) {
+                VERROR(graph, constant_tensor_cache,
+                        "'%s': backend name is invalid ", fields[0].c_str());
+                continue;
+            }
+            try {
+                static constexpr size_t converter = 1024 * 1024;
+                size_t capacity = std::stoll(fields[1]);
+                backend_capacities[bkd->get_id()]
+                        = capacity < std::numeric_limits<size_t>::max()
+                                / converter
+                        ? capacity * converter
+                        : std::numeric_limits<size_t>::max();
+            } catch (const std::exception &e) {
+                VERROR(graph, constant_tensor_cache,
+                        "'%s': backend capacity setting is invalid ",
+                        e.what());
+            }
+        }
+
         // create cache for all engine kinds and all devices in the
         // system, to avoid potential data race when modifying caches vector at
         // runtime in multiple threads.
@@ -408,6 +670,11 @@ private:
                         [](constant_tensor_cache_t *ptr) {
                             return ptr->release();
                         });
+                if (kind == impl::engine_kind::cpu)
+                    cache->set_numa_replica_capacity(numa_replica_capacity);
+                cache->set_eviction_policy(eviction_policy);
+                for (const auto &bc : backend_capacities)
+                    cache->set_backend_capacity(bc.first, bc.second);
             }
             caches.insert({kind, std::move(cache_list)});
         }
@@ -421,6 +688,9 @@ private:
     std::unordered_map<impl::engine_kind_t, std::vector<cache_ptr>> caches;
     std::unordered_map<impl::engine_kind_t, size_t> default_capacities;
     std::unordered_map<impl::engine_kind_t, size_t> user_capacities;
+    size_t numa_replica_capacity = 0;
+    constant_tensor_cache_t::eviction_policy_t eviction_policy
+            = constant_tensor_cache_t::eviction_policy_t::no_evict;
 };
 
 constant_tensor_cache_t *get_constant_tensor_cache(
@@ -519,3 +789,39 @@ dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_capacity(
 
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t
+dnnl_graph_set_constant_tensor_cache_numa_replica_capacity(size_t size) {
+    static constexpr size_t converter = 1024 * 1024;
+    size_t size_byte = size < std::numeric_limits<size_t>::max() / converter
+            ? size * converter
+            : std::numeric_limits<size_t>::max();
+    auto &manager = dnnl::impl::graph::global_cache_manager_t::get_instance();
+    manager.get_numa_replica_capacity() = size_byte; // convert MB to Bytes
+
+    // NUMA replicas are only used by the CPU caches
+    if (manager.get_caches().count(dnnl::impl::engine_kind::cpu)) {
+        for (auto &cache :
+                manager.get_caches().at(dnnl::impl::engine_kind::cpu)) {
+            if (cache) cache->set_numa_replica_capacity(size_byte);
+        }
+    }
+    return dnnl::impl::graph::status::success;
+}
+
+dnnl::impl::graph::status_t
+dnnl_graph_get_constant_tensor_cache_numa_replica_capacity(size_t *size) {
+    if (size == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+    static constexpr size_t converter = 1024 * 1024;
+    // convert Bytes to MB
+    *size = dnnl::impl::graph::global_cache_manager_t::get_instance()
+                    .get_numa_replica_capacity()
+            / converter;
+    return dnnl::impl::graph::status::success;
+}
+
+dnnl::impl::graph::status_t dnnl_graph_set_constant_tensor_cache_pin_callback(
+        dnnl_graph_constant_tensor_cache_pin_f callback) {
+    dnnl::impl::graph::constant_tensor_cache_t::set_pin_func(callback);
+    return dnnl::impl::graph::status::success;
+}
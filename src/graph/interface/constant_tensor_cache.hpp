@@ -17,16 +17,20 @@
 #define GRAPH_INTERFACE_CONSTANT_TENSOR_CACHE_HPP
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
 #include "common/rw_mutex.hpp"
+#include "common/utils.hpp"
 
 #include "graph/interface/allocator.hpp"
 #include "graph/interface/c_types_map.hpp"
@@ -47,7 +51,9 @@ public:
         , eng_(eng)
         , alc_(alc)
         , malloc_func_(malloc_func)
-        , free_func_(free_func) {
+        , free_func_(free_func)
+        , alloc_time_ns_(get_time_ns())
+        , creation_time_ns_(0) {
         data_ = malloc_func_(size, eng, alc);
         eng_->retain();
     }
@@ -70,6 +76,15 @@ public:
 
     size_t size() const { return size_; }
 
+    // Records the time elapsed since the buffer was allocated. Backends call
+    // it once the content of the buffer is computed. The cache uses it to
+    // estimate the cost of recomputing the buffer when choosing the entries
+    // to evict.
+    void record_creation_time() {
+        creation_time_ns_ = get_time_ns() - alloc_time_ns_;
+    }
+    uint64_t get_creation_time_ns() const { return creation_time_ns_; }
+
     // used to notify backend the buffer has been evict. backend can use this
     // api to avoid query constant cache frequently to reduce overhead.
     virtual void notify_evict() {}
@@ -81,14 +96,33 @@ protected:
     allocator_t *alc_;
 
 private:
+    static uint64_t get_time_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+    }
+
     malloc_func_t malloc_func_;
     free_func_t free_func_;
+    uint64_t alloc_time_ns_;
+    std::atomic<uint64_t> creation_time_ns_;
 };
 
 struct constant_tensor_cache_t {
     using key_t = size_t;
     using cached_t = std::shared_ptr<constant_buffer_t>;
     using value_t = std::shared_future<cached_t>;
+    using pin_func_t = dnnl_graph_constant_tensor_cache_pin_f;
+
+    // Defines what happens when a new tensor does not fit in the cache.
+    enum class eviction_policy_t {
+        // The new tensor is not cached
+        no_evict,
+        // The cached tensors with the lowest cost, computed as their size
+        // multiplied by the time it took to create them, are evicted to make
+        // room for the new tensor. Pinned tensors are never evicted.
+        cost,
+    };
 
     explicit constant_tensor_cache_t(
             size_t capacity_in_bytes, const std::string &name = "");
@@ -108,12 +142,33 @@ struct constant_tensor_cache_t {
     status_t set_capacity(size_t capacity);
     size_t get_capacity();
 
+    // The partition id is passed to the pin function to decide whether the
+    // tensor can be evicted.
     value_t get_or_add(key_t backend_id, key_t backend_specific_key,
-            size_t size, const value_t &value);
+            size_t size, const value_t &value,
+            size_t partition_id = std::numeric_limits<size_t>::max());
     void remove_if_exist(key_t backend_id, key_t backend_specific_key);
 
     size_t get_size() const;
 
+    // The capacity of the NUMA replicas on each node, in bytes. When it is
+    // not zero, a thread that misses a tensor cached by another NUMA node
+    // creates a local replica as long as the replicas of its own node fit in
+    // the capacity. Otherwise, the remote copy is used.
+    status_t set_numa_replica_capacity(size_t capacity);
+    size_t get_numa_replica_capacity() const;
+
+    void set_eviction_policy(eviction_policy_t policy);
+    eviction_policy_t get_eviction_policy() const;
+
+    // Limits the size of the tensors of a backend, in bytes. The limit is
+    // applied in addition to the capacity of the cache.
+    status_t set_backend_capacity(key_t backend_id, size_t capacity);
+
+    // The pin function is shared by all the caches. A tensor whose partition
+    // id makes the function return a non-zero value is never evicted.
+    static void set_pin_func(pin_func_t func);
+
     // The key_t is composed of two parts: backend id and backend specific key.
     // The backend id occupies 4 bits, and the backend specific key occupies the
     // remained 60 bits. So backends should ensure not encode any information in
@@ -123,9 +178,37 @@ struct constant_tensor_cache_t {
     static key_t combine_key(key_t backend_id, key_t backend_specific_key);
 
 private:
+    // A tensor can be cached once per NUMA node. The entries of the same key
+    // are distinguished by the node of the thread that added them.
+    struct entry_key_t {
+        key_t key_;
+        int node_;
+        bool operator==(const entry_key_t &other) const {
+            return key_ == other.key_ && node_ == other.node_;
+        }
+    };
+
+    struct entry_key_hash_t {
+        size_t operator()(const entry_key_t &k) const {
+            return hash_combine(k.key_, k.node_);
+        }
+    };
+
+    struct timed_entry_t;
+    using constant_map_t = std::unordered_map<entry_key_t, timed_entry_t,
+            entry_key_hash_t>;
+
     void evict(size_t n);
-    value_t get(const key_t &key);
-    void add(const key_t &key, size_t size, const value_t &constant);
+    value_t get(const key_t &key, int node, bool any_node);
+    // The tensors evicted to make room for the new one are appended to
+    // `evicted`, to be notified once the cache lock is released.
+    void add(const key_t &key, int node, size_t size, const value_t &constant,
+            bool is_replica, size_t partition_id,
+            std::vector<value_t> &evicted);
+    size_t get_replica_size(int node) const;
+    bool evict_for(key_t backend_id, size_t size, size_t current_size,
+            size_t backend_size, std::vector<value_t> &evicted);
+    static void notify_evict(const std::vector<value_t> &evicted);
 
     void lock_read() { rw_mutex_.lock_read(); }
     void lock_write() { rw_mutex_.lock_write(); }
@@ -142,26 +225,35 @@ private:
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        // Whether the entry is a copy of a tensor cached by another node.
+        bool is_replica_;
+        size_t partition_id_;
+        timed_entry_t(const value_t &value, size_t timestamp, bool is_replica,
+                size_t partition_id)
+            : value_(value)
+            , timestamp_(timestamp)
+            , is_replica_(is_replica)
+            , partition_id_(partition_id) {}
     };
 
-    std::unordered_map<key_t, timed_entry_t> &constant_map() {
-        return *constant_map_;
-    }
+    constant_map_t &constant_map() { return *constant_map_; }
 
-    const std::unordered_map<key_t, timed_entry_t> &constant_map() const {
-        return *constant_map_;
-    }
+    const constant_map_t &constant_map() const { return *constant_map_; }
 
     // Each entry in the cache has a corresponding key and timestamp.
     // NOTE: pairs that contain atomics cannot be stored in an unordered_map *as
     // an element*, since it invokes the copy constructor of std::atomic, which
     // is deleted.
-    std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> constant_map_;
+    std::unique_ptr<constant_map_t> constant_map_;
     impl::utils::rw_mutex_t rw_mutex_;
     std::string name_;
     std::atomic<size_t> capacity_in_bytes_;
+    std::atomic<size_t> numa_replica_capacity_in_bytes_;
+    std::atomic<eviction_policy_t> eviction_policy_;
+    std::unordered_map<key_t, size_t> backend_capacities_;
+    // The highest NUMA node that added an entry, bounds the lookup of the
+    // copies held by other nodes.
+    std::atomic<int> max_node_;
     std::atomic<int32_t> counter_;
 };
 
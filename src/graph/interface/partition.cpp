@@ -318,6 +318,15 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
         outs.emplace_back(**(outputs + i));
     }
 
+    // Kernels reuse and release their memory objects right after submitting
+    // the primitives, so they are executed synchronously on out-of-order CPU
+    // streams, after the previously submitted work.
+    dnnl::impl::sync_exec_scope_t sync_exec_scope;
+    if (stream->engine()->kind() == engine_kind::cpu
+            && (stream->flags() & dnnl::impl::stream_flags::out_of_order))
+        CHECK(stream->wait());
+
+    dnnl::impl::exec_allocation_checker_t allocation_checker;
     if (get_verbose(dnnl::impl::verbose_t::exec_profile,
                 dnnl::impl::component_t::graph)) {
 #ifndef NDEBUG
@@ -344,7 +353,7 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
     } else {
         CHECK(compiled_partition->execute(stream, ins, outs));
     }
-    return status::success;
+    return allocation_checker.check(compiled_partition->info());
 }
 
 status_t DNNL_API dnnl_graph_sycl_interop_compiled_partition_execute(
@@ -522,6 +531,26 @@ status_t DNNL_API dnnl_graph_ocl_interop_compiled_partition_execute(
 }
 #endif
 
+status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs) {
+    if (utils::any_null(stream, compiled_partition, inputs)) {
+        return status::invalid_arguments;
+    }
+    // The kernels address the inputs by their position in the partition.
+    if (num_inputs != compiled_partition->get_inputs().size())
+        return status::invalid_arguments;
+
+    std::vector<tensor_t> ins;
+    ins.reserve(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        if (inputs[i] == nullptr) return status::invalid_arguments;
+        ins.emplace_back(**(inputs + i));
+    }
+
+    return compiled_partition->prepare_constants(stream, ins);
+}
+
 status_t DNNL_API dnnl_graph_compiled_partition_destroy(
         compiled_partition_t *compiled_partition) {
     delete compiled_partition;
@@ -784,6 +813,27 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
     }
 }
 
+status_t dnnl_graph_compiled_partition::prepare_constants(
+        const stream_t *astream, const std::vector<tensor_t> &inputs) const {
+    if (!astream || (astream->engine()->kind() != pimpl_->get_engine()->kind()))
+        return status::invalid_arguments;
+
+    // The constant parts are computed through the host stream only. On other
+    // runtimes they are still materialized by the first execution.
+    if (astream->engine()->kind() == engine_kind::gpu) return status::success;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    return status::success;
+#else
+    const backend_t *backend = src_partition_.get_assigned_backend();
+    if (!backend) return status::invalid_arguments;
+
+    std::vector<tensor_t> processed_inputs;
+    pre_process(processed_inputs, inputs, backend);
+
+    return pimpl_->prepare_constants(astream, processed_inputs);
+#endif
+}
+
 #ifdef DNNL_WITH_SYCL
 status_t dnnl_graph_compiled_partition::execute_sycl(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
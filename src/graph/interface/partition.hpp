@@ -178,6 +178,9 @@ public:
             const std::vector<graph::tensor_t> &inputs,
             const std::vector<graph::tensor_t> &outputs) const;
 
+    graph::status_t prepare_constants(const graph::stream_t *astream,
+            const std::vector<graph::tensor_t> &inputs) const;
+
 #ifdef DNNL_WITH_SYCL
     graph::status_t execute_sycl(const graph::stream_t *astream,
             const std::vector<graph::tensor_t> &inputs,
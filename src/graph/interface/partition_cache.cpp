@@ -15,11 +15,18 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cassert>
 #include <chrono>
+#include <cstring>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "graph/interface/backend.hpp"
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/graph.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/op.hpp"
 #include "graph/interface/partition.hpp"
 #include "graph/interface/partition_cache.hpp"
 
@@ -49,6 +56,371 @@ const partition_t *compiled_partition_cache_t::get_partition(const key_t &key) {
     return result.value != nullptr ? &(result.value->src_partition()) : nullptr;
 }
 
+namespace {
+
+// Version of the blob layout. It must be increased whenever the layout
+// changes.
+const uint64_t blob_format_version = 1;
+
+struct blob_reader_t {
+    blob_reader_t(const uint8_t *data, size_t size)
+        : data_(data), size_(size), pos_(0) {}
+
+    template <typename T>
+    bool read(T *ptr, size_t nelems = 1) {
+        static_assert(!std::is_pointer<T>::value,
+                "T cannot be a pointer to pointer.");
+        if (nelems > (size_ - pos_) / sizeof(T)) return false;
+        const size_t bytes = sizeof(T) * nelems;
+        std::memcpy(static_cast<void *>(ptr), data_ + pos_, bytes);
+        pos_ += bytes;
+        return true;
+    }
+
+    bool read(std::string &s) {
+        uint64_t len = 0;
+        if (!read(&len) || len > size_ - pos_) return false;
+        s.assign(reinterpret_cast<const char *>(data_ + pos_), len);
+        pos_ += len;
+        return true;
+    }
+
+    template <typename T>
+    bool read(std::vector<T> &v) {
+        uint64_t len = 0;
+        if (!read(&len) || len > (size_ - pos_) / sizeof(T)) return false;
+        v.resize(len);
+        return read(v.data(), len);
+    }
+
+private:
+    const uint8_t *data_;
+    size_t size_;
+    size_t pos_;
+};
+
+void write_string(serialization_stream_t &sstream, const std::string &s) {
+    const uint64_t len = s.size();
+    sstream.write(&len);
+    sstream.write(s.data(), s.size());
+}
+
+template <typename T>
+void write_vector(serialization_stream_t &sstream, const std::vector<T> &v) {
+    const uint64_t len = v.size();
+    sstream.write(&len);
+    sstream.write(v.data(), v.size());
+}
+
+void write_logical_tensor(
+        serialization_stream_t &sstream, const logical_tensor_t &lt) {
+    sstream.write(&lt.id);
+    sstream.write(&lt.ndims);
+    sstream.write(lt.dims, DNNL_MAX_NDIMS);
+    sstream.write(&lt.data_type);
+    sstream.write(&lt.property);
+    sstream.write(&lt.layout_type);
+    // The strides cover the whole layout union.
+    sstream.write(lt.layout.strides, DNNL_MAX_NDIMS);
+}
+
+bool read_logical_tensor(blob_reader_t &reader, logical_tensor_t &lt) {
+    return reader.read(&lt.id) && reader.read(&lt.ndims)
+            && reader.read(lt.dims, DNNL_MAX_NDIMS)
+            && reader.read(&lt.data_type) && reader.read(&lt.property)
+            && reader.read(&lt.layout_type)
+            && reader.read(lt.layout.strides, DNNL_MAX_NDIMS);
+}
+
+void write_logical_tensors(serialization_stream_t &sstream,
+        const std::vector<logical_tensor_t> &lts) {
+    const uint64_t len = lts.size();
+    sstream.write(&len);
+    for (const auto &lt : lts)
+        write_logical_tensor(sstream, lt);
+}
+
+bool read_logical_tensors(
+        blob_reader_t &reader, std::vector<logical_tensor_t> &lts) {
+    uint64_t len = 0;
+    if (!reader.read(&len)) return false;
+    lts.clear();
+    for (uint64_t i = 0; i < len; i++) {
+        logical_tensor_t lt = zero_logical_tensor();
+        if (!read_logical_tensor(reader, lt)) return false;
+        lts.push_back(lt);
+    }
+    return true;
+}
+
+void write_attribute(serialization_stream_t &sstream, op_attr_t name,
+        const utils::attribute_value_t &attr) {
+    const attribute_kind_t kind = attr.get_kind();
+    sstream.write(&name);
+    sstream.write(&kind);
+    switch (kind) {
+        case attribute_kind::f: {
+            const float v = attr.get<float>();
+            sstream.write(&v);
+        } break;
+        case attribute_kind::fs:
+            write_vector(sstream, attr.get<std::vector<float>>());
+            break;
+        case attribute_kind::i: {
+            const int64_t v = attr.get<int64_t>();
+            sstream.write(&v);
+        } break;
+        case attribute_kind::is:
+            write_vector(sstream, attr.get<std::vector<int64_t>>());
+            break;
+        case attribute_kind::s:
+            write_string(sstream, attr.get<std::string>());
+            break;
+        case attribute_kind::b: {
+            const bool v = attr.get<bool>();
+            sstream.write(&v);
+        } break;
+        default: assert(!"unknown attribute kind");
+    }
+}
+
+template <typename T>
+bool read_attribute_value(blob_reader_t &reader, op_t &op, op_attr_t name) {
+    T v {};
+    if (!reader.read(&v)) return false;
+    op.set_attr<T>(name, v);
+    return true;
+}
+
+template <typename T>
+bool read_attribute_vector(blob_reader_t &reader, op_t &op, op_attr_t name) {
+    T v;
+    if (!reader.read(v)) return false;
+    op.set_attr<T>(name, v);
+    return true;
+}
+
+bool read_attribute(blob_reader_t &reader, op_t &op) {
+    op_attr_t name {};
+    attribute_kind_t kind {};
+    if (!reader.read(&name) || !reader.read(&kind)) return false;
+    switch (kind) {
+        case attribute_kind::f:
+            return read_attribute_value<float>(reader, op, name);
+        case attribute_kind::fs:
+            return read_attribute_vector<std::vector<float>>(reader, op, name);
+        case attribute_kind::i:
+            return read_attribute_value<int64_t>(reader, op, name);
+        case attribute_kind::is:
+            return read_attribute_vector<std::vector<int64_t>>(
+                    reader, op, name);
+        case attribute_kind::s:
+            return read_attribute_vector<std::string>(reader, op, name);
+        case attribute_kind::b:
+            return read_attribute_value<bool>(reader, op, name);
+        default: return false;
+    }
+}
+
+void write_op(serialization_stream_t &sstream, const op_t &op) {
+    const size_t id = op.get_id();
+    const op_kind_t kind = op.get_kind();
+    sstream.write(&id);
+    sstream.write(&kind);
+    write_string(sstream, op.get_name());
+
+    // Internal attributes are set by the passes and will be set again when
+    // the partition is re-created.
+    std::vector<op_attr_t> names;
+    for (const auto &attr : op.get_attributes())
+        if (attr.first < op_attr::end) names.push_back(attr.first);
+    // Keep the blob independent of the hash map iteration order.
+    std::sort(names.begin(), names.end());
+    const uint64_t n_attrs = names.size();
+    sstream.write(&n_attrs);
+    for (const auto &name : names)
+        write_attribute(sstream, name, op.get_attributes().at(name));
+
+    std::vector<logical_tensor_t> lts;
+    for (const auto &val : op.get_input_values())
+        lts.push_back(val->get_logical_tensor());
+    write_logical_tensors(sstream, lts);
+    lts.clear();
+    for (const auto &val : op.get_output_values())
+        lts.push_back(val->get_logical_tensor());
+    write_logical_tensors(sstream, lts);
+}
+
+bool read_op(blob_reader_t &reader, std::shared_ptr<op_t> &op) {
+    size_t id = 0;
+    op_kind_t kind {};
+    std::string name;
+    uint64_t n_attrs = 0;
+    if (!reader.read(&id) || !reader.read(&kind) || !reader.read(name)
+            || !reader.read(&n_attrs))
+        return false;
+    if (static_cast<size_t>(kind)
+            >= static_cast<size_t>(op_kind::LastSymbol))
+        return false;
+
+    op = std::make_shared<op_t>(id, kind, name);
+    for (uint64_t i = 0; i < n_attrs; i++)
+        if (!read_attribute(reader, *op)) return false;
+
+    std::vector<logical_tensor_t> ins, outs;
+    if (!read_logical_tensors(reader, ins)
+            || !read_logical_tensors(reader, outs))
+        return false;
+    for (const auto &lt : ins)
+        op->add_input(lt);
+    for (const auto &lt : outs)
+        op->add_output(lt);
+    return true;
+}
+
+bool has_opaque_layout(const std::vector<logical_tensor_t> &lts) {
+    return std::any_of(
+            lts.begin(), lts.end(), [](const logical_tensor_t &lt) {
+                return logical_tensor_wrapper_t(lt).is_opaque();
+            });
+}
+
+// Re-creates the partition from its operations and compiles it through the
+// compiled partition cache.
+status_t compile_entry(const impl::engine_t *engine, fpmath_mode_t fpmath_mode,
+        const std::vector<std::shared_ptr<op_t>> &ops,
+        const std::vector<logical_tensor_t> &ins,
+        const std::vector<logical_tensor_t> &outs) {
+    graph_t g {engine->kind(), fpmath_mode};
+    for (const auto &op : ops)
+        CHECK(g.add_op(op.get()));
+    CHECK(g.finalize());
+
+    std::vector<const backend_t *> &backends
+            = backend_registry_t::get_singleton().get_registered_backends();
+    for (const auto &cbkd : backends) {
+        if (g.num_unpartitioned_ops() == 0) break;
+        backend_t *bkd = const_cast<backend_t *>(cbkd);
+        CHECK(bkd->get_partitions(g, partition_policy::fusion));
+    }
+
+    // The stored operations were a single partition when they were compiled.
+    // Anything else means the partitioning changed and the key would not
+    // match anyway.
+    if (g.get_num_partitions() != 1) return status::unimplemented;
+
+    partition_t part;
+    std::vector<partition_t *> parts {&part};
+    CHECK(g.get_ordered_partitions(parts));
+    if (!part.is_supported()) return status::unimplemented;
+
+    std::vector<const logical_tensor_t *> in_ptrs, out_ptrs;
+    for (const auto &lt : ins)
+        in_ptrs.push_back(&lt);
+    for (const auto &lt : outs)
+        out_ptrs.push_back(&lt);
+
+    compiled_partition_t cp(part);
+    std::pair<compiled_partition_t *, bool> cp_pair {&cp, false};
+    return part.compile(cp_pair, in_ptrs, out_ptrs, engine);
+}
+
+} // namespace
+
+status_t compiled_partition_cache_t::serialize(
+        serialization_stream_t &sstream) {
+    serialization_stream_t entries;
+    uint64_t n_entries = 0;
+    const auto write_entry = [&](const key_t &key,
+                                     const compiled_partition_t &cp) {
+        // Opaque layout IDs are only valid within the current process.
+        if (has_opaque_layout(key.ins_) || has_opaque_layout(key.outs_))
+            return;
+
+        const partition_t &part = cp.src_partition();
+        const engine_kind_t engine_kind = part.get_engine_kind();
+        const fpmath_mode_t fpmath_mode = part.get_fpmath_mode();
+        entries.write(&engine_kind);
+        entries.write(&fpmath_mode);
+
+        const uint64_t n_ops = part.get_ops().size();
+        entries.write(&n_ops);
+        for (const auto &op : part.get_ops())
+            write_op(entries, *op);
+
+        write_logical_tensors(entries, key.ins_);
+        write_logical_tensors(entries, key.outs_);
+        n_entries++;
+    };
+    cache_.for_each_ready(write_entry);
+
+    const char *hash = dnnl_version()->hash;
+    sstream.write(&blob_format_version);
+    write_string(sstream, std::string(hash));
+    sstream.write(&n_entries);
+    const auto &data = entries.get_data();
+    sstream.write(data.data(), data.size());
+    return status::success;
+}
+
+status_t compiled_partition_cache_t::get_blob_size(size_t *size) {
+    serialization_stream_t sstream;
+    CHECK(serialize(sstream));
+    *size = sstream.get_data().size();
+    return status::success;
+}
+
+status_t compiled_partition_cache_t::get_blob(uint8_t *blob, size_t size) {
+    serialization_stream_t sstream;
+    CHECK(serialize(sstream));
+    const auto &data = sstream.get_data();
+    // The cache may have grown since the size was queried.
+    if (data.size() > size) return status::invalid_arguments;
+    std::memcpy(blob, data.data(), data.size());
+    return status::success;
+}
+
+status_t compiled_partition_cache_t::set_blob(
+        const impl::engine_t *engine, const uint8_t *blob, size_t size) {
+    blob_reader_t reader(blob, size);
+
+    uint64_t version = 0;
+    std::string hash;
+    uint64_t n_entries = 0;
+    if (!reader.read(&version) || version != blob_format_version
+            || !reader.read(hash) || hash != dnnl_version()->hash
+            || !reader.read(&n_entries))
+        return status::invalid_arguments;
+
+    for (uint64_t i = 0; i < n_entries; i++) {
+        engine_kind_t engine_kind {};
+        fpmath_mode_t fpmath_mode {};
+        uint64_t n_ops = 0;
+        if (!reader.read(&engine_kind) || !reader.read(&fpmath_mode)
+                || !reader.read(&n_ops))
+            return status::invalid_arguments;
+
+        std::vector<std::shared_ptr<op_t>> ops;
+        for (uint64_t j = 0; j < n_ops; j++) {
+            std::shared_ptr<op_t> op;
+            if (!read_op(reader, op)) return status::invalid_arguments;
+            ops.push_back(op);
+        }
+
+        std::vector<logical_tensor_t> ins, outs;
+        if (!read_logical_tensors(reader, ins)
+                || !read_logical_tensors(reader, outs))
+            return status::invalid_arguments;
+
+        if (engine_kind != engine->kind()) continue;
+        // Warming up the cache is best effort: a partition that cannot be
+        // compiled in the current environment, e.g. due to a different ISA,
+        // is compiled again on its first use.
+        compile_entry(engine, fpmath_mode, ops, ins, outs);
+    }
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -73,3 +445,27 @@ dnnl::impl::graph::status_t dnnl_graph_set_compiled_partition_cache_capacity(
 #endif
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t dnnl_graph_get_compiled_partition_cache_blob(
+        size_t *size, uint8_t *cache_blob) {
+    if (size == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    auto &cache = dnnl::impl::graph::compiled_partition_cache();
+    if (cache_blob == nullptr) return cache.get_blob_size(size);
+    return cache.get_blob(cache_blob, *size);
+#else
+    return dnnl::impl::graph::status::unimplemented;
+#endif
+}
+
+dnnl::impl::graph::status_t dnnl_graph_set_compiled_partition_cache_blob(
+        dnnl::impl::engine_t *engine, size_t size, const uint8_t *cache_blob) {
+    if (dnnl::impl::utils::any_null(engine, cache_blob))
+        return dnnl::impl::graph::status::invalid_arguments;
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+    return dnnl::impl::graph::compiled_partition_cache().set_blob(
+            engine, cache_blob, size);
+#else
+    return dnnl::impl::graph::status::unimplemented;
+#endif
+}
@@ -30,6 +30,7 @@
 
 #include "common/cache_utils.hpp"
 #include "common/rw_mutex.hpp"
+#include "common/serialization_stream.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -65,7 +66,21 @@ struct compiled_partition_cache_t {
 
     const partition_t *get_partition(const key_t &key);
 
+    // Serializes the compiled partitions held in the cache into a blob. Only
+    // the information needed to recompile the partitions is stored: the
+    // partition operations and the logical tensors given at compilation.
+    status_t get_blob_size(size_t *size);
+    status_t get_blob(uint8_t *blob, size_t size);
+
+    // Recompiles the partitions stored in a blob for the given engine. Since
+    // the compilation goes through `partition_t::compile`, the results are
+    // put into the cache.
+    status_t set_blob(
+            const impl::engine_t *engine, const uint8_t *blob, size_t size);
+
 private:
+    status_t serialize(serialization_stream_t &sstream);
+
     // No need to set key_merge here since update_entry function is not need in
     // partition cache
     utils::lru_cache_t<key_t, compiled_partition_t, result_t,
@@ -347,6 +347,21 @@ public:
             const std::vector<tensor_t> &outputs)
             = 0;
 
+    /// Compute the constant parts of a compiled_partition and store them in
+    /// the constant tensor cache ahead of the first execution
+    /// @param astream The stream used for the computation
+    /// @param inputs The inputs tensors, same as the ones given to execute.
+    ///     Only the buffers of the constant inputs are accessed
+    /// @return The status code
+    /// @note The default implementation does nothing, in which case the
+    ///     constant parts are computed by the first execution.
+    virtual status_t prepare_constants(
+            const stream_t *astream, const std::vector<tensor_t> &inputs) {
+        UNUSED(astream);
+        UNUSED(inputs);
+        return status::success;
+    }
+
 #ifdef DNNL_WITH_SYCL
     virtual status_t execute_sycl(const stream_t *astream,
             const std::vector<tensor_t> &inputs,
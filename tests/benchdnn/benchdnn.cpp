@@ -57,6 +57,7 @@ int verbose {0};
 bool canonical {false};
 bool mem_check {true};
 std::string skip_impl;
+std::string cache_blob_store;
 stat_t benchdnn_stat {0};
 std::string driver_name;
 
@@ -67,6 +68,16 @@ int fix_times_per_prb {default_fix_times_per_prb};
 int default_fix_times_per_prb {0};
 int repeats_per_prb {default_repeats_per_prb};
 int default_repeats_per_prb {1};
+int instances {default_instances};
+int default_instances {1};
+int threads_per_instance {default_threads_per_instance};
+int default_threads_per_instance {0};
+double peak_gflops {default_peak_gflops};
+double default_peak_gflops {0};
+double peak_gbps {default_peak_gbps};
+double default_peak_gbps {0};
+double perf_cliff {default_perf_cliff};
+double default_perf_cliff {0};
 
 bool default_fast_ref {DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE};
 bool fast_ref {default_fast_ref};
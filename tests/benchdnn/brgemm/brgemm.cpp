@@ -293,6 +293,30 @@ dnnl_status_t brgemm_kernel_execute_postops_wrapper(
     return dnnl_success;
 }
 
+// Measures the cost of an AMX tile configuration switch. It happens every time
+// kernels with different tile configurations are called one after another,
+// e.g. through `set_hw_context()` of the ukernel API. Each measured iteration
+// releases tiles and loads the `palette` of the problem back.
+int measure_tile_config_switch(const char *palette, res_t *res) {
+    using namespace dnnl::impl::cpu::x64;
+
+    static constexpr int n_iters = 1000;
+    auto &t = res->timer_map.get_timer(timer::names::tile_cfg_timer);
+    t.reset();
+    while (true) {
+        t.start();
+        for (int i = 0; i < n_iters; i++) {
+            DNN_SAFE(amx_tile_release(), WARN);
+            DNN_SAFE(amx_tile_configure(palette), WARN);
+        }
+        t.stamp(n_iters);
+        // The time of a single switch is tiny, hence, no need to spend the
+        // full problem time budget on it.
+        if (t.times() >= 100 * n_iters) break;
+    }
+    return OK;
+}
+
 int doit(const prb_t *prb, res_t *res) {
     if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
 
@@ -377,8 +401,8 @@ int doit(const prb_t *prb, res_t *res) {
     auto brgemm_kernel = make_benchdnn_dnnl_wrapper(brgemm_kernel_);
 
     const auto is_tmm = brgemm_desc.is_tmm;
+    char palette[AMX_PALETTE_SIZE] = {};
     if (is_tmm) {
-        char palette[AMX_PALETTE_SIZE] = {};
         DNN_SAFE(brgemm_init_tiles(brgemm_desc, palette), WARN);
         DNN_SAFE(amx_tile_configure(palette), WARN);
     }
@@ -640,6 +664,9 @@ int doit(const prb_t *prb, res_t *res) {
             scratchpad_ptr, std::placeholders::_1, std::placeholders::_2);
     measure_perf(prb->ctx_exe, res, perf_func, args);
 
+    if (is_tmm && has_bench_mode_bit(mode_bit_t::perf))
+        SAFE(measure_tile_config_switch(palette, res), WARN);
+
     if (is_tmm) DNN_SAFE(amx_tile_release(), WARN);
 
     return OK;
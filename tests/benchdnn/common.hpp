@@ -94,6 +94,7 @@ extern bool canonical;
 extern bool mem_check;
 extern bool attr_same_pd_check;
 extern std::string skip_impl; /* empty or "" means skip nothing */
+extern std::string cache_blob_store; /* empty means no store is dumped */
 extern std::string driver_name;
 
 #define BENCHDNN_PRINT(v, fmt, ...) \
@@ -117,6 +118,16 @@ extern int fix_times_per_prb; // if non-zero run prb that many times
 extern int default_fix_times_per_prb; // 0, rely on time criterion
 extern int repeats_per_prb; // test repeats per prb
 extern int default_repeats_per_prb; // default test repeats per prb
+extern int instances; // concurrent problem executions on CPU
+extern int default_instances; // default concurrent problem executions
+extern int threads_per_instance; // threads per instance, 0 - split evenly
+extern int default_threads_per_instance; // default threads per instance
+extern double peak_gflops; // peak compute for efficiency report, 0 - auto
+extern double default_peak_gflops; // default peak compute
+extern double peak_gbps; // peak bandwidth for efficiency report, 0 - none
+extern double default_peak_gbps; // default peak bandwidth
+extern double perf_cliff; // drop in percents to report a cliff, 0 - disabled
+extern double default_perf_cliff; // default perf cliff threshold
 
 extern bool fast_ref;
 extern bool default_fast_ref;
@@ -190,6 +201,18 @@ struct res_t {
     skip_reason_t reason;
     size_t ibytes, obytes;
     dir_t mem_check_dir = DIR_UNDEF;
+    // Hardware counter values per run in the order of `--perf-counters`.
+    std::vector<double> perf_counters;
+    // Number of problem runs per second summed over all instances.
+    double throughput = 0;
+    // Size of JIT code generated for the tested primitive in bytes.
+    size_t jit_code_size = 0;
+    // Latency and page faults of the first execution of the last executed
+    // primitive, which include the warm-up costs like faulting the scratchpad
+    // pages in or lazy weights packing.
+    double first_exec_ms = 0;
+    long first_exec_page_faults = 0;
+    const void *first_exec_prim = nullptr;
 };
 
 void parse_result(res_t &res, const char *pstr);
@@ -113,6 +113,14 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_prelu_po(prb->attr, res, dnnl_concat);
     skip_unimplemented_arg_scale(prb->attr, res);
 
+    // Only CPU concat requantizes inputs to a destination scale and zero point.
+    const bool has_dst_quant = !prb->attr.scales.get(DNNL_ARG_DST).is_def()
+            || !prb->attr.zero_points.get(DNNL_ARG_DST).is_def();
+    if (!is_cpu() && has_dst_quant) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     // ref concat is reorder-based, hence, inherits some reorder limitations.
     // bf16, f16 reorders on cpu supports only [bf16, f16]<->f32
     bool valid_xf16_input
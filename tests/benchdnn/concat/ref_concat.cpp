@@ -36,6 +36,15 @@ void compute_ref(
 
     float *dst_ptr = (float *)dst;
 
+    // Every input is requantized to the common destination scale and zero
+    // point.
+    const auto &dst_sc = prb->attr.scales.get(DNNL_ARG_DST);
+    const float dst_scale = dst_sc.is_def() ? 1.f : dst_sc.scale;
+    const bool has_dst_zp = !prb->attr.zero_points.get(DNNL_ARG_DST).is_def();
+    const int dst_zero_point = has_dst_zp
+            ? args.find(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST).get_elem(0)
+            : 0;
+
     int64_t outer_size {0}, inner_size {0}, axis_size {0};
     get_sizes(prb, outer_size, inner_size, axis_size);
 
@@ -53,7 +62,8 @@ void compute_ref(
             for (int64_t as = 0; as < i_axis_size; ++as) {
                 int64_t idx = as * inner_size + in;
                 dst_ptr[off_dst + idx]
-                        = src_i.get_elem(off_src + idx) * scale_i;
+                        = src_i.get_elem(off_src + idx) * scale_i / dst_scale
+                        + dst_zero_point;
             }
             // the next input start point
             off_dst += i_axis_size * inner_size;
@@ -868,6 +868,10 @@ std::ostream &dump_global_params(std::ostream &s) {
 #endif
     if (canonical || cold_cache_mode != default_cold_cache_mode)
         s << "--cold-cache=" << cold_cache_mode << " ";
+    if (canonical || cold_cache_numa_node != default_cold_cache_numa_node)
+        s << "--cold-cache-numa=" << cold_cache_numa_node << " ";
+    if (canonical || cold_cache_warm != default_cold_cache_warm)
+        s << "--cold-cache-warm=" << cold_cache_warm << " ";
 
     return s;
 }
@@ -892,6 +896,10 @@ dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str) {
     if (!strncasecmp(param, str, strlen(param)))
         return dnnl_scratchpad_mode_user;
 
+    param = "shared";
+    if (!strncasecmp(param, str, strlen(param)))
+        return dnnl_scratchpad_mode_shared;
+
     assert(!"not expected");
     return attr_t::get_default_scratchpad_mode();
 }
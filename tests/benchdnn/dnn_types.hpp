@@ -388,8 +388,11 @@ struct attr_t {
     // build time, otherwise scratchpad pointers are invalidated (as were
     // created inside threads that no longer exist when execution time comes).
     // Relevant for both engines since GPU uses CPU for faster validation.
+    // Concurrent instances executing the same primitive need their own
+    // scratchpad memory for the same reason.
     static dnnl_scratchpad_mode_t get_default_scratchpad_mode() {
         return has_bench_mode_modifier(mode_modifier_t::par_create)
+                        || instances > 1
                 ? dnnl_scratchpad_mode_user
                 : dnnl_scratchpad_mode_library;
     }
@@ -416,6 +419,9 @@ struct isa_hints_t {
         // Use prefer_ymm CPU ISA hint
         // Will override DNNL_CPU_ISA_HINTS if that is available too
         prefer_ymm = 0x2,
+        // Use prefer_ymm_auto CPU ISA hint
+        // Will override DNNL_CPU_ISA_HINTS if that is available too
+        prefer_ymm_auto = 0x3,
     };
 
     cpu_hints_t hints_;
@@ -428,6 +434,7 @@ struct isa_hints_t {
             case none: return "none";
             case no_hints: return "no_hints";
             case prefer_ymm: return "prefer_ymm";
+            case prefer_ymm_auto: return "prefer_ymm_auto";
             default: assert(!"unknown hint"); return "unknown_hint";
         }
     }
@@ -437,6 +444,8 @@ struct isa_hints_t {
 
         if (strcasecmp(str, "prefer_ymm") == 0)
             hints = prefer_ymm;
+        else if (strcasecmp(str, "prefer_ymm_auto") == 0)
+            hints = prefer_ymm_auto;
         else if (strcasecmp(str, "no_hints") == 0)
             hints = no_hints;
 
@@ -15,14 +15,28 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <atomic>
+#include <condition_variable>
 #include <functional> // for std::bind and std::placeholders
 #include <list>
+#include <map>
+#include <mutex>
 #include <string> // for std::string
+#include <thread>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -47,6 +61,7 @@
 
 #include "utils/cold_cache.hpp"
 #include "utils/fill.hpp"
+#include "utils/perf_counters.hpp"
 #include "utils/stream_kind.hpp"
 
 extern "C" dnnl_status_t dnnl_impl_notify_profiling_complete(
@@ -170,6 +185,33 @@ lru_cache_t &get_test_cache() {
     return cache;
 }
 
+// Creates one more primitive from the cache blob of `prim` to collect the
+// creation time for the performance report. The new primitive is discarded.
+// Primitives without cache blob support are silently skipped.
+static int measure_create_from_cache_blob(
+        dnnl_primitive_t prim, res_t *res) {
+    size_t size = 0;
+    if (dnnl_primitive_get_cache_blob(prim, &size, nullptr) != dnnl_success
+            || size == 0)
+        return OK;
+
+    std::vector<uint8_t> cache_blob;
+    SAFE(get_cache_blob(cache_blob, prim), WARN);
+
+    // The primitive cache is disabled to avoid picking up `prim` from it.
+    const auto old_capacity = set_primitive_cache_capacity_without_clearing(0);
+    dnnl_primitive_t p {};
+    dnnl_status_t dnnl_st = dnnl_success;
+    TIME_C_PRIM_BLOB(dnnl_st = dnnl_primitive_create_from_cache_blob(&p,
+                             query_pd(prim), cache_blob.size(),
+                             cache_blob.data()));
+    set_primitive_cache_capacity_without_clearing(old_capacity);
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> blob_prim(p);
+    if (dnnl_st != dnnl_success) return res->state = FAILED, FAIL;
+
+    return OK;
+}
+
 int test_persistent_cache_api(
         benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &prim, res_t *res) {
 
@@ -192,6 +234,11 @@ int test_persistent_cache_api(
             return res->state = FAILED, FAIL;
     }
 
+    // CPU primitives created from cache blobs are not validated, only their
+    // creation time is reported when the correctness is not checked.
+    if (is_cpu() && !has_bench_mode_bit(mode_bit_t::corr))
+        return measure_create_from_cache_blob(prim, res);
+
     // Start testing persistent cache API.
     if (!is_gpu() || (is_gpu() && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
         return OK;
@@ -216,8 +263,9 @@ int test_persistent_cache_api(
     if (!cache_value.empty()) {
         const size_t size = cache_value.size();
         const uint8_t *cache_blob = cache_value.data();
-        auto dnnl_st = dnnl_primitive_create_from_cache_blob(
-                &p, pd, size, cache_blob);
+        dnnl_status_t dnnl_st = dnnl_success;
+        TIME_C_PRIM_BLOB(dnnl_st = dnnl_primitive_create_from_cache_blob(
+                                 &p, pd, size, cache_blob));
         if (dnnl_st != dnnl_success) return res->state = FAILED, FAIL;
     } else {
         std::vector<uint8_t> cache_blob;
@@ -238,8 +286,9 @@ int test_persistent_cache_api(
             return FAIL;
         }
 
-        auto dnnl_st = dnnl_primitive_create_from_cache_blob(
-                &p, pd, cache_blob.size(), cache_blob.data());
+        dnnl_status_t dnnl_st = dnnl_success;
+        TIME_C_PRIM_BLOB(dnnl_st = dnnl_primitive_create_from_cache_blob(
+                                 &p, pd, cache_blob.size(), cache_blob.data()));
         if (dnnl_st != dnnl_success) return res->state = FAILED, FAIL;
         cache.add(cache_blob_id, cache_blob);
     }
@@ -251,6 +300,59 @@ int test_persistent_cache_api(
     return OK;
 }
 
+using cache_blob_map_t = std::map<std::vector<uint8_t>, std::vector<uint8_t>>;
+
+cache_blob_map_t &get_cache_blob_store_entries() {
+    static cache_blob_map_t entries;
+    return entries;
+}
+
+int collect_cache_blob(dnnl_primitive_t prim) {
+    if (cache_blob_store.empty()) return OK;
+
+    std::vector<uint8_t> cache_blob_id;
+    SAFE(get_cache_blob_id(cache_blob_id, query_pd(prim)), WARN);
+    auto &entries = get_cache_blob_store_entries();
+    if (cache_blob_id.empty() || entries.count(cache_blob_id)) return OK;
+
+    // Not every engine and implementation supports cache blobs, such
+    // primitives are silently skipped.
+    size_t size = 0;
+    if (dnnl_primitive_get_cache_blob(prim, &size, nullptr) != dnnl_success
+            || size == 0)
+        return OK;
+
+    std::vector<uint8_t> cache_blob;
+    SAFE(get_cache_blob(cache_blob, prim), WARN);
+    entries.emplace(cache_blob_id, cache_blob);
+    return OK;
+}
+
+static void dump_cache_blob_store() {
+    if (cache_blob_store.empty()) return;
+
+    FILE *file = fopen(cache_blob_store.c_str(), "wb");
+    if (!file) {
+        BENCHDNN_PRINT(0, "Error: can't open cache blob store file '%s'\n",
+                cache_blob_store.c_str());
+        return;
+    }
+
+    const auto write_record = [&](const std::vector<uint8_t> &data) {
+        const uint64_t size = data.size();
+        fwrite(&size, sizeof(size), 1, file);
+        fwrite(data.data(), 1, data.size(), file);
+    };
+    const auto &entries = get_cache_blob_store_entries();
+    for (const auto &e : entries) {
+        write_record(e.first);
+        write_record(e.second);
+    }
+    fclose(file);
+    BENCHDNN_PRINT(0, "Dumped %zu cache blobs into '%s'\n", entries.size(),
+            cache_blob_store.c_str());
+}
+
 // Engine kind used to run oneDNN primitives for testing
 dnnl_engine_kind_t engine_tgt_kind = dnnl_cpu;
 // Engine index used to run oneDNN primitives for testing
@@ -268,6 +370,8 @@ void init_isa_settings() {
         DNN_SAFE_V(dnnl_set_cpu_isa_hints(dnnl_cpu_isa_no_hints));
     else if (hints.get() == isa_hints_t::prefer_ymm)
         DNN_SAFE_V(dnnl_set_cpu_isa_hints(dnnl_cpu_isa_prefer_ymm));
+    else if (hints.get() == isa_hints_t::prefer_ymm_auto)
+        DNN_SAFE_V(dnnl_set_cpu_isa_hints(dnnl_cpu_isa_prefer_ymm_auto));
     else {
         // Do nothing when hints == none
         assert(hints.get() == isa_hints_t::none);
@@ -354,16 +458,36 @@ void execute_map_args(const args_t &args) {
         if (!args.dnn_mem(i).is_mapped()) args.dnn_mem(i).map();
 }
 
+// Returns the number of minor and major page faults of the process.
+static long get_page_faults() {
+#if !defined(_WIN32)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_minflt + usage.ru_majflt;
+#endif
+    return 0;
+}
+
 int execute_and_wait(perf_function_t &exec_func, const dnnl_engine_t &engine,
-        const args_t &args, res_t *res) {
+        const args_t &args, res_t *res, const_dnnl_primitive_t prim) {
     stream_t stream(engine);
     std::vector<dnnl_exec_arg_t> dnnl_args;
 
     execute_unmap_args(args, dnnl_args);
 
+    const bool is_first_exec = res && prim && res->first_exec_prim != prim;
+    const long page_faults = is_first_exec ? get_page_faults() : 0;
+    timer::timer_t t;
+    t.start();
     auto status = exec_func(stream, dnnl_args);
     DNN_SAFE(dnnl_stream_wait(stream), CRIT);
+    t.stamp();
     if (res) res->state = EXECUTED;
+    if (is_first_exec) {
+        res->first_exec_ms = t.ms();
+        res->first_exec_page_faults = get_page_faults() - page_faults;
+        res->first_exec_prim = prim;
+    }
 
     execute_map_args(args);
     if (status != dnnl_success) {
@@ -386,7 +510,7 @@ int execute_and_wait(dnnl_primitive_t prim, const args_t &args, res_t *res) {
             std::placeholders::_1, std::placeholders::_2);
     auto pd = query_pd(prim);
     auto engine = query_engine(pd);
-    return execute_and_wait(exec_func, engine, args, res);
+    return execute_and_wait(exec_func, engine, args, res, prim);
 }
 
 void reset_gpu_profiling(dnnl_stream_t stream) {
@@ -434,13 +558,23 @@ void notify_gpu_profiling_complete(dnnl_stream_t stream) {
 }
 
 void finalize() {
+    dump_cache_blob_store();
     finalize_tbb();
 }
 
 inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args,
+        res_t *res) {
     cold_cache_t cold_cache(dnnl_args);
 
+    perf_counters_t counters;
+    if (counters.is_enabled() && res) {
+        // Counters are attached to existing threads only, the warm-up run
+        // makes sure the thread team is created.
+        DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+        counters.start();
+    }
+
     t.reset();
     while (true) {
         if (!cold_cache.update_dnnl_args(dnnl_args)) break;
@@ -449,6 +583,14 @@ inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
         t.stamp();
         if (should_stop(t)) break;
     }
+
+    if (counters.is_enabled() && res) {
+        counters.stop();
+        res->perf_counters.clear();
+        for (uint64_t v : counters.values())
+            res->perf_counters.push_back(
+                    t.times() ? (double)v / t.times() : 0.);
+    }
     return OK;
 }
 
@@ -545,20 +687,126 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     return OK;
 }
 
+int get_threads_per_instance() {
+    if (threads_per_instance > 0) return threads_per_instance;
+    return MAX2(1, benchdnn_get_max_threads() / instances);
+}
+
+// Binds the calling thread to the CPUs of a given instance. Threads spawned by
+// the threading runtime afterwards inherit the binding, unless the runtime
+// binds threads on its own (e.g. `OMP_PROC_BIND` is set).
+static void bind_instance_thread(int instance, int nthr) {
+#if defined(__linux__)
+    cpu_set_t process_set;
+    CPU_ZERO(&process_set);
+    if (sched_getaffinity(0, sizeof(process_set), &process_set) != 0) return;
+
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &process_set)) cpus.push_back(cpu);
+
+    const size_t first = (size_t)instance * nthr;
+    if (first + nthr > cpus.size()) {
+        static std::atomic<bool> warned {false};
+        if (!warned.exchange(true)) {
+            BENCHDNN_PRINT(0,
+                    "WARNING: %d instances with %d threads each exceed %d "
+                    "available CPUs, instances are not pinned.\n",
+                    instances, nthr, (int)cpus.size());
+        }
+        return;
+    }
+
+    cpu_set_t instance_set;
+    CPU_ZERO(&instance_set);
+    for (int i = 0; i < nthr; i++)
+        CPU_SET(cpus[first + i], &instance_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(instance_set), &instance_set);
+#else
+    (void)instance;
+    (void)nthr;
+#endif
+}
+
+// Runs `instances` concurrent measurements of the same problem, each one with
+// its own stream, copy of memory arguments and subset of threads. The perf
+// timer collects runs of all instances, so its `max` mode reports the tail
+// latency, while the throughput sums up rates of all instances.
+inline int measure_perf_multi_instance(const thr_ctx_t &inst_ctx, res_t *res,
+        std::vector<stream_t> &v_stream, perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
+    const int nthr = get_threads_per_instance();
+    std::vector<timer::timer_t> timers(instances);
+    std::vector<int> statuses(instances, OK);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int n_ready = 0;
+
+    const auto run_instance = [&](int &i) -> int {
+        // Warm-up run creates the thread team of the instance, then all
+        // instances start measurements at the same time.
+        const auto warmup_status = perf_func(v_stream[i], dnnl_args[i]);
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (++n_ready == instances)
+                cv.notify_all();
+            else
+                cv.wait(lock, [&] { return n_ready == instances; });
+        }
+        DNN_SAFE(warmup_status, WARN);
+
+        res_t *no_res = nullptr; // perf counters are not per-instance
+        return measure_perf_individual(
+                timers[i], v_stream[i], perf_func, dnnl_args[i], no_res);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(instances);
+    for (int i = 0; i < instances; i++) {
+        workers.emplace_back([&, i] {
+            int idx = i;
+            bind_instance_thread(idx, nthr);
+            statuses[idx] = execute_in_thr_ctx(inst_ctx, run_instance, idx);
+        });
+    }
+    for (auto &w : workers)
+        w.join();
+
+    auto &t = res->timer_map.perf_timer();
+    t.reset();
+    res->throughput = 0;
+    for (int i = 0; i < instances; i++) {
+        if (statuses[i] != OK) return statuses[i];
+        t.merge(timers[i]);
+        const double sec = timers[i].sec(timer::timer_t::sum);
+        if (sec > 0) res->throughput += timers[i].times() / sec;
+    }
+    return OK;
+}
+
 int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         args_t &args) {
     if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
 
     const auto &engine = get_test_engine();
-    std::vector<stream_t> v_stream(num_streams);
-    for (int i = 0; i < num_streams; i++)
-        v_stream[i] = stream_t(engine, ctx.get_interop_obj());
-
-    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(num_streams);
-    std::vector<dnn_mem_map_t> mem_map(num_streams);
-    std::vector<args_t> v_args(num_streams);
+    const bool is_multi_instance
+            = instances > 1 && is_cpu() && !is_sycl_engine(engine);
+    const int n_copies = is_multi_instance ? instances : num_streams;
+    const thr_ctx_t inst_ctx = {get_threads_per_instance(), ctx.core_type,
+            ctx.nthr_per_core};
+
+    std::vector<stream_t> v_stream(n_copies);
+    for (int i = 0; i < n_copies; i++)
+        v_stream[i] = stream_t(engine,
+                is_multi_instance ? inst_ctx.get_interop_obj()
+                                  : ctx.get_interop_obj());
+
+    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(n_copies);
+    std::vector<dnn_mem_map_t> mem_map(n_copies);
+    std::vector<args_t> v_args(n_copies);
     v_args[0] = args;
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < n_copies; j++) {
         for (int i = 0; i < args.size(); i++) {
             int arg = args.arg(i);
             const auto &m = args.dnn_mem(i);
@@ -575,17 +823,24 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // For DPCPP CPU and GPU: measure iterations in batches to hide driver
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     int ret = OK;
-    if (is_cpu() && !is_sycl_engine(engine)) {
+    if (is_multi_instance) {
+        ret = measure_perf_multi_instance(
+                inst_ctx, res, v_stream, perf_func, dnnl_args);
+    } else if (is_cpu() && !is_sycl_engine(engine)) {
         ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, v_stream[0],
-                perf_func, dnnl_args[0]);
+                perf_func, dnnl_args[0], res);
     } else {
         ret = execute_in_thr_ctx(
                 ctx, measure_perf_aggregate, t, v_stream, perf_func, dnnl_args);
     }
+    if (!is_multi_instance) {
+        const double sec = t.sec(timer::timer_t::sum);
+        res->throughput = sec > 0 ? t.times() / sec : 0;
+    }
 
     if (ret != OK) res->state = FAILED;
     execute_map_args(args);
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < n_copies; j++) {
         execute_map_args(v_args[j]);
     }
 
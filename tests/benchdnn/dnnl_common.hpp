@@ -236,6 +236,7 @@ int get_memory_footprint(const_dnnl_primitive_desc_t pd, res_t *res);
 int check_same_pd(const dnnl_primitive_desc_t &pd_no_attr, res_t *res);
 int test_persistent_cache_api(
         benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &prim, res_t *res);
+int collect_cache_blob(dnnl_primitive_t prim);
 int check_mem_size(const_dnnl_memory_desc_t md, res_t *res);
 int check_mem_size(const_dnnl_primitive_desc_t const_pd, res_t *res, dir_t dir);
 
@@ -483,6 +484,10 @@ int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
     BENCHDNN_PRINT(5, "oneDNN implementation: %s\n", res->impl_name.c_str());
     // Collect memory footprint (perf report) for a given primitive descriptor.
     SAFE(get_memory_footprint(pd, res), WARN);
+    // Collect the size of generated code (perf report).
+    DNN_SAFE(dnnl_primitive_get_memory_consumption(primw,
+                     dnnl_memory_consumption_code, &res->jit_code_size),
+            WARN);
 
     if (has_bench_mode_bit(mode_bit_t::corr)) {
         // Check if adding attributes doesn't cause a fall back to another impl.
@@ -491,6 +496,9 @@ int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
                 WARN);
     }
 
+    // Save the cache blob to produce an ahead-of-time cache blob store.
+    SAFE(collect_cache_blob(primw), WARN);
+
     user_prim.reset(primw.release());
     return res->state = INITIALIZED, OK;
 }
@@ -610,8 +618,11 @@ typedef std::function<dnnl_status_t(
         const dnnl_stream_t &, const std::vector<dnnl_exec_arg_t> &)>
         perf_function_t;
 
+// When `prim` is passed and was not executed with `res` before, the latency and
+// the page faults of the execution are saved in `res` as the first execution.
 int execute_and_wait(perf_function_t &exec_func, const dnnl_engine_t &engine,
-        const args_t &args, res_t *res = nullptr);
+        const args_t &args, res_t *res = nullptr,
+        const_dnnl_primitive_t prim = nullptr);
 int execute_and_wait(
         dnnl_primitive_t prim, const args_t &args, res_t *res = nullptr);
 
@@ -351,8 +351,22 @@ bool miopen_check_correctness(const prb_t *prb,
 
 void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
         const args_t &ref_args) {
-    const float trh
-            = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
+    float trh = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
+    // fpmath modes allowing down-conversion to bf16 or f16 let CPU
+    // implementations use fast approximations of the algorithms below. Their
+    // relative error is bounded by 5e-4, see the eltwise developer guide.
+    const auto fpmath_mode = prb->attr.fpmath_mode.mode;
+    const bool is_fpmath_relaxed = fpmath_mode == dnnl_fpmath_mode_bf16
+            || fpmath_mode == dnnl_fpmath_mode_f16
+            || fpmath_mode == dnnl_fpmath_mode_any;
+    const bool alg_has_fast_approx = prb->alg == alg_t::EXP
+            || prb->alg == alg_t::EXP_DST || prb->alg == alg_t::LOGISTIC
+            || prb->alg == alg_t::LOGISTIC_DST || prb->alg == alg_t::SWISH
+            || prb->alg == alg_t::TANH || prb->alg == alg_t::TANH_DST
+            || prb->alg == alg_t::GELU_TANH;
+    if (is_cpu() && (prb->dir & FLAG_FWD) && is_fpmath_relaxed
+            && alg_has_fast_approx)
+        trh = MAX2(trh, 5e-4f);
     cmp.set_threshold(trh);
 
     cmp.set_zero_trust_percent(get_eltwise_zero_trust_percent(prb));
@@ -332,6 +332,42 @@ int make_output_tensors(std::vector<dnnl::graph::tensor> &output_ts,
     return OK;
 }
 
+/// @brief Print the time of the first execution and of the steady state for
+/// each executed partition and for the whole graph.
+/// @param part_ids indices of executed partitions in the partition list
+/// @param first_exec_timers timers of the first execution per partition
+/// @param part_timers timers of the steady state per partition, empty when
+/// the split is not supported
+/// @param perf_timer timer of the steady state of the whole graph
+void print_partitions_time(const std::vector<size_t> &part_ids,
+        const std::vector<timer::timer_t> &first_exec_timers,
+        const std::vector<timer::timer_t> &part_timers,
+        const timer::timer_t &perf_timer) {
+    using bt = timer::timer_t;
+    if (verbose < 1) return;
+
+    double first_exec_ms = 0;
+    for (size_t i = 0; i < part_ids.size(); i++) {
+        const double first_ms = first_exec_timers[i].ms(bt::avg);
+        first_exec_ms += first_ms;
+        if (part_timers.size() != part_ids.size()) {
+            BENCHDNN_PRINT(1,
+                    "[PARTITION_TIME] #%zu: first(ms):%g avg(ms):n/a\n",
+                    part_ids[i], first_ms);
+            continue;
+        }
+
+        const double avg_ms = part_timers[i].ms(bt::avg);
+        const double graph_ms = perf_timer.ms(bt::avg);
+        BENCHDNN_PRINT(1,
+                "[PARTITION_TIME] #%zu: first(ms):%g avg(ms):%g (%.1f%%)\n",
+                part_ids[i], first_ms, avg_ms,
+                graph_ms > 0 ? 100. * avg_ms / graph_ms : 0.);
+    }
+    BENCHDNN_PRINT(1, "[PARTITION_TIME] graph: first(ms):%g avg(ms):%g\n",
+            first_exec_ms, perf_timer.ms(bt::avg));
+}
+
 } // namespace
 
 namespace graph {
@@ -579,6 +615,12 @@ int doit(const prb_t *prb, res_t *res) {
     }
     if (bench_mode == bench_mode_t::init) return res->state = INITIALIZED, OK;
 
+    // The first execution of each partition includes one-time costs, such as
+    // filling the constant weights cache, and is reported apart from the
+    // steady state in performance mode.
+    std::vector<timer::timer_t> first_exec_timers;
+    std::vector<size_t> c_partition_ids;
+
     // `idx_offset` points to the correspondent `compiled_partition`, if any
     // of `partitions` were skipped expectedly and not compiled.
     size_t idx_offset = 0;
@@ -655,8 +697,11 @@ int doit(const prb_t *prb, res_t *res) {
         output_ts_all.emplace_back(output_ts);
 
         BENCHDNN_PRINT(3, "[INFO]: Start execution of partition #%zd.\n", i);
+        first_exec_timers.emplace_back();
         c_partitions[i - idx_offset].execute(strm, input_ts, output_ts);
         strm.wait();
+        first_exec_timers.back().stamp();
+        c_partition_ids.push_back(i);
 
         // map memory from device back to host
         map_unmap_partition_mem(partition_mem_map_v[i], inputs, MAP, res);
@@ -680,9 +725,12 @@ int doit(const prb_t *prb, res_t *res) {
     }
 
     if (has_bench_mode_bit(mode_bit_t::perf)) {
+        std::vector<timer::timer_t> part_timers;
         SAFE(measure_perf(res->timer_map.perf_timer(), c_partitions,
-                     input_ts_all, output_ts_all, res),
+                     input_ts_all, output_ts_all, res, &part_timers),
                 WARN);
+        print_partitions_time(c_partition_ids, first_exec_timers, part_timers,
+                res->timer_map.perf_timer());
     }
     return OK;
 }
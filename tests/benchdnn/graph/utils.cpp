@@ -200,19 +200,25 @@ inline int measure_perf_individual(timer::timer_t &t,
         std::vector<perf_function_t> &perf_func_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &inputs_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &outputs_v,
-        res_t *res) {
+        res_t *res, std::vector<timer::timer_t> *part_timers) {
     const bool use_profiling = is_gpu() && !is_nvidia_gpu() && !is_amd_gpu();
     const dnnl::stream::flags flags = use_profiling
             ? dnnl::stream::flags::default_flags | get_profiling_flags()
             : dnnl::stream::flags::default_flags;
     cpp_stream_t stream {get_graph_engine(), flags};
 
+    auto sz = perf_func_v.size();
+    if (part_timers) part_timers->assign(sz, timer::timer_t());
+
     t.reset();
     while (true) {
-        auto sz = perf_func_v.size();
         for (size_t i = 0; i < sz; i++) {
+            // Execution is synchronous on CPU, so a time stamp taken right
+            // after the call covers the whole partition execution.
+            if (part_timers) (*part_timers)[i].start();
             DNN_GRAPH_SAFE(perf_func_v[i](stream, inputs_v[i], outputs_v[i]),
                     WARN, res);
+            if (part_timers) (*part_timers)[i].stamp();
         }
         t.stamp();
         if (should_stop(t)) break;
@@ -223,14 +229,17 @@ inline int measure_perf_individual(timer::timer_t &t,
 int measure_perf(timer::timer_t &t, std::vector<perf_function_t> &perf_func_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &inputs_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &outputs_v,
-        res_t *res) {
+        res_t *res, std::vector<timer::timer_t> *part_timers) {
     if (has_bench_mode_bit(mode_bit_t::perf)) {
         // enable GPU profiling, Nvidia/AMD dose not support profiling.
         int ret = OK;
         if (is_cpu() && !is_sycl_engine()) {
             ret = measure_perf_individual(
-                    t, perf_func_v, inputs_v, outputs_v, res);
+                    t, perf_func_v, inputs_v, outputs_v, res, part_timers);
         } else {
+            // Asynchronous execution doesn't allow to split the time between
+            // partitions without extra synchronization.
+            if (part_timers) part_timers->clear();
             ret = measure_perf_aggregate(
                     t, perf_func_v, inputs_v, outputs_v, res);
         }
@@ -244,7 +253,7 @@ int measure_perf(timer::timer_t &t,
         const std::vector<dnnl::graph::compiled_partition> &cp_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &inputs_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &outputs_v,
-        res_t *res) {
+        res_t *res, std::vector<timer::timer_t> *part_timers) {
     std::vector<perf_function_t> perf_func_v;
     for (size_t i = 0; i < cp_v.size(); i++) {
         perf_func_v.emplace_back(std::bind(&compiled_partition_executor,
@@ -252,7 +261,8 @@ int measure_perf(timer::timer_t &t,
                 std::placeholders::_3));
     }
 
-    int status = measure_perf(t, perf_func_v, inputs_v, outputs_v, res);
+    int status = measure_perf(
+            t, perf_func_v, inputs_v, outputs_v, res, part_timers);
     if (res) res->state = EXECUTED;
 
     return status;
@@ -112,11 +112,15 @@ int execute_and_wait(const std::vector<dnnl::graph::compiled_partition> &cp_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &outputs_v,
         res_t *res);
 
+// Measures the execution of all compiled partitions in order. When
+// `part_timers` is provided, it is filled with the time of each partition
+// individually. The split is supported for synchronous CPU execution only, for
+// other configurations `part_timers` is left empty.
 int measure_perf(timer::timer_t &t,
         const std::vector<dnnl::graph::compiled_partition> &cp_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &inputs_v,
         const std::vector<std::vector<dnnl::graph::tensor>> &outputs_v,
-        res_t *res);
+        res_t *res, std::vector<timer::timer_t> *part_timers = nullptr);
 
 dnnl::graph::op::kind opstr2kind(const std::string &kind);
 dnnl::graph::op::attr attrstr2kind(const std::string &attr_name);
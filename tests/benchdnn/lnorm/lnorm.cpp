@@ -51,7 +51,7 @@ int fill_mean(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_fp,
         const float val_coeff = is_integral_dt(prb->dt[0]) ? 1.f : 0.25f;
         float val = 0.f;
         // For zero channels the logic relies on memory filled with zeros.
-        if (prb->c > 0
+        if (prb->c > 0 && !prb->skip_mean()
                 && (cfg.check_alg_ != ALG_0 || (prb->flags & GLOB_STATS))) {
             int64_t mean_val_shift = n % 7;
             // Bump mean for u8 to keep src values in non-negative range
@@ -111,8 +111,10 @@ int fill_src(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_fp,
                 }
 
                 const int64_t gen = (l / 2 * 1637) & cfg.flex_mask_;
-                // s_{i} + s_{i+1} = 2 * m
-                const float sign = l % 2 == 0 ? 1.f : -1.f;
+                // s_{i} + s_{i+1} = 2 * m, except RMS normalization keeps
+                // values non-negative.
+                const float sign
+                        = l % 2 == 0 || prb->skip_mean() ? 1.f : -1.f;
                 const float f = sign * gen / (1 << cfg.flex_bits_);
 
                 val = cfg.check_alg_ == ALG_0 ? f : m * (1.f + f);
@@ -428,6 +430,12 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
         return;
     }
+
+    if (is_gpu() && prb->skip_mean()) {
+        // GPU does not support RMS normalization
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
@@ -603,7 +611,7 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
     std::vector<data_kind_t> check_kinds;
     if (prb->dir & FLAG_FWD) {
         if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
-            check_kinds.push_back(MEAN);
+            if (!prb->skip_mean()) check_kinds.push_back(MEAN);
             check_kinds.push_back(VAR);
         }
         check_kinds.push_back(DST);
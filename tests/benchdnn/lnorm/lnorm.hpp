@@ -41,6 +41,7 @@ const flags_t NONE = bnorm::NONE;
 const flags_t GLOB_STATS = bnorm::GLOB_STATS;
 const flags_t USE_SCALE = bnorm::USE_SCALE;
 const flags_t USE_SHIFT = bnorm::USE_SHIFT;
+const flags_t RMS_NORM = bnorm::RMS_NORM;
 const auto flags2str = bnorm::flags2str;
 flags_t str2flags(const char *str);
 
@@ -133,6 +134,7 @@ struct prb_t : public prb_dims_t {
     bool use_stats() const { return flags & GLOB_STATS; }
     bool use_sc() const { return flags & USE_SCALE; }
     bool use_sh() const { return flags & USE_SHIFT; }
+    bool skip_mean() const { return flags & RMS_NORM; }
 
     // Used to construct memory desc when dimensions are runtime since such mds
     // can't be used directly from query and memory objects can't be constructed.
@@ -167,6 +169,9 @@ struct cfg_t {
     // ALG_2: same as ALG_1 for mean and some more variation in src.
     // ALG_AUTO: choose between algorithms automatically.
     //
+    // RMS normalization always uses ALG_0 with non-negative source values, so
+    // the zero mean assumed by the library differs from the actual one.
+    //
     // `density_` is filled according to the following inequation:
     //     (exact_bits - log_2(L * density)) / 2 >= flex_bits
     cfg_t(const prb_t *prb)
@@ -176,13 +181,14 @@ struct cfg_t {
                   std::ceil(std::log2(static_cast<float>(L_)))))
         , free_bits_((exact_bits_ - logL_) / 2 - 1)
         , want_flex_bits_(MIN2(6, exact_bits_ / 2))
-        , check_alg_(prb->check_alg == bnorm::ALG_AUTO
-                          ? (free_bits_ >= min_flex_bits_
-                                          ? bnorm::ALG_1
-                                          : (want_flex_bits_ == exact_bits_ / 2
-                                                          ? bnorm::ALG_2
-                                                          : bnorm::ALG_0))
-                          : prb->check_alg)
+        , check_alg_(prb->skip_mean() ? bnorm::ALG_0
+                        : prb->check_alg == bnorm::ALG_AUTO
+                        ? (free_bits_ >= min_flex_bits_
+                                        ? bnorm::ALG_1
+                                        : (want_flex_bits_ == exact_bits_ / 2
+                                                        ? bnorm::ALG_2
+                                                        : bnorm::ALG_0))
+                        : prb->check_alg)
         , flex_bits_(check_alg_ == bnorm::ALG_1 ? MIN2(exact_bits_, free_bits_)
                                                 : want_flex_bits_)
         , flex_mask_((1LL << flex_bits_) - 1)
@@ -122,7 +122,9 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float ds = d_dst.get_elem(off) * gamma;
             if (!(prb->flags & GLOB_STATS)) {
                 const float x = src.get_elem(off) - smean;
-                ds -= (dd_gamma + x * dd_gamma_x * rcp_denom) / prb->c;
+                // The mean term vanishes for RMS normalization.
+                const float dd_mean = prb->skip_mean() ? 0.f : dd_gamma;
+                ds -= (dd_mean + x * dd_gamma_x * rcp_denom) / prb->c;
             }
 
             d_src.set_elem(off, rcp_denom * ds);
@@ -69,6 +69,15 @@ int verify_input(const settings_t &s) {
         }
     }
 
+    for_(const auto &i_scales : s.scales)
+    for (const auto &e : i_scales.scales) {
+        if (e.second.policy != policy_t::COMMON) {
+            BENCHDNN_PRINT(
+                    0, "%s\n", "ERROR: scales support only `common` policy.");
+            return FAIL;
+        }
+    }
+
     return OK;
 }
 
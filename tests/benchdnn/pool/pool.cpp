@@ -184,6 +184,14 @@ bool cuda_check_correctness(const prb_t *prb,
     return false;
 }
 
+// Scales are folded into the averaging divider by optimized implementations,
+// which may flip rounding of integer outputs sitting on a half boundary.
+bool scales_check_correctness(const prb_t *prb,
+        const compare::compare_t::driver_check_func_args_t &args) {
+    if (prb->attr.scales.is_def() || !is_integral_dt(args.dt)) return false;
+    return args.diff <= 1.f;
+}
+
 void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
         const args_t &ref_args) {
     // Threshold to compensate division error. CPU could live with 6.f coeff.
@@ -201,7 +209,8 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     // and `kind` by value to avoid using dangling references.
     const auto pooling_add_check =
             [&, prb](const compare::compare_t::driver_check_func_args_t &args) {
-                return cuda_check_correctness(prb, args);
+                return cuda_check_correctness(prb, args)
+                        || scales_check_correctness(prb, args);
             };
     cmp.set_driver_check_function(pooling_add_check);
 }
@@ -24,9 +24,20 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
     const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
     const dnn_mem_t &ws = args.find(DNNL_ARG_WORKSPACE);
+    const dnn_mem_t &src_scale = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const dnn_mem_t &dst_scale = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
     float *dst_ptr = (float *)dst;
 
+    const bool has_src_scale = !prb->attr.scales.get(DNNL_ARG_SRC).is_def();
+    const bool has_dst_scale = !prb->attr.scales.get(DNNL_ARG_DST).is_def();
+    assert(IMPLICATION(has_src_scale, src_scale.nelems() == 1));
+    assert(IMPLICATION(has_dst_scale, dst_scale.nelems() == 1));
+
+    const float src_scale_val = has_src_scale ? src_scale.get_elem(0) : 1.f;
+    const float dst_scale_val = has_dst_scale ? dst_scale.get_elem(0) : 1.f;
+    const float r_dst_scale_val = 1.0f / dst_scale_val;
+
     auto v_po_masks = prb->attr.post_ops.get_po_masks();
     auto ker = [&](int64_t mb, int64_t ic, int64_t od, int64_t oh, int64_t ow) {
         const int64_t ID = prb->id, IH = prb->ih, IW = prb->iw;
@@ -71,9 +82,12 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
             res = avg_value / get_num_summands(prb, od, oh, ow);
         }
 
+        res *= src_scale_val;
+
         const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, dst_off);
 
         maybe_post_ops(prb->attr, res, 0.f, v_po_vals);
+        res *= r_dst_scale_val;
         dst_ptr[dst_off] = res;
     };
 
@@ -80,8 +80,14 @@ void compute_ref(
             int64_t dst_mask_idx = dst.get_scale_idx(idx, dst_scale_mask);
             dst_scale = dst_scales.get_elem(dst_mask_idx);
         }
-        float value = (s8_scale_factor * src_scale * s + beta * d) / dst_scale
-                + dst_zero_point;
+        float acc = s8_scale_factor * src_scale * s + beta * d;
+        for (int i = 0; i < po.len(); ++i) {
+            const auto &e = po.entry[i];
+            if (!e.is_eltwise_kind()) continue;
+            acc = compute_eltwise_fwd(
+                    e.kind, acc, e.eltwise.alpha, e.eltwise.beta);
+        }
+        float value = acc / dst_scale + dst_zero_point;
         value = maybe_saturate(dst_dt, value);
         if (dst_dt == dnnl_s32 && value >= (float)INT_MAX)
             value = BENCHDNN_S32_TO_F32_SAT_CONST;
@@ -204,6 +204,18 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_sum_po(prb->attr, res, dnnl_reorder, sdt);
     skip_unimplemented_prelu_po(prb->attr, res, dnnl_reorder);
 
+    // Eltwise post-ops are supported by the x64 jit implementation only.
+    if (prb->attr.post_ops.eltwise_index() != -1) {
+#if !defined(DNNL_X64) || DNNL_X64 == 0
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+#endif
+        if (is_gpu()) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
+    }
+
     bool scales_ok = true;
 #if !defined(DNNL_X64) || DNNL_X64 == 0
     {
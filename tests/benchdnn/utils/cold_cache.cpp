@@ -14,14 +14,27 @@
 * limitations under the License.
 *******************************************************************************/
 
+#if defined(__linux__)
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
 #include "dnnl_common.hpp"
 
 #include "utils/cold_cache.hpp"
 #include "utils/fill.hpp"
+#include "utils/parallel.hpp"
 
 cold_cache_mode_t default_cold_cache_mode {cold_cache_mode_t::none};
 cold_cache_mode_t cold_cache_mode {default_cold_cache_mode};
 
+cold_cache_warm_t default_cold_cache_warm {cold_cache_warm_t::none};
+cold_cache_warm_t cold_cache_warm {default_cold_cache_warm};
+
+int default_cold_cache_numa_node = -1;
+int cold_cache_numa_node {default_cold_cache_numa_node};
+
 namespace cold_cache_utils {
 // Returns `arg` index in `dnnl_args` since they packed in random order.
 int get_arg_idx(const std::vector<dnnl_exec_arg_t> &dnnl_args, int arg) {
@@ -37,6 +50,71 @@ size_t get_arg_size(const std::vector<dnnl_exec_arg_t> &dnnl_args, int arg) {
     const auto &mem = dnnl_args[arg_idx].memory;
     return dnnl_memory_desc_get_size(query_md(mem));
 }
+
+// Returns the execution argument for cold cache modes targeting a single
+// argument, and `DNNL_ARG_UNDEF` for other modes.
+int get_single_arg(cold_cache_mode_t mode) {
+    switch (mode) {
+        case cold_cache_mode_t::wei: return DNNL_ARG_WEIGHTS;
+        case cold_cache_mode_t::src: return DNNL_ARG_SRC;
+        case cold_cache_mode_t::dst: return DNNL_ARG_DST;
+        default: return DNNL_ARG_UNDEF;
+    }
+}
+
+// Binds pages of `mem` to NUMA `node` and moves already touched pages there.
+// Only whole pages are bound, thus, the head and the tail of a buffer may stay
+// on the original node.
+int bind_to_numa_node(const dnn_mem_t &mem, int node) {
+#if defined(__linux__)
+    void *ptr = nullptr;
+    DNN_SAFE(dnnl_memory_get_data_handle(mem.m_, &ptr), WARN);
+    if (!ptr) return OK;
+
+    const uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uintptr_t begin = rnd_up((uintptr_t)ptr, page_size);
+    const uintptr_t end
+            = ((uintptr_t)ptr + mem.size()) / page_size * page_size;
+    if (begin >= end) return OK;
+
+    const size_t bits_per_mask = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> node_mask(node / bits_per_mask + 1, 0);
+    node_mask[node / bits_per_mask] |= 1UL << (node % bits_per_mask);
+    const long st = syscall(SYS_mbind, (void *)begin, end - begin, MPOL_BIND,
+            node_mask.data(), node_mask.size() * bits_per_mask + 1,
+            MPOL_MF_MOVE);
+    if (st != 0) {
+        BENCHDNN_PRINT(0,
+                "Error: cold cache memory can't be bound to NUMA node %d "
+                "(%s).\n",
+                node, strerror(errno));
+        return FAIL;
+    }
+    return OK;
+#else
+    BENCHDNN_PRINT(0, "%s\n",
+            "Error: binding cold cache memory to a NUMA node is supported on "
+            "Linux only.");
+    return FAIL;
+#endif
+}
+
+// Reads the first `size` bytes of `mem` to bring them into caches.
+void warm_up(const dnn_mem_t &mem, size_t size) {
+    void *ptr = nullptr;
+    DNN_SAFE_V(dnnl_memory_get_data_handle(mem.m_, &ptr));
+    if (!ptr) return;
+
+    const size_t warm_size = MIN2(size, mem.size());
+    const size_t chunk_size = 4096;
+    const size_t cache_line_size = 64;
+    const volatile uint8_t *data = static_cast<const uint8_t *>(ptr);
+    benchdnn_parallel_nd(div_up(warm_size, chunk_size), [&](int64_t c) {
+        const size_t end = MIN2(warm_size, (c + 1) * chunk_size);
+        for (size_t i = c * chunk_size; i < end; i += cache_line_size)
+            (void)data[i];
+    });
+}
 } // namespace cold_cache_utils
 
 cold_cache_t::cold_cache_t()
@@ -79,12 +157,13 @@ cold_cache_t::cold_cache_t(const std::vector<dnnl_exec_arg_t> &dnnl_args)
     size_t cold_args_size = 0;
 
     std::vector<int> cc_args; // future keys for cold_cache object.
-    if (cold_cache_mode == cold_cache_mode_t::wei) {
-        cc_args = {DNNL_ARG_WEIGHTS};
-        const auto wei_size
-                = cold_cache_utils::get_arg_size(dnnl_args, DNNL_ARG_WEIGHTS);
-        hot_args_size -= wei_size;
-        cold_args_size += wei_size;
+    const int single_arg = cold_cache_utils::get_single_arg(cold_cache_mode);
+    if (single_arg != DNNL_ARG_UNDEF) {
+        cc_args = {single_arg};
+        const auto arg_size
+                = cold_cache_utils::get_arg_size(dnnl_args, single_arg);
+        hot_args_size -= arg_size;
+        cold_args_size += arg_size;
     } else if (cold_cache_mode == cold_cache_mode_t::all) {
         cc_args.resize(dnnl_args.size());
         for (size_t i = 0; i < dnnl_args.size(); i++) {
@@ -174,9 +253,25 @@ cold_cache_t::cold_cache_t(const std::vector<dnnl_exec_arg_t> &dnnl_args)
             }
 #endif
             if (cc_entry[i].is_mapped()) cc_entry[i].unmap();
+
+            if (cold_cache_numa_node >= 0 && !is_gpu()) {
+                SAFE_V(cold_cache_utils::bind_to_numa_node(
+                        cc_entry[i], cold_cache_numa_node));
+            }
         }
     }
 
+    if (cold_cache_warm != cold_cache_warm_t::none && !is_gpu()
+            && !cache_.empty()) {
+        const size_t warm_capacity = cold_cache_warm == cold_cache_warm_t::l2
+                ? cpu_cache_args.L2_size * cpu_cache_args.num_cores
+                : cpu_cache_capacity;
+        // The capacity is divided evenly across cold arguments.
+        warm_size_ = warm_capacity / cache_.size();
+        BENCHDNN_PRINT(3, "[COLD_CACHE] Pre-warm size per arg: %.3g MB.\n",
+                MB(warm_size_));
+    }
+
     // Refer to `gpu_n_buffers_top_limit_` comment.
     // Exact cache size for src is needed to secure from potential non-temporal
     // dst stores.
@@ -231,6 +326,7 @@ cold_cache_t &cold_cache_t::operator=(cold_cache_t &&rhs) {
     n_buffers_ = rhs.n_buffers_;
     override_n_buffers_ = rhs.override_n_buffers_;
     cache_ = std::move(rhs.cache_);
+    warm_size_ = rhs.warm_size_;
 
     return *this;
 }
@@ -248,6 +344,8 @@ bool cold_cache_t::update_dnnl_args(std::vector<dnnl_exec_arg_t> &dnnl_args) {
         // Assumption that cache entries of the same size.
         if (cc_counter_ >= e.size()) cc_counter_ = 0;
         dnnl_args[dnnl_args_idx].memory = e[cc_counter_].m_;
+        // Emulates data partially left in caches by a previous layer.
+        if (warm_size_) cold_cache_utils::warm_up(e[cc_counter_], warm_size_);
     }
     // Update counter outside of the loop to make **all** arguments use same
     // order element from the cache.
@@ -262,21 +360,25 @@ bool cold_cache_t::should_stop() const {
 
 bool cold_cache_t::use_cold_cache(
         const std::vector<dnnl_exec_arg_t> &dnnl_args) {
-    const bool cc_wei = cold_cache_mode == cold_cache_mode_t::wei;
+    const int single_arg = cold_cache_utils::get_single_arg(cold_cache_mode);
+    const bool cc_single = single_arg != DNNL_ARG_UNDEF;
     const bool cc_all = cold_cache_mode == cold_cache_mode_t::all;
     const bool cc_custom = cold_cache_mode == cold_cache_mode_t::custom;
-    const bool has_weights
-            = cold_cache_utils::get_arg_idx(dnnl_args, DNNL_ARG_WEIGHTS) >= 0;
+    const bool has_single_arg
+            = cold_cache_utils::get_arg_idx(dnnl_args, single_arg) >= 0;
     static int warning_printed = 0;
-    if (cc_wei && !has_weights && !warning_printed) {
-        BENCHDNN_PRINT(0, "%s\n",
-                "Warning: cold cache for weights was requested but weights "
-                "were not identified in execution arguments. Cold cache will "
-                "not be enabled.");
+    if (cc_single && !has_single_arg && !warning_printed) {
+        std::stringstream ss;
+        ss << cold_cache_mode;
+        BENCHDNN_PRINT(0,
+                "Warning: cold cache for \'%s\' was requested but the "
+                "argument was not identified in execution arguments. Cold "
+                "cache will not be enabled.\n",
+                ss.str().c_str());
         warning_printed = 1;
     }
 
-    return (cc_wei && has_weights) || cc_all || cc_custom;
+    return (cc_single && has_single_arg) || cc_all || cc_custom;
 }
 
 std::ostream &operator<<(std::ostream &s, cold_cache_mode_t cold_cache_mode) {
@@ -288,8 +390,25 @@ std::ostream &operator<<(std::ostream &s, cold_cache_mode_t cold_cache_mode) {
         s << "all";
     else if (cold_cache_mode == cold_cache_mode_t::custom)
         s << "custom";
+    else if (cold_cache_mode == cold_cache_mode_t::src)
+        s << "src";
+    else if (cold_cache_mode == cold_cache_mode_t::dst)
+        s << "dst";
     else {
         assert(!"unsupported cold cache mode");
     }
     return s;
 }
+
+std::ostream &operator<<(std::ostream &s, cold_cache_warm_t cold_cache_warm) {
+    if (cold_cache_warm == cold_cache_warm_t::none)
+        s << "none";
+    else if (cold_cache_warm == cold_cache_warm_t::l2)
+        s << "l2";
+    else if (cold_cache_warm == cold_cache_warm_t::l3)
+        s << "l3";
+    else {
+        assert(!"unsupported cold cache pre-warm level");
+    }
+    return s;
+}
@@ -35,6 +35,10 @@ enum class cold_cache_mode_t : unsigned {
     // Cold cache is enabled for custom execution arguments, which must be
     // specified directly in code.
     custom = 0x4,
+    // Cold cache is enabled for source execution argument.
+    src = 0x8,
+    // Cold cache is enabled for destination execution argument.
+    dst = 0x10,
 };
 
 extern cold_cache_mode_t default_cold_cache_mode; // default cold cache mode
@@ -42,6 +46,26 @@ extern cold_cache_mode_t cold_cache_mode; // user cold cache mode
 
 std::ostream &operator<<(std::ostream &s, cold_cache_mode_t cold_cache_mode);
 
+// Cache level cold arguments are pre-warmed to before each run.
+enum class cold_cache_warm_t : unsigned {
+    // Cold arguments are not pre-warmed.
+    none = 0x0,
+    // The leading part of cold arguments fitting L2 caches is pre-warmed.
+    l2 = 0x1,
+    // The leading part of cold arguments fitting L2 and L3 caches is
+    // pre-warmed.
+    l3 = 0x2,
+};
+
+extern cold_cache_warm_t default_cold_cache_warm; // default pre-warm level
+extern cold_cache_warm_t cold_cache_warm; // user pre-warm level
+
+std::ostream &operator<<(std::ostream &s, cold_cache_warm_t cold_cache_warm);
+
+extern int default_cold_cache_numa_node; // -1, no binding
+// NUMA node to place cold arguments on. CPU and Linux only.
+extern int cold_cache_numa_node;
+
 struct cold_cache_t {
     // Default constructor to have an ability create cold_cache in std::vector.
     // Such cold_cache is always disabled.
@@ -94,6 +118,9 @@ private:
 
     size_t cc_counter_ = 0;
 
+    // Number of bytes of each cold argument to pre-warm before a run.
+    size_t warm_size_ = 0;
+
     // Returns `true`, if "cold cache" was requested and eligible.
     bool use_cold_cache(const std::vector<dnnl_exec_arg_t> &dnnl_args);
 
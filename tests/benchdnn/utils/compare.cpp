@@ -346,6 +346,19 @@ int compare_t::compare_p2p(const dnn_mem_t &exp_mem, const dnn_mem_t &got_mem,
                     && args.rel_diff <= std::max(epsilon_dt(dt), 5e-6f);
             if (ok) break;
 
+            // fpmath modes allowing down-conversion to bf16 or f16 let CPU
+            // implementations use fast approximations of transcendental
+            // eltwise post-ops. Their relative error is bounded by 5e-4, see
+            // the fpmath mode developer guide.
+            const auto fpmath_mode = attr.fpmath_mode.mode;
+            const bool is_fpmath_relaxed = fpmath_mode == dnnl_fpmath_mode_bf16
+                    || fpmath_mode == dnnl_fpmath_mode_f16
+                    || fpmath_mode == dnnl_fpmath_mode_any;
+            ok = is_cpu() && has_eltwise && is_fpmath_relaxed
+                    && (fabsf(args.exp) > 1e-5f ? args.rel_diff : args.diff)
+                            <= 5e-4f;
+            if (ok) break;
+
             // Attr dst scale is used as a divisor to quantize data to dt.
             // Implementation might decide to pre-compute inverse value and
             // multiply on it in kernel. This difference might result in a
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <chrono>
+
 #include "tests/test_thread.hpp"
 
 #include "utils/parallel.hpp"
@@ -70,3 +72,23 @@ void benchdnn_parallel_nd(int64_t D0, int64_t D1, int64_t D2, int64_t D3,
 int benchdnn_get_max_threads() {
     return dnnl_get_max_threads();
 }
+
+double benchdnn_get_fork_join_time_ms() {
+    static const double fork_join_time_ms = [] {
+        ACTIVATE_THREADPOOL;
+        const auto empty_region = [](int, int) {};
+        // Warm up the thread team first.
+        constexpr int n_warmup = 10;
+        for (int i = 0; i < n_warmup; i++)
+            dnnl::impl::parallel(0, empty_region);
+
+        constexpr int n_calls = 1000;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n_calls; i++)
+            dnnl::impl::parallel(0, empty_region);
+        const std::chrono::duration<double, std::milli> elapsed
+                = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / n_calls;
+    }();
+    return fork_join_time_ms;
+}
@@ -49,4 +49,9 @@ void benchdnn_parallel_nd(int64_t D0, int64_t D1, int64_t D2, int64_t D3,
 
 int benchdnn_get_max_threads();
 
+// Returns the average time in milliseconds of an empty parallel region using
+// all threads, i.e. the fork/join overhead paid by every parallel call of a
+// primitive. The value is measured once per process.
+double benchdnn_get_fork_join_time_ms();
+
 #endif
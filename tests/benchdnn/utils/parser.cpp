@@ -19,6 +19,7 @@
 
 #include "utils/cold_cache.hpp"
 #include "utils/parser.hpp"
+#include "utils/perf_counters.hpp"
 #include "utils/stream_kind.hpp"
 
 #include "dnnl_common.hpp"
@@ -475,7 +476,8 @@ bool parse_attr_scratchpad_mode(
         const char *str, const std::string &option_name = "attr-scratchpad") {
     static const std::string help
             = "MODE    (Default: `library`)\n    Specifies scratchpad "
-              "attribute. `MODE` values can be `library` or `user`.\n    More "
+              "attribute. `MODE` values can be `library`, `user` or "
+              "`shared`.\n    More "
               "details at "
             + doc_url + "knobs_attr.md\n";
     return parse_vector_option(scratchpad_mode, def_scratchpad_mode,
@@ -751,6 +753,20 @@ static bool parse_attr_same_pd_check(const char *str,
             attr_same_pd_check, false, str2bool, str, option_name, help);
 }
 
+static bool parse_cache_blob_store(
+        const char *str, const std::string &option_name = "cache-blob-store") {
+    static const std::string help
+            = "FILE    (Default: not specified)\n    Instructs the driver to "
+              "collect cache blobs of all created primitives and to dump them "
+              "into `FILE` at exit.\n    The file can be passed to "
+              "`dnnl_set_primitive_cache_blob_store` to create the same "
+              "primitives from cache blobs.\n    When empty, option has no "
+              "effect.\n";
+    const auto chars2chars = [](const char *str) { return str; };
+    return parse_single_value_option(cache_blob_store, std::string(),
+            chars2chars, str, option_name, help);
+}
+
 static bool parse_canonical(
         const char *str, const std::string &option_name = "canonical") {
     static const std::string help
@@ -769,8 +785,10 @@ static bool parse_cold_cache(
               "cold cache for performance mode.\n    When set to `none` (the "
               "default), cold cache is disabled.\n    When set to `wei`, cold "
               "cache is enabled for weights argument only. Targets forward "
-              "propagation kind.\n    When set to `all`, cold cache is enabled "
-              "for each execution argument.\n    When set to `custom`, cold "
+              "propagation kind.\n    When set to `src` or `dst`, cold cache "
+              "is enabled for source or destination argument only.\n    When "
+              "set to `all`, cold cache is enabled for each execution "
+              "argument.\n    When set to `custom`, cold "
               "cache is enabled for custom arguments which should be specified "
               "directly in the code. Refer to doc for more details.\n";
 
@@ -780,6 +798,10 @@ static bool parse_cold_cache(
             cc_mode = cold_cache_mode_t::none;
         } else if (_str == "wei") {
             cc_mode = cold_cache_mode_t::wei;
+        } else if (_str == "src") {
+            cc_mode = cold_cache_mode_t::src;
+        } else if (_str == "dst") {
+            cc_mode = cold_cache_mode_t::dst;
         } else if (_str == "all") {
             cc_mode = cold_cache_mode_t::all;
         } else if (_str == "custom") {
@@ -796,12 +818,61 @@ static bool parse_cold_cache(
             str2cold_cache_mode, str, option_name, help);
 }
 
+static bool parse_cold_cache_numa(
+        const char *str, const std::string &option_name = "cold-cache-numa") {
+    static const std::string help
+            = "NODE    (Default: `-1`)\n    Instructs the driver to place "
+              "cold cache memory on NUMA node `NODE`.\n    When set to `-1` "
+              "(the default), memory is placed by the system policy.\n    "
+              "Applicable to CPU on Linux only.\n";
+    bool parsed = parse_single_value_option(cold_cache_numa_node,
+            default_cold_cache_numa_node, parser_utils::stoll_safe, str,
+            option_name, help);
+    if (parsed && cold_cache_numa_node < -1) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: NUMA node must be non-negative or `-1`.");
+        SAFE_V(FAIL);
+    }
+    return parsed;
+}
+
+static bool parse_cold_cache_warm(
+        const char *str, const std::string &option_name = "cold-cache-warm") {
+    static const std::string help
+            = "LEVEL    (Default: `none`)\n    Instructs the driver to "
+              "pre-warm cold cache memory before each run.\n    When set to "
+              "`none` (the default), memory is not pre-warmed.\n    When set "
+              "to `l2` or `l3`, the leading part of cold arguments fitting "
+              "caches up to the level `LEVEL` is read.\n    Applicable to "
+              "CPU only.\n";
+
+    const auto str2cold_cache_warm = [](const std::string &_str) {
+        cold_cache_warm_t cc_warm = default_cold_cache_warm;
+        if (_str == "none") {
+            cc_warm = cold_cache_warm_t::none;
+        } else if (_str == "l2") {
+            cc_warm = cold_cache_warm_t::l2;
+        } else if (_str == "l3") {
+            cc_warm = cold_cache_warm_t::l3;
+        } else {
+            BENCHDNN_PRINT(0, "%s \'%s\'\n%s",
+                    "Error: unknown cold cache pre-warm level", _str.c_str(),
+                    help.c_str());
+            SAFE_V(FAIL);
+        }
+        return cc_warm;
+    };
+
+    return parse_single_value_option(cold_cache_warm, default_cold_cache_warm,
+            str2cold_cache_warm, str, option_name, help);
+}
+
 static bool parse_cpu_isa_hints(
         const char *str, const std::string &option_name = "cpu-isa-hints") {
     static const std::string help
             = "HINTS    (Default: `none`)\n    Specifies the ISA specific "
               "hints for CPU engine.\n    `HINTS` values can be `none`, "
-              "`no_hints` or `prefer_ymm`.\n";
+              "`no_hints`, `prefer_ymm` or `prefer_ymm_auto`.\n";
     const bool parsed
             = parse_single_value_option(hints, isa_hints_t {isa_hints_t::none},
                     isa_hints_t::str2hints, str, option_name, help);
@@ -971,6 +1042,102 @@ static bool parse_max_ms_per_prb(
     return parsed;
 }
 
+static bool parse_instances(
+        const char *str, const std::string &option_name = "instances") {
+    static const std::string help
+            = "N    (Default: `1`)\n    Specifies the number `N` of "
+              "concurrent instances of a problem for CPU performance "
+              "benchmarking.\n    Each instance runs on its own subset of "
+              "`--threads-per-instance` threads.\n";
+    bool parsed = parse_single_value_option(instances, default_instances,
+            parser_utils::stoll_safe, str, option_name, help);
+    if (parsed && instances <= 0) {
+        BENCHDNN_PRINT(
+                0, "%s\n", "Error: number of instances must be positive.");
+        SAFE_V(FAIL);
+    }
+    return parsed;
+}
+
+static bool parse_threads_per_instance(const char *str,
+        const std::string &option_name = "threads-per-instance") {
+    static const std::string help
+            = "N    (Default: `0`)\n    Specifies the number `N` of threads "
+              "used by each instance set by `--instances`.\n    When `0`, "
+              "threads are split evenly between instances.\n";
+    bool parsed = parse_single_value_option(threads_per_instance,
+            default_threads_per_instance, parser_utils::stoll_safe, str,
+            option_name, help);
+    if (parsed && threads_per_instance < 0) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: number of threads per instance can't be negative.");
+        SAFE_V(FAIL);
+    }
+    return parsed;
+}
+
+static bool parse_perf_counters(
+        const char *str, const std::string &option_name = "perf-counters") {
+    static const std::string help
+            = "NAME[,NAME...]    (Default: not specified)\n    Specifies "
+              "hardware counters to collect during performance "
+              "benchmarking on CPU.\n    `NAME` values can be `cycles`, "
+              "`instructions`, `branch-misses`, `l1d-misses`, `llc-misses`, "
+              "`dtlb-misses` or a raw event in `rHEX` form.\n    Values are "
+              "reported per run through `%counters%` perf report option.\n";
+
+    const auto str2name = [](const std::string &_str) {
+        if (!perf_counters_utils::is_valid_name(_str)) {
+            BENCHDNN_PRINT(0, "%s \'%s\'\n%s",
+                    "Error: unsupported perf counter", _str.c_str(),
+                    help.c_str());
+            SAFE_V(FAIL);
+        }
+        return _str;
+    };
+
+    return parse_vector_option(perf_counters, default_perf_counters,
+            str2name, str, option_name, help);
+}
+
+static bool parse_peak_gflops(
+        const char *str, const std::string &option_name = "peak-gflops") {
+    static const std::string help
+            = "GFLOPS    (Default: `0`)\n    Specifies the peak compute "
+              "throughput `GFLOPS` used by efficiency perf report options.\n "
+              "   When `0`, it is estimated for CPU from the ISA and the "
+              "measured frequency.\n";
+    bool parsed = parse_single_value_option(peak_gflops, default_peak_gflops,
+            parser_utils::stof_safe, str, option_name, help);
+    if (parsed) peak_gflops = MAX2(0, peak_gflops);
+    return parsed;
+}
+
+static bool parse_peak_gbps(
+        const char *str, const std::string &option_name = "peak-gbps") {
+    static const std::string help
+            = "GBPS    (Default: `0`)\n    Specifies the peak memory bandwidth "
+              "`GBPS` in gigabytes per second used by efficiency perf report "
+              "options.\n";
+    bool parsed = parse_single_value_option(peak_gbps, default_peak_gbps,
+            parser_utils::stof_safe, str, option_name, help);
+    if (parsed) peak_gbps = MAX2(0, peak_gbps);
+    return parsed;
+}
+
+static bool parse_perf_cliff(
+        const char *str, const std::string &option_name = "perf-cliff") {
+    static const std::string help
+            = "PCT    (Default: `0`)\n    Instructs the driver to report a "
+              "performance cliff when the performance of a problem drops more "
+              "than `PCT` percents compared to the previous problem.\n    "
+              "When `0` (the default), cliffs are not reported.\n";
+    bool parsed = parse_single_value_option(perf_cliff, default_perf_cliff,
+            parser_utils::stof_safe, str, option_name, help);
+    if (parsed) perf_cliff = MIN2(MAX2(0, perf_cliff), 100);
+    return parsed;
+}
+
 static bool parse_num_streams(
         const char *str, const std::string &option_name = "num-streams") {
     static const std::string help
@@ -1235,11 +1402,17 @@ bool parse_bench_settings(const char *str) {
     }
 
     bool parsed = parse_allow_enum_tags_only(str)
-            || parse_attr_same_pd_check(str) || parse_canonical(str)
-            || parse_cold_cache(str) || parse_cpu_isa_hints(str)
-            || parse_engine(str) || parse_fast_ref(str)
-            || parse_fast_ref_gpu(str) || parse_fix_times_per_prb(str)
+            || parse_attr_same_pd_check(str) || parse_cache_blob_store(str)
+            || parse_canonical(str) || parse_cold_cache(str)
+            || parse_cold_cache_numa(str) || parse_cold_cache_warm(str)
+            || parse_cpu_isa_hints(str) || parse_engine(str)
+            || parse_fast_ref(str) || parse_fast_ref_gpu(str)
+            || parse_fix_times_per_prb(str)
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
+            || parse_peak_gflops(str) || parse_peak_gbps(str)
+            || parse_perf_cliff(str)
+            || parse_perf_counters(str) || parse_instances(str)
+            || parse_threads_per_instance(str)
             || parse_repeats_per_prb(str) || parse_mem_check(str)
             || parse_memory_kind(str) || parse_mode(str)
             || parse_mode_modifier(str) || parse_skip_impl(str)
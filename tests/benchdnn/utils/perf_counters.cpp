@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "dnnl_common.hpp"
+
+#include "utils/perf_counters.hpp"
+
+std::vector<std::string> default_perf_counters;
+std::vector<std::string> perf_counters {default_perf_counters};
+
+namespace perf_counters_utils {
+
+#if defined(__linux__)
+struct event_t {
+    uint32_t type;
+    uint64_t config;
+};
+
+static uint64_t hw_cache_config(uint64_t cache, uint64_t op, uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+static bool str2event(const std::string &name, event_t &event) {
+    if (name == "cycles") {
+        event = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+    } else if (name == "instructions") {
+        event = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+    } else if (name == "branch-misses") {
+        event = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+    } else if (name == "l1d-misses") {
+        event = {PERF_TYPE_HW_CACHE,
+                hw_cache_config(PERF_COUNT_HW_CACHE_L1D,
+                        PERF_COUNT_HW_CACHE_OP_READ,
+                        PERF_COUNT_HW_CACHE_RESULT_MISS)};
+    } else if (name == "llc-misses") {
+        event = {PERF_TYPE_HW_CACHE,
+                hw_cache_config(PERF_COUNT_HW_CACHE_LL,
+                        PERF_COUNT_HW_CACHE_OP_READ,
+                        PERF_COUNT_HW_CACHE_RESULT_MISS)};
+    } else if (name == "dtlb-misses") {
+        event = {PERF_TYPE_HW_CACHE,
+                hw_cache_config(PERF_COUNT_HW_CACHE_DTLB,
+                        PERF_COUNT_HW_CACHE_OP_READ,
+                        PERF_COUNT_HW_CACHE_RESULT_MISS)};
+    } else if (name.size() > 1 && name[0] == 'r') {
+        // Raw model specific event, e.g. `r01a3`, in the same encoding as
+        // `perf stat -e rNNN` accepts.
+        char *end = nullptr;
+        const uint64_t config = strtoull(name.c_str() + 1, &end, 16);
+        if (*end != '\0') return false;
+        event = {PERF_TYPE_RAW, config};
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static int open_event(const event_t &event, pid_t tid) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = event.type;
+    attr.size = sizeof(attr);
+    attr.config = event.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format
+            = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0);
+}
+
+static std::vector<pid_t> get_process_threads() {
+    std::vector<pid_t> tids;
+    DIR *dir = opendir("/proc/self/task");
+    if (!dir) return tids;
+    while (struct dirent *entry = readdir(dir)) {
+        if (entry->d_name[0] == '.') continue;
+        tids.push_back((pid_t)atoi(entry->d_name));
+    }
+    closedir(dir);
+    return tids;
+}
+#endif
+
+bool is_valid_name(const std::string &name) {
+#if defined(__linux__)
+    event_t event;
+    return str2event(name, event);
+#else
+    return false;
+#endif
+}
+
+} // namespace perf_counters_utils
+
+perf_counters_t::~perf_counters_t() {
+    close_all();
+}
+
+void perf_counters_t::close_all() {
+#if defined(__linux__)
+    for_(auto &thread_fds : fds_)
+    for (int fd : thread_fds) {
+        if (fd >= 0) close(fd);
+    }
+#endif
+    fds_.clear();
+}
+
+void perf_counters_t::start() {
+    close_all();
+    values_.assign(perf_counters.size(), 0);
+    if (!is_enabled()) return;
+
+#if defined(__linux__)
+    using namespace perf_counters_utils;
+
+    const auto tids = get_process_threads();
+    fds_.resize(perf_counters.size());
+    for (size_t i = 0; i < perf_counters.size(); i++) {
+        event_t event;
+        if (!str2event(perf_counters[i], event)) continue;
+        for (pid_t tid : tids) {
+            const int fd = open_event(event, tid);
+            if (fd < 0) {
+                static bool warned = false;
+                if (!warned) {
+                    const bool no_access = errno == EACCES || errno == EPERM;
+                    BENCHDNN_PRINT(0,
+                            "WARNING: perf counter \'%s\' could not be opened "
+                            "(%s).%s\n",
+                            perf_counters[i].c_str(), strerror(errno),
+                            no_access ? " Check /proc/sys/kernel/"
+                                        "perf_event_paranoid."
+                                      : "");
+                    warned = true;
+                }
+                continue;
+            }
+            fds_[i].push_back(fd);
+        }
+    }
+
+    for_(auto &thread_fds : fds_)
+    for (int fd : thread_fds) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+void perf_counters_t::stop() {
+#if defined(__linux__)
+    for_(auto &thread_fds : fds_)
+    for (int fd : thread_fds) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    for (size_t i = 0; i < fds_.size(); i++) {
+        double value = 0;
+        for (int fd : fds_[i]) {
+            // Layout is defined by `read_format`: value, time enabled, time
+            // running.
+            uint64_t data[3] = {0, 0, 0};
+            if (read(fd, data, sizeof(data)) != (ssize_t)sizeof(data))
+                continue;
+            if (!data[2]) continue;
+            value += (double)data[0] * data[1] / data[2];
+        }
+        values_[i] = (uint64_t)value;
+    }
+#endif
+    close_all();
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_PERF_COUNTERS_HPP
+#define UTILS_PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+extern std::vector<std::string> default_perf_counters; // empty
+// Names of hardware counters requested by `--perf-counters` option. Empty when
+// the option is not specified.
+extern std::vector<std::string> perf_counters;
+
+namespace perf_counters_utils {
+
+// Returns `true` if `name` is a supported counter name: one of the generic
+// names or a raw event in `rHEX` form.
+bool is_valid_name(const std::string &name);
+
+} // namespace perf_counters_utils
+
+// Collects hardware counters requested by `--perf-counters` option for all
+// threads of the process via perf_event_open. Counters are opened for threads
+// alive at `start()`, so the thread team must be created before the call.
+// Counter values are scaled in case the kernel multiplexed them.
+struct perf_counters_t {
+    perf_counters_t() = default;
+    ~perf_counters_t();
+
+    bool is_enabled() const { return !perf_counters.empty(); }
+
+    void start();
+    void stop();
+
+    // Returns values collected between `start()` and `stop()` in the order of
+    // requested counters. Values of counters which couldn't be opened are `0`.
+    const std::vector<uint64_t> &values() const { return values_; }
+
+private:
+    // File descriptors of counters, `fds_[counter][thread]`.
+    std::vector<std::vector<int>> fds_;
+    std::vector<uint64_t> values_;
+
+    void close_all();
+
+    perf_counters_t(const perf_counters_t &) = delete;
+    perf_counters_t &operator=(const perf_counters_t &) = delete;
+};
+
+#endif
@@ -17,8 +17,22 @@
 #include "dnn_types.hpp"
 #include "dnnl_common.hpp"
 
+#include "utils/parallel.hpp"
 #include "utils/perf_report.hpp"
 
+// Returns the number of single precision floating-point operations a CPU core
+// can retire per cycle for the effective ISA. Two FMA units are assumed for
+// AVX2 and AVX-512 cores.
+static double cpu_f32_flops_per_cycle() {
+    const dnnl_cpu_isa_t isa = dnnl_get_effective_cpu_isa();
+    const auto has = [&](dnnl_cpu_isa_t i) { return (isa & i) == i; };
+    if (has(dnnl_cpu_isa_avx512_core)) return 64;
+    if (has(dnnl_cpu_isa_avx2)) return 32;
+    if (has(dnnl_cpu_isa_avx)) return 16;
+    if (has(dnnl_cpu_isa_sse41)) return 8;
+    return 0;
+}
+
 void base_perf_report_t::report(res_t *res, const char *prb_str) const {
     dump_perf_footer();
 
@@ -36,8 +50,49 @@ void base_perf_report_t::report(res_t *res, const char *prb_str) const {
 
     std::string str = ss.str();
     BENCHDNN_PRINT(0, "%s\n", str.c_str());
+
+    detect_perf_cliff(res, prb_str);
 };
 
+void base_perf_report_t::detect_perf_cliff(
+        res_t *res, const char *prb_str) const {
+    if (perf_cliff <= 0) return;
+
+    struct perf_point_t {
+        std::string prb_str;
+        std::string impl_name;
+        double perf;
+    };
+    // Neighbours are problems reported one after another, which is the order
+    // of problem descriptors in a batch.
+    static perf_point_t prev {"", "", 0};
+
+    const double ms = res->timer_map.perf_timer().ms(timer::timer_t::min);
+    // Problems which were not executed don't break the sequence.
+    if (!ms) return;
+
+    // Giga operations per second for ops based drivers, gigabytes per second
+    // for the rest.
+    const bool use_ops = ops() > 0;
+    const double amount
+            = use_ops ? ops() : static_cast<double>(res->ibytes + res->obytes);
+    const double perf = amount / ms / 1e6;
+    const char *unit = use_ops ? "Gflops" : "GB/s";
+
+    if (prev.perf > 0) {
+        const double drop = 100. * (1. - perf / prev.perf);
+        if (drop > perf_cliff) {
+            BENCHDNN_PRINT(0,
+                    "[PERF_CLIFF] %.1f%% drop: %s (impl: %s, %g %s) -> %s "
+                    "(impl: %s, %g %s)\n",
+                    drop, prev.prb_str.c_str(), prev.impl_name.c_str(),
+                    prev.perf, unit, prb_str, res->impl_name.c_str(), perf,
+                    unit);
+        }
+    }
+    prev = {prb_str, res->impl_name, perf};
+}
+
 void base_perf_report_t::dump_engine(std::ostream &s) const {
     s << engine_tgt_kind;
 }
@@ -81,6 +136,34 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ticks(mode) / t.sec(mode) / unit;
     };
 
+    auto get_peak_flops = [&](const timer::timer_t &t) -> double {
+        if (peak_gflops > 0) return peak_gflops * 1e9 / unit;
+        if (!is_cpu()) return 0;
+        return benchdnn_get_max_threads() * cpu_f32_flops_per_cycle()
+                * get_freq(t);
+    };
+
+    auto get_peak_bw = [&]() -> double { return peak_gbps * 1e9 / unit; };
+
+    // Efficiency is reported in percents of the peak value.
+    auto get_flops_eff = [&](const timer::timer_t &t) -> double {
+        const double peak = get_peak_flops(t);
+        if (!peak) return 0;
+        return 100. * get_flops(t) / peak;
+    };
+
+    auto get_bw_eff = [&](const timer::timer_t &t) -> double {
+        const double peak = get_peak_bw();
+        if (!peak) return 0;
+        return 100. * get_bw(t) / peak;
+    };
+
+    auto get_ai = [&]() -> double {
+        const double iobytes = res->ibytes + res->obytes;
+        if (!iobytes) return 0;
+        return ops() / iobytes;
+    };
+
     auto get_create_time = [&](const timer::timer_t &t) -> double {
         // If user didn't ask for mode, choose the maximum one to return time
         // for no-cache-hit creation.
@@ -129,10 +212,19 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("ctx-init", s << *ctx_init());
     HANDLE("ctx-exe", s << *ctx_exe());
     // Options operating on driver independent objects, e.g. timer values.
+    HANDLE("ai", s << get_ai());
     HANDLE("bw", s << get_bw(res->timer_map.perf_timer()));
+    HANDLE("bw_eff", s << get_bw_eff(res->timer_map.perf_timer()));
     HANDLE("driver", s << driver_name);
     HANDLE("flops", s << get_flops(res->timer_map.perf_timer()));
+    HANDLE("flops_eff", s << get_flops_eff(res->timer_map.perf_timer()));
+    HANDLE("counters", {
+        for (size_t i = 0; i < res->perf_counters.size(); i++)
+            s << (i ? "," : "") << res->perf_counters[i] / unit;
+    });
     HANDLE("clocks", s << res->timer_map.perf_timer().ticks(mode) / unit);
+    HANDLE("peak_bw", s << get_peak_bw());
+    HANDLE("peak_flops", s << get_peak_flops(res->timer_map.perf_timer()));
     HANDLE("prb", s << prb_str);
     HANDLE("freq", s << get_freq(res->timer_map.perf_timer()));
     HANDLE("ops", s << ops() / unit);
@@ -141,12 +233,33 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("obytes", s << res->obytes / unit);
     HANDLE("iobytes", s << (res->ibytes + res->obytes) / unit);
     HANDLE("idx", s << benchdnn_stat.tests);
+    HANDLE("tput", s << res->throughput / unit);
+    HANDLE("p50", s << res->timer_map.perf_timer().percentile_ms(50) / unit);
+    HANDLE("p90", s << res->timer_map.perf_timer().percentile_ms(90) / unit);
+    HANDLE("p99", s << res->timer_map.perf_timer().percentile_ms(99) / unit);
+    HANDLE("stddev", s << res->timer_map.perf_timer().stddev_ms() / unit);
+    HANDLE("samples", s << res->timer_map.perf_timer().n_samples());
+    HANDLE("hist", {
+        const auto hist = res->timer_map.perf_timer().histogram(10);
+        for (size_t i = 0; i < hist.size(); i++)
+            s << (i ? ";" : "") << hist[i];
+    });
     HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("ftime", s << res->first_exec_ms / unit);
+    HANDLE("fpf", s << res->first_exec_page_faults);
+    HANDLE("tcfgtime",
+            s << res->timer_map.get_timer(timer::names::tile_cfg_timer).ms(mode)
+                            / unit);
     HANDLE("ctime",
             s << get_create_time(res->timer_map.cp_timer())
                             + get_create_time(res->timer_map.cpd_timer()));
     HANDLE("cptime", s << get_create_time(res->timer_map.cp_timer()));
     HANDLE("cpdtime", s << get_create_time(res->timer_map.cpd_timer()));
+    HANDLE("cpbtime",
+            s << get_create_time(res->timer_map.get_timer(
+                    timer::names::cp_blob_timer)));
+    HANDLE("jitsize", s << res->jit_code_size / unit);
+    HANDLE("fjtime", s << benchdnn_get_fork_join_time_ms() / unit);
 
 #undef HANDLE
 
@@ -75,6 +75,10 @@ private:
     void handle_option(std::ostream &s, const char *&option, res_t *res,
             const char *prb_str) const;
 
+    // Compares performance of the problem with the previous reported one and
+    // prints both if the drop exceeds `--perf-cliff` threshold.
+    void detect_perf_cliff(res_t *res, const char *prb_str) const;
+
     void dump_perf_footer() const {
         static bool footer_printed = false;
         if (!footer_printed) {
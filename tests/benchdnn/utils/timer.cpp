@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "common.hpp"
 #include "utils/timer.hpp"
@@ -51,6 +52,7 @@ void timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    samples_ms_.clear();
 
     start();
 }
@@ -85,6 +87,7 @@ void timer_t::stop(int add_times, int64_t add_ticks, double add_ms) {
     ticks_[mode_t::max]
             = times_ ? std::max(ticks_[mode_t::max], d_ticks) : d_ticks;
 
+    samples_ms_.push_back(d_ms);
     times_ += add_times;
 }
 
@@ -92,6 +95,70 @@ void timer_t::stamp(int add_times) {
     stop(add_times, ticks_now() - ticks_start_, ms_now() - ms_start_);
 }
 
+void timer_t::merge(const timer_t &other) {
+    if (other.times_ == 0) return;
+
+    ms_[mode_t::avg] += other.ms_[mode_t::avg];
+    ms_[mode_t::sum] += other.ms_[mode_t::sum];
+    ticks_[mode_t::avg] += other.ticks_[mode_t::avg];
+    ticks_[mode_t::sum] += other.ticks_[mode_t::sum];
+
+    ms_[mode_t::min] = times_
+            ? std::min(ms_[mode_t::min], other.ms_[mode_t::min])
+            : other.ms_[mode_t::min];
+    ms_[mode_t::max] = times_
+            ? std::max(ms_[mode_t::max], other.ms_[mode_t::max])
+            : other.ms_[mode_t::max];
+    ticks_[mode_t::min] = times_
+            ? std::min(ticks_[mode_t::min], other.ticks_[mode_t::min])
+            : other.ticks_[mode_t::min];
+    ticks_[mode_t::max] = times_
+            ? std::max(ticks_[mode_t::max], other.ticks_[mode_t::max])
+            : other.ticks_[mode_t::max];
+
+    samples_ms_.insert(samples_ms_.end(), other.samples_ms_.begin(),
+            other.samples_ms_.end());
+    times_ += other.times_;
+}
+
+double timer_t::percentile_ms(double p) const {
+    if (samples_ms_.empty()) return 0;
+    // Nearest-rank method.
+    std::vector<double> sorted(samples_ms_);
+    const size_t n = sorted.size();
+    size_t rank = (size_t)std::ceil(std::max(0., std::min(p, 100.)) / 100. * n);
+    const size_t idx = rank ? rank - 1 : 0;
+    std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+    return sorted[idx];
+}
+
+double timer_t::stddev_ms() const {
+    const size_t n = samples_ms_.size();
+    if (n < 2) return 0;
+    double mean = 0;
+    for (double s : samples_ms_)
+        mean += s;
+    mean /= n;
+    double var = 0;
+    for (double s : samples_ms_)
+        var += (s - mean) * (s - mean);
+    return std::sqrt(var / (n - 1));
+}
+
+std::vector<size_t> timer_t::histogram(int nbuckets) const {
+    std::vector<size_t> buckets(nbuckets, 0);
+    if (samples_ms_.empty() || nbuckets <= 0) return buckets;
+    const auto minmax
+            = std::minmax_element(samples_ms_.begin(), samples_ms_.end());
+    const double lo = *minmax.first;
+    const double width = (*minmax.second - lo) / nbuckets;
+    for (double s : samples_ms_) {
+        int b = width > 0 ? (int)((s - lo) / width) : 0;
+        buckets[std::min(b, nbuckets - 1)]++;
+    }
+    return buckets;
+}
+
 timer_t &timer_t::operator=(const timer_t &rhs) {
     if (this == &rhs) return *this;
     *this = timer_t(rhs);
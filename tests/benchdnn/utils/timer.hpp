@@ -19,6 +19,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #define TIME_FUNC(func, res, name) \
     do { \
@@ -35,6 +36,8 @@
 #define TIME_REF(func) TIME_FUNC(func, res, timer::names::ref_timer)
 #define TIME_C_PD(func) TIME_FUNC(func, res, timer::names::cpd_timer)
 #define TIME_C_PRIM(func) TIME_FUNC(func, res, timer::names::cp_timer)
+#define TIME_C_PRIM_BLOB(func) \
+    TIME_FUNC(func, res, timer::names::cp_blob_timer)
 // Designated timer to calculate time spent on comparison with reference
 #define TIME_COMPARE(func) TIME_FUNC(func, res, timer::names::compare_timer)
 // Designated timer to calculate time spent on filling
@@ -56,6 +59,10 @@ struct timer_t {
 
     void stamp(int add_times = 1);
 
+    // Combine statistics of `other` timer into this one as if all its
+    // measurements were done by this timer.
+    void merge(const timer_t &other);
+
     void stamp_with_frequency(int add_times, double add_ms, double freq) {
         uint64_t add_ticks = (uint64_t)(add_ms * freq / 1e3);
         stop(add_times, add_ticks, add_ms);
@@ -77,6 +84,18 @@ struct timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    // Distribution of measurements. Each `stop()` call records a single
+    // sample, a time of one run averaged over `add_times` runs.
+    // Returns the `p`-th percentile, `p` in [0, 100], in milliseconds.
+    double percentile_ms(double p) const;
+    // Returns the standard deviation of samples in milliseconds.
+    double stddev_ms() const;
+    // Returns the number of samples.
+    size_t n_samples() const { return samples_ms_.size(); }
+    // Returns the number of samples in each of `nbuckets` equal-width buckets
+    // between the minimum and the maximum sample.
+    std::vector<size_t> histogram(int nbuckets) const;
+
     timer_t(const timer_t &rhs) = default;
     timer_t &operator=(const timer_t &rhs);
     timer_t &operator=(timer_t &&rhs) = default;
@@ -84,6 +103,7 @@ struct timer_t {
     int times_;
     uint64_t ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    std::vector<double> samples_ms_;
 };
 
 // Designated timers to support benchdnn performance reporting and general time
@@ -97,10 +117,14 @@ const std::string ref_timer = "compute_ref_timer";
 const std::string cpd_timer = "create_pd_timer";
 // Primitive creation performace.
 const std::string cp_timer = "create_prim_timer";
+// Primitive creation from a cache blob performance.
+const std::string cp_blob_timer = "create_prim_from_blob_timer";
 // Driver's comparison.
 const std::string compare_timer = "compare_timer";
 // Driver's memory filling.
 const std::string fill_timer = "fill_timer";
+// AMX tile configuration switch performance (brgemm driver).
+const std::string tile_cfg_timer = "tile_config_timer";
 } // namespace names
 
 struct timer_map_t {
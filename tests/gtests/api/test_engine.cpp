@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <cstdlib>
 #include <thread>
 
 #include "dnnl_test_common.hpp"
@@ -73,6 +75,48 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestMultithreading) {
     exe.join();
 }
 
+namespace {
+std::atomic<int> n_user_allocations {0};
+
+void *user_allocate(size_t size, size_t alignment) {
+    (void)alignment;
+    n_user_allocations++;
+    return malloc(size);
+}
+
+void user_deallocate(void *ptr) {
+    n_user_allocations--;
+    free(ptr);
+}
+} // namespace
+
+TEST(cpu_engine_allocator_test_t, TestUserAllocator) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "CPU engine is not found.");
+    SKIP_IF(is_sycl_engine(engine::kind::cpu), "Do not test SYCL engines.");
+
+    {
+        engine eng = make_cpu_engine_with_allocator(
+                user_allocate, user_deallocate);
+        ASSERT_EQ(eng.get_kind(), engine::kind::cpu);
+
+        memory::desc mem_d({16}, memory::data_type::f32, memory::format_tag::x);
+        memory mem(mem_d, eng);
+        ASSERT_EQ(n_user_allocations, 1);
+
+        auto eltwise_pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward, algorithm::eltwise_relu, mem_d, mem_d,
+                0.0f);
+        eltwise_forward eltwise(eltwise_pd);
+        stream s(eng);
+        eltwise.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        s.wait();
+    }
+    ASSERT_EQ(n_user_allocations, 0);
+
+    EXPECT_ANY_THROW(make_cpu_engine_with_allocator(nullptr, nullptr));
+}
+
 INSTANTIATE_TEST_SUITE_P(AllEngineKinds, engine_test_t,
         ::testing::Values(engine::kind::cpu, engine::kind::gpu));
 
@@ -112,6 +112,36 @@ TEST_P(memory_test_cpp_t, OutOfMemory) {
     if (!is_sycl) FAIL() << "Expected exception.";
 }
 
+TEST(memory_test_huge_pages, LargeBufferAlignment) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "CPU engine is not found.");
+    SKIP_IF(is_sycl_engine(engine::kind::cpu), "Do not test SYCL engines.");
+
+    const size_t hp_size = 2 * 1024 * 1024;
+    status st = set_huge_page_threshold(hp_size);
+#ifdef __linux__
+    ASSERT_EQ(st, status::success);
+#else
+    ASSERT_EQ(st, status::unimplemented);
+#endif
+
+    engine eng(engine::kind::cpu, 0);
+    memory::desc md({(memory::dim)(3 * hp_size)}, memory::data_type::u8,
+            memory::format_tag::x);
+    auto mem = test::make_memory(md, eng);
+    ASSERT_NE(mem.get_data_handle(), nullptr);
+#if defined(__linux__) && !defined(DNNL_ENABLE_MEM_DEBUG)
+    if (st == status::success) {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(mem.get_data_handle()) % hp_size,
+                0U);
+    }
+#endif
+
+    if (st == status::success) {
+        ASSERT_EQ(set_huge_page_threshold(0), status::success);
+    }
+}
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -137,6 +137,112 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST(stream_test_c_t, SetCpuAffinity) {
+    dnnl_engine_t engine;
+    DNNL_CHECK(dnnl_engine_create(&engine, dnnl_cpu, 0));
+
+    dnnl_stream_t stream;
+    DNNL_CHECK(dnnl_stream_create(&stream, engine, dnnl_stream_default_flags));
+
+    const int cpus[] = {0, -1};
+    ASSERT_EQ(dnnl_stream_set_cpu_affinity(nullptr, 1, cpus),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_set_cpu_affinity(stream, 0, cpus),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_set_cpu_affinity(stream, 2, cpus),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_set_numa_node_affinity(stream, -1),
+            dnnl_invalid_arguments);
+
+    // The binding is only applied when a primitive is executed.
+    const dnnl_status_t status = dnnl_stream_set_cpu_affinity(stream, 1, cpus);
+    ASSERT_TRUE(status == dnnl_success || status == dnnl_unimplemented);
+
+    DNNL_CHECK(dnnl_stream_destroy(stream));
+    DNNL_CHECK(dnnl_engine_destroy(engine));
+}
+#endif
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+TEST(stream_test_cpp_t, OutOfOrderCpuExecution) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::out_of_order);
+
+    const memory::dim n = 1000;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    // dst = src + 1
+    eltwise_forward add_one(eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            1.f, 1.f));
+
+    // Independent chains of dependent steps that ping-pong between two
+    // buffers.
+    const int nchains = 4;
+    const int nsteps = 9;
+    std::vector<memory> a, b;
+    for (int c = 0; c < nchains; c++) {
+        a.emplace_back(md, eng);
+        b.emplace_back(md, eng);
+        float *ptr = static_cast<float *>(a.back().get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = (float)c;
+    }
+
+    for (int step = 0; step < nsteps; step++)
+        for (int c = 0; c < nchains; c++) {
+            memory &src = step % 2 ? b[c] : a[c];
+            memory &dst = step % 2 ? a[c] : b[c];
+            add_one.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        }
+    s.wait();
+
+    for (int c = 0; c < nchains; c++) {
+        const memory &res = nsteps % 2 ? b[c] : a[c];
+        const float *ptr = static_cast<const float *>(res.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(ptr[i], (float)(c + nsteps));
+    }
+}
+#endif
+
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, CpuProfiling) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::profiling);
+
+    memory::desc md({2, 3, 4, 5}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    eltwise_forward relu(eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+            0.f));
+    memory mem(md, eng);
+
+    ASSERT_NO_THROW(reset_profiling(s));
+
+    const int nexecs = 3;
+    for (int i = 0; i < nexecs; i++)
+        relu.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    s.wait();
+
+    std::vector<uint64_t> nsec;
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_EQ(nsec.size(), (size_t)nexecs);
+
+    ASSERT_NO_THROW(reset_profiling(s));
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_TRUE(nsec.empty());
+
+    // Profiling data is only collected on streams created with the flag.
+    stream s_default(eng);
+    ASSERT_ANY_THROW(reset_profiling(s_default));
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "oneapi/dnnl/dnnl_ukernel.hpp"
+#include "tests/test_isa_common.hpp"
+
+namespace dnnl {
+
+#if defined(DNNL_EXPERIMENTAL_UKERNEL) && DNNL_X64 \
+        && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+
+using dt = memory::data_type;
+using ukernel::pack_type;
+
+class ukernel_pack_B_test_t : public ::testing::Test {
+protected:
+    // Packs a plain f32 `K x N` tensor B stored as `ab` or `ba` with a leading
+    // dimension `in_ld` and compares it against the expected layout. `N` fits
+    // a single output block, so the packed element `(k, n)` lives at
+    // `k * out_ld + n`.
+    void check_pack(memory::dim K, memory::dim N, pack_type in_pack_type,
+            memory::dim in_ld) {
+        const bool is_trans = in_pack_type == pack_type::trans;
+        const memory::dim out_ld = N;
+        // Input elements outside of the logical tensor are filled with a
+        // value that must never show up in the output.
+        const float garbage = -1.f;
+        std::vector<float> in((is_trans ? N : K) * in_ld, garbage);
+        for (memory::dim k = 0; k < K; k++)
+            for (memory::dim n = 0; n < N; n++)
+                in[is_trans ? n * in_ld + k : k * in_ld + n]
+                        = static_cast<float>(k * N + n);
+
+        ukernel::brgemm_pack_B pack_B(
+                K, N, in_pack_type, in_ld, out_ld, dt::f32, dt::f32);
+        // A transposed input can't be consumed by the ukernel as is.
+        if (is_trans) { ASSERT_TRUE(pack_B.need_pack()); }
+        ASSERT_NO_THROW(pack_B.generate());
+
+        // The output buffer is padded by K up to the packing block.
+        const memory::dim K_padded = (K + 15) / 16 * 16;
+        std::vector<float> out(K_padded * out_ld, 0.f);
+        ASSERT_NO_THROW(pack_B.execute(in.data(), out.data()));
+
+        for (memory::dim k = 0; k < K; k++)
+            for (memory::dim n = 0; n < N; n++)
+                ASSERT_EQ(out[k * out_ld + n], static_cast<float>(k * N + n))
+                        << "k: " << k << " n: " << n;
+    }
+
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "ukernel API requires a CPU engine");
+        SKIP_IF(!mayiuse(cpu_isa::avx512_core),
+                "brgemm_pack_B requires avx512_core CPU");
+    }
+};
+
+TEST_F(ukernel_pack_B_test_t, PlainInputStridedLd) {
+    check_pack(/* K = */ 20, /* N = */ 16, pack_type::no_trans,
+            /* in_ld = */ 24);
+}
+
+TEST_F(ukernel_pack_B_test_t, TransposedInput) {
+    check_pack(/* K = */ 20, /* N = */ 16, pack_type::trans, /* in_ld = */ 20);
+}
+
+TEST_F(ukernel_pack_B_test_t, TransposedInputStridedLd) {
+    check_pack(/* K = */ 20, /* N = */ 32, pack_type::trans, /* in_ld = */ 28);
+}
+
+TEST_F(ukernel_pack_B_test_t, InvalidPackType) {
+    EXPECT_ANY_THROW(ukernel::brgemm_pack_B(
+            16, 16, pack_type::undef, 16, 16, dt::f32, dt::f32));
+}
+
+class ukernel_hw_context_test_t : public ::testing::Test {
+protected:
+    static ukernel::brgemm make_brgemm(
+            memory::dim M, memory::dim N, memory::dim K, dt a_dt, dt b_dt) {
+        return ukernel::brgemm(M, N, K, /* batch_size = */ 1,
+                /* lda = */ K, /* ldb = */ N, /* ldc = */ N, a_dt, b_dt,
+                dt::f32, /* alpha = */ 1.f, /* beta = */ 0.f);
+    }
+
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "ukernel API requires a CPU engine");
+        SKIP_IF(!mayiuse(cpu_isa::avx512_core),
+                "brgemm ukernel requires avx512_core CPU");
+    }
+};
+
+// Kernels that don't use AMX have an empty palette, so any two of them share
+// the hardware context.
+TEST_F(ukernel_hw_context_test_t, NonAmxPalettes) {
+    auto brg = make_brgemm(16, 16, 16, dt::f32, dt::f32);
+    auto other = make_brgemm(8, 48, 64, dt::f32, dt::f32);
+    EXPECT_TRUE(brg.is_same_hw_context(other));
+    EXPECT_TRUE(other.is_same_hw_context(brg));
+
+    int is_same = 0;
+    ASSERT_EQ(dnnl_brgemm_is_same_hw_context(brg.get(), other.get(), &is_same),
+            dnnl_success);
+    EXPECT_EQ(is_same, 1);
+}
+
+TEST_F(ukernel_hw_context_test_t, AmxPalettes) {
+    SKIP_IF(!mayiuse(cpu_isa::avx512_core_amx),
+            "AMX palettes require avx512_core_amx CPU");
+    auto brg = make_brgemm(16, 16, 32, dt::bf16, dt::bf16);
+    auto same = make_brgemm(16, 16, 32, dt::bf16, dt::bf16);
+    auto other = make_brgemm(8, 8, 32, dt::bf16, dt::bf16);
+    EXPECT_TRUE(brg.is_same_hw_context(same));
+    EXPECT_FALSE(brg.is_same_hw_context(other));
+
+    int is_same = 1;
+    ASSERT_EQ(dnnl_brgemm_is_same_hw_context(brg.get(), other.get(), &is_same),
+            dnnl_success);
+    EXPECT_EQ(is_same, 0);
+    ASSERT_EQ(dnnl_brgemm_is_same_hw_context(brg.get(), same.get(), &is_same),
+            dnnl_success);
+    EXPECT_EQ(is_same, 1);
+}
+
+TEST_F(ukernel_hw_context_test_t, InvalidArguments) {
+    auto brg = make_brgemm(16, 16, 16, dt::f32, dt::f32);
+    int is_same = 0;
+    EXPECT_EQ(dnnl_brgemm_is_same_hw_context(brg.get(), nullptr, &is_same),
+            dnnl_invalid_arguments);
+    EXPECT_EQ(dnnl_brgemm_is_same_hw_context(brg.get(), brg.get(), nullptr),
+            dnnl_invalid_arguments);
+}
+
+#endif
+
+} // namespace dnnl
@@ -37,3 +37,14 @@ TEST(APIConstantTensorCache, CapacityControl) {
             dnnl::engine::kind::cpu);
     ASSERT_EQ(capacity, std::numeric_limits<size_t>::max() / (1024 * 1024));
 }
+
+TEST(APIConstantTensorCache, NumaReplicaCapacityControl) {
+    dnnl::graph::set_constant_tensor_cache_numa_replica_capacity(64);
+    ASSERT_EQ(dnnl::graph::get_constant_tensor_cache_numa_replica_capacity(),
+            64U);
+
+    // recover the default config
+    dnnl::graph::set_constant_tensor_cache_numa_replica_capacity(0);
+    ASSERT_EQ(
+            dnnl::graph::get_constant_tensor_cache_numa_replica_capacity(), 0U);
+}
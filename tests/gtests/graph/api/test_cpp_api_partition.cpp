@@ -16,9 +16,11 @@
 
 #include "oneapi/dnnl/dnnl_graph.hpp"
 
+#include "test_allocator.hpp"
 #include "test_api_common.hpp"
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <cstdint>
 
 TEST(APIPartition, PartitionTest) {
@@ -324,6 +326,131 @@ TEST(APIPartitionCache, GetSetCapacity) {
 #endif
 }
 
+#ifndef DNNL_GRAPH_DISABLE_COMPILED_PARTITION_CACHE
+TEST(APIPartitionCache, CacheBlob) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+
+    graph g(engine_kind);
+    logical_tensor src {0, logical_tensor::data_type::f32, {8, 32},
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {32, 16},
+            logical_tensor::layout_type::strided};
+    logical_tensor mm_dst {2, logical_tensor::data_type::f32, {8, 16},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {3, logical_tensor::data_type::f32, {8, 16},
+            logical_tensor::layout_type::strided};
+
+    op mm {0, op::kind::MatMul, "matmul"};
+    mm.add_inputs({src, wei});
+    mm.add_output(mm_dst);
+    op relu {1, op::kind::ReLU, "relu"};
+    relu.add_input(mm_dst);
+    relu.add_output(dst);
+
+    g.add_op(mm);
+    g.add_op(relu);
+    g.finalize();
+    auto partitions = g.get_partitions();
+    ASSERT_EQ(partitions.size(), 1U);
+
+    set_compiled_partition_cache_capacity(0);
+    set_compiled_partition_cache_capacity(4);
+    const auto empty_blob = get_compiled_partition_cache_blob();
+    ASSERT_FALSE(empty_blob.empty());
+
+    partitions[0].compile({src, wei}, {dst}, eng);
+    const auto blob = get_compiled_partition_cache_blob();
+    ASSERT_GT(blob.size(), empty_blob.size());
+
+    // Clearing the cache and loading the blob must bring the compiled
+    // partition back.
+    set_compiled_partition_cache_capacity(0);
+    set_compiled_partition_cache_capacity(4);
+    ASSERT_EQ(get_compiled_partition_cache_blob().size(), empty_blob.size());
+    set_compiled_partition_cache_blob(eng, blob);
+    ASSERT_EQ(get_compiled_partition_cache_blob().size(), blob.size());
+
+    // A truncated blob is rejected.
+    std::vector<uint8_t> bad_blob(blob.begin(), blob.begin() + 4);
+    EXPECT_THROW(set_compiled_partition_cache_blob(eng, bad_blob), dnnl::error);
+
+    set_compiled_partition_cache_capacity(1024);
+}
+#endif
+
+namespace {
+std::atomic<int> num_allocations {0};
+
+void *counting_allocate(size_t size, size_t alignment) {
+    num_allocations++;
+    return dnnl::graph::testing::allocate(size, alignment);
+}
+} // namespace
+
+TEST(APIPartition, PrepareConstants) {
+    using namespace dnnl::graph;
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Skip the case when CPU runtime is NONE or SYCL");
+
+    graph g(engine::kind::cpu);
+    logical_tensor src {0, logical_tensor::data_type::f32, {8, 32},
+            logical_tensor::layout_type::strided};
+    logical_tensor wei {1, logical_tensor::data_type::f32, {32, 16},
+            logical_tensor::layout_type::strided,
+            logical_tensor::property_type::constant};
+    logical_tensor dst {2, logical_tensor::data_type::f32, {8, 16},
+            logical_tensor::layout_type::strided};
+
+    op mm {0, op::kind::MatMul, "matmul"};
+    mm.add_inputs({src, wei});
+    mm.add_output(dst);
+
+    g.add_op(mm);
+    g.finalize();
+    auto partitions = g.get_partitions();
+    ASSERT_EQ(partitions.size(), 1U);
+
+    // Buffers of the kernel, including the constant cache entries, come from
+    // the engine allocator.
+    allocator alloc {counting_allocate, dnnl::graph::testing::deallocate};
+    engine eng = make_engine_with_allocator(engine::kind::cpu, 0, alloc);
+    auto cp = partitions[0].compile({src, wei}, {dst}, eng);
+
+    std::vector<float> src_data(8 * 32, 1.f);
+    std::vector<float> wei_data(32 * 16, 0.5f);
+    std::vector<float> dst_data(8 * 16, 0.f);
+    tensor ts_src(src, eng, src_data.data());
+    tensor ts_wei(wei, eng, wei_data.data());
+    tensor ts_dst(dst, eng, dst_data.data());
+
+    stream strm(eng);
+    // Only the constant inputs are needed, the non-constant ones may be
+    // given without a buffer.
+    tensor ts_src_empty(src, eng, nullptr);
+    cp.prepare_constants(strm, {ts_src_empty, ts_wei});
+
+    // The constant buffer is already cached, so the first execution
+    // allocates as much as any later one.
+    const int num_allocations_prepared = num_allocations;
+    cp.execute(strm, {ts_src, ts_wei}, {ts_dst});
+    strm.wait();
+    const int num_allocations_first = num_allocations;
+    cp.execute(strm, {ts_src, ts_wei}, {ts_dst});
+    strm.wait();
+    ASSERT_EQ(num_allocations_first - num_allocations_prepared,
+            num_allocations - num_allocations_first);
+
+    for (const auto &v : dst_data)
+        ASSERT_FLOAT_EQ(v, 16.f);
+
+    // The number of inputs must match the partition.
+    ASSERT_ANY_THROW(cp.prepare_constants(strm, {ts_wei}));
+}
+
 // Test the f8f8f32 partition as below;
 //
 //      deq0_src     deq1_src
@@ -13,6 +13,10 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
+#include <chrono>
+#include <future>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "interface/constant_tensor_cache.hpp"
@@ -110,3 +114,118 @@ TEST(test_constant_cache_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+TEST(test_constant_cache_constant_cache, NumaReplicaCapacity) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    graph::constant_tensor_cache_t cache(5);
+    ASSERT_EQ(cache.get_numa_replica_capacity(), 0U);
+    ASSERT_EQ(cache.set_numa_replica_capacity(4), graph::status::success);
+    ASSERT_EQ(cache.get_numa_replica_capacity(), 4U);
+
+    // should cache miss
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise1;
+    ASSERT_FALSE(cache.get_or_add(0, 1, 2, c_promise1.get_future()).valid());
+    graph::constant_tensor_cache_t::cached_t c_buffer1
+            = std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+                    2, p_engine_, g_alloc_);
+    c_promise1.set_value(c_buffer1);
+
+    // should cache hit, the entry was added by the node of this thread
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise1_2;
+    auto value = cache.get_or_add(0, 1, 2, c_promise1_2.get_future());
+    ASSERT_TRUE(value.valid());
+    ASSERT_EQ(value.get(), c_buffer1);
+    ASSERT_EQ(cache.get_size(), 2U);
+
+    // flushing the replicas keeps the entries not created as a replica
+    ASSERT_EQ(cache.set_numa_replica_capacity(0), graph::status::success);
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise1_3;
+    ASSERT_TRUE(cache.get_or_add(0, 1, 2, c_promise1_3.get_future()).valid());
+
+    cache.remove_if_exist(0, 1);
+    ASSERT_EQ(cache.get_size(), 0U);
+}
+
+namespace {
+using cached_t = graph::constant_tensor_cache_t::cached_t;
+
+// Adds a ready tensor to the cache. The creation time of the tensor is at
+// least `creation_ms`.
+bool add_tensor(graph::constant_tensor_cache_t &cache, size_t backend_id,
+        size_t key, size_t size, int creation_ms, size_t partition_id = 0) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_ = static_cast<graph::allocator_t *>(engine.get_allocator());
+
+    std::promise<cached_t> c_promise;
+    auto value = cache.get_or_add(
+            backend_id, key, size, c_promise.get_future(), partition_id);
+    if (value.valid()) return false;
+    cached_t c_buffer = std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+            size, p_engine_, g_alloc_);
+    std::this_thread::sleep_for(std::chrono::milliseconds(creation_ms));
+    c_buffer->record_creation_time();
+    c_promise.set_value(c_buffer);
+    return true;
+}
+
+bool is_cached(graph::constant_tensor_cache_t &cache, size_t backend_id,
+        size_t key, size_t size) {
+    return !add_tensor(cache, backend_id, key, size, 0);
+}
+
+int pin_partition_7(size_t partition_id) {
+    return partition_id == 7;
+}
+} // namespace
+
+TEST(test_constant_cache_constant_cache, CostEviction) {
+    graph::constant_tensor_cache_t cache(5);
+    cache.set_eviction_policy(
+            graph::constant_tensor_cache_t::eviction_policy_t::cost);
+
+    ASSERT_TRUE(add_tensor(cache, 0, 1, 3, 5));
+    ASSERT_TRUE(add_tensor(cache, 0, 2, 1, 0));
+    ASSERT_TRUE(add_tensor(cache, 0, 3, 1, 0));
+    ASSERT_EQ(cache.get_size(), 5U);
+
+    // The two cheap tensors are evicted to make room for the new one, the
+    // expensive tensor stays in the cache.
+    ASSERT_TRUE(add_tensor(cache, 0, 4, 2, 0));
+    ASSERT_EQ(cache.get_size(), 5U);
+    ASSERT_TRUE(is_cached(cache, 0, 1, 3));
+    ASSERT_TRUE(is_cached(cache, 0, 4, 2));
+}
+
+TEST(test_constant_cache_constant_cache, PinnedTensorNotEvicted) {
+    graph::constant_tensor_cache_t cache(4);
+    cache.set_eviction_policy(
+            graph::constant_tensor_cache_t::eviction_policy_t::cost);
+    graph::constant_tensor_cache_t::set_pin_func(pin_partition_7);
+
+    ASSERT_TRUE(add_tensor(cache, 0, 1, 2, 0, 7));
+    ASSERT_TRUE(add_tensor(cache, 0, 2, 2, 5, 8));
+
+    // The cheapest tensor is pinned, the other one is evicted instead.
+    ASSERT_TRUE(add_tensor(cache, 0, 3, 2, 0));
+    ASSERT_TRUE(is_cached(cache, 0, 1, 2));
+    ASSERT_TRUE(is_cached(cache, 0, 3, 2));
+
+    graph::constant_tensor_cache_t::set_pin_func(nullptr);
+}
+
+TEST(test_constant_cache_constant_cache, BackendCapacity) {
+    graph::constant_tensor_cache_t cache(10);
+    ASSERT_EQ(cache.set_backend_capacity(0, 2), graph::status::success);
+
+    ASSERT_TRUE(add_tensor(cache, 0, 1, 2, 0));
+    // Exceeds the capacity of backend 0
+    ASSERT_TRUE(add_tensor(cache, 0, 2, 1, 0));
+    ASSERT_EQ(cache.get_size(), 2U);
+    // Other backends still have room
+    ASSERT_TRUE(add_tensor(cache, 1, 3, 1, 0));
+    ASSERT_EQ(cache.get_size(), 3U);
+}
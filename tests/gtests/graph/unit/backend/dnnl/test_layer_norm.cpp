@@ -480,3 +480,130 @@ TEST(test_layer_norm_execute_subgraph_int8, LayernormTypecastQuant_CPU) {
         ASSERT_FLOAT_EQ(ref_data[i], dst_data[i]);
     }
 }
+
+TEST(test_layer_norm_execute_subgraph_int8, AddLayernormQuant_CPU) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    std::vector<int64_t> layernorm_shape {2, 3, 8};
+    std::vector<int64_t> scale_lt_shape {8};
+    std::vector<int64_t> shift_lt_shape {8};
+    std::vector<float> src0_data(product(layernorm_shape));
+    std::vector<float> src1_data(product(layernorm_shape));
+
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> src_distribution(-1.f, 1.f);
+    std::generate(src0_data.begin(), src0_data.end(),
+            [&]() { return src_distribution(generator); });
+    std::generate(src1_data.begin(), src1_data.end(),
+            [&]() { return src_distribution(generator); });
+
+    graph::op_t add_op(0, graph::op_kind::Add, "add");
+    graph::op_t layernorm_op(1, graph::op_kind::LayerNorm, "layernorm");
+    layernorm_op.set_attr<float>(graph::op_attr::epsilon, 0);
+    layernorm_op.set_attr<bool>(graph::op_attr::keep_stats, false); //inference
+    graph::op_t quantize(2, graph::op_kind::Quantize, "quantize");
+    quantize.set_attr<std::vector<float>>(graph::op_attr::scales, {0.1f});
+    quantize.set_attr<std::vector<int64_t>>(graph::op_attr::zps, {0});
+    quantize.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+    // consumer of the residual sum outside of the partition
+    graph::op_t relu(3, graph::op_kind::ReLU, "relu");
+
+    graph::logical_tensor_t src0 = utils::logical_tensor_init(
+            0, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t src1 = utils::logical_tensor_init(
+            1, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t add_dst = utils::logical_tensor_init(
+            2, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t scale_lt = utils::logical_tensor_init(
+            3, scale_lt_shape, graph::data_type::f32);
+    graph::logical_tensor_t shift_lt = utils::logical_tensor_init(
+            4, shift_lt_shape, graph::data_type::f32);
+    graph::logical_tensor_t layernorm_dst = utils::logical_tensor_init(
+            5, layernorm_shape, graph::data_type::f32);
+    graph::logical_tensor_t quant_dst = utils::logical_tensor_init(
+            6, layernorm_shape, graph::data_type::u8);
+    graph::logical_tensor_t relu_dst = utils::logical_tensor_init(
+            7, layernorm_shape, graph::data_type::f32);
+
+    add_op.add_input(src0);
+    add_op.add_input(src1);
+    add_op.add_output(add_dst);
+    layernorm_op.add_input(add_dst);
+    layernorm_op.add_input(scale_lt);
+    layernorm_op.add_input(shift_lt);
+    layernorm_op.add_output(layernorm_dst);
+    quantize.add_input(layernorm_dst);
+    quantize.add_output(quant_dst);
+    relu.add_input(add_dst);
+    relu.add_output(relu_dst);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&add_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&layernorm_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&quantize), graph::status::success);
+    ASSERT_EQ(g.add_op(&relu), graph::status::success);
+    ASSERT_EQ(g.finalize(), graph::status::success);
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("add_layernorm_post_ops_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_outputs().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> lt_ins {
+            &src0, &src1, &scale_lt, &shift_lt};
+    std::vector<const graph::logical_tensor_t *> lt_outs {
+            &add_dst, &quant_dst};
+    ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine), graph::status::success);
+
+    std::vector<float> scale(product(scale_lt_shape), 1.f);
+    std::vector<float> shift(product(shift_lt_shape), 0.f);
+
+    test_tensor src0_ts(src0, engine, src0_data);
+    test_tensor src1_ts(src1, engine, src1_data);
+    test_tensor scale_ts(scale_lt, engine, scale);
+    test_tensor shift_ts(shift_lt, engine, shift);
+    test_tensor add_dst_ts(add_dst, engine);
+    test_tensor quant_dst_ts(quant_dst, engine);
+
+    ASSERT_EQ(cp.execute(strm,
+                      {src0_ts.get(), src1_ts.get(), scale_ts.get(),
+                              shift_ts.get()},
+                      {add_dst_ts.get(), quant_dst_ts.get()}),
+            graph::status::success);
+    strm->wait();
+
+    auto sum_data = add_dst_ts.as_vec_type<float>();
+    auto dst_data = quant_dst_ts.as_vec_type<uint8_t>();
+    const size_t norm_size = static_cast<size_t>(layernorm_shape.back());
+    for (size_t off = 0; off < sum_data.size(); off += norm_size) {
+        float mean = 0.f, var = 0.f;
+        for (size_t i = 0; i < norm_size; ++i) {
+            const float sum = src0_data[off + i] + src1_data[off + i];
+            ASSERT_FLOAT_EQ(sum_data[off + i], sum);
+            mean += sum;
+        }
+        mean /= norm_size;
+        for (size_t i = 0; i < norm_size; ++i) {
+            const float d = sum_data[off + i] - mean;
+            var += d * d;
+        }
+        var /= norm_size;
+        for (size_t i = 0; i < norm_size; ++i) {
+            const float norm = (sum_data[off + i] - mean) / std::sqrt(var);
+            const float ref = std::min(
+                    255.f, std::max(0.f, std::nearbyint(norm / 0.1f)));
+            // allow off-by-one due to rounding of the normalized value
+            ASSERT_LE(std::abs(ref - static_cast<float>(dst_data[off + i])),
+                    1.f);
+        }
+    }
+}
@@ -37,3 +37,31 @@ TEST(test_memory_planning_memory_planning, GetMemoryInfo) {
     graph::value_t val {op, 0, lt};
     ASSERT_NO_THROW(mp.get_memory_info(&val));
 }
+
+TEST(test_memory_planning_memory_planning, InplacePairsWithPostOps) {
+    namespace op_kind = dnnl_impl::op_kind;
+    size_t id = 0;
+    auto src_lt = utils::logical_tensor_init(
+            id++, {2, 16}, graph::data_type::f32, graph::layout_type::strided);
+    auto dst_lt = utils::logical_tensor_init(
+            id++, {2, 16}, graph::data_type::f32, graph::layout_type::strided);
+
+    graph::op_t eltwise {id++, op_kind::dnnl_eltwise, "eltwise"};
+    eltwise.add_input(src_lt);
+    eltwise.add_output(dst_lt);
+
+    dnnl_impl::fusion_info_mgr_t mgr;
+    ASSERT_EQ(dnnl_impl::get_op_inplace_pairs(eltwise, mgr).size(), 1U);
+
+    // An eltwise post-op doesn't prevent the op from computing in place
+    auto key = mgr.init_info();
+    eltwise.set_attr<int64_t>(dnnl_impl::op_attr::fusion_info_key, key);
+    auto post_op = std::make_shared<graph::op_t>(
+            id++, op_kind::dnnl_eltwise, "post_eltwise");
+    mgr.get_mutable_info(key).append_post_eltwise(post_op);
+
+    auto pairs = dnnl_impl::get_op_inplace_pairs(eltwise, mgr);
+    ASSERT_EQ(pairs.size(), 1U);
+    ASSERT_EQ(pairs[0].in_idx_, 0U);
+    ASSERT_EQ(pairs[0].out_idx_, 0U);
+}
@@ -111,6 +111,38 @@ TEST(test_thread_local_cache_thread_local_cache, Clear) {
     ASSERT_NO_THROW(cache.clear());
 }
 
+TEST(test_thread_local_cache_thread_local_cache, RemoveExpired) {
+    thread_local_cache_t<test_resource_t> cache;
+    cache.clear();
+
+    size_t key1 = 1U;
+    cache.get_or_add(
+            key1, []() { return std::make_shared<test_resource_t>(10); });
+    size_t key2 = 2U;
+    cache.get_or_add(
+            key2, []() { return std::make_shared<test_resource_t>(20); });
+    ASSERT_EQ(cache.size(), 2U);
+
+    // the expired entry is erased at the next cache miss
+    cache.remove_if_exist(key1);
+    ASSERT_FALSE(cache.has_resource(key1));
+    size_t key3 = 3U;
+    cache.get_or_add(
+            key3, []() { return std::make_shared<test_resource_t>(30); });
+    ASSERT_EQ(cache.size(), 2U);
+    ASSERT_TRUE(cache.has_resource(key2));
+    ASSERT_TRUE(cache.has_resource(key3));
+
+    // a removed key can be cached again
+    test_resource_t *resource_ptr1 = cache.get_or_add(
+            key1, []() { return std::make_shared<test_resource_t>(40); });
+    ASSERT_EQ(resource_ptr1->data_, 40U);
+    ASSERT_EQ(cache.size(), 3U);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0U);
+}
+
 TEST(test_thread_local_cache_thread_local_cache, RetainAndRelease) {
     auto func = []() {
         thread_local_cache_t<test_resource_t> cache;
@@ -198,6 +198,27 @@ INST_TEST_CASE(TestGEMM_packed,
                 3.0f, 8000, 8000, 200),
         make_test_params_pack({false, true}, 't', 'n', 200, 300, 8000, 1.0f,
                 3.0f, 200, 300, 300));
+
+#if defined(FP32)
+INST_TEST_CASE(TestGEMM_packed_api,
+        test_params {'n', 'n', 3, 2, 2, 1.0, 0.0, 1, 5, 8, {},
+                {true, false, true}, true, dnnl_invalid_arguments},
+        test_params {'n', 't', 3, 2, 2, 1.0, 0.0, 3, 1, 8, {},
+                {true, true, true}, true, dnnl_invalid_arguments},
+
+        make_test_params_pack({true, false, true}, 'N', 'n', 31, 21, 11, 1.0f,
+                1.5f, 61, 51, 81),
+        make_test_params_pack({false, true, true}, 'n', 'T', 31, 21, 11, 1.0f,
+                1.5f, 61, 51, 81),
+        make_test_params_pack({true, true, true}, 't', 't', 31, 21, 11, 1.0f,
+                1.5f, 61, 51, 81),
+        make_test_params_pack({true, true, true}, 'n', 't', 100, 2, 100, 1.0f,
+                2.0f, 100, 100, 100),
+        make_test_params_pack({false, true, true}, 'n', 'n', 1, 100, 100,
+                1.0f, 2.0f, 100, 100, 100),
+        make_test_params_pack({true, false, true}, 't', 'n', 300, 200, 500,
+                1.0f, 0.0f, 300, 200, 200));
+#endif
 #endif
 #endif
 
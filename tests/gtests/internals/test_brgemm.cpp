@@ -26,6 +26,7 @@
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
 
 namespace dnnl {
 
@@ -283,4 +284,27 @@ TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
 
+TEST(brgemm_kernel_container_test_t, TestKernelDeduplication) {
+    using namespace impl::cpu::x64;
+
+    brgemm_desc_t desc;
+    ASSERT_EQ(brgemm_desc_init(&desc, cpu_isa_t::isa_undef, brgemm_addr,
+                      dnnl_f32, dnnl_f32, false, false, brgemm_row_major, 1.f,
+                      0.f, 64, 64, 64, 64, 64, 64),
+            dnnl_success);
+    SKIP_IF(desc.is_tmm, "Tile configuration is not needed for the test.");
+    brgemm_attr_t attr;
+    attr.max_bs = 1;
+    ASSERT_EQ(brgemm_desc_set_attr(&desc, attr), dnnl_success);
+    brgemm_desc_t desc_copy = desc;
+
+    // Kernels with identical code are shared between containers, which
+    // represent different primitives.
+    brgemm_containers::brgemm_kernel_container_t kernels_0(1), kernels_1(1);
+    ASSERT_EQ(kernels_0.insert(0, &desc), dnnl_success);
+    ASSERT_EQ(kernels_1.insert(0, &desc_copy), dnnl_success);
+    ASSERT_NE(kernels_0[0], nullptr);
+    ASSERT_EQ(kernels_0[0], kernels_1[0]);
+}
+
 } // namespace dnnl
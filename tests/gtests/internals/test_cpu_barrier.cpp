@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu/x64/cpu_barrier.hpp"
+
+namespace dnnl {
+
+using namespace impl::cpu::x64;
+
+TEST(test_simple_barrier, Test) {
+    const int nthr = 4;
+    const int niter = 200;
+
+    simple_barrier::ctx_t ctx;
+    simple_barrier::ctx_init(&ctx);
+
+    std::atomic<int> arrived {0};
+    std::atomic<bool> ok {true};
+    auto worker = [&](int ithr) {
+        for (int iter = 0; iter < niter; iter++) {
+            // Delay one thread from time to time so that the others stop
+            // spinning and sleep.
+            if (ithr == 0 && iter % 50 == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            arrived++;
+            simple_barrier::barrier(&ctx, nthr);
+            if (arrived.load() < (iter + 1) * nthr) ok = false;
+            simple_barrier::barrier(&ctx, nthr);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int ithr = 0; ithr < nthr; ithr++)
+        threads.emplace_back(worker, ithr);
+    for (auto &t : threads)
+        t.join();
+
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(arrived.load(), niter * nthr);
+    ASSERT_EQ(ctx.ctr, 0u);
+    ASSERT_EQ(ctx.nparked, 0);
+}
+
+} // namespace dnnl
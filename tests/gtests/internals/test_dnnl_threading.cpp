@@ -29,6 +29,44 @@ TEST(test_parallel, Test) {
     });
 }
 
+TEST(test_max_threads_limit, Test) {
+    const int max_nthr = dnnl_get_max_threads();
+    {
+        impl::max_threads_limit_guard_t guard(1);
+        ASSERT_EQ(dnnl_get_max_threads(), 1);
+        ASSERT_EQ(dnnl_get_current_num_threads(), 1);
+        {
+            // A nested guard cannot raise the limit.
+            impl::max_threads_limit_guard_t nested_guard(2);
+            ASSERT_EQ(dnnl_get_max_threads(), 1);
+        }
+    }
+    {
+        // No limit is applied for 0.
+        impl::max_threads_limit_guard_t guard(0);
+        ASSERT_EQ(dnnl_get_max_threads(), max_nthr);
+    }
+    ASSERT_EQ(dnnl_get_max_threads(), max_nthr);
+}
+
+TEST(test_adjust_num_threads_cost, Test) {
+    const int nthr = 4;
+    impl::parallel_cost_t tiny_cost;
+    tiny_cost.bytes = 1024;
+    tiny_cost.ops = 256;
+    // Tiny jobs run inline regardless of the work amount.
+    ASSERT_EQ(impl::adjust_num_threads(nthr, 1024, tiny_cost), 1);
+
+    impl::parallel_cost_t big_cost;
+    big_cost.bytes = size_t(1) << 30;
+    big_cost.ops = size_t(1) << 28;
+    const int expected_nthr = impl::adjust_num_threads(nthr, 1024);
+    ASSERT_EQ(impl::adjust_num_threads(nthr, 1024, big_cost), expected_nthr);
+    // The cost never raises the number of threads.
+    ASSERT_EQ(impl::adjust_num_threads(nthr, 2, big_cost),
+            impl::adjust_num_threads(nthr, 2));
+}
+
 using data_t = ptrdiff_t;
 
 struct nd_params_t {
@@ -160,4 +198,48 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    void emit_parallel_nd_dynamic(impl::dynamic_schedule_t schedule) {
+        switch ((int)p.dims.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(
+                        p.dims[0],
+                        [&](ptrdiff_t d0) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            data[d0] = d0;
+                        },
+                        schedule);
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(
+                        p.dims[0], p.dims[1],
+                        [&](ptrdiff_t d0, ptrdiff_t d1) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            const ptrdiff_t idx = d0 * p.dims[1] + d1;
+                            data[idx] = idx;
+                        },
+                        schedule);
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+TEST_P(test_parallel_nd_dynamic_t, TestHybrid) {
+    emit_parallel_nd_dynamic(impl::dynamic_schedule_t::hybrid);
+    CheckID();
+}
+
+TEST_P(test_parallel_nd_dynamic_t, TestAlways) {
+    emit_parallel_nd_dynamic(impl::dynamic_schedule_t::always);
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{100}}, np_t {{1031}},
+                np_t {{0, 0}}, np_t {{1, 2}}, np_t {{10, 10}},
+                np_t {{37, 129}}));
+
 } // namespace dnnl
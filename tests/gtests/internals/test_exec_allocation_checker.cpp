@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "common/utils.hpp"
+
+namespace dnnl {
+
+using namespace impl;
+
+TEST(test_exec_allocation_checker, Disabled) {
+    exec_allocation_checker_t checker(0);
+    void *p = impl::malloc(64, 64);
+    impl::free(p);
+    EXPECT_EQ(checker.count(), 0u);
+    EXPECT_EQ(checker.check("test"), status::success);
+}
+
+TEST(test_exec_allocation_checker, Count) {
+    exec_allocation_checker_t checker(1);
+    EXPECT_EQ(checker.count(), 0u);
+
+    void *p0 = impl::malloc(64, 64);
+    void *p1 = impl::malloc(128, 64);
+    impl::free(p0);
+    impl::free(p1);
+    EXPECT_EQ(checker.count(), 2u);
+    EXPECT_EQ(checker.size(), 192u);
+    EXPECT_EQ(checker.check("test"), status::success);
+}
+
+TEST(test_exec_allocation_checker, Fail) {
+    exec_allocation_checker_t checker(2);
+    EXPECT_EQ(checker.check("test"), status::success);
+
+    void *p = impl::malloc(64, 64);
+    impl::free(p);
+    EXPECT_EQ(checker.check("test"), status::runtime_error);
+}
+
+} // namespace dnnl
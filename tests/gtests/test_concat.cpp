@@ -445,4 +445,50 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+TEST(concat_test_in_place, SourceIsViewOfDestination) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test requires a host-accessible destination.");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim N = 2, C0 = 4, C1 = 2, HW = 9;
+    memory::desc dst_md({N, C0 + C1, 3, 3}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto dst = test::make_memory(dst_md, eng);
+
+    // The first source is a view of its part of the destination, as if its
+    // producer wrote the result there, the second one is a separate buffer.
+    auto src0_md = dst_md.submemory_desc({N, C0, 3, 3}, {0, 0, 0, 0});
+    memory src0(src0_md, eng, dst.get_data_handle());
+    memory::desc src1_md(
+            {N, C1, 3, 3}, memory::data_type::f32, memory::format_tag::nchw);
+    auto src1 = test::make_memory(src1_md, eng);
+
+    const memory::dim dst_nelems = N * (C0 + C1) * HW;
+    fill_data<float>(dst_nelems, dst);
+    fill_data<float>(N * C1 * HW, src1);
+    std::vector<float> dst_ref(dst_nelems);
+    {
+        auto d = map_memory<float>(dst);
+        auto s1 = map_memory<float>(src1);
+        for (memory::dim n = 0; n < N; n++)
+            for (memory::dim c = 0; c < C0 + C1; c++)
+                for (memory::dim sp = 0; sp < HW; sp++) {
+                    const auto off = (n * (C0 + C1) + c) * HW + sp;
+                    dst_ref[off] = c < C0 ? d[off]
+                                          : s1[(n * C1 + c - C0) * HW + sp];
+                }
+    }
+
+    auto concat_pd = concat::primitive_desc(eng, dst_md, 1, {src0_md, src1_md});
+    concat(concat_pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src0}, {DNNL_ARG_MULTIPLE_SRC + 1, src1},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto d = map_memory<float>(dst);
+    for (memory::dim i = 0; i < dst_nelems; i++)
+        ASSERT_EQ(d[i], dst_ref[i]);
+}
+
 } // namespace dnnl
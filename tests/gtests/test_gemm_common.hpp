@@ -181,10 +181,55 @@ struct dnnl_gemm<float, float, float> {
         return status;
     }
 
+    // Same as call_packed() through the public row-major functions.
+    static dnnl_status_t call_packed_api(const test_params &p,
+            const test_memory &a_mem, const test_memory &b_mem,
+            const test_memory &c_mem) {
+        assert(p.alpha == 1.f);
+
+        char trans_a = p.transA, trans_b = p.transB;
+
+        std::vector<float> a_pack_buf, b_pack_buf;
+        const float *a_eff = map_memory<float>(a_mem);
+        const float *b_eff = map_memory<float>(b_mem);
+        float *C = map_memory<float>(c_mem);
+
+        auto pack = [&](char identifier, const float *src,
+                            std::vector<float> &buf, const float *&eff) {
+            size_t sz;
+            dnnl_status_t status = dnnl_sgemm_pack_get_size(identifier,
+                    p.transA, p.transB, p.M, p.N, p.K, p.lda, p.ldb, &sz);
+            if (status != dnnl_success) return status;
+
+            buf.resize(sz / sizeof(float));
+            status = dnnl_sgemm_pack(identifier, p.transA, p.transB, p.M, p.N,
+                    p.K, p.lda, p.ldb, src, buf.data());
+            eff = buf.data();
+            return status;
+        };
+
+        dnnl_status_t status = dnnl_success;
+        if (p.pack_params.pack_a) {
+            status = pack('A', a_eff, a_pack_buf, a_eff);
+            if (status != dnnl_success) return status;
+            trans_a = 'P';
+        }
+        if (p.pack_params.pack_b) {
+            status = pack('B', b_eff, b_pack_buf, b_eff);
+            if (status != dnnl_success) return status;
+            trans_b = 'P';
+        }
+
+        return dnnl_sgemm_compute(trans_a, trans_b, p.M, p.N, p.K, a_eff,
+                p.lda, b_eff, p.ldb, p.beta, C, p.ldc);
+    }
+
     static dnnl_status_t call(const test_params &p, const test_memory &a_mem,
             const test_memory &b_mem, const test_memory &c_mem,
             const test_memory &) {
 
+        if (p.pack_params.public_api)
+            return call_packed_api(p, a_mem, b_mem, c_mem);
         if (p.pack_params.pack_a || p.pack_params.pack_b)
             return call_packed(p, a_mem, b_mem, c_mem);
 
@@ -26,6 +26,19 @@ using gemm_test = gemm_test_common<float, float, float>;
 
 TEST_P(gemm_test, TestGEMM) {}
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST(gemm_pack_test, InvalidIdentifier) {
+    size_t size = 0;
+    EXPECT_EQ(dnnl_sgemm_pack_get_size('C', 'n', 'n', 2, 2, 2, 2, 2, &size),
+            dnnl_invalid_arguments);
+
+    std::vector<float> src(4, 0.f), dst(1024, 0.f);
+    EXPECT_EQ(dnnl_sgemm_pack('C', 'n', 'n', 2, 2, 2, 2, 2, src.data(),
+                      dst.data()),
+            dnnl_invalid_arguments);
+}
+#endif
+
 #define TEST_CASE_NAME_PREFIX fp32
 #define FP32
 #include "gemm_in.h"
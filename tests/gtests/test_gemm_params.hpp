@@ -40,6 +40,8 @@ struct test_igemm_params {
 struct test_pack_params {
     bool pack_a;
     bool pack_b;
+    // Use the public packed sgemm functions instead of the internal ones.
+    bool public_api;
 };
 
 struct gemm_offset {
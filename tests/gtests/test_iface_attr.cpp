@@ -84,7 +84,8 @@ TEST_F(attr_test_t, TestAccMode) {
 
 TEST_F(attr_test_t, TestScratchpadMode) {
     dnnl::primitive_attr attr;
-    for (auto m : {scratchpad_mode::library, scratchpad_mode::user}) {
+    for (auto m : {scratchpad_mode::library, scratchpad_mode::user,
+                 scratchpad_mode::shared}) {
         attr.set_scratchpad_mode(m);
         ASSERT_EQ(m, attr.get_scratchpad_mode());
     }
@@ -99,7 +100,8 @@ TEST_F(attr_test_t, TestScratchpadModeEx) {
             {N, C, W}, memory::data_type::f32, memory::format_tag::ncw);
 
     dnnl::primitive_attr attr;
-    for (auto m : {scratchpad_mode::library, scratchpad_mode::user}) {
+    for (auto m : {scratchpad_mode::library, scratchpad_mode::user,
+                 scratchpad_mode::shared}) {
         attr.set_scratchpad_mode(m);
         auto softmax_pd = softmax_forward::primitive_desc(eng,
                 prop_kind::forward_inference, algorithm::softmax_accurate,
@@ -108,7 +110,7 @@ TEST_F(attr_test_t, TestScratchpadModeEx) {
         auto mem_consumption
                 = (long)softmax_pd.query_s64(query::memory_consumption_s64);
 
-        if (m == scratchpad_mode::library) {
+        if (m != scratchpad_mode::user) {
             ASSERT_EQ(scratchpad_size, 0L);
         } else {
             ASSERT_EQ(mem_consumption, 0L);
@@ -127,6 +129,44 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestMaxThreads) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(0, attr.get_max_threads());
+
+    for (int nthr : {1, 4, 0}) {
+        attr.set_max_threads(nthr);
+        ASSERT_EQ(nthr, attr.get_max_threads());
+    }
+
+    EXPECT_ANY_THROW(attr.set_max_threads(-1));
+}
+
+TEST_F(attr_test_t, TestCpuIsaHints) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(cpu_isa_hints::no_hints, attr.get_cpu_isa_hints());
+
+    for (auto hints : {cpu_isa_hints::prefer_ymm,
+                 cpu_isa_hints::prefer_ymm_auto, cpu_isa_hints::no_hints}) {
+        attr.set_cpu_isa_hints(hints);
+        ASSERT_EQ(hints, attr.get_cpu_isa_hints());
+    }
+
+    EXPECT_ANY_THROW(attr.set_cpu_isa_hints(static_cast<cpu_isa_hints>(-1)));
+}
+
+TEST_F(attr_test_t, TestScratchpadLimit) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(0u, attr.get_scratchpad_limit());
+
+    for (size_t limit : {size_t(4096), size_t(1) << 40, size_t(0)}) {
+        attr.set_scratchpad_limit(limit);
+        ASSERT_EQ(limit, attr.get_scratchpad_limit());
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -136,7 +176,8 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
             {N, C, W}, memory::data_type::f32, memory::format_tag::ncw);
 
     dnnl::primitive_attr attr;
-    for (auto m : {scratchpad_mode::library, scratchpad_mode::user}) {
+    for (auto m : {scratchpad_mode::library, scratchpad_mode::user,
+                 scratchpad_mode::shared}) {
         attr.set_scratchpad_mode(m);
         auto softmax_pd = softmax_forward::primitive_desc(eng,
                 prop_kind::forward_inference, algorithm::softmax_accurate,
@@ -158,6 +199,122 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadLimitConv) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Scratchpad limit is supported on CPU only.");
+
+    const memory::dim N = 1, C = 64, H = 28, W = 28;
+    memory::desc data_md(
+            {N, C, H, W}, memory::data_type::f32, memory::format_tag::nhwc);
+    memory::desc wei_md({C, C, 3, 3}, memory::data_type::f32,
+            memory::format_tag::any);
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto create_pd = [&]() {
+        return convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                data_md, wei_md, data_md, {1, 1}, {1, 1}, {1, 1}, attr);
+    };
+
+    const size_t size = create_pd().scratchpad_desc().get_size();
+    SKIP_IF(size == 0, "Implementation does not use a scratchpad.");
+
+    const size_t limit = size / 2;
+    attr.set_scratchpad_limit(limit);
+    auto conv_pd = create_pd();
+    // Implementations that do not support the limit ignore it.
+    if (std::string(conv_pd.impl_info_str()).find("brg")
+            != std::string::npos) {
+        ASSERT_LE(conv_pd.scratchpad_desc().get_size(), limit);
+    }
+
+    auto src = test::make_memory(conv_pd.src_desc(), eng);
+    auto wei = test::make_memory(conv_pd.weights_desc(), eng);
+    auto dst = test::make_memory(conv_pd.dst_desc(), eng);
+    auto scratchpad = test::make_memory(conv_pd.scratchpad_desc(), eng);
+    fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+    fill_data<float>(wei.get_desc().get_size() / sizeof(float), wei);
+
+    stream s(eng);
+    convolution_forward(conv_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_SCRATCHPAD, scratchpad}});
+    s.wait();
+}
+
+TEST_F(attr_test_t, TestSoftmaxParams) {
+    dnnl::primitive_attr attr;
+    float scale = 0.f;
+    softmax_mask mask = softmax_mask::causal;
+    // Check the default values
+    attr.get_softmax_params(scale, mask);
+    ASSERT_EQ(1.f, scale);
+    ASSERT_EQ(softmax_mask::none, mask);
+
+    attr.set_softmax_params(0.125f, softmax_mask::causal);
+    attr.get_softmax_params(scale, mask);
+    ASSERT_EQ(0.125f, scale);
+    ASSERT_EQ(softmax_mask::causal, mask);
+
+    EXPECT_ANY_THROW(
+            attr.set_softmax_params(1.f, static_cast<softmax_mask>(-1)));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSoftmaxCausalMask) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Softmax parameters are supported on CPU only.");
+
+    const memory::dim B = 2, M = 37, N = 70;
+    const float scale = 0.25f;
+    memory::desc md({B, M, N}, data_type::f32, tag::abc);
+
+    dnnl::primitive_attr attr;
+    attr.set_softmax_params(scale, softmax_mask::causal);
+    auto softmax_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate, md, md,
+            2, attr);
+
+    // Causal mask is not defined for an axis other than the last one.
+    EXPECT_ANY_THROW(softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate, md, md,
+            1, attr));
+
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+    {
+        auto s = map_memory<float>(src);
+        for (memory::dim i = 0; i < B * M * N; i++)
+            s[i] = static_cast<float>((i * 7) % 13) - 6.f;
+    }
+
+    stream strm(eng);
+    softmax_forward(softmax_pd)
+            .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto s = map_memory<float>(src);
+    auto d = map_memory<float>(dst);
+    for (memory::dim b = 0; b < B; b++)
+        for (memory::dim m = 0; m < M; m++) {
+            const memory::dim off = (b * M + m) * N;
+            const memory::dim n_valid = m + 1 + N - M;
+            float max = -FLT_MAX, sum = 0.f;
+            for (memory::dim n = 0; n < n_valid; n++)
+                max = std::max(max, scale * s[off + n]);
+            for (memory::dim n = 0; n < n_valid; n++)
+                sum += expf(scale * s[off + n] - max);
+            for (memory::dim n = 0; n < N; n++) {
+                const float exp_val = n < n_valid
+                        ? expf(scale * s[off + n] - max) / sum
+                        : 0.f;
+                ASSERT_NEAR(exp_val, d[off + n], 1e-6f);
+            }
+        }
+}
+
 TEST_F(attr_test_t, TestZeroPoints) {
     dnnl::primitive_attr attr;
 
@@ -704,6 +861,305 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusionNhwc) {
+    auto engine_kind = get_test_engine_kind();
+    bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+            || (engine_kind != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx512_core);
+#endif
+    SKIP_IF(skip_test,
+            "Depthwise fusion with nhwc layout is supported only on "
+            "avx512_core CPU");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim mb = 2, ic = 24, oc = 32, ih = 9, iw = 13, str = 2;
+    const memory::dim oh = (ih + str - 1) / str, ow = (iw + str - 1) / str;
+
+    memory::desc src_md {{mb, ic, ih, iw}, data_type::f32, tag::nhwc};
+    memory::desc wei_md {{oc, ic, 1, 1}, data_type::f32, tag::oihw};
+    memory::desc wei_any_md {{oc, ic, 1, 1}, data_type::f32, tag::any};
+    memory::desc bia_md {{oc}, data_type::f32, tag::a};
+    memory::desc mid_md {{mb, oc, ih, iw}, data_type::f32, tag::nhwc};
+    memory::desc dst_md {{mb, oc, oh, ow}, data_type::f32, tag::nhwc};
+    memory::desc dw_wei_md {{oc, 1, 1, 3, 3}, data_type::f32, tag::goihw};
+
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto bia = test::make_memory(bia_md, e);
+    auto dw_wei = test::make_memory(dw_wei_md, e);
+    auto dw_bia = test::make_memory(bia_md, e);
+    fill_data<float>(mb * ic * ih * iw, src);
+    fill_data<float>(oc * ic, wei);
+    fill_data<float>(oc, bia);
+    fill_data<float>(oc * 9, dw_wei);
+    fill_data<float>(oc, dw_bia);
+
+    // fused: 1x1 + relu + 3x3 depthwise with stride 2
+    dnnl::primitive_attr attr_fused;
+    post_ops fused_ops;
+    fused_ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    fused_ops.append_dw_conv(static_cast<int>(ih), static_cast<int>(iw), 3, 3,
+            static_cast<int>(str), static_cast<int>(str), dnnl_f32);
+    attr_fused.set_post_ops(fused_ops);
+    auto fused_pd = convolution_forward::primitive_desc(e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_any_md, bia_md, dst_md, {1, 1}, {0, 0},
+            {oh - ih, ow - iw}, attr_fused);
+    ASSERT_NE(std::string(fused_pd.impl_info_str()).find("brgconv_1x1"),
+            std::string::npos);
+
+    auto wei_fused = test::make_memory(fused_pd.weights_desc(), e);
+    reorder(wei, wei_fused).execute(s, wei, wei_fused);
+
+    // The fused depthwise post-op takes weights in the queried layout.
+    const auto dw_wei_fused_md = fused_pd.query_md(
+            query::exec_arg_md, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    ASSERT_EQ(fused_pd.query_md(query::exec_arg_md,
+                      DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS),
+            bia_md);
+    auto dw_wei_fused = test::make_memory(dw_wei_fused_md, e);
+    reorder(dw_wei, dw_wei_fused).execute(s, dw_wei, dw_wei_fused);
+
+    auto dst_fused = test::make_memory(dst_md, e);
+    convolution_forward(fused_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_fused},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst_fused},
+                    {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+                            dw_wei_fused},
+                    {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS, dw_bia}});
+
+    // reference: two separate convolutions
+    dnnl::primitive_attr attr_1x1;
+    post_ops relu_ops;
+    relu_ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    attr_1x1.set_post_ops(relu_ops);
+    auto pd_1x1 = convolution_forward::primitive_desc(e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, bia_md, mid_md, {1, 1}, {0, 0}, {0, 0}, attr_1x1);
+    const memory::dim pad_b = (oh - 1) * str - ih + 2;
+    const memory::dim pad_r = (ow - 1) * str - iw + 2;
+    auto pd_dw = convolution_forward::primitive_desc(e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            mid_md, dw_wei_md, bia_md, dst_md, {str, str}, {1, 1},
+            {pad_b, pad_r});
+
+    auto mid = test::make_memory(mid_md, e);
+    auto dst_ref = test::make_memory(dst_md, e);
+    convolution_forward(pd_1x1).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, mid}});
+    convolution_forward(pd_dw).execute(s,
+            {{DNNL_ARG_SRC, mid}, {DNNL_ARG_WEIGHTS, dw_wei},
+                    {DNNL_ARG_BIAS, dw_bia}, {DNNL_ARG_DST, dst_ref}});
+    s.wait();
+
+    compare_data<float>(dst_ref, dst_fused, 1e-5f);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, ConvWeightsDecompression) {
+    auto engine_kind = get_test_engine_kind();
+    bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+            || (engine_kind != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx512_core);
+#endif
+    SKIP_IF(skip_test,
+            "Convolution weights decompression is supported only on "
+            "avx512_core CPU");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim mb = 2, ic = 16, oc = 40, ih = 7, iw = 7, k = 3;
+    memory::desc src_md {{mb, ic, ih, iw}, data_type::f32, tag::nhwc};
+    memory::desc wei_f32_md {{oc, ic, k, k}, data_type::f32, tag::oihw};
+    memory::desc dst_md {{mb, oc, ih, iw}, data_type::f32, tag::nhwc};
+
+    auto src = test::make_memory(src_md, e);
+    fill_data<float>(mb * ic * ih * iw, src);
+
+    // Integer weights, per-oc zero points and scales, and the dequantized
+    // weights for the reference convolution.
+    auto wei_int = test::make_memory(wei_f32_md, e);
+    auto wei_deq = test::make_memory(wei_f32_md, e);
+    auto wei_zp = test::make_memory(
+            memory::desc {{oc}, data_type::s32, tag::a}, e);
+    auto wei_scales = test::make_memory(
+            memory::desc {{oc}, data_type::f32, tag::a}, e);
+    {
+        auto q = map_memory<float>(wei_int);
+        auto w = map_memory<float>(wei_deq);
+        auto zp = map_memory<int32_t>(wei_zp);
+        auto sc = map_memory<float>(wei_scales);
+        const memory::dim oc_sz = ic * k * k;
+        for (memory::dim o = 0; o < oc; o++) {
+            zp[o] = static_cast<int32_t>(o % 3) - 1;
+            sc[o] = 0.5f + 0.125f * static_cast<float>(o % 5);
+            for (memory::dim i = 0; i < oc_sz; i++) {
+                const auto off = o * oc_sz + i;
+                q[off] = static_cast<float>((off * 7) % 13) - 6.f;
+                w[off] = (q[off] - zp[o]) * sc[o];
+            }
+        }
+    }
+
+    memory::desc wei_f32_any_md {{oc, ic, k, k}, data_type::f32, tag::any};
+    // There is no reorder into blocked int4 layouts, so s4 weights are
+    // packed by hand: two values per byte, the low nibble first.
+    const auto pack_s4 = [&](const memory &from, const memory &to) {
+        const auto md = to.get_desc();
+        const auto strides = md.get_strides();
+        const auto blks = md.get_inner_blks();
+        const auto idxs = md.get_inner_idxs();
+        auto f = map_memory<float>(from);
+        auto t = map_memory<uint8_t>(to);
+        std::fill(&t[0], &t[0] + md.get_size(), uint8_t(0));
+        for_(memory::dim o = 0; o < oc; o++)
+        for_(memory::dim i = 0; i < ic; i++)
+        for_(memory::dim h = 0; h < k; h++)
+        for (memory::dim w = 0; w < k; w++) {
+            memory::dims pos {o, i, h, w};
+            memory::dim off = 0, inner_sz = 1;
+            for (int j = static_cast<int>(blks.size()) - 1; j >= 0; j--) {
+                auto &p = pos[idxs[j]];
+                off += (p % blks[j]) * inner_sz;
+                inner_sz *= blks[j];
+                p /= blks[j];
+            }
+            for (size_t d = 0; d < pos.size(); d++)
+                off += pos[d] * strides[d];
+            const auto q = static_cast<int>(f[((o * ic + i) * k + h) * k + w]);
+            const auto nibble = static_cast<uint8_t>(q & 0xf);
+            t[off / 2] |= static_cast<uint8_t>(
+                    off % 2 ? nibble << 4 : nibble);
+        }
+    };
+
+    // The default math mode is process-wide, so pin strict math to keep
+    // the results exact.
+    dnnl::primitive_attr ref_attr;
+    ref_attr.set_fpmath_mode(fpmath_mode::strict);
+    auto ref_pd = convolution_forward::primitive_desc(e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_f32_any_md, dst_md, {1, 1}, {1, 1}, {1, 1},
+            ref_attr);
+    auto wei_ref = test::make_memory(ref_pd.weights_desc(), e);
+    reorder(wei_deq, wei_ref).execute(s, wei_deq, wei_ref);
+    auto dst_ref = test::make_memory(dst_md, e);
+    convolution_forward(ref_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_ref},
+                    {DNNL_ARG_DST, dst_ref}});
+
+    for (auto wei_dt : {data_type::s8, data_type::s4}) {
+        memory::desc wei_md {{oc, ic, k, k}, wei_dt, tag::any};
+        dnnl::primitive_attr attr;
+        attr.set_fpmath_mode(fpmath_mode::strict);
+        attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1);
+        attr.set_zero_points_mask(DNNL_ARG_WEIGHTS, 1);
+        auto pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}, attr);
+        ASSERT_NE(std::string(pd.impl_info_str()).find("brg_conv_fwd"),
+                std::string::npos);
+
+        auto wei = test::make_memory(pd.weights_desc(), e);
+        if (wei_dt == data_type::s4)
+            pack_s4(wei_int, wei);
+        else
+            reorder(wei_int, wei).execute(s, wei_int, wei);
+
+        auto dst = test::make_memory(dst_md, e);
+        convolution_forward(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, wei_scales},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS,
+                                wei_zp}});
+        s.wait();
+
+        compare_data<float>(dst_ref, dst, 1e-5f);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, ConvPoolingFusionNchw) {
+    auto engine_kind = get_test_engine_kind();
+    bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+            || (engine_kind != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx512_core);
+#endif
+    SKIP_IF(skip_test,
+            "Pooling post-op fusion is supported only on avx512_core CPU");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim mb = 2, ic = 3, oc = 24, ih = 14, iw = 15, k = 3;
+    const memory::dim pk = 2, ohp = ih / pk, owp = iw / pk;
+    memory::desc src_md {{mb, ic, ih, iw}, data_type::f32, tag::nchw};
+    memory::desc wei_md {{oc, ic, k, k}, data_type::f32, tag::oihw};
+    memory::desc bia_md {{oc}, data_type::f32, tag::a};
+    memory::desc mid_md {{mb, oc, ih, iw}, data_type::f32, tag::nchw};
+    memory::desc dst_md {{mb, oc, ohp, owp}, data_type::f32, tag::nchw};
+
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto bia = test::make_memory(bia_md, e);
+    fill_data<float>(mb * ic * ih * iw, src);
+    fill_data<float>(oc * ic * k * k, wei);
+    fill_data<float>(oc, bia);
+
+    dnnl::post_ops relu_ops;
+    relu_ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    dnnl::primitive_attr relu_attr;
+    relu_attr.set_post_ops(relu_ops);
+
+    auto conv_pd = convolution_forward::primitive_desc(e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, bia_md, mid_md, {1, 1}, {1, 1}, {1, 1},
+            relu_attr);
+    auto mid = test::make_memory(mid_md, e);
+    convolution_forward(conv_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, mid}});
+
+    for (auto alg : {algorithm::pooling_max,
+                 algorithm::pooling_avg_exclude_padding}) {
+        auto pool_pd = pooling_forward::primitive_desc(e,
+                prop_kind::forward_inference, alg, mid_md, dst_md,
+                {pk, pk}, {pk, pk}, {0, 0}, {0, 0}, {0, 0});
+        auto dst_ref = test::make_memory(dst_md, e);
+        pooling_forward(pool_pd).execute(
+                s, {{DNNL_ARG_SRC, mid}, {DNNL_ARG_DST, dst_ref}});
+
+        // The destination has the pooled spatial sizes, so the right
+        // padding of the fused convolution is negative.
+        dnnl::post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_pooling(alg, ih, iw, pk, pk);
+        dnnl::primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        auto pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, bia_md, dst_md, {1, 1}, {1, 1},
+                {ohp - ih + 1, owp - iw + 1}, attr);
+        ASSERT_NE(std::string(pd.impl_info_str()).find("brgemm_planar"),
+                std::string::npos);
+
+        auto dst = test::make_memory(dst_md, e);
+        convolution_forward(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+        s.wait();
+
+        compare_data<float>(dst_ref, dst, 1e-5f);
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, InnerProdBlockedWeights) {
     auto engine_kind = get_test_engine_kind();
     bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
@@ -104,4 +104,60 @@ TEST_F(pd_test_t, TestOptionalQueries) {
     ASSERT_EQ(pd.get_prop_kind(), dnnl::prop_kind::undef);
 }
 
+TEST_F(pd_test_t, TestFlopsAndBytes) {
+    auto conv_pd = convolution_forward::primitive_desc {e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            dat_md, wht_md, dat_md, {1, 1}, {0, 0}, {0, 0}};
+    ASSERT_EQ(conv_pd.get_flops(), 2.0 * 16 * 16 * 16 * 16 * 16);
+    ASSERT_EQ(conv_pd.get_bytes_read(),
+            (memory::dim)(dat_md.get_size() + wht_md.get_size()));
+    ASSERT_EQ(conv_pd.get_bytes_written(), (memory::dim)dat_md.get_size());
+
+    // Post-op arguments are accounted as inputs.
+    memory::desc mm_md {
+            {10, 10}, memory::data_type::f32, memory::format_tag::ab};
+    post_ops ops;
+    ops.append_binary(algorithm::binary_add, mm_md);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+    auto mm_pd = matmul::primitive_desc(e, mm_md, mm_md, mm_md, attr);
+    ASSERT_EQ(mm_pd.get_flops(), 2.0 * 10 * 10 * 10);
+    ASSERT_EQ(mm_pd.get_bytes_read(), 3 * 10 * 10 * 4);
+    ASSERT_EQ(mm_pd.get_bytes_written(), 10 * 10 * 4);
+
+    // The number of operations is not defined for memory-bound primitives.
+    auto eltwise_pd = eltwise_forward::primitive_desc {e,
+            prop_kind::forward_inference, algorithm::eltwise_relu, dat_md,
+            dat_md, 0.f};
+    ASSERT_EQ(eltwise_pd.get_flops(), 0.0);
+    ASSERT_EQ(eltwise_pd.get_bytes_read(), (memory::dim)dat_md.get_size());
+}
+
+TEST_F(pd_test_t, TestMemoryConsumption) {
+    using kind = primitive::memory_consumption_kind;
+
+    auto attr = primitive_attr();
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto pd = convolution_forward::primitive_desc {e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            dat_md, wht_md, dat_md, {1, 1}, {0, 0}, {0, 0}, attr};
+    auto conv = convolution_forward(pd);
+
+    ASSERT_EQ(conv.get_memory_consumption(kind::scratchpad),
+            pd.scratchpad_desc().get_size());
+    ASSERT_NO_THROW(conv.get_memory_consumption(kind::resources));
+
+    const std::string impl_name(pd.impl_info_str());
+    const bool is_jit = e.get_kind() == engine::kind::cpu
+            && (impl_name.find("jit") != std::string::npos
+                    || impl_name.find("brg") != std::string::npos);
+    if (is_jit) { ASSERT_GT(conv.get_memory_consumption(kind::code), 0u); }
+
+    dnnl_primitive_t c_conv = conv.get();
+    size_t size = 0;
+    ASSERT_EQ(dnnl_primitive_get_memory_consumption(c_conv,
+                      static_cast<dnnl_memory_consumption_kind_t>(-1), &size),
+            dnnl_invalid_arguments);
+}
+
 } // namespace dnnl
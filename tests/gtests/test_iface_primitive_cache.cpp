@@ -116,6 +116,56 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    const auto stats_before = get_primitive_cache_stats();
+
+    fill_primitive_cache(4);
+    const auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.misses - stats_before.misses, 4);
+    ASSERT_EQ(stats.evictions - stats_before.evictions, 0);
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        // Regular CPU engines are always considered equal, so the first four
+        // primitives are cache hits and the last two evict the oldest ones.
+        fill_primitive_cache(6);
+        const auto stats_after = get_primitive_cache_stats();
+        ASSERT_EQ(stats_after.hits - stats.hits, 4);
+        ASSERT_EQ(stats_after.misses - stats.misses, 2);
+        ASSERT_EQ(stats_after.evictions - stats.evictions, 2);
+        ASSERT_GE(stats_after.creation_time_saved_ms,
+                stats.creation_time_saved_ms);
+    }
+#endif
+}
+
+TEST(primitive_cache_test, TestAsyncCreation) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+
+    engine eng(get_test_engine_kind(), 0);
+    auto md = memory::desc({2, 16, 8, 8}, dt::f32, tag::nchw);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f,
+            0.f);
+
+    primitive_future future(relu_pd);
+    auto p = future.get_primitive();
+    ASSERT_TRUE(future.is_ready());
+    ASSERT_EQ(p.get_kind(), primitive::kind::eltwise);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+
+    // The primitive created in the background is picked from the cache.
+    const auto stats = get_primitive_cache_stats();
+    auto relu = eltwise_forward(relu_pd);
+    ASSERT_EQ(get_primitive_cache_stats().hits - stats.hits, 1);
+}
 #endif
 
 } // namespace dnnl
@@ -51,7 +51,12 @@ protected:
 
 #if DNNL_X64 || DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
-        input_f32.wino_supported = is_gpu;
+        bool is_cpu_f32_supported = false;
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        is_cpu_f32_supported = get_test_engine_kind() == engine::kind::cpu
+                && impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core);
+#endif
+        input_f32.wino_supported = is_gpu || is_cpu_f32_supported;
         input_f16.wino_supported = is_gpu;
 #elif DNNL_AARCH64 && DNNL_USE_ACL
 #if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
@@ -138,4 +143,40 @@ TEST_F(wino_conv_test_t, TestUnsupportedKernel) {
     }
 }
 
+TEST_F(wino_conv_test_t, TestF32Accuracy) {
+    SKIP_IF(!input_f32.wino_supported, "Winograd f32 is not supported.");
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Accuracy is only checked on CPU.");
+
+    const memory::dim mb = 2, ic = 24, oc = 40, h = 13, w = 11;
+    memory::desc src_md {{mb, ic, h, w}, data_type::f32, tag::nhwc};
+    memory::desc wei_md {{oc, ic, 3, 3}, data_type::f32, tag::oihw};
+    memory::desc bia_md {{oc}, data_type::f32, tag::x};
+    memory::desc dst_md {{mb, oc, h, w}, data_type::f32, tag::nhwc};
+
+    auto wino_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_winograd,
+            src_md, wei_md, bia_md, dst_md, {1, 1}, {1, 1}, {1, 1});
+    auto direct_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, bia_md, dst_md, {1, 1}, {1, 1}, {1, 1});
+
+    memory src(src_md, eng), wei(wei_md, eng), bia(bia_md, eng);
+    memory wino_dst(dst_md, eng), direct_dst(dst_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei);
+    fill_data<float>(bia_md.get_size() / sizeof(float), bia);
+
+    stream strm(eng);
+    convolution_forward(wino_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, wino_dst}});
+    convolution_forward(direct_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, direct_dst}});
+    strm.wait();
+
+    compare_data<float>(direct_dst, wino_dst, 1e-4f);
+}
+
 } // namespace dnnl
@@ -384,6 +384,32 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(
     ASSERT_EQ(impl_info_no_postops, impl_info_with_postops);
 }
 
+class matmul_packed_weights_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        matmul_packed_weights_test_t, TestPackedWeightsDoNotDependOnM) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(!DNNL_X64 || engine_kind != engine::kind::cpu,
+            "Packed weights layout is M-independent only on x64 CPU");
+    engine e {engine_kind, 0};
+
+    const memory::dim K = 256, N = 256;
+    const auto dt = memory::data_type::f32;
+    auto weights_md = memory::desc({K, N}, dt, memory::format_tag::any);
+
+    auto get_weights_md = [&](memory::dim M) {
+        auto src_md = memory::desc({M, K}, dt, memory::format_tag::ab);
+        auto dst_md = memory::desc({M, N}, dt, memory::format_tag::ab);
+        auto pd = matmul::primitive_desc(e, src_md, weights_md, dst_md);
+        return pd.weights_desc();
+    };
+
+    // One reordered weights tensor should serve every M.
+    const auto decode_weights_md = get_weights_md(1);
+    const auto prefill_weights_md = get_weights_md(512);
+    ASSERT_EQ(decode_weights_md, prefill_weights_md);
+}
+
 /********************************* TEST CASES *********************************/
 
 using iface = matmul_iface_test_t;
@@ -45,7 +45,14 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
+    const bool is_cpu_blob_supported
+            = get_test_engine_kind() == engine::kind::cpu
+            && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL;
+    if (is_cpu_blob_supported) {
+        // Only a subset of CPU implementations can store their code in a
+        // cache blob, see TestPersistentCacheAPICPUEltwise.
+        ASSERT_EQ(cache_blob_id.empty(), false);
+    } else if (get_test_engine_kind() != engine::kind::gpu
             || (get_test_engine_kind() == engine::kind::gpu
                     && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
         ASSERT_EQ(cache_blob_id.empty(), true);
@@ -61,6 +68,97 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPICPUEltwise) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "CPU engine with a non-SYCL runtime is required");
+
+    engine e = get_test_engine();
+    stream s(e);
+    memory::desc md(
+            {2, 16, 16, 16}, memory::data_type::f32, memory::format_tag::nchw);
+    auto pd = eltwise_forward::primitive_desc {e, prop_kind::forward_inference,
+            algorithm::eltwise_gelu_erf, md, md, 0.f, 0.f};
+    auto p = eltwise_forward(pd);
+
+    std::vector<uint8_t> cache_blob;
+    try {
+        cache_blob = p.get_cache_blob();
+    } catch (error &err) {
+        SKIP_IF(err.status == dnnl_unimplemented,
+                "Implementation doesn't support cache blobs");
+        throw;
+    }
+    ASSERT_EQ(cache_blob.empty(), false);
+
+    // The primitive cache would return the original primitive otherwise.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    auto p_from_blob = eltwise_forward(pd, cache_blob);
+    set_primitive_cache_capacity(capacity);
+    ASSERT_EQ(cache_blob, p_from_blob.get_cache_blob());
+
+    memory src(md, e), dst_ref(md, e), dst(md, e);
+    fill_data(memory::data_type::f32, src, 0.f, 2.f);
+    p.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst_ref}});
+    p_from_blob.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    const auto nelems = md.get_size() / sizeof(float);
+    auto ref_ptr = map_memory<float>(dst_ref);
+    auto ptr = map_memory<float>(dst);
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(ref_ptr[i], ptr[i]);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIBlobStore) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "CPU engine with a non-SYCL runtime is required");
+
+    engine e = get_test_engine();
+    memory::desc md(
+            {2, 16, 16, 16}, memory::data_type::f32, memory::format_tag::nchw);
+    auto pd = eltwise_forward::primitive_desc {e, prop_kind::forward_inference,
+            algorithm::eltwise_gelu_erf, md, md, 0.f, 0.f};
+    auto p = eltwise_forward(pd);
+
+    std::vector<uint8_t> cache_blob;
+    try {
+        cache_blob = p.get_cache_blob();
+    } catch (error &err) {
+        SKIP_IF(err.status == dnnl_unimplemented,
+                "Implementation doesn't support cache blobs");
+        throw;
+    }
+
+    const auto add_record = [](std::vector<uint8_t> &store,
+                                    const std::vector<uint8_t> &data) {
+        const uint64_t size = data.size();
+        const auto *size_ptr = reinterpret_cast<const uint8_t *>(&size);
+        store.insert(store.end(), size_ptr, size_ptr + sizeof(size));
+        store.insert(store.end(), data.begin(), data.end());
+    };
+    std::vector<uint8_t> store;
+    add_record(store, pd.get_cache_blob_id());
+    add_record(store, cache_blob);
+
+    // A truncated store is rejected.
+    std::vector<uint8_t> bad_store(store.begin(), store.end() - 1);
+    EXPECT_ANY_THROW(set_primitive_cache_blob_store(bad_store));
+
+    // The primitive cache would return the original primitive otherwise.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    ASSERT_NO_THROW(set_primitive_cache_blob_store(store));
+    auto p_from_store = eltwise_forward(pd);
+    ASSERT_NO_THROW(set_primitive_cache_blob_store({}));
+    set_primitive_cache_capacity(capacity);
+    ASSERT_EQ(cache_blob, p_from_store.get_cache_blob());
+}
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPIEngine) {
@@ -415,4 +415,79 @@ GPU_INSTANTIATE_TEST_SUITE_P(PaddedWeights, reorder_simple_test_f32_f32,
         ::testing::Values(cfg_f32 {fmt::oihw, fmt::IOhw16i16o, {17, 23, 2, 1}},
                 cfg_f32 {fmt::goihw, fmt::gOIhw16o16i, {2, 17, 23, 1, 2}}));
 
+// Large weights can be reordered into a blocked format chunk by chunk, e.g.
+// from a memory-mapped file, through sub-memory views of the source and the
+// destination. The result must match the one of a single reorder.
+TEST(reorder_chunked_test_t, ChunksMatchFullReorder) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test creates views from raw data handles.");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim rows = 256, cols = 32, chunk = 64;
+    memory::desc src_md({rows, cols}, memory::data_type::f32, fmt::ab);
+    memory::desc dst_md({rows, cols}, memory::data_type::f32, fmt::AB16b16a);
+
+    auto src = test::make_memory(src_md, eng);
+    auto dst_full = test::make_memory(dst_md, eng);
+    auto dst_chunked = test::make_memory(dst_md, eng);
+    fill_data<float>(rows * cols, src);
+
+    reorder(src, dst_full).execute(strm, src, dst_full);
+
+    for (memory::dim r = 0; r < rows; r += chunk) {
+        auto src_chunk_md = src_md.submemory_desc({chunk, cols}, {r, 0});
+        auto dst_chunk_md = dst_md.submemory_desc({chunk, cols}, {r, 0});
+        memory src_chunk(src_chunk_md, eng, src.get_data_handle());
+        memory dst_chunk(dst_chunk_md, eng, dst_chunked.get_data_handle());
+        reorder(src_chunk, dst_chunk).execute(strm, src_chunk, dst_chunk);
+    }
+    strm.wait();
+
+    auto full = map_memory<float>(dst_full);
+    auto chunked = map_memory<float>(dst_chunked);
+    const auto nelems = (memory::dim)(dst_md.get_size() / sizeof(float));
+    for (memory::dim i = 0; i < nelems; i++)
+        ASSERT_EQ(full[i], chunked[i]);
+}
+
+// A batch of reorders of different sizes and formats must produce the same
+// results as reorders executed one by one.
+TEST(reorder_batch_test_t, BatchMatchesSingleReorders) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Batched reorders are supported only on CPU.");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const std::vector<memory::dims> shapes = {{2, 16, 7, 7}, {1, 32, 3, 5},
+            {8, 64, 14, 14}, {3, 16, 1, 1}, {4, 48, 9, 2}};
+
+    std::vector<memory> src, dst_batch, dst_ref;
+    for (const auto &dims : shapes) {
+        memory::desc src_md(dims, memory::data_type::f32, fmt::nchw);
+        memory::desc dst_md(dims, memory::data_type::f32, fmt::nChw16c);
+        src.push_back(test::make_memory(src_md, eng));
+        dst_batch.push_back(test::make_memory(dst_md, eng));
+        dst_ref.push_back(test::make_memory(dst_md, eng));
+        fill_data<float>(src_md.get_size() / sizeof(float), src.back());
+        reorder(src.back(), dst_ref.back())
+                .execute(strm, src.back(), dst_ref.back());
+    }
+
+    reorder::execute_batch(strm, src, dst_batch);
+    strm.wait();
+
+    for (size_t t = 0; t < shapes.size(); t++) {
+        auto ref = map_memory<float>(dst_ref[t]);
+        auto got = map_memory<float>(dst_batch[t]);
+        const auto nelems = (memory::dim)(
+                dst_ref[t].get_desc().get_size() / sizeof(float));
+        for (memory::dim i = 0; i < nelems; i++)
+            ASSERT_EQ(ref[i], got[i]);
+    }
+
+    const std::vector<memory> dst_short(dst_batch.begin() + 1, dst_batch.end());
+    EXPECT_ANY_THROW(reorder::execute_batch(strm, src, dst_short));
+}
+
 } // namespace dnnl
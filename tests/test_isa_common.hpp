@@ -99,6 +99,8 @@ hints_masked_internal_cpu_isa(cpu_isa_hints hints) {
             return std::set<mask_pair> {
                     {avx512_core_bf16, avx512_core_bf16_ymm}};
             break;
+        // Applies to memory-bound primitives only, not to internal ISA.
+        case cpu_isa_hints::prefer_ymm_auto: return std::set<mask_pair> {};
         default:
             assert(!"unknown CPU ISA hint");
             return std::set<mask_pair> {};